@@ -0,0 +1,147 @@
+#include <array>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <cxxopts.hpp>
+
+#include "cost_estimation/join_cost_model.hpp"
+#include "hyrise.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/join_index.hpp"
+#include "operators/join_nested_loop.hpp"
+#include "operators/join_sort_merge.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "storage/chunk.hpp"
+#include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "synthetic_table_generator.hpp"
+#include "types.hpp"
+
+/**
+ * Calibrates the JoinCostModel that the LQPTranslator uses to choose the join implementation. Runs JoinHash,
+ * JoinSortMerge (on unsorted and on sorted inputs), JoinIndex, and JoinNestedLoop on synthetic tables of various
+ * sizes, fits the coefficients of the model to the measured runtimes, and prints them. As the runtimes depend on the
+ * hardware, the calibration should run on the machine that Hyrise is used on.
+ */
+
+using namespace opossum;  // NOLINT
+
+namespace {
+
+constexpr auto CHUNK_SIZE = ChunkOffset{10'000};
+constexpr auto TABLE_SIZES =
+    std::array{size_t{1'000}, size_t{3'000}, size_t{10'000}, size_t{100'000}, size_t{1'000'000}};
+
+// Keeps the runtime of the calibration tolerable
+constexpr auto MAX_NESTED_LOOP_COMPARISONS = size_t{100'000'000};
+
+// Table with a single int column, in which (on average) each value occurs once. Each chunk has an index.
+std::shared_ptr<AbstractOperator> generate_input(const size_t row_count) {
+  const auto column_specification =
+      ColumnSpecification{ColumnDataDistribution::make_uniform_config(0.0, static_cast<double>(row_count)),
+                          DataType::Int, SegmentEncodingSpec{EncodingType::Dictionary}};
+  const auto table = SyntheticTableGenerator::generate_table({column_specification}, row_count, CHUNK_SIZE);
+
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    table->get_chunk(chunk_id)->create_index<AdaptiveRadixTreeIndex>(std::vector<ColumnID>{ColumnID{0}});
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  return table_wrapper;
+}
+
+std::shared_ptr<AbstractOperator> sort_input(const std::shared_ptr<AbstractOperator>& input) {
+  const auto sort = std::make_shared<Sort>(input, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}}});
+  sort->execute();
+  return sort;
+}
+
+template <typename JoinOperator, typename... Args>
+JoinCostModel::Sample run_join(const std::shared_ptr<AbstractOperator>& left,
+                               const std::shared_ptr<AbstractOperator>& right, Args&&... args) {
+  const auto join = std::make_shared<JoinOperator>(
+      left, right, JoinMode::Inner, OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals},
+      std::vector<OperatorJoinPredicate>{}, std::forward<Args>(args)...);
+  join->execute();
+  return JoinCostModel::sample(*join);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  auto cli_options = cxxopts::Options{"./hyriseJoinCostCalibration", "Calibrates the cost model of the joins"};
+
+  // clang-format off
+  cli_options.add_options()
+    ("help", "Display this help and exit") // NOLINT
+    ("r,runs", "Number of runs of each join", cxxopts::value<size_t>()->default_value("3")) // NOLINT
+    ("scheduler", "Use the multi-threaded scheduler", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ;  // NOLINT
+  // clang-format on
+
+  const auto parsed_options = cli_options.parse(argc, argv);
+  if (parsed_options.count("help")) {
+    std::cout << cli_options.help() << std::endl;
+    return 0;
+  }
+
+  const auto runs = parsed_options["runs"].as<size_t>();
+  if (parsed_options["scheduler"].as<bool>()) {
+    Hyrise::get().topology.use_default_topology();
+    Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+  }
+
+  std::cout << "- Generating tables" << std::endl;
+  auto inputs = std::vector<std::shared_ptr<AbstractOperator>>{};
+  auto sorted_inputs = std::vector<std::shared_ptr<AbstractOperator>>{};
+  for (const auto table_size : TABLE_SIZES) {
+    inputs.emplace_back(generate_input(table_size));
+    sorted_inputs.emplace_back(sort_input(inputs.back()));
+  }
+
+  std::cout << "- Running joins" << std::endl;
+  auto samples = std::vector<JoinCostModel::Sample>{};
+  for (auto left_idx = size_t{0}; left_idx < TABLE_SIZES.size(); ++left_idx) {
+    for (auto right_idx = size_t{0}; right_idx < TABLE_SIZES.size(); ++right_idx) {
+      const auto& left = inputs[left_idx];
+      const auto& right = inputs[right_idx];
+
+      for (auto run = size_t{0}; run < runs; ++run) {
+        samples.emplace_back(run_join<JoinHash>(left, right));
+        samples.emplace_back(run_join<JoinSortMerge>(left, right));
+        samples.emplace_back(run_join<JoinSortMerge>(sorted_inputs[left_idx], sorted_inputs[right_idx]));
+        samples.emplace_back(run_join<JoinIndex>(left, right, IndexSide::Right));
+
+        if (TABLE_SIZES[left_idx] * TABLE_SIZES[right_idx] <= MAX_NESTED_LOOP_COMPARISONS) {
+          samples.emplace_back(run_join<JoinNestedLoop>(left, right));
+        }
+      }
+    }
+  }
+
+  std::cout << "- Calibrating with " << samples.size() << " samples" << std::endl;
+  auto& join_cost_model = *Hyrise::get().join_cost_model;
+  join_cost_model.calibrate(samples);
+
+  const auto join_types = std::vector<std::pair<OperatorType, std::string>>{
+      {OperatorType::JoinHash, "JoinHash"},
+      {OperatorType::JoinSortMerge, "JoinSortMerge"},
+      {OperatorType::JoinIndex, "JoinIndex"},
+      {OperatorType::JoinNestedLoop, "JoinNestedLoop"}};
+  for (const auto& [join_type, name] : join_types) {
+    std::cout << name << ":";
+    for (const auto coefficient : join_cost_model.coefficients(join_type)) {
+      std::cout << " " << coefficient;
+    }
+    std::cout << std::endl;
+  }
+
+  Hyrise::get().scheduler()->finish();
+  return 0;
+}
@@ -198,7 +198,10 @@ void AbstractTableGenerator::generate_and_store() {
 
       std::cout << "- Writing '" << table_name << "' into binary file " << binary_file_path << " " << std::flush;
       Timer per_table_timer;
-      BinaryWriter::write(*table_info.table, binary_file_path);
+      // The table might have been loaded from a memory-mapped version of the file. Removing the file first keeps the
+      // mapped pages intact, as the new file is created with a different inode.
+      std::filesystem::remove(binary_file_path);
+      BinaryWriter::write(*table_info.table, binary_file_path, BinaryFileLayout::Indexed);
       std::cout << "(" << per_table_timer.lap_formatted() << ")" << std::endl;
     }
     metrics.binary_caching_duration = timer.lap();
@@ -84,7 +84,7 @@ std::unordered_map<std::string, BenchmarkTableInfo> FileBasedTableGenerator::gen
     // Pick a source file to load a table from, prefer the binary version
     if (table_info.binary_file_path && !table_info.binary_file_out_of_date) {
       std::cout << "from " << *table_info.binary_file_path << std::flush;
-      table_info.table = BinaryParser::parse(*table_info.binary_file_path);
+      table_info.table = BinaryParser::parse(*table_info.binary_file_path, UseMmap::Yes);
       table_info.loaded_from_binary = true;
     } else {
       std::cout << "from " << *table_info.text_file_path << std::flush;
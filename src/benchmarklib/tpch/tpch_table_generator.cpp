@@ -135,7 +135,7 @@ std::unordered_map<std::string, BenchmarkTableInfo> TPCHTableGenerator::generate
       std::cout << "-  Loading table " << table_name << " from cached binary " << table_file.relative_path();
 
       BenchmarkTableInfo table_info;
-      table_info.table = BinaryParser::parse(table_file);
+      table_info.table = BinaryParser::parse(table_file, UseMmap::Yes);
       table_info.loaded_from_binary = true;
       table_info.binary_file_path = table_file;
       table_info_by_name[table_name] = table_info;
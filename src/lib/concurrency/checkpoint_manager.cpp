@@ -0,0 +1,345 @@
+#include "checkpoint_manager.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "import_export/binary/binary_parser.hpp"
+#include "import_export/binary/binary_writer.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "transaction_context.hpp"
+#include "utils/assert.hpp"
+#include "utils/pausable_loop_thread.hpp"
+#include "write_ahead_log.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+constexpr auto CHECKPOINT_DIRECTORY_PREFIX = "checkpoint_";
+
+// Markers for chunks without a file in the manifest.
+constexpr auto REMOVED_CHUNK = "removed";
+constexpr auto EMPTY_CHUNK = "empty";
+
+bool is_row_visible(const MvccData& mvcc_data, const ChunkOffset chunk_offset, const CommitID snapshot_commit_id) {
+  return mvcc_data.get_begin_cid(chunk_offset) <= snapshot_commit_id &&
+         mvcc_data.get_end_cid(chunk_offset) > snapshot_commit_id;
+}
+
+// Returns true if a row of the chunk was inserted or deleted by a transaction that committed after the previous
+// snapshot but not after the current one.
+bool changed_between_snapshots(const Chunk& chunk, const ChunkOffset row_count, const CommitID previous_snapshot,
+                               const CommitID snapshot) {
+  const auto& mvcc_data = *chunk.mvcc_data();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+    const auto begin_cid = mvcc_data.get_begin_cid(chunk_offset);
+    const auto end_cid = mvcc_data.get_end_cid(chunk_offset);
+    if ((begin_cid > previous_snapshot && begin_cid <= snapshot) ||
+        (end_cid > previous_snapshot && end_cid <= snapshot)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Makes the contents of a file or the entries of a directory durable.
+void sync_path(const std::filesystem::path& path) {
+  const auto file_descriptor = ::open(path.c_str(), O_RDONLY);
+  Assert(file_descriptor >= 0, "Cannot open " + path.string() + ": " + std::strerror(errno));
+  const auto result = ::fsync(file_descriptor);
+  ::close(file_descriptor);
+  Assert(result == 0, "Syncing " + path.string() + " failed");
+}
+
+void write_chunk(const std::shared_ptr<const Table>& table, const ChunkID chunk_id, const std::shared_ptr<Chunk>& chunk,
+                 const ChunkOffset row_count, const std::string& path) {
+  if (!chunk->is_mutable()) {
+    // Immutable chunks are written as they are, so that their encoding is kept.
+    auto chunks = std::vector<std::shared_ptr<Chunk>>{chunk};
+    BinaryWriter::write(Table{table->column_definitions(), TableType::Data, std::move(chunks), UseMvcc::Yes}, path);
+    return;
+  }
+
+  // Mutable chunks might still grow while they are written. Thus, only the rows that existed when the snapshot was
+  // taken are written. The BinaryWriter stores them as values.
+  const auto pos_list = std::make_shared<RowIDPosList>(row_count);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+    (*pos_list)[chunk_offset] = RowID{chunk_id, chunk_offset};
+  }
+  pos_list->guarantee_single_chunk();
+
+  auto segments = Segments{};
+  for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+    segments.emplace_back(std::make_shared<ReferenceSegment>(table, column_id, pos_list));
+  }
+  auto chunks = std::vector<std::shared_ptr<Chunk>>{std::make_shared<Chunk>(segments)};
+  BinaryWriter::write(Table{table->column_definitions(), TableType::References, std::move(chunks)}, path);
+}
+
+}  // namespace
+
+namespace opossum {
+
+CheckpointManager::CheckpointManager(const std::string& directory) : _directory(directory) {
+  std::filesystem::create_directories(_directory);
+
+  const auto latest_checkpoint_id = _latest_checkpoint_id();
+  if (latest_checkpoint_id) _next_checkpoint_id = *latest_checkpoint_id + 1;
+}
+
+CheckpointManager::~CheckpointManager() {
+  // Stop the background thread before the members it uses are destroyed.
+  _background_thread = nullptr;
+}
+
+uint32_t CheckpointManager::create_checkpoint() {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+
+  // The transaction context registers the snapshot commit ID as active, so that the MvccDeletePlugin does not
+  // physically remove chunks that are still visible for the snapshot.
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto snapshot_commit_id = transaction_context->snapshot_commit_id();
+
+  const auto checkpoint_id = _next_checkpoint_id;
+  const auto checkpoint_directory_name = CHECKPOINT_DIRECTORY_PREFIX + std::to_string(checkpoint_id);
+  const auto checkpoint_directory = std::filesystem::path{_directory} / checkpoint_directory_name;
+  std::filesystem::create_directories(checkpoint_directory);
+
+  struct TableEntry {
+    std::string name;
+    std::string schema_file_name;
+  };
+  auto table_entries = std::vector<TableEntry>{};
+  auto checkpointed_chunks = std::unordered_map<std::string, std::vector<CheckpointedChunk>>{};
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+
+  auto table_index = size_t{0};
+  for (const auto& [table_name, table] : Hyrise::get().storage_manager.tables()) {
+    if (!table) continue;
+
+    // Table names are not used as file names, as they might contain characters that are not allowed there.
+    const auto file_prefix = checkpoint_directory_name + "/table_" + std::to_string(table_index++);
+    const auto schema_file_name = file_prefix + "_schema.bin";
+    BinaryWriter::write(Table{table->column_definitions(), TableType::Data, table->target_chunk_size(), UseMvcc::Yes},
+                        _directory + "/" + schema_file_name);
+    sync_path(_directory + "/" + schema_file_name);
+    table_entries.emplace_back(TableEntry{table_name, schema_file_name});
+
+    const auto previous_chunks_iter = _checkpointed_chunks.find(table_name);
+    const auto chunk_count = table->chunk_count();
+    auto& chunks = checkpointed_chunks[table_name];
+    chunks.resize(chunk_count);
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      auto& checkpointed_chunk = chunks[chunk_id];
+
+      if (!chunk) {
+        checkpointed_chunk.file_name = REMOVED_CHUNK;
+        continue;
+      }
+
+      // Only the last chunk of a table may be empty (see Table::append_chunk()). Other empty chunks do not hold any
+      // rows and are restored as removed chunks, so that the following chunks keep their ChunkIDs.
+      const auto row_count = chunk->size();
+      if (row_count == 0) {
+        checkpointed_chunk.file_name = chunk_id == chunk_count - 1 ? EMPTY_CHUNK : REMOVED_CHUNK;
+        continue;
+      }
+
+      if (previous_chunks_iter != _checkpointed_chunks.end() && chunk_id < previous_chunks_iter->second.size()) {
+        const auto& previous_chunk = previous_chunks_iter->second[chunk_id];
+        if (previous_chunk.chunk.lock() == chunk && !previous_chunk.was_mutable &&
+            !changed_between_snapshots(*chunk, row_count, *_previous_snapshot_commit_id, snapshot_commit_id)) {
+          checkpointed_chunk = previous_chunk;
+          continue;
+        }
+      }
+
+      checkpointed_chunk.chunk = chunk;
+      checkpointed_chunk.was_mutable = chunk->is_mutable();
+      checkpointed_chunk.file_name = file_prefix + "_chunk_" + std::to_string(chunk_id) + ".bin";
+
+      jobs.emplace_back(std::make_shared<JobTask>([&, checkpointed_chunk = &checkpointed_chunk, table = table, chunk_id,
+                                                   chunk, row_count]() {
+        const auto& mvcc_data = *chunk->mvcc_data();
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+          if (!is_row_visible(mvcc_data, chunk_offset, snapshot_commit_id)) {
+            checkpointed_chunk->invisible_offsets.emplace_back(chunk_offset);
+          }
+        }
+
+        write_chunk(table, chunk_id, chunk, row_count, _directory + "/" + checkpointed_chunk->file_name);
+        sync_path(_directory + "/" + checkpointed_chunk->file_name);
+      }));
+    }
+  }
+
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  // The manifest is written last and renamed atomically, so that incomplete checkpoints are never loaded.
+  const auto manifest_path = checkpoint_directory / MANIFEST_FILE_NAME;
+  const auto temporary_manifest_path = checkpoint_directory / (std::string{MANIFEST_FILE_NAME} + ".tmp");
+  {
+    auto manifest = std::ofstream{temporary_manifest_path};
+    manifest.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+
+    manifest << checkpoint_id << " " << snapshot_commit_id << " " << table_entries.size() << "\n";
+    for (const auto& table_entry : table_entries) {
+      const auto& chunks = checkpointed_chunks[table_entry.name];
+      manifest << std::quoted(table_entry.name) << " " << table_entry.schema_file_name << " " << chunks.size() << "\n";
+
+      for (const auto& checkpointed_chunk : chunks) {
+        manifest << checkpointed_chunk.file_name << " " << checkpointed_chunk.invisible_offsets.size();
+        for (const auto chunk_offset : checkpointed_chunk.invisible_offsets) {
+          manifest << " " << chunk_offset;
+        }
+        manifest << "\n";
+      }
+    }
+  }
+
+  // All files of the checkpoint and their directory entries are durable before the marker is logged and the
+  // manifest is renamed. Otherwise, a crash could leave a visible manifest that refers to incomplete files. Chunk
+  // files of earlier checkpoints were synced when they were written.
+  sync_path(temporary_manifest_path);
+  sync_path(checkpoint_directory);
+  sync_path(_directory);
+
+  transaction_context->commit();
+
+  // The marker is durable before the checkpoint becomes visible. Thus, WriteAheadLog::recover() finds the marker of
+  // every complete checkpoint. If the process crashes in between, the marker refers to a checkpoint that is never
+  // loaded, so the previous checkpoint and its marker are used for recovery.
+  if (Hyrise::get().write_ahead_log) {
+    Hyrise::get().write_ahead_log->log_checkpoint(checkpoint_id, snapshot_commit_id);
+  }
+
+  std::filesystem::rename(temporary_manifest_path, manifest_path);
+  sync_path(checkpoint_directory);
+
+  _checkpointed_chunks = std::move(checkpointed_chunks);
+  _previous_snapshot_commit_id = snapshot_commit_id;
+  ++_next_checkpoint_id;
+
+  return checkpoint_id;
+}
+
+void CheckpointManager::start_background_checkpoints(const std::chrono::milliseconds interval) {
+  Assert(!_background_thread, "Background checkpoints have already been started");
+  _background_thread = std::make_unique<PausableLoopThread>(interval, [&](size_t) { create_checkpoint(); });
+  _background_thread->resume();
+}
+
+std::optional<uint32_t> CheckpointManager::load_latest_checkpoint() {
+  const auto checkpoint_id = _latest_checkpoint_id();
+  if (!checkpoint_id) return std::nullopt;
+
+  const auto checkpoint_directory =
+      std::filesystem::path{_directory} / (CHECKPOINT_DIRECTORY_PREFIX + std::to_string(*checkpoint_id));
+  auto manifest = std::ifstream{checkpoint_directory / MANIFEST_FILE_NAME};
+  manifest.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+
+  auto manifest_checkpoint_id = uint32_t{};
+  auto snapshot_commit_id = CommitID{};
+  auto table_count = size_t{};
+  manifest >> manifest_checkpoint_id >> snapshot_commit_id >> table_count;
+  Assert(manifest_checkpoint_id == *checkpoint_id, "Manifest belongs to a different checkpoint");
+
+  for (auto table_index = size_t{0}; table_index < table_count; ++table_index) {
+    auto table_name = std::string{};
+    auto schema_file_name = std::string{};
+    auto chunk_count = size_t{};
+    manifest >> std::quoted(table_name) >> schema_file_name >> chunk_count;
+
+    auto chunk_file_names = std::vector<std::string>(chunk_count);
+    auto invisible_offsets = std::vector<std::vector<ChunkOffset>>(chunk_count);
+    for (auto chunk_index = size_t{0}; chunk_index < chunk_count; ++chunk_index) {
+      auto invisible_row_count = size_t{};
+      manifest >> chunk_file_names[chunk_index] >> invisible_row_count;
+      invisible_offsets[chunk_index].resize(invisible_row_count);
+      for (auto& chunk_offset : invisible_offsets[chunk_index]) {
+        manifest >> chunk_offset;
+      }
+    }
+
+    // Parse the chunk files in parallel.
+    auto chunk_tables = std::vector<std::shared_ptr<Table>>(chunk_count);
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto chunk_index = size_t{0}; chunk_index < chunk_count; ++chunk_index) {
+      const auto& file_name = chunk_file_names[chunk_index];
+      if (file_name == REMOVED_CHUNK || file_name == EMPTY_CHUNK) continue;
+
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_index]() {
+        chunk_tables[chunk_index] = BinaryParser::parse(_directory + "/" + chunk_file_names[chunk_index]);
+      }));
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+    const auto table = BinaryParser::parse(_directory + "/" + schema_file_name);
+    for (auto chunk_index = size_t{0}; chunk_index < chunk_count; ++chunk_index) {
+      const auto& file_name = chunk_file_names[chunk_index];
+      if (file_name == REMOVED_CHUNK || file_name == EMPTY_CHUNK) {
+        // Keep the ChunkIDs of the following chunks. Only the last chunk stays as an empty, mutable chunk.
+        table->append_mutable_chunk();
+        if (file_name == REMOVED_CHUNK || chunk_index + 1 < chunk_count) {
+          table->remove_chunk(ChunkID{table->chunk_count() - 1});
+        }
+        continue;
+      }
+
+      const auto chunk = chunk_tables[chunk_index]->get_chunk(ChunkID{0});
+      auto segments = Segments{};
+      for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+        segments.emplace_back(chunk->get_segment(column_id));
+      }
+      table->append_chunk(segments, chunk->mvcc_data());
+
+      const auto& appended_chunk = table->last_chunk();
+      appended_chunk->finalize();
+      if (!chunk->individually_sorted_by().empty()) {
+        appended_chunk->set_individually_sorted_by(chunk->individually_sorted_by());
+      }
+
+      for (const auto chunk_offset : invisible_offsets[chunk_index]) {
+        appended_chunk->mvcc_data()->set_end_cid(chunk_offset, CommitID{0});
+      }
+      appended_chunk->increase_invalid_row_count(static_cast<uint32_t>(invisible_offsets[chunk_index].size()));
+    }
+
+    Hyrise::get().storage_manager.add_table(table_name, table);
+  }
+
+  return checkpoint_id;
+}
+
+std::optional<uint32_t> CheckpointManager::_latest_checkpoint_id() const {
+  auto latest_checkpoint_id = std::optional<uint32_t>{};
+
+  const auto prefix = std::string{CHECKPOINT_DIRECTORY_PREFIX};
+  for (const auto& entry : std::filesystem::directory_iterator(_directory)) {
+    const auto directory_name = entry.path().filename().string();
+    if (!entry.is_directory() || directory_name.rfind(prefix, 0) != 0) continue;
+    if (!std::filesystem::exists(entry.path() / MANIFEST_FILE_NAME)) continue;
+
+    const auto checkpoint_id = static_cast<uint32_t>(std::stoul(directory_name.substr(prefix.size())));
+    if (!latest_checkpoint_id || checkpoint_id > *latest_checkpoint_id) latest_checkpoint_id = checkpoint_id;
+  }
+
+  return latest_checkpoint_id;
+}
+
+}  // namespace opossum
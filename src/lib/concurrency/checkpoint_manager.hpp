@@ -0,0 +1,87 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+class PausableLoopThread;
+
+/**
+ * Writes consistent snapshots (checkpoints) of all tables of the StorageManager to disk and loads them at startup.
+ *
+ * A checkpoint is written for the snapshot commit ID that is the last commit ID when create_checkpoint() is called.
+ * Every chunk is stored in its own file in the binary format of the BinaryWriter, so that chunks can be written in
+ * parallel by JobTasks and so that chunks that did not change since the previous checkpoint of this manager do not
+ * need to be written again - the new checkpoint refers to the file of the previous one instead. A chunk has changed if
+ * it was mutable at the previous checkpoint or if one of its rows was inserted or deleted by a transaction with a
+ * commit ID between the two snapshots.
+ *
+ * Chunks are stored with all of their rows, including those that are invisible at the snapshot. The offsets of the
+ * invisible rows are listed in the manifest and are invalidated when the checkpoint is loaded. Thus, the rows keep
+ * their positions, so the checkpoint can replace the initially loaded tables as the starting point for the replay of
+ * the WriteAheadLog. Empty chunks other than the last one hold no rows and are restored as removed chunks, as a table
+ * may not contain them (see Table::append_chunk()). All files of a checkpoint are synced to disk before its manifest is
+ * made visible. If a write-ahead log is set, a checkpoint marker is logged after the files were synced, but before the
+ * manifest is made visible.
+ *
+ * Directory layout: Checkpoint n is stored in <directory>/checkpoint_<n>/. Its manifest, which is written last and
+ * thus marks the checkpoint as complete, lists the tables, their schema files, and, per chunk, the file that it is
+ * stored in (possibly in the directory of an earlier checkpoint) and its invisible rows. Older checkpoints are not
+ * deleted, as their files might still be referenced.
+ */
+class CheckpointManager : private Noncopyable {
+ public:
+  explicit CheckpointManager(const std::string& directory);
+  ~CheckpointManager();
+
+  /**
+   * Writes a checkpoint of all tables and returns its ID.
+   */
+  uint32_t create_checkpoint();
+
+  /**
+   * Periodically creates checkpoints in a background thread until the manager is destroyed.
+   */
+  void start_background_checkpoints(const std::chrono::milliseconds interval);
+
+  /**
+   * Adds the tables of the most recent complete checkpoint to the StorageManager. Returns the ID of the checkpoint or
+   * std::nullopt if there is none. Pass the ID to WriteAheadLog::recover() to replay the transactions that committed
+   * after the checkpoint's snapshot.
+   */
+  std::optional<uint32_t> load_latest_checkpoint();
+
+  static constexpr auto MANIFEST_FILE_NAME = "manifest";
+
+ private:
+  // State of a chunk at the previous checkpoint written by this manager.
+  struct CheckpointedChunk {
+    std::weak_ptr<const Chunk> chunk;
+    bool was_mutable;
+    std::string file_name;
+    std::vector<ChunkOffset> invisible_offsets;
+  };
+
+  std::optional<uint32_t> _latest_checkpoint_id() const;
+
+  const std::string _directory;
+  uint32_t _next_checkpoint_id{0};
+  std::optional<CommitID> _previous_snapshot_commit_id;
+  std::unordered_map<std::string, std::vector<CheckpointedChunk>> _checkpointed_chunks;
+
+  // Held while writing a checkpoint, as checkpoints can be created both manually and by the background thread.
+  std::mutex _mutex;
+
+  std::unique_ptr<PausableLoopThread> _background_thread;
+};
+
+}  // namespace opossum
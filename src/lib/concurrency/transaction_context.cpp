@@ -7,6 +7,7 @@
 #include "hyrise.hpp"
 #include "operators/abstract_read_write_operator.hpp"
 #include "utils/assert.hpp"
+#include "write_ahead_log.hpp"
 
 namespace opossum {
 
@@ -93,6 +94,11 @@ void TransactionContext::commit_async(const std::function<void(TransactionID)>&
     op->commit_records(commit_id());
   }
 
+  // The changes have to be durable before they become visible to other transactions.
+  if (Hyrise::get().write_ahead_log) {
+    Hyrise::get().write_ahead_log->log_commit(commit_id(), _read_write_operators);
+  }
+
   _mark_as_pending_and_try_commit(callback);
 }
 
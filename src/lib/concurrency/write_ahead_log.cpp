@@ -0,0 +1,445 @@
+#include "write_ahead_log.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "operators/delete.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "resolve_type.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "transaction_context.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+using EntryType = WriteAheadLog::EntryType;
+using RecordType = WriteAheadLog::RecordType;
+
+// Size and checksum precede the payload of each entry.
+constexpr auto ENTRY_HEADER_SIZE = sizeof(uint32_t) + sizeof(uint32_t);
+
+uint32_t checksum(const char* data, const size_t size) {
+  // 32 bit FNV-1a
+  auto hash = uint32_t{2166136261u};
+  for (auto index = size_t{0}; index < size; ++index) {
+    hash ^= static_cast<uint8_t>(data[index]);
+    hash *= uint32_t{16777619u};
+  }
+  return hash;
+}
+
+template <typename T>
+void write_value(std::vector<char>& payload, const T& value) {
+  const auto* const bytes = reinterpret_cast<const char*>(&value);
+  payload.insert(payload.end(), bytes, bytes + sizeof(T));
+}
+
+template <>
+void write_value(std::vector<char>& payload, const pmr_string& value) {
+  write_value(payload, static_cast<uint32_t>(value.size()));
+  payload.insert(payload.end(), value.begin(), value.end());
+}
+
+template <>
+void write_value(std::vector<char>& payload, const std::string& value) {
+  write_value(payload, static_cast<uint32_t>(value.size()));
+  payload.insert(payload.end(), value.begin(), value.end());
+}
+
+void write_row_ids(std::vector<char>& payload, const RowIDPosList& row_ids) {
+  write_value(payload, static_cast<uint32_t>(row_ids.size()));
+  for (const auto& row_id : row_ids) {
+    write_value(payload, row_id.chunk_id);
+    write_value(payload, row_id.chunk_offset);
+  }
+}
+
+// Finds the name of a table in the StorageManager. Deletes only know the table they reference.
+std::string stored_table_name(const std::shared_ptr<const Table>& table) {
+  for (const auto& [name, stored_table] : Hyrise::get().storage_manager.tables()) {
+    if (stored_table == table) return name;
+  }
+  Fail("Deleted rows do not belong to a table of the StorageManager");
+}
+
+void write_insert_record(std::vector<char>& payload, const Insert& insert) {
+  const auto& table_name = insert.target_table_name();
+  const auto table = Hyrise::get().storage_manager.get_table(table_name);
+  const auto row_ids = insert.inserted_row_ids();
+
+  write_value(payload, RecordType::Insert);
+  write_value(payload, table_name);
+  write_row_ids(payload, row_ids);
+
+  // The values are logged column by column. They are read from the target table, where Insert has written them to.
+  const auto column_count = table->column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(table->column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      for (const auto& row_id : row_ids) {
+        const auto value = (*table->get_chunk(row_id.chunk_id)->get_segment(column_id))[row_id.chunk_offset];
+        const auto is_null = variant_is_null(value);
+        write_value(payload, static_cast<uint8_t>(is_null));
+        if (!is_null) write_value(payload, boost::get<ColumnDataType>(value));
+      }
+    });
+  }
+}
+
+void write_delete_records(std::vector<char>& payload, const Delete& delete_operator, uint32_t& record_count) {
+  const auto& referencing_table = delete_operator.referencing_table();
+  const auto chunk_count = referencing_table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto segment = std::static_pointer_cast<const ReferenceSegment>(
+        referencing_table->get_chunk(chunk_id)->get_segment(ColumnID{0}));
+
+    auto row_ids = RowIDPosList{};
+    row_ids.reserve(segment->pos_list()->size());
+    for (const auto& row_id : *segment->pos_list()) {
+      row_ids.emplace_back(row_id);
+    }
+
+    write_value(payload, RecordType::Delete);
+    write_value(payload, stored_table_name(segment->referenced_table()));
+    write_row_ids(payload, row_ids);
+    ++record_count;
+  }
+}
+
+// Reads the payload of a single log entry.
+class PayloadReader {
+ public:
+  explicit PayloadReader(const std::vector<char>& payload) : _payload(payload) {}
+
+  template <typename T>
+  T read() {
+    auto value = T{};
+    Assert(_offset + sizeof(T) <= _payload.size(), "Unexpected end of log entry");
+    std::memcpy(&value, _payload.data() + _offset, sizeof(T));
+    _offset += sizeof(T);
+    return value;
+  }
+
+  template <typename T>
+  T read_string() {
+    const auto size = read<uint32_t>();
+    Assert(_offset + size <= _payload.size(), "Unexpected end of log entry");
+    auto value = T{_payload.data() + _offset, size};
+    _offset += size;
+    return value;
+  }
+
+  RowIDPosList read_row_ids() {
+    const auto row_count = read<uint32_t>();
+    auto row_ids = RowIDPosList{};
+    row_ids.reserve(row_count);
+    for (auto row_index = uint32_t{0}; row_index < row_count; ++row_index) {
+      const auto chunk_id = read<ChunkID>();
+      const auto chunk_offset = read<ChunkOffset>();
+      row_ids.emplace_back(RowID{chunk_id, chunk_offset});
+    }
+    return row_ids;
+  }
+
+ private:
+  const std::vector<char>& _payload;
+  size_t _offset{0};
+};
+
+template <>
+pmr_string PayloadReader::read() {
+  return read_string<pmr_string>();
+}
+
+// Maps the positions of rows in the log to the positions of the replayed rows, per table. Positions that are not
+// contained refer to rows that already existed at the beginning of the session.
+using RowIDMapping = std::unordered_map<std::string, std::map<RowID, RowID>>;
+
+void replay_insert(PayloadReader& reader, const std::shared_ptr<TransactionContext>& transaction_context,
+                   RowIDMapping& row_id_mapping) {
+  const auto table_name = reader.read_string<std::string>();
+  const auto logged_row_ids = reader.read_row_ids();
+  const auto row_count = logged_row_ids.size();
+
+  const auto target_table = Hyrise::get().storage_manager.get_table(table_name);
+  const auto column_count = target_table->column_count();
+
+  auto rows = std::vector<std::vector<AllTypeVariant>>(row_count, std::vector<AllTypeVariant>(column_count));
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(target_table->column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      for (auto row_index = size_t{0}; row_index < row_count; ++row_index) {
+        const auto is_null = reader.read<uint8_t>();
+        rows[row_index][column_id] = is_null ? NULL_VALUE : AllTypeVariant{reader.read<ColumnDataType>()};
+      }
+    });
+  }
+
+  const auto values = std::make_shared<Table>(target_table->column_definitions(), TableType::Data);
+  for (const auto& row : rows) {
+    values->append(row);
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(values);
+  table_wrapper->execute();
+  const auto insert = std::make_shared<Insert>(table_name, table_wrapper);
+  insert->set_transaction_context(transaction_context);
+  insert->execute();
+  Assert(!insert->execute_failed(), "Replaying an insert failed");
+
+  const auto replayed_row_ids = insert->inserted_row_ids();
+  auto& table_mapping = row_id_mapping[table_name];
+  for (auto row_index = size_t{0}; row_index < row_count; ++row_index) {
+    table_mapping[logged_row_ids[row_index]] = replayed_row_ids[row_index];
+  }
+}
+
+void replay_delete(PayloadReader& reader, const std::shared_ptr<TransactionContext>& transaction_context,
+                   const RowIDMapping& row_id_mapping) {
+  const auto table_name = reader.read_string<std::string>();
+  auto row_ids = reader.read_row_ids();
+
+  const auto mapping_iter = row_id_mapping.find(table_name);
+  if (mapping_iter != row_id_mapping.end()) {
+    for (auto& row_id : row_ids) {
+      const auto replayed_row_id_iter = mapping_iter->second.find(row_id);
+      if (replayed_row_id_iter != mapping_iter->second.end()) row_id = replayed_row_id_iter->second;
+    }
+  }
+
+  const auto target_table = Hyrise::get().storage_manager.get_table(table_name);
+  const auto pos_list = std::make_shared<RowIDPosList>(std::move(row_ids));
+
+  auto segments = Segments{};
+  for (auto column_id = ColumnID{0}; column_id < target_table->column_count(); ++column_id) {
+    segments.emplace_back(std::make_shared<ReferenceSegment>(target_table, column_id, pos_list));
+  }
+  const auto rows_to_delete = std::make_shared<Table>(target_table->column_definitions(), TableType::References);
+  rows_to_delete->append_chunk(segments);
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(rows_to_delete);
+  table_wrapper->execute();
+  const auto delete_operator = std::make_shared<Delete>(table_wrapper);
+  delete_operator->set_transaction_context(transaction_context);
+  delete_operator->execute();
+  Assert(!delete_operator->execute_failed(), "Replaying a delete failed");
+}
+
+}  // namespace
+
+namespace opossum {
+
+WriteAheadLog::WriteAheadLog(const std::string& path, const std::chrono::microseconds group_commit_window)
+    : _path(path), _group_commit_window(group_commit_window) {
+  _file_descriptor = ::open(_path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+  Assert(_file_descriptor >= 0, "Cannot open write-ahead log " + _path + ": " + std::strerror(errno));
+
+  _flush_thread = std::thread(&WriteAheadLog::_flush_loop, this);
+
+  // Positions of later entries refer to the tables as they are now (see class comment).
+  auto payload = std::vector<char>{};
+  write_value(payload, EntryType::SessionStart);
+  _append_entry(payload);
+}
+
+WriteAheadLog::~WriteAheadLog() {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _shutdown = true;
+  }
+  _flush_requested.notify_one();
+  _flush_thread.join();
+
+  ::close(_file_descriptor);
+}
+
+void WriteAheadLog::log_commit(const CommitID commit_id,
+                               const std::vector<std::shared_ptr<AbstractReadWriteOperator>>& operators) {
+  // The entry is serialized before taking the lock so that concurrent commits only serialize on the buffer append.
+  auto payload = std::vector<char>{};
+  write_value(payload, EntryType::Commit);
+  write_value(payload, commit_id);
+
+  const auto record_count_offset = payload.size();
+  auto record_count = uint32_t{0};
+  write_value(payload, record_count);
+
+  for (const auto& read_write_operator : operators) {
+    switch (read_write_operator->type()) {
+      case OperatorType::Insert:
+        write_insert_record(payload, static_cast<const Insert&>(*read_write_operator));
+        ++record_count;
+        break;
+      case OperatorType::Delete:
+        write_delete_records(payload, static_cast<const Delete&>(*read_write_operator), record_count);
+        break;
+      default:
+        // Update consists of a Delete and an Insert, which are logged on their own.
+        break;
+    }
+  }
+  std::memcpy(payload.data() + record_count_offset, &record_count, sizeof(record_count));
+
+  _append_entry(payload);
+}
+
+void WriteAheadLog::log_checkpoint(const uint32_t checkpoint_id, const CommitID snapshot_commit_id) {
+  auto payload = std::vector<char>{};
+  write_value(payload, EntryType::Checkpoint);
+  write_value(payload, checkpoint_id);
+  write_value(payload, snapshot_commit_id);
+  _append_entry(payload);
+}
+
+void WriteAheadLog::_append_entry(const std::vector<char>& payload) {
+  std::unique_lock<std::mutex> lock(_mutex);
+
+  write_value(_buffer, static_cast<uint32_t>(payload.size()));
+  write_value(_buffer, checksum(payload.data(), payload.size()));
+  _buffer.insert(_buffer.end(), payload.begin(), payload.end());
+  const auto entry_number = ++_appended_entry_count;
+
+  _flush_requested.notify_one();
+  _flush_completed.wait(lock, [&]() { return _durable_entry_count >= entry_number; });
+}
+
+void WriteAheadLog::_flush_loop() {
+  auto buffer = std::vector<char>{};
+
+  while (true) {
+    auto lock = std::unique_lock<std::mutex>{_mutex};
+    _flush_requested.wait(lock, [&]() { return _shutdown || !_buffer.empty(); });
+    if (_buffer.empty()) return;
+
+    if (_group_commit_window.count() > 0) {
+      // Give concurrent transactions the chance to join this flush. We do not wait for a notification here, as that
+      // would be triggered by every new entry.
+      lock.unlock();
+      std::this_thread::sleep_for(_group_commit_window);
+      lock.lock();
+    }
+
+    buffer.clear();
+    std::swap(buffer, _buffer);
+    const auto flushed_entry_count = _appended_entry_count;
+    lock.unlock();
+
+    auto bytes_written = size_t{0};
+    while (bytes_written < buffer.size()) {
+      const auto result = ::write(_file_descriptor, buffer.data() + bytes_written, buffer.size() - bytes_written);
+      Assert(result >= 0 || errno == EINTR,
+             "Writing to the write-ahead log failed: " + std::string{std::strerror(errno)});
+      if (result > 0) bytes_written += static_cast<size_t>(result);
+    }
+    Assert(::fdatasync(_file_descriptor) == 0, "Syncing the write-ahead log failed");
+
+    lock.lock();
+    _durable_entry_count = flushed_entry_count;
+    lock.unlock();
+    _flush_completed.notify_all();
+  }
+}
+
+size_t WriteAheadLog::recover(const std::string& path, const std::optional<uint32_t> checkpoint_id) {
+  if (!std::filesystem::exists(path)) return 0;
+
+  auto file = std::ifstream{path, std::ios::binary};
+  Assert(file.is_open(), "Cannot open write-ahead log " + path);
+
+  // Read all complete entries. Commits are replayed per session in commit order, as the flush order of concurrent
+  // transactions might differ from their commit order.
+  auto sessions = std::vector<std::map<CommitID, std::vector<char>>>{};
+
+  // If the tables were loaded from a checkpoint, the session in which it was written and its snapshot commit ID.
+  auto checkpoint_session_index = std::optional<size_t>{};
+  auto checkpoint_snapshot_commit_id = CommitID{0};
+
+  while (true) {
+    auto header = std::array<char, ENTRY_HEADER_SIZE>{};
+    if (!file.read(header.data(), header.size())) break;
+
+    auto payload_size = uint32_t{};
+    auto payload_checksum = uint32_t{};
+    std::memcpy(&payload_size, header.data(), sizeof(payload_size));
+    std::memcpy(&payload_checksum, header.data() + sizeof(payload_size), sizeof(payload_checksum));
+
+    auto payload = std::vector<char>(payload_size);
+    if (!file.read(payload.data(), payload_size)) break;
+    if (payload_size == 0 || checksum(payload.data(), payload.size()) != payload_checksum) break;
+
+    auto reader = PayloadReader{payload};
+    const auto entry_type = reader.read<EntryType>();
+    if (entry_type == EntryType::SessionStart) {
+      sessions.emplace_back();
+      continue;
+    }
+
+    Assert(!sessions.empty(), "Write-ahead log does not start with a session marker");
+
+    if (entry_type == EntryType::Checkpoint) {
+      if (reader.read<uint32_t>() == checkpoint_id) {
+        checkpoint_session_index = sessions.size() - 1;
+        checkpoint_snapshot_commit_id = reader.read<CommitID>();
+      }
+      continue;
+    }
+
+    Assert(entry_type == EntryType::Commit, "Unexpected entry in write-ahead log");
+    const auto commit_id = reader.read<CommitID>();
+    sessions.back().emplace(commit_id, std::move(payload));
+  }
+
+  Assert(!checkpoint_id || checkpoint_session_index, "Checkpoint was not logged in the write-ahead log");
+
+  auto replayed_transaction_count = size_t{0};
+  for (auto session_index = checkpoint_session_index.value_or(0); session_index < sessions.size(); ++session_index) {
+    auto row_id_mapping = RowIDMapping{};
+
+    for (const auto& [commit_id, payload] : sessions[session_index]) {
+      // The effects of these transactions are part of the checkpoint.
+      if (session_index == checkpoint_session_index && commit_id <= checkpoint_snapshot_commit_id) continue;
+
+      auto reader = PayloadReader{payload};
+      reader.read<EntryType>();
+      reader.read<CommitID>();
+      const auto record_count = reader.read<uint32_t>();
+
+      const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+      for (auto record_index = uint32_t{0}; record_index < record_count; ++record_index) {
+        const auto record_type = reader.read<RecordType>();
+        if (record_type == RecordType::Insert) {
+          replay_insert(reader, transaction_context, row_id_mapping);
+        } else {
+          replay_delete(reader, transaction_context, row_id_mapping);
+        }
+      }
+      transaction_context->commit();
+      ++replayed_transaction_count;
+    }
+  }
+
+  return replayed_transaction_count;
+}
+
+const std::string& WriteAheadLog::path() const { return _path; }
+
+}  // namespace opossum
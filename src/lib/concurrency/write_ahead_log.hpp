@@ -0,0 +1,107 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractReadWriteOperator;
+
+/**
+ * Write-ahead log that makes committed transactions durable.
+ *
+ * LOG RECORDS
+ *
+ * The log is a logical redo log: For every committed transaction, TransactionContext::commit_async() passes its
+ * read-write operators to log_commit(), which writes one commit entry containing the commit ID, the rows added by
+ * Insert operators (their positions in the target table and their values), and the positions of the rows
+ * invalidated by Delete operators. Update operators are implemented as a Delete followed by an Insert, which are
+ * registered at the TransactionContext themselves, so they do not need to be logged separately. Nothing is logged for
+ * rolled back transactions. The log entry is durable before the commit ID becomes visible to other transactions.
+ *
+ * File layout: The log is a sequence of entries, each consisting of the payload size (uint32_t), an FNV-1a checksum
+ * of the payload (uint32_t), and the payload. A payload starts with its EntryType. A torn entry at the end of the
+ * file (e.g., because the process crashed while writing it) is detected by its size or checksum and ignored.
+ *
+ * GROUP COMMIT
+ *
+ * log_commit() serializes the entry, appends it to a shared buffer, and blocks until a dedicated flush thread has
+ * written the buffer and called fdatasync(). While the flush thread waits for the disk, further commits accumulate in
+ * the buffer and are made durable by the next single fdatasync(). Thus, concurrent sessions share the cost of the
+ * flush. Additionally, the flush thread can wait for group_commit_window before writing so that more commits join a
+ * batch. This trades commit latency for throughput and is disabled by default.
+ *
+ * RECOVERY
+ *
+ * The positions stored in the log refer to the tables as they were loaded at startup (e.g., from CSV or binary
+ * files), plus the rows added by previously replayed transactions. recover() has to be called after the tables have
+ * been loaded (with the same chunk sizes as before) and before a new WriteAheadLog is opened on the same file. It
+ * replays the committed transactions in commit order by executing Insert and Delete operators. Replaying the log is
+ * deterministic, so the rows end up at the same positions in every recovery. Each time a WriteAheadLog is opened, it
+ * writes a session marker, after which positions refer to the state after recovery.
+ *
+ * The CheckpointManager logs a marker for every checkpoint it writes. Checkpoints keep the positions of all rows. If
+ * the tables were loaded from a checkpoint, recover() only replays the transactions of the checkpoint's session that
+ * committed after its snapshot as well as all transactions of later sessions.
+ *
+ * To use the log, set Hyrise::get().write_ahead_log after calling recover().
+ */
+class WriteAheadLog : private Noncopyable {
+ public:
+  enum class EntryType : uint8_t { SessionStart, Commit, Checkpoint };
+  enum class RecordType : uint8_t { Insert, Delete };
+
+  explicit WriteAheadLog(const std::string& path,
+                         const std::chrono::microseconds group_commit_window = std::chrono::microseconds{0});
+  ~WriteAheadLog();
+
+  /**
+   * Writes the changes of the given (committed) operators and blocks until they are durable.
+   */
+  void log_commit(const CommitID commit_id, const std::vector<std::shared_ptr<AbstractReadWriteOperator>>& operators);
+
+  /**
+   * Logs that a checkpoint of all tables as of snapshot_commit_id has been written. Blocks until the marker is durable.
+   */
+  void log_checkpoint(const uint32_t checkpoint_id, const CommitID snapshot_commit_id);
+
+  /**
+   * Replays all committed transactions of the log at path into the tables of the StorageManager. Returns the number of
+   * replayed transactions. If no log file exists, nothing is done. If the tables were loaded from a checkpoint, its ID
+   * has to be passed.
+   */
+  static size_t recover(const std::string& path, const std::optional<uint32_t> checkpoint_id = std::nullopt);
+
+  const std::string& path() const;
+
+ private:
+  void _append_entry(const std::vector<char>& payload);
+  void _flush_loop();
+
+  const std::string _path;
+  const std::chrono::microseconds _group_commit_window;
+  int _file_descriptor;
+
+  // Entries that were logged but have not been written yet. _appended_entry_count and _durable_entry_count are
+  // used to find out whether the entry of a committing transaction has been flushed.
+  std::vector<char> _buffer;
+  uint64_t _appended_entry_count{0};
+  uint64_t _durable_entry_count{0};
+  bool _shutdown{false};
+
+  std::mutex _mutex;
+  std::condition_variable _flush_requested;
+  std::condition_variable _flush_completed;
+  std::thread _flush_thread;
+};
+
+}  // namespace opossum
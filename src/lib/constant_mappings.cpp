@@ -39,6 +39,8 @@ const boost::bimap<EncodingType, std::string> encoding_type_to_string = make_bim
     {EncodingType::FixedStringDictionary, "FixedStringDictionary"},
     {EncodingType::FrameOfReference, "FrameOfReference"},
     {EncodingType::LZ4, "LZ4"},
+    {EncodingType::FSST, "FSST"},
+    {EncodingType::ALP, "ALP"},
     {EncodingType::Unencoded, "Unencoded"},
 });
 
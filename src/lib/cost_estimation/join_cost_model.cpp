@@ -0,0 +1,238 @@
+#include "join_cost_model.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "operators/join_index.hpp"
+#include "operators/sort.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+constexpr auto FEATURE_COUNT = JoinCostModel::FEATURE_COUNT;
+
+bool sorted_by_column(const AbstractOperator& op, const ColumnID column_id) {
+  if (op.type() != OperatorType::Sort) return false;
+
+  const auto& sort_definitions = static_cast<const Sort&>(op).sort_definitions();
+  return !sort_definitions.empty() && sort_definitions.front().column == column_id &&
+         sort_definitions.front().sort_mode == SortMode::Ascending;
+}
+
+double sort_cost(const Cardinality row_count) {
+  const auto rows = static_cast<double>(row_count);
+  return rows > 1.0 ? rows * std::log2(rows) : 0.0;
+}
+
+/**
+ * Solves the least squares problem `rows * x = targets` via the normal equations, with all features that are not in
+ * @param active_features fixed to zero.
+ * @return std::nullopt if the normal equations are singular
+ */
+std::optional<JoinCostModel::Coefficients> least_squares(const std::vector<JoinCostModel::Features>& rows,
+                                                         const std::vector<double>& targets,
+                                                         const std::array<bool, FEATURE_COUNT>& active_features) {
+  // Augmented matrix [rows^T * rows | rows^T * targets]
+  auto equations = std::array<std::array<double, FEATURE_COUNT + 1>, FEATURE_COUNT>{};
+  for (auto feature_idx = size_t{0}; feature_idx < FEATURE_COUNT; ++feature_idx) {
+    if (!active_features[feature_idx]) {
+      equations[feature_idx][feature_idx] = 1.0;
+      continue;
+    }
+
+    for (auto row_idx = size_t{0}; row_idx < rows.size(); ++row_idx) {
+      const auto& row = rows[row_idx];
+      for (auto other_feature_idx = size_t{0}; other_feature_idx < FEATURE_COUNT; ++other_feature_idx) {
+        if (!active_features[other_feature_idx]) continue;
+        equations[feature_idx][other_feature_idx] += row[feature_idx] * row[other_feature_idx];
+      }
+      equations[feature_idx][FEATURE_COUNT] += row[feature_idx] * targets[row_idx];
+    }
+  }
+
+  // Gaussian elimination with partial pivoting
+  for (auto column_idx = size_t{0}; column_idx < FEATURE_COUNT; ++column_idx) {
+    auto pivot_idx = column_idx;
+    for (auto row_idx = column_idx + 1; row_idx < FEATURE_COUNT; ++row_idx) {
+      if (std::abs(equations[row_idx][column_idx]) > std::abs(equations[pivot_idx][column_idx])) pivot_idx = row_idx;
+    }
+    if (std::abs(equations[pivot_idx][column_idx]) < 1e-12) return std::nullopt;
+    std::swap(equations[column_idx], equations[pivot_idx]);
+
+    for (auto row_idx = column_idx + 1; row_idx < FEATURE_COUNT; ++row_idx) {
+      const auto factor = equations[row_idx][column_idx] / equations[column_idx][column_idx];
+      for (auto idx = column_idx; idx <= FEATURE_COUNT; ++idx) {
+        equations[row_idx][idx] -= factor * equations[column_idx][idx];
+      }
+    }
+  }
+
+  auto solution = JoinCostModel::Coefficients{};
+  for (auto row_idx = FEATURE_COUNT; row_idx-- > 0;) {
+    auto value = equations[row_idx][FEATURE_COUNT];
+    for (auto idx = row_idx + 1; idx < FEATURE_COUNT; ++idx) {
+      value -= equations[row_idx][idx] * solution[idx];
+    }
+    solution[row_idx] = value / equations[row_idx][row_idx];
+  }
+
+  return solution;
+}
+
+}  // namespace
+
+namespace opossum {
+
+JoinCostModel::JoinCostModel() {
+  // Rough runtimes in nanoseconds, see the class comment. The intercepts reflect the fixed costs of setting up the
+  // jobs of the operators, which are higher for the multi-phase JoinHash and JoinSortMerge.
+  _coefficients[OperatorType::JoinHash] = {50'000.0, 40.0, 15.0, 10.0};
+  _coefficients[OperatorType::JoinSortMerge] = {80'000.0, 5.0, 25.0, 10.0};
+  _coefficients[OperatorType::JoinIndex] = {20'000.0, 150.0, 10.0, 15.0};
+  _coefficients[OperatorType::JoinNestedLoop] = {10'000.0, 2.0, 5.0, 10.0};
+}
+
+Cost JoinCostModel::estimate_cost(const OperatorType join_type, const JoinProperties& properties) const {
+  const auto& join_coefficients = coefficients(join_type);
+  const auto join_features = features(join_type, properties);
+
+  auto cost = 0.0;
+  for (auto feature_idx = size_t{0}; feature_idx < FEATURE_COUNT; ++feature_idx) {
+    cost += join_coefficients[feature_idx] * join_features[feature_idx];
+  }
+  return static_cast<Cost>(cost);
+}
+
+JoinCostModel::Features JoinCostModel::features(const OperatorType join_type, const JoinProperties& properties) {
+  const auto left_rows = static_cast<double>(properties.left_row_count);
+  const auto right_rows = static_cast<double>(properties.right_row_count);
+  const auto output_rows = static_cast<double>(properties.output_row_count);
+
+  switch (join_type) {
+    case OperatorType::JoinHash:
+      return {1.0, std::min(left_rows, right_rows), std::max(left_rows, right_rows), output_rows};
+
+    case OperatorType::JoinSortMerge: {
+      auto sort_rows = 0.0;
+      if (!properties.left_input_sorted) sort_rows += sort_cost(properties.left_row_count);
+      if (!properties.right_input_sorted) sort_rows += sort_cost(properties.right_row_count);
+      return {1.0, sort_rows, left_rows + right_rows, output_rows};
+    }
+
+    case OperatorType::JoinIndex: {
+      const auto probe_rows = properties.index_side == IndexSide::Right ? left_rows : right_rows;
+      return {1.0, probe_rows * static_cast<double>(properties.index_chunk_count), probe_rows, output_rows};
+    }
+
+    case OperatorType::JoinNestedLoop:
+      return {1.0, left_rows * right_rows, left_rows + right_rows, output_rows};
+
+    default:
+      Fail("JoinCostModel does not cover this operator type");
+  }
+}
+
+JoinCostModel::Sample JoinCostModel::sample(const AbstractJoinOperator& join_operator) {
+  const auto& performance_data = *join_operator.performance_data;
+  Assert(performance_data.executed, "Cannot sample a join operator that has not been executed");
+
+  const auto& left_input = *join_operator.left_input();
+  const auto& right_input = *join_operator.right_input();
+  const auto& [left_column_id, right_column_id] = join_operator.primary_predicate().column_ids;
+
+  auto properties = JoinProperties{};
+  properties.left_row_count = static_cast<Cardinality>(left_input.performance_data->output_row_count);
+  properties.right_row_count = static_cast<Cardinality>(right_input.performance_data->output_row_count);
+  properties.output_row_count = static_cast<Cardinality>(performance_data.output_row_count);
+  properties.left_input_sorted = sorted_by_column(left_input, left_column_id);
+  properties.right_input_sorted = sorted_by_column(right_input, right_column_id);
+
+  if (join_operator.type() == OperatorType::JoinIndex) {
+    const auto& index_performance_data = static_cast<const JoinIndex::PerformanceData&>(performance_data);
+    properties.index_side = static_cast<const JoinIndex&>(join_operator).index_side();
+    properties.index_chunk_count =
+        index_performance_data.chunks_scanned_with_index + index_performance_data.chunks_scanned_without_index;
+  }
+
+  return Sample{join_operator.type(), properties, performance_data.walltime};
+}
+
+void JoinCostModel::calibrate(const std::vector<Sample>& samples) {
+  for (auto& [join_type, join_coefficients] : _coefficients) {
+    // Dividing each equation by the measured runtime turns the absolute into the relative error
+    auto rows = std::vector<Features>{};
+    for (const auto& sample : samples) {
+      const auto runtime = static_cast<double>(sample.runtime.count());
+      if (sample.join_type != join_type || runtime <= 0.0) continue;
+
+      auto row = features(join_type, sample.properties);
+      for (auto& feature : row) {
+        feature /= runtime;
+      }
+      rows.emplace_back(row);
+    }
+
+    if (rows.size() < MIN_SAMPLE_COUNT) continue;
+    const auto targets = std::vector<double>(rows.size(), 1.0);
+
+    // Scale the features to [0, 1] to improve the conditioning of the normal equations. Features that are zero in all
+    // samples (e.g., the sort cost if all inputs were sorted) are not fitted and keep their coefficients.
+    auto scales = Features{};
+    auto observed_features = std::array<bool, FEATURE_COUNT>{};
+    for (auto feature_idx = size_t{0}; feature_idx < FEATURE_COUNT; ++feature_idx) {
+      for (const auto& row : rows) {
+        scales[feature_idx] = std::max(scales[feature_idx], row[feature_idx]);
+      }
+      observed_features[feature_idx] = scales[feature_idx] > 0.0;
+      if (!observed_features[feature_idx]) continue;
+
+      for (auto& row : rows) {
+        row[feature_idx] /= scales[feature_idx];
+      }
+    }
+
+    // Active-set approach to non-negativity: Drop the feature with the most negative coefficient and fit again
+    auto active_features = observed_features;
+    auto solution = least_squares(rows, targets, active_features);
+    while (solution) {
+      auto negative_feature_idx = std::optional<size_t>{};
+      for (auto feature_idx = size_t{0}; feature_idx < FEATURE_COUNT; ++feature_idx) {
+        if (!active_features[feature_idx] || (*solution)[feature_idx] >= 0.0) continue;
+        if (!negative_feature_idx || (*solution)[feature_idx] < (*solution)[*negative_feature_idx]) {
+          negative_feature_idx = feature_idx;
+        }
+      }
+      if (!negative_feature_idx) break;
+
+      active_features[*negative_feature_idx] = false;
+      solution = least_squares(rows, targets, active_features);
+    }
+
+    // Singular normal equations, e.g., because of linearly dependent features. Keep the current coefficients.
+    if (!solution) continue;
+
+    for (auto feature_idx = size_t{0}; feature_idx < FEATURE_COUNT; ++feature_idx) {
+      if (!observed_features[feature_idx]) continue;
+      join_coefficients[feature_idx] =
+          active_features[feature_idx] ? (*solution)[feature_idx] / scales[feature_idx] : 0.0;
+    }
+  }
+}
+
+const JoinCostModel::Coefficients& JoinCostModel::coefficients(const OperatorType join_type) const {
+  const auto iter = _coefficients.find(join_type);
+  Assert(iter != _coefficients.cend(), "JoinCostModel does not cover this operator type");
+  return iter->second;
+}
+
+void JoinCostModel::set_coefficients(const OperatorType join_type, const Coefficients& coefficients) {
+  Assert(_coefficients.contains(join_type), "JoinCostModel does not cover this operator type");
+  _coefficients[join_type] = coefficients;
+}
+
+}  // namespace opossum
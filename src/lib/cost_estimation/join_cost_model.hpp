@@ -0,0 +1,90 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <unordered_map>
+#include <vector>
+
+#include "operators/abstract_join_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Physical cost model for the join operators. The LQPTranslator uses it to choose the cheapest of the join
+ * implementations that support a JoinNode. The Cost of a join is its predicted runtime in nanoseconds, modeled as a
+ * linear combination of features that are derived from the row counts of its inputs and its output:
+ *
+ *   JoinHash:        1, rows of the smaller (build) input, rows of the larger (probe) input, output rows
+ *   JoinSortMerge:   1, n * log2(n) summed over the inputs that are not yet sorted by the join column, rows of both
+ *                    inputs, output rows
+ *   JoinIndex:       1, probe rows times the number of chunks on the index side (the index of every chunk is probed
+ *                    with every probe row), probe rows, output rows
+ *   JoinNestedLoop:  1, product of the input rows, rows of both inputs, output rows
+ *
+ * The default coefficients are rough estimates. As the actual runtimes depend on the hardware, calibrate() fits the
+ * coefficients to the measured runtimes of executed join operators, which are taken from their
+ * OperatorPerformanceData. The hyriseJoinCostCalibration binary runs the joins on synthetic tables of various sizes
+ * and prints the calibrated coefficients, which can then be set via set_coefficients().
+ *
+ * calibrate() and set_coefficients() must not be called while queries are translated.
+ */
+class JoinCostModel {
+ public:
+  static constexpr auto FEATURE_COUNT = size_t{4};
+  using Features = std::array<double, FEATURE_COUNT>;
+  using Coefficients = std::array<double, FEATURE_COUNT>;
+
+  // Join types with fewer samples keep their coefficients when calibrating
+  static constexpr auto MIN_SAMPLE_COUNT = size_t{8};
+
+  // The properties of a join that its cost depends on
+  struct JoinProperties {
+    Cardinality left_row_count{0};
+    Cardinality right_row_count{0};
+    Cardinality output_row_count{0};
+
+    // Whether an input is sorted ascendingly by the join column
+    bool left_input_sorted{false};
+    bool right_input_sorted{false};
+
+    // Only for JoinIndex
+    IndexSide index_side{IndexSide::Right};
+    size_t index_chunk_count{0};
+  };
+
+  // A measured execution of a join operator
+  struct Sample {
+    OperatorType join_type;
+    JoinProperties properties;
+    std::chrono::nanoseconds runtime;
+  };
+
+  // Initializes the model with the default coefficients
+  JoinCostModel();
+
+  Cost estimate_cost(const OperatorType join_type, const JoinProperties& properties) const;
+
+  static Features features(const OperatorType join_type, const JoinProperties& properties);
+
+  /**
+   * Creates a Sample from an executed join operator, using the OperatorPerformanceData of the operator and of its
+   * inputs. An input counts as sorted if it is a Sort operator that sorts by the join column first.
+   */
+  static Sample sample(const AbstractJoinOperator& join_operator);
+
+  /**
+   * Fits the coefficients of each join type to the runtimes of the @param samples. The coefficients are determined by
+   * least squares on the relative error (so that short and long runtimes are weighted alike) and are constrained to
+   * be non-negative.
+   */
+  void calibrate(const std::vector<Sample>& samples);
+
+  const Coefficients& coefficients(const OperatorType join_type) const;
+  void set_coefficients(const OperatorType join_type, const Coefficients& coefficients);
+
+ private:
+  std::unordered_map<OperatorType, Coefficients> _coefficients;
+};
+
+}  // namespace opossum
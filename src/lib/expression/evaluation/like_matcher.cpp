@@ -1,12 +1,64 @@
 #include "like_matcher.hpp"
 
-#include "boost/algorithm/string/replace.hpp"
+#include <climits>
+#include <cstring>
 
 #include "utils/assert.hpp"
 
+namespace {
+
+// As in ValueIDRangeScan, GCC vector extensions are used so that the comparisons compile to the SIMD instructions of
+// the target (e.g., AVX2 for 256 bit) without using platform-specific intrinsics.
+constexpr auto SIMD_SIZE = size_t{256 / CHAR_BIT};
+using SimdType = uint8_t __attribute__((vector_size(SIMD_SIZE)));
+
+// Number of positions that can be tracked by the Shift-And automaton
+constexpr auto MAX_AUTOMATON_SEGMENT_SIZE = size_t{64};
+
+}  // namespace
+
 namespace opossum {
 
-LikeMatcher::LikeMatcher(const pmr_string& pattern) { _pattern_variant = pattern_string_to_pattern_variant(pattern); }
+LikeMatcher::LikeMatcher(const pmr_string& pattern) : _pattern_variant{pattern_string_to_pattern_variant(pattern)} {}
+
+size_t LikeMatcher::find(const std::string_view string, const std::string_view substring, const size_t offset) {
+  const auto substring_size = substring.size();
+  if (substring_size == 0 || offset + substring_size > string.size()) return string.find(substring, offset);
+
+  const auto* const data = reinterpret_cast<const uint8_t*>(string.data());
+  const auto last_candidate_position = string.size() - substring_size;
+
+  auto first_characters = SimdType{};
+  auto last_characters = SimdType{};
+  for (auto lane = size_t{0}; lane < SIMD_SIZE; ++lane) {
+    first_characters[lane] = static_cast<uint8_t>(substring.front());
+    last_characters[lane] = static_cast<uint8_t>(substring.back());
+  }
+
+  auto position = offset;
+  for (; position + SIMD_SIZE <= last_candidate_position + 1; position += SIMD_SIZE) {
+    auto first_block = SimdType{};
+    auto last_block = SimdType{};
+    std::memcpy(&first_block, data + position, SIMD_SIZE);
+    std::memcpy(&last_block, data + position + substring_size - 1, SIMD_SIZE);
+
+    const auto candidates = (first_block == first_characters) & (last_block == last_characters);
+
+    auto mask = uint32_t{0};
+    for (auto lane = size_t{0}; lane < SIMD_SIZE; ++lane) {
+      mask |= static_cast<uint32_t>(candidates[lane] & 1) << lane;
+    }
+
+    while (mask) {
+      const auto candidate_position = position + static_cast<size_t>(__builtin_ctz(mask));
+      if (std::memcmp(data + candidate_position, substring.data(), substring_size) == 0) return candidate_position;
+      mask &= mask - 1;
+    }
+  }
+
+  // Remaining candidates that do not fill an entire SIMD register
+  return string.find(substring, position);
+}
 
 size_t LikeMatcher::get_index_of_next_wildcard(const pmr_string& pattern, const size_t offset) {
   return pattern.find_first_of("_%", offset);
@@ -60,12 +112,12 @@ LikeMatcher::AllPatternVariant LikeMatcher::pattern_string_to_pattern_variant(co
   } else {
     /**
      * Pattern is either MultipleContainsPattern, e.g., '%hello%world%how%are%you%' or we fall back to
-     * using a regex matcher.
+     * the GeneralPattern.
      *
      * A MultipleContainsPattern begins and ends with '%' and  contains only strings and '%'.
      */
 
-    // Pick ContainsMultiple or Regex
+    // Pick ContainsMultiple or GeneralPattern
     auto pattern_is_contains_multiple = true;  // Set to false if tokens don't match %(, string, %)* pattern
     auto strings = std::vector<pmr_string>{};  // arguments used for ContainsMultiple, if it gets used
     auto expect_any_chars = true;              // If true, expect '%', if false, expect a string
@@ -88,37 +140,105 @@ LikeMatcher::AllPatternVariant LikeMatcher::pattern_string_to_pattern_variant(co
       expect_any_chars = !expect_any_chars;
     }
 
-    if (pattern_is_contains_multiple) {
+    // The pattern must end with a '%', which also rules out the empty pattern
+    if (pattern_is_contains_multiple && !expect_any_chars) {
       return MultipleContainsPattern{strings};
     } else {
-      return std::regex(sql_like_to_regex(pattern));
+      return GeneralPattern{pattern};
+    }
+  }
+}
+
+LikeMatcher::GeneralPattern::Segment::Segment(const pmr_string& init_characters)
+    : characters{init_characters}, contains_single_char_wildcard{characters.find('_') != pmr_string::npos} {
+  if (!contains_single_char_wildcard || characters.size() > MAX_AUTOMATON_SEGMENT_SIZE) return;
+
+  character_masks.resize(size_t{1} << CHAR_BIT);
+  for (auto index = size_t{0}; index < characters.size(); ++index) {
+    const auto position_bit = uint64_t{1} << index;
+    if (characters[index] == '_') {
+      for (auto& character_mask : character_masks) {
+        character_mask |= position_bit;
+      }
+    } else {
+      character_masks[static_cast<uint8_t>(characters[index])] |= position_bit;
     }
   }
 }
 
-std::string LikeMatcher::sql_like_to_regex(pmr_string sql_like) {
-  // Do substitution of <backslash> with <backslash><backslash> FIRST, because otherwise it will also replace
-  // backslashes introduced by the other substitutions
-  constexpr auto REPLACE_BY = std::array<std::pair<const char*, const char*>, 14u>{{{"\\", "\\\\"},
-                                                                                    {".", "\\."},
-                                                                                    {"^", "\\^"},
-                                                                                    {"$", "\\$"},
-                                                                                    {"+", "\\+"},
-                                                                                    {"?", "\\?"},
-                                                                                    {"(", "\\("},
-                                                                                    {")", "\\)"},
-                                                                                    {"{", "\\{"},
-                                                                                    {"}", "\\}"},
-                                                                                    {"|", "\\|"},
-                                                                                    {"*", "\\*"},
-                                                                                    {"%", ".*"},
-                                                                                    {"_", "."}}};
-
-  for (const auto& pair : REPLACE_BY) {
-    boost::replace_all(sql_like, pair.first, pair.second);
+bool LikeMatcher::GeneralPattern::Segment::matches_at(const std::string_view string, const size_t position) const {
+  DebugAssert(position + characters.size() <= string.size(), "Segment exceeds the string");
+  if (!contains_single_char_wildcard) return string.compare(position, characters.size(), characters) == 0;
+
+  for (auto index = size_t{0}; index < characters.size(); ++index) {
+    if (characters[index] != '_' && characters[index] != string[position + index]) return false;
+  }
+  return true;
+}
+
+size_t LikeMatcher::GeneralPattern::Segment::find(const std::string_view string, const size_t begin,
+                                                  const size_t end) const {
+  const auto segment_size = characters.size();
+  if (begin + segment_size > end) return std::string_view::npos;
+
+  if (!contains_single_char_wildcard) {
+    return LikeMatcher::find(string.substr(0, end), characters, begin);
   }
 
-  return std::string{"^" + sql_like + "$"};
+  if (!character_masks.empty()) {
+    // Bit i of the state is set if the last i + 1 characters match the first i + 1 characters of the segment
+    const auto accepting_state = uint64_t{1} << (segment_size - 1);
+    auto state = uint64_t{0};
+    for (auto position = begin; position < end; ++position) {
+      state = ((state << 1) | 1) & character_masks[static_cast<uint8_t>(string[position])];
+      if (state & accepting_state) return position + 1 - segment_size;
+    }
+    return std::string_view::npos;
+  }
+
+  for (auto position = begin; position + segment_size <= end; ++position) {
+    if (matches_at(string, position)) return position;
+  }
+  return std::string_view::npos;
+}
+
+LikeMatcher::GeneralPattern::GeneralPattern(const pmr_string& pattern) {
+  auto segment_begin = size_t{0};
+  while (true) {
+    const auto segment_end = pattern.find('%', segment_begin);
+    const auto segment = pattern.substr(segment_begin, segment_end - segment_begin);
+
+    // Segments between two '%' can be omitted if they are empty (i.e., for '%%'). The first and the last segment are
+    // kept as they are anchored to the beginning and end of the string.
+    if (!segment.empty() || segment_begin == 0 || segment_end == pmr_string::npos) {
+      segments.emplace_back(segment);
+    }
+
+    if (segment_end == pmr_string::npos) break;
+    segment_begin = segment_end + 1;
+  }
+}
+
+bool LikeMatcher::GeneralPattern::matches(const std::string_view string) const {
+  const auto& first_segment = segments.front();
+  if (segments.size() == 1) {
+    return string.size() == first_segment.characters.size() && first_segment.matches_at(string, 0);
+  }
+
+  const auto& last_segment = segments.back();
+  if (string.size() < first_segment.characters.size() + last_segment.characters.size()) return false;
+
+  const auto end = string.size() - last_segment.characters.size();
+  if (!first_segment.matches_at(string, 0) || !last_segment.matches_at(string, end)) return false;
+
+  auto position = first_segment.characters.size();
+  for (auto segment_id = size_t{1}; segment_id + 1 < segments.size(); ++segment_id) {
+    const auto& segment = segments[segment_id];
+    position = segment.find(string, position, end);
+    if (position == std::string_view::npos) return false;
+    position += segment.characters.size();
+  }
+  return true;
 }
 
 std::ostream& operator<<(std::ostream& stream, const LikeMatcher::Wildcard& wildcard) {
@@ -1,8 +1,7 @@
 #pragma once
 
-#include <experimental/functional>
-#include <regex>
 #include <string>
+#include <string_view>
 #include <variant>
 #include <vector>
 
@@ -18,18 +17,14 @@ namespace opossum {
  * check.
  */
 class LikeMatcher {
-  // A faster search algorithm than the typical byte-wise search if we can reuse the searcher
-#ifdef __GLIBCXX__
-  using Searcher = std::boyer_moore_searcher<pmr_string::const_iterator>;
-#else
-  using Searcher = std::experimental::boyer_moore_searcher<pmr_string::const_iterator>;
-#endif
-
  public:
   /**
-   * Turn SQL LIKE-pattern into a C++ regex.
+   * Returns the position of the first occurrence of substring in string at or after offset, or std::string_view::npos.
+   * Compares the first and the last character of the substring at 32 consecutive positions at once using SIMD
+   * instructions and only compares the entire substring where both match (Muła: "SIMD-friendly algorithms for
+   * substring searching", 2016).
    */
-  static std::string sql_like_to_regex(pmr_string sql_like);
+  static size_t find(const std::string_view string, const std::string_view substring, const size_t offset = 0);
 
   static size_t get_index_of_next_wildcard(const pmr_string& pattern, const size_t offset = 0);
   static bool contains_wildcard(const pmr_string& pattern);
@@ -48,7 +43,7 @@ class LikeMatcher {
 
   /**
    * To speed up LIKE there are special implementations available for simple, common patterns.
-   * Any other pattern will fall back to regex.
+   * Any other pattern will fall back to the GeneralPattern.
    */
   // 'hello%'
   struct StartsWithPattern final {
@@ -68,11 +63,46 @@ class LikeMatcher {
   };
 
   /**
-   * Contains one of the specialised patterns from above (StartsWithPattern, ...) or falls back to std::regex for a
-   * general pattern.
+   * Any other pattern, e.g., 'H_llo%W_rld' or '%abc_def%'. The pattern is split at its '%' wildcards into segments
+   * of characters and '_' wildcards. The first segment has to match at the beginning of the string, the last one at
+   * its end, and the segments in between are searched for from left to right. As '%' matches any sequence of
+   * characters, taking the leftmost occurrence of each segment finds a match whenever there is one, so that no
+   * backtracking is needed.
+   */
+  struct GeneralPattern final {
+    struct Segment {
+      explicit Segment(const pmr_string& init_characters);
+
+      // Returns whether the segment matches string at the given position, which has to leave enough characters
+      bool matches_at(const std::string_view string, const size_t position) const;
+
+      // Returns the position of the first occurrence in string[begin, end), or std::string_view::npos
+      size_t find(const std::string_view string, const size_t begin, const size_t end) const;
+
+      // '_' matches any character
+      pmr_string characters;
+      bool contains_single_char_wildcard;
+
+      // For segments with '_' wildcards that fit into a 64-bit state, occurrences are searched for using a bit-parallel
+      // automaton (Shift-And, Baeza-Yates and Gonnet: "A new approach to text searching", 1992). Bit i of the mask of a
+      // character is set if the character matches the i-th position of the segment. Empty otherwise.
+      std::vector<uint64_t> character_masks;
+    };
+
+    explicit GeneralPattern(const pmr_string& pattern);
+
+    bool matches(const std::string_view string) const;
+
+    // Contains at least one segment. With a single segment, the pattern has no '%' wildcard. The first and the last
+    // segment are empty if the pattern begins or ends with '%', respectively.
+    std::vector<Segment> segments;
+  };
+
+  /**
+   * Contains one of the specialised patterns from above (StartsWithPattern, ...) or the GeneralPattern
    */
   using AllPatternVariant =
-      std::variant<std::regex, StartsWithPattern, EndsWithPattern, ContainsPattern, MultipleContainsPattern>;
+      std::variant<GeneralPattern, StartsWithPattern, EndsWithPattern, ContainsPattern, MultipleContainsPattern>;
 
   static AllPatternVariant pattern_string_to_pattern_variant(const pmr_string& pattern);
 
@@ -101,37 +131,25 @@ class LikeMatcher {
 
     } else if (std::holds_alternative<ContainsPattern>(_pattern_variant)) {
       const auto& contains_str = std::get<ContainsPattern>(_pattern_variant).string;
-      // It's really hard to store the searcher in the pattern as it only holds iterators into the string that easily
-      // get invalidated when the pattern is passed around.
-      const auto searcher = Searcher{contains_str.begin(), contains_str.end()};
       functor([&](const auto& string) -> bool {
-        return (std::search(string.begin(), string.end(), searcher) != string.end()) ^ invert_results;
+        return (find(string, contains_str) != std::string_view::npos) ^ invert_results;
       });
 
     } else if (std::holds_alternative<MultipleContainsPattern>(_pattern_variant)) {
       const auto& contains_strs = std::get<MultipleContainsPattern>(_pattern_variant).strings;
-      std::vector<Searcher> searchers;
-      searchers.reserve(contains_strs.size());
-      for (const auto& contains_str : contains_strs) {
-        searchers.emplace_back(Searcher(contains_str.begin(), contains_str.end()));
-      }
-
       functor([&](const auto& string) -> bool {
-        auto current_position = string.begin();
-        for (auto searcher_idx = size_t{0}; searcher_idx < searchers.size(); ++searcher_idx) {
-          current_position = std::search(current_position, string.end(), searchers[searcher_idx]);
-          if (current_position == string.end()) return invert_results;
-          current_position += contains_strs[searcher_idx].size();
+        auto current_position = size_t{0};
+        for (const auto& contains_str : contains_strs) {
+          current_position = find(string, contains_str, current_position);
+          if (current_position == std::string_view::npos) return invert_results;
+          current_position += contains_str.size();
         }
         return !invert_results;
       });
 
-    } else if (std::holds_alternative<std::regex>(_pattern_variant)) {
-      const auto& regex = std::get<std::regex>(_pattern_variant);
-
-      functor([&](const auto& string) -> bool {
-        return std::regex_match(string.cbegin(), string.cend(), regex) ^ invert_results;
-      });
+    } else if (std::holds_alternative<GeneralPattern>(_pattern_variant)) {
+      const auto& general_pattern = std::get<GeneralPattern>(_pattern_variant);
+      functor([&](const auto& string) -> bool { return general_pattern.matches(string) ^ invert_results; });
 
     } else {
       Fail("Pattern not implemented. Probably a bug.");
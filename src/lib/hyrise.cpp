@@ -1,5 +1,8 @@
 #include "hyrise.hpp"
 
+#include "cost_estimation/join_cost_model.hpp"
+#include "utils/settings/memory_budget_setting.hpp"
+
 namespace opossum {
 
 Hyrise::Hyrise() {
@@ -18,8 +21,10 @@ Hyrise::Hyrise() {
   transaction_manager = TransactionManager{};
   meta_table_manager = MetaTableManager{};
   settings_manager = SettingsManager{};
+  settings_manager._add(std::make_shared<MemoryBudgetSetting>());
   log_manager = LogManager{};
   topology = Topology{};
+  join_cost_model = std::make_shared<JoinCostModel>();
   _scheduler = std::make_shared<ImmediateExecutionScheduler>();
 }
 
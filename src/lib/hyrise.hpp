@@ -16,6 +16,8 @@ namespace opossum {
 
 class AbstractScheduler;
 class BenchmarkRunner;
+class JoinCostModel;
+class WriteAheadLog;
 
 // This should be the only singleton in the src/lib world. It provides a unified way of accessing components like the
 // storage manager, the transaction manager, and more. Encapsulating this in one class avoids the static initialization
@@ -52,6 +54,13 @@ class Hyrise : public Singleton<Hyrise> {
   std::shared_ptr<SQLPhysicalPlanCache> default_pqp_cache;
   std::shared_ptr<SQLLogicalPlanCache> default_lqp_cache;
 
+  // If set, the effects of committed transactions are made durable before they become visible. Call
+  // WriteAheadLog::recover() before setting it.
+  std::shared_ptr<WriteAheadLog> write_ahead_log;
+
+  // Used by the LQPTranslator to choose the join implementation. Calibrated coefficients can be set on it.
+  std::shared_ptr<JoinCostModel> join_cost_model;
+
   // The BenchmarkRunner is available here so that non-benchmark components can add information to the benchmark
   // result JSON.
   std::weak_ptr<BenchmarkRunner> benchmark_runner;
@@ -6,36 +6,122 @@
 #include <numeric>
 #include <optional>
 #include <string>
+#include <type_traits>
 #include <utility>
 
 #include "constant_mappings.hpp"
 #include "hyrise.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/chunk.hpp"
 #include "storage/encoding_type.hpp"
 #include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_vector.hpp"
 #include "storage/vector_compression/simd_bp128/oversized_types.hpp"
 #include "storage/vector_compression/simd_bp128/simd_bp128_vector.hpp"
 
+#include "memory/mapped_file_resource.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Stream buffer that reads from a MappedFileResource. Values that are not mapped (see
+// BinaryParser::_read_page_aligned_values) are copied from the mapping just like they would be read from a file.
+class MappedFileBuffer : public std::streambuf {
+ public:
+  explicit MappedFileBuffer(MappedFileResource& resource) : resource(resource) {
+    auto* const data = const_cast<char*>(resource.data());
+    setg(data, data, data + resource.size());
+  }
+
+  MappedFileResource& resource;
+
+ protected:
+  pos_type seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode mode) override {
+    auto position = offset;
+    if (direction == std::ios_base::cur) position += gptr() - eback();
+    if (direction == std::ios_base::end) position += egptr() - eback();
+    return seekpos(pos_type{position}, mode);
+  }
+
+  pos_type seekpos(pos_type position, std::ios_base::openmode mode) override {
+    if (!(mode & std::ios_base::in) || position < 0 || position > egptr() - eback()) return pos_type{off_type{-1}};
+    setg(eback(), eback() + position, egptr());
+    return position;
+  }
+};
+
+
+// Input stream that reads from its own MappedFileBuffer, so that multiple JobTasks can read from the same mapping.
+class MappedFileStream : public std::istream {
+ public:
+  explicit MappedFileStream(MappedFileResource& resource) : std::istream(nullptr), _buffer(resource) {
+    rdbuf(&_buffer);
+  }
+
+ private:
+  MappedFileBuffer _buffer;
+};
+
+}  // namespace
+
 namespace opossum {
 
-std::shared_ptr<Table> BinaryParser::parse(const std::string& filename) {
-  std::ifstream file;
-  file.open(filename, std::ios::binary);
-  file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+std::shared_ptr<Table> BinaryParser::parse(const std::string& filename, const UseMmap use_mmap) {
+  // The resource stays alive as long as segments use its memory.
+  auto resource = std::unique_ptr<MappedFileResource, void (*)(MappedFileResource*)>{
+      nullptr, [](auto* mapped_file_resource) { mapped_file_resource->release(); }};
+  if (use_mmap == UseMmap::Yes) resource.reset(MappedFileResource::create(filename));
+
+  const auto open_file = [&]() -> std::unique_ptr<std::istream> {
+    auto file = std::unique_ptr<std::istream>{};
+    if (resource) {
+      file = std::make_unique<MappedFileStream>(*resource);
+    } else {
+      file = std::make_unique<std::ifstream>(filename, std::ios::binary);
+    }
+    file->exceptions(std::istream::failbit | std::istream::badbit);
+    return file;
+  };
+
+  const auto file = open_file();
+  auto table = std::shared_ptr<Table>{};
+  auto chunk_count = ChunkID{};
+  auto layout = BinaryFileLayout{};
+  std::tie(table, chunk_count, layout) = _read_header(*file);
+
+  if (layout == BinaryFileLayout::Sequential) {
+    for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+      _append_chunk(*table, _read_chunk(*file, *table, layout));
+    }
+    return table;
+  }
 
-  auto [table, chunk_count] = _read_header(file);
+  // The chunk offset directory allows us to read the chunks in parallel. Each JobTask uses its own stream.
+  const auto chunk_offsets = _read_values<uint64_t>(*file, chunk_count);
+  auto chunks = std::vector<ChunkContents>(chunk_count);
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
   for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
-    _import_chunk(file, table);
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto chunk_file = open_file();
+      chunk_file->seekg(static_cast<std::streamoff>(chunk_offsets[chunk_id]));
+      chunks[chunk_id] = _read_chunk(*chunk_file, *table, layout);
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  for (auto& chunk : chunks) {
+    _append_chunk(*table, std::move(chunk));
   }
 
   return table;
 }
 
 template <typename T>
-pmr_vector<T> BinaryParser::_read_values(std::ifstream& file, const size_t count) {
+pmr_vector<T> BinaryParser::_read_values(std::istream& file, const size_t count) {
   pmr_vector<T> values(count);
   file.read(reinterpret_cast<char*>(values.data()), values.size() * sizeof(T));
   return values;
@@ -43,19 +129,19 @@ pmr_vector<T> BinaryParser::_read_values(std::ifstream& file, const size_t count
 
 // specialized implementation for string values
 template <>
-pmr_vector<pmr_string> BinaryParser::_read_values(std::ifstream& file, const size_t count) {
+pmr_vector<pmr_string> BinaryParser::_read_values(std::istream& file, const size_t count) {
   return _read_string_values(file, count);
 }
 
 // specialized implementation for bool values
 template <>
-pmr_vector<bool> BinaryParser::_read_values(std::ifstream& file, const size_t count) {
+pmr_vector<bool> BinaryParser::_read_values(std::istream& file, const size_t count) {
   pmr_vector<BoolAsByteType> readable_bools(count);
   file.read(reinterpret_cast<char*>(readable_bools.data()), readable_bools.size() * sizeof(BoolAsByteType));
   return pmr_vector<bool>(readable_bools.begin(), readable_bools.end());
 }
 
-pmr_vector<pmr_string> BinaryParser::_read_string_values(std::ifstream& file, const size_t count) {
+pmr_vector<pmr_string> BinaryParser::_read_string_values(std::istream& file, const size_t count) {
   const auto string_lengths = _read_values<size_t>(file, count);
   const auto total_length = std::accumulate(string_lengths.cbegin(), string_lengths.cend(), static_cast<size_t>(0));
   const auto buffer = _read_values<char>(file, total_length);
@@ -72,14 +158,43 @@ pmr_vector<pmr_string> BinaryParser::_read_string_values(std::ifstream& file, co
 }
 
 template <typename T>
-T BinaryParser::_read_value(std::ifstream& file) {
+pmr_vector<T> BinaryParser::_read_page_aligned_values(std::istream& file, const size_t count,
+                                                      const BinaryFileLayout layout) {
+  const auto byte_count = count * sizeof(T);
+  if (layout == BinaryFileLayout::Sequential || byte_count < BinaryWriter::PAGE_ALIGNMENT) {
+    return _read_values<T>(file, count);
+  }
+
+  const auto unaligned_offset = static_cast<size_t>(file.tellg());
+  const auto offset = (unaligned_offset + BinaryWriter::PAGE_ALIGNMENT - 1) / BinaryWriter::PAGE_ALIGNMENT *
+                      BinaryWriter::PAGE_ALIGNMENT;
+  file.seekg(static_cast<std::streamoff>(offset));
+
+  // The OS page size might be larger than the alignment of the file, in which case the values are copied.
+  auto* const mapped_file_buffer = dynamic_cast<MappedFileBuffer*>(file.rdbuf());
+  if (!mapped_file_buffer || !MappedFileResource::is_page_aligned(offset)) {
+    return _read_values<T>(file, count);
+  }
+
+  file.seekg(static_cast<std::streamoff>(offset + byte_count));
+  return mapped_file_buffer->resource.map_values<T>(offset, count);
+}
+
+template <typename T>
+T BinaryParser::_read_value(std::istream& file) {
   T result;
   file.read(reinterpret_cast<char*>(&result), sizeof(T));
   return result;
 }
 
-std::pair<std::shared_ptr<Table>, ChunkID> BinaryParser::_read_header(std::ifstream& file) {
-  const auto chunk_size = _read_value<ChunkOffset>(file);
+std::tuple<std::shared_ptr<Table>, ChunkID, BinaryFileLayout> BinaryParser::_read_header(std::istream& file) {
+  auto chunk_size = _read_value<ChunkOffset>(file);
+  auto layout = BinaryFileLayout::Sequential;
+  if (chunk_size == BinaryWriter::INDEXED_LAYOUT_MARKER) {
+    layout = BinaryFileLayout::Indexed;
+    chunk_size = _read_value<ChunkOffset>(file);
+  }
+
   const auto chunk_count = _read_value<ChunkID>(file);
   const auto column_count = _read_value<ColumnID>(file);
   const auto column_data_types = _read_values<pmr_string>(file, column_count);
@@ -95,58 +210,64 @@ std::pair<std::shared_ptr<Table>, ChunkID> BinaryParser::_read_header(std::ifstr
 
   auto table = std::make_shared<Table>(output_column_definitions, TableType::Data, chunk_size, UseMvcc::Yes);
 
-  return std::make_pair(table, chunk_count);
+  return std::make_tuple(table, chunk_count, layout);
 }
 
-void BinaryParser::_import_chunk(std::ifstream& file, std::shared_ptr<Table>& table) {
+BinaryParser::ChunkContents BinaryParser::_read_chunk(std::istream& file, const Table& table,
+                                                     const BinaryFileLayout layout) {
   const auto row_count = _read_value<ChunkOffset>(file);
 
+  auto chunk = ChunkContents{};
+
   // Import sort column definitions
   const auto num_sorted_columns = _read_value<uint32_t>(file);
-  std::vector<SortColumnDefinition> sorted_columns;
   for (ColumnID sorted_column_id{0}; sorted_column_id < num_sorted_columns; ++sorted_column_id) {
     const auto column_id = _read_value<ColumnID>(file);
     const auto sort_mode = _read_value<SortMode>(file);
-    sorted_columns.emplace_back(SortColumnDefinition{column_id, sort_mode});
+    chunk.sorted_columns.emplace_back(SortColumnDefinition{column_id, sort_mode});
   }
 
-  Segments output_segments;
-  for (ColumnID column_id{0}; column_id < table->column_count(); ++column_id) {
-    output_segments.push_back(
-        _import_segment(file, row_count, table->column_data_type(column_id), table->column_is_nullable(column_id)));
+  for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
+    chunk.segments.push_back(_import_segment(file, row_count, table.column_data_type(column_id),
+                                             table.column_is_nullable(column_id), layout));
   }
 
-  const auto mvcc_data = std::make_shared<MvccData>(row_count, CommitID{0});
-  table->append_chunk(output_segments, mvcc_data);
-  table->last_chunk()->finalize();
-  if (num_sorted_columns > 0) table->last_chunk()->set_individually_sorted_by(sorted_columns);
+  chunk.mvcc_data = std::make_shared<MvccData>(row_count, CommitID{0});
+  return chunk;
 }
 
-std::shared_ptr<AbstractSegment> BinaryParser::_import_segment(std::ifstream& file, ChunkOffset row_count,
-                                                               DataType data_type, bool is_nullable) {
+void BinaryParser::_append_chunk(Table& table, ChunkContents&& chunk) {
+  table.append_chunk(chunk.segments, chunk.mvcc_data);
+  table.last_chunk()->finalize();
+  if (!chunk.sorted_columns.empty()) table.last_chunk()->set_individually_sorted_by(chunk.sorted_columns);
+}
+
+std::shared_ptr<AbstractSegment> BinaryParser::_import_segment(std::istream& file, ChunkOffset row_count,
+                                                               DataType data_type, bool is_nullable,
+                                                               const BinaryFileLayout layout) {
   std::shared_ptr<AbstractSegment> result;
   resolve_data_type(data_type, [&](auto type) {
     using ColumnDataType = typename decltype(type)::type;
-    result = _import_segment<ColumnDataType>(file, row_count, is_nullable);
+    result = _import_segment<ColumnDataType>(file, row_count, is_nullable, layout);
   });
 
   return result;
 }
 
 template <typename ColumnDataType>
-std::shared_ptr<AbstractSegment> BinaryParser::_import_segment(std::ifstream& file, ChunkOffset row_count,
-                                                               bool is_nullable) {
+std::shared_ptr<AbstractSegment> BinaryParser::_import_segment(std::istream& file, ChunkOffset row_count,
+                                                               bool is_nullable, const BinaryFileLayout layout) {
   const auto column_type = _read_value<EncodingType>(file);
 
   switch (column_type) {
     case EncodingType::Unencoded:
       return _import_value_segment<ColumnDataType>(file, row_count, is_nullable);
     case EncodingType::Dictionary:
-      return _import_dictionary_segment<ColumnDataType>(file, row_count);
+      return _import_dictionary_segment<ColumnDataType>(file, row_count, layout);
     case EncodingType::FixedStringDictionary:
       if constexpr (encoding_supports_data_type(enum_c<EncodingType, EncodingType::FixedStringDictionary>,
                                                 hana::type_c<ColumnDataType>)) {
-        return _import_fixed_string_dictionary_segment(file, row_count);
+        return _import_fixed_string_dictionary_segment(file, row_count, layout);
       } else {
         Fail("Unsupported data type for FixedStringDictionary encoding");
       }
@@ -161,13 +282,27 @@ std::shared_ptr<AbstractSegment> BinaryParser::_import_segment(std::ifstream& fi
       }
     case EncodingType::LZ4:
       return _import_lz4_segment<ColumnDataType>(file, row_count);
+    case EncodingType::FSST:
+      if constexpr (encoding_supports_data_type(enum_c<EncodingType, EncodingType::FSST>,
+                                                hana::type_c<ColumnDataType>)) {
+        return _import_fsst_segment(file, row_count);
+      } else {
+        Fail("Unsupported data type for FSST encoding");
+      }
+    case EncodingType::ALP:
+      if constexpr (encoding_supports_data_type(enum_c<EncodingType, EncodingType::ALP>,
+                                                hana::type_c<ColumnDataType>)) {
+        return _import_alp_segment<ColumnDataType>(file, row_count);
+      } else {
+        Fail("Unsupported data type for ALP encoding");
+      }
   }
 
   Fail("Invalid EncodingType");
 }
 
 template <typename T>
-std::shared_ptr<ValueSegment<T>> BinaryParser::_import_value_segment(std::ifstream& file, ChunkOffset row_count,
+std::shared_ptr<ValueSegment<T>> BinaryParser::_import_value_segment(std::istream& file, ChunkOffset row_count,
                                                                      bool is_nullable) {
   if (is_nullable) {
     auto nullables = _read_values<bool>(file, row_count);
@@ -180,29 +315,35 @@ std::shared_ptr<ValueSegment<T>> BinaryParser::_import_value_segment(std::ifstre
 }
 
 template <typename T>
-std::shared_ptr<DictionarySegment<T>> BinaryParser::_import_dictionary_segment(std::ifstream& file,
-                                                                               ChunkOffset row_count) {
+std::shared_ptr<DictionarySegment<T>> BinaryParser::_import_dictionary_segment(std::istream& file,
+                                                                               ChunkOffset row_count,
+                                                                               const BinaryFileLayout layout) {
   const auto attribute_vector_width = _read_value<AttributeVectorWidth>(file);
   const auto dictionary_size = _read_value<ValueID>(file);
-  auto dictionary = std::make_shared<pmr_vector<T>>(_read_values<T>(file, dictionary_size));
+  auto dictionary = std::shared_ptr<pmr_vector<T>>{};
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    dictionary = std::make_shared<pmr_vector<T>>(_read_values<T>(file, dictionary_size));
+  } else {
+    dictionary = std::make_shared<pmr_vector<T>>(_read_page_aligned_values<T>(file, dictionary_size, layout));
+  }
 
-  auto attribute_vector = _import_attribute_vector(file, row_count, attribute_vector_width);
+  auto attribute_vector = _import_attribute_vector(file, row_count, attribute_vector_width, layout);
 
   return std::make_shared<DictionarySegment<T>>(dictionary, attribute_vector);
 }
 
 std::shared_ptr<FixedStringDictionarySegment<pmr_string>> BinaryParser::_import_fixed_string_dictionary_segment(
-    std::ifstream& file, ChunkOffset row_count) {
+    std::istream& file, ChunkOffset row_count, const BinaryFileLayout layout) {
   const auto attribute_vector_width = _read_value<AttributeVectorWidth>(file);
   const auto dictionary_size = _read_value<ValueID>(file);
-  auto dictionary = _import_fixed_string_vector(file, dictionary_size);
-  auto attribute_vector = _import_attribute_vector(file, row_count, attribute_vector_width);
+  auto dictionary = _import_fixed_string_vector(file, dictionary_size, layout);
+  auto attribute_vector = _import_attribute_vector(file, row_count, attribute_vector_width, layout);
 
   return std::make_shared<FixedStringDictionarySegment<pmr_string>>(dictionary, attribute_vector);
 }
 
 template <typename T>
-std::shared_ptr<RunLengthSegment<T>> BinaryParser::_import_run_length_segment(std::ifstream& file,
+std::shared_ptr<RunLengthSegment<T>> BinaryParser::_import_run_length_segment(std::istream& file,
                                                                               ChunkOffset row_count) {
   const auto size = _read_value<uint32_t>(file);
   const auto values = std::make_shared<pmr_vector<T>>(_read_values<T>(file, size));
@@ -213,7 +354,7 @@ std::shared_ptr<RunLengthSegment<T>> BinaryParser::_import_run_length_segment(st
 }
 
 template <typename T>
-std::shared_ptr<FrameOfReferenceSegment<T>> BinaryParser::_import_frame_of_reference_segment(std::ifstream& file,
+std::shared_ptr<FrameOfReferenceSegment<T>> BinaryParser::_import_frame_of_reference_segment(std::istream& file,
                                                                                              ChunkOffset row_count) {
   const auto attribute_vector_width = _read_value<AttributeVectorWidth>(file);
   const auto block_count = _read_value<uint32_t>(file);
@@ -227,11 +368,21 @@ std::shared_ptr<FrameOfReferenceSegment<T>> BinaryParser::_import_frame_of_refer
 
   auto offset_values = _import_offset_value_vector(file, row_count, attribute_vector_width);
 
-  return std::make_shared<FrameOfReferenceSegment<T>>(block_minima, null_values, std::move(offset_values));
+  auto high_offset_values = std::unique_ptr<const BaseCompressedVector>{};
+  if constexpr (std::is_same_v<T, int64_t>) {
+    const auto high_offset_values_stored = _read_value<BoolAsByteType>(file);
+    if (high_offset_values_stored) {
+      const auto high_offset_value_vector_width = _read_value<AttributeVectorWidth>(file);
+      high_offset_values = _import_offset_value_vector(file, row_count, high_offset_value_vector_width);
+    }
+  }
+
+  return std::make_shared<FrameOfReferenceSegment<T>>(block_minima, null_values, std::move(offset_values),
+                                                      std::move(high_offset_values));
 }
 
 template <typename T>
-std::shared_ptr<LZ4Segment<T>> BinaryParser::_import_lz4_segment(std::ifstream& file, ChunkOffset row_count) {
+std::shared_ptr<LZ4Segment<T>> BinaryParser::_import_lz4_segment(std::istream& file, ChunkOffset row_count) {
   const auto num_elements = _read_value<uint32_t>(file);
   const auto block_count = _read_value<uint32_t>(file);
   const auto block_size = _read_value<uint32_t>(file);
@@ -280,22 +431,82 @@ std::shared_ptr<LZ4Segment<T>> BinaryParser::_import_lz4_segment(std::ifstream&
   }
 }
 
+std::shared_ptr<FSSTSegment<pmr_string>> BinaryParser::_import_fsst_segment(std::istream& file,
+                                                                          ChunkOffset row_count) {
+  const auto offset_vector_width = _read_value<AttributeVectorWidth>(file);
+
+  const auto symbol_count = _read_value<uint32_t>(file);
+  const auto symbols = _read_values<pmr_string>(file, symbol_count);
+  const auto symbol_table = FSSTSymbolTable{std::vector<std::string_view>(symbols.cbegin(), symbols.cend())};
+
+  const auto compressed_values_size = _read_value<uint32_t>(file);
+  auto compressed_values = _read_values<char>(file, compressed_values_size);
+
+  const auto null_values_stored = _read_value<BoolAsByteType>(file);
+  std::optional<pmr_vector<bool>> null_values;
+  if (null_values_stored) {
+    null_values = pmr_vector<bool>(_read_values<bool>(file, row_count));
+  }
+
+  auto offsets = _import_offset_value_vector(file, row_count, offset_vector_width);
+
+  return std::make_shared<FSSTSegment<pmr_string>>(symbol_table, std::move(compressed_values), std::move(offsets),
+                                                   std::move(null_values));
+}
+
+template <typename T>
+std::shared_ptr<ALPSegment<T>> BinaryParser::_import_alp_segment(std::istream& file, ChunkOffset row_count) {
+  const auto offset_value_vector_width = _read_value<AttributeVectorWidth>(file);
+
+  const auto block_count = _read_value<uint32_t>(file);
+  const auto block_minima = _read_values<int64_t>(file, block_count);
+  const auto block_first_exceptions = _read_values<uint32_t>(file, block_count);
+  const auto block_exponents = _read_values<uint8_t>(file, block_count);
+  const auto block_factors = _read_values<uint8_t>(file, block_count);
+
+  auto blocks = pmr_vector<ALPBlock>(block_count);
+  for (auto block_id = size_t{0}; block_id < block_count; ++block_id) {
+    blocks[block_id] = ALPBlock{block_minima[block_id], block_first_exceptions[block_id], block_exponents[block_id],
+                                block_factors[block_id]};
+  }
+
+  const auto exception_count = _read_value<uint32_t>(file);
+  auto exception_chunk_offsets = _read_values<ChunkOffset>(file, exception_count);
+  auto exception_values = _read_values<T>(file, exception_count);
+
+  const auto null_values_stored = _read_value<BoolAsByteType>(file);
+  std::optional<pmr_vector<bool>> null_values;
+  if (null_values_stored) {
+    null_values = pmr_vector<bool>(_read_values<bool>(file, row_count));
+  }
+
+  auto offset_values = _import_offset_value_vector(file, row_count, offset_value_vector_width);
+
+  return std::make_shared<ALPSegment<T>>(std::move(blocks), std::move(offset_values),
+                                         std::move(exception_chunk_offsets), std::move(exception_values),
+                                         std::move(null_values));
+}
+
 std::shared_ptr<BaseCompressedVector> BinaryParser::_import_attribute_vector(
-    std::ifstream& file, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width) {
+    std::istream& file, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width,
+    const BinaryFileLayout layout) {
   switch (attribute_vector_width) {
     case 1:
-      return std::make_shared<FixedSizeByteAlignedVector<uint8_t>>(_read_values<uint8_t>(file, row_count));
+      return std::make_shared<FixedSizeByteAlignedVector<uint8_t>>(
+          _read_page_aligned_values<uint8_t>(file, row_count, layout));
     case 2:
-      return std::make_shared<FixedSizeByteAlignedVector<uint16_t>>(_read_values<uint16_t>(file, row_count));
+      return std::make_shared<FixedSizeByteAlignedVector<uint16_t>>(
+          _read_page_aligned_values<uint16_t>(file, row_count, layout));
     case 4:
-      return std::make_shared<FixedSizeByteAlignedVector<uint32_t>>(_read_values<uint32_t>(file, row_count));
+      return std::make_shared<FixedSizeByteAlignedVector<uint32_t>>(
+          _read_page_aligned_values<uint32_t>(file, row_count, layout));
     default:
       Fail("Cannot import attribute vector with width: " + std::to_string(attribute_vector_width));
   }
 }
 
 std::unique_ptr<const BaseCompressedVector> BinaryParser::_import_offset_value_vector(
-    std::ifstream& file, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width) {
+    std::istream& file, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width) {
   switch (attribute_vector_width) {
     case 1:
       return std::make_unique<FixedSizeByteAlignedVector<uint8_t>>(_read_values<uint8_t>(file, row_count));
@@ -308,10 +519,10 @@ std::unique_ptr<const BaseCompressedVector> BinaryParser::_import_offset_value_v
   }
 }
 
-std::shared_ptr<FixedStringVector> BinaryParser::_import_fixed_string_vector(std::ifstream& file, const size_t count) {
+std::shared_ptr<FixedStringVector> BinaryParser::_import_fixed_string_vector(std::istream& file, const size_t count,
+                                                                             const BinaryFileLayout layout) {
   const auto string_length = _read_value<uint32_t>(file);
-  pmr_vector<char> values(string_length * count);
-  file.read(values.data(), values.size());
+  auto values = _read_page_aligned_values<char>(file, string_length * count, layout);
   return std::make_shared<FixedStringVector>(std::move(values), string_length);
 }
 
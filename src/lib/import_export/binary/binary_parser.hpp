@@ -1,17 +1,21 @@
 #pragma once
 
-#include <fstream>
+#include <istream>
 #include <memory>
 #include <optional>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
+#include "import_export/binary/binary_writer.hpp"
 #include "storage/abstract_segment.hpp"
+#include "storage/alp_segment.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/encoding_type.hpp"
 #include "storage/fixed_string_dictionary_segment.hpp"
 #include "storage/frame_of_reference_segment.hpp"
+#include "storage/fsst_segment.hpp"
 #include "storage/lz4_segment.hpp"
 #include "storage/run_length_segment.hpp"
 #include "storage/table.hpp"
@@ -19,6 +23,10 @@
 
 namespace opossum {
 
+// If enabled, the file is mapped into memory instead of being read through a stream. For files with the indexed layout
+// (see BinaryWriter::write()), the dictionaries and attribute vectors then directly use the pages of the mapping.
+enum class UseMmap : bool { No, Yes };
+
 /*
  * This parser reads an Opossum binary file and creates a table from that input.
  * Documentation of the file formats can be found in BinaryWriter header file.
@@ -35,19 +43,28 @@ class BinaryParser {
    * --------------
    *
    * ¹ Zero or more chunks
+   *
+   * The chunks of files with the indexed layout are read in parallel by JobTasks.
    */
-  static std::shared_ptr<Table> parse(const std::string& filename);
+  static std::shared_ptr<Table> parse(const std::string& filename, const UseMmap use_mmap = UseMmap::No);
 
  private:
+  // Segments and sort order of a chunk read from the file.
+  struct ChunkContents {
+    Segments segments;
+    std::shared_ptr<MvccData> mvcc_data;
+    std::vector<SortColumnDefinition> sorted_columns;
+  };
+
   /*
    * Reads the header from the given file.
    * Creates an empty table from the extracted information and
-   * returns that table and the number of chunks.
+   * returns that table, the number of chunks, and the layout of the file.
    */
-  static std::pair<std::shared_ptr<Table>, ChunkID> _read_header(std::ifstream& file);
+  static std::tuple<std::shared_ptr<Table>, ChunkID, BinaryFileLayout> _read_header(std::istream& file);
 
   /*
-   * Creates a chunk from chunk information from the given file and adds it to the given table.
+   * Reads a chunk of the given table from the given file.
    * The chunk information has the following form:
    *
    * ----------------
@@ -58,53 +75,72 @@ class BinaryParser {
    *
    * ¹Number of columns is provided in the binary header
    */
-  static void _import_chunk(std::ifstream& file, std::shared_ptr<Table>& table);
+  static ChunkContents _read_chunk(std::istream& file, const Table& table, const BinaryFileLayout layout);
+
+  // Adds the chunk to the table, finalizes it, and sets its sort order.
+  static void _append_chunk(Table& table, ChunkContents&& chunk);
 
   // Calls the right _import_column<ColumnDataType> depending on the given data_type.
-  static std::shared_ptr<AbstractSegment> _import_segment(std::ifstream& file, ChunkOffset row_count,
-                                                          DataType data_type, bool is_nullable);
+  static std::shared_ptr<AbstractSegment> _import_segment(std::istream& file, ChunkOffset row_count,
+                                                          DataType data_type, bool is_nullable,
+                                                          const BinaryFileLayout layout);
 
   template <typename ColumnDataType>
   // Reads the column type from the given file and chooses a segment import function from it.
-  static std::shared_ptr<AbstractSegment> _import_segment(std::ifstream& file, ChunkOffset row_count, bool is_nullable);
+  static std::shared_ptr<AbstractSegment> _import_segment(std::istream& file, ChunkOffset row_count, bool is_nullable,
+                                                          const BinaryFileLayout layout);
 
   template <typename T>
-  static std::shared_ptr<ValueSegment<T>> _import_value_segment(std::ifstream& file, ChunkOffset row_count,
+  static std::shared_ptr<ValueSegment<T>> _import_value_segment(std::istream& file, ChunkOffset row_count,
                                                                 bool is_nullable);
   template <typename T>
-  static std::shared_ptr<DictionarySegment<T>> _import_dictionary_segment(std::ifstream& file, ChunkOffset row_count);
+  static std::shared_ptr<DictionarySegment<T>> _import_dictionary_segment(std::istream& file, ChunkOffset row_count,
+                                                                          const BinaryFileLayout layout);
 
   static std::shared_ptr<FixedStringDictionarySegment<pmr_string>> _import_fixed_string_dictionary_segment(
-      std::ifstream& file, ChunkOffset row_count);
+      std::istream& file, ChunkOffset row_count, const BinaryFileLayout layout);
 
   template <typename T>
-  static std::shared_ptr<RunLengthSegment<T>> _import_run_length_segment(std::ifstream& file, ChunkOffset row_count);
+  static std::shared_ptr<RunLengthSegment<T>> _import_run_length_segment(std::istream& file, ChunkOffset row_count);
 
   template <typename T>
-  static std::shared_ptr<FrameOfReferenceSegment<T>> _import_frame_of_reference_segment(std::ifstream& file,
+  static std::shared_ptr<FrameOfReferenceSegment<T>> _import_frame_of_reference_segment(std::istream& file,
                                                                                         ChunkOffset row_count);
   template <typename T>
-  static std::shared_ptr<LZ4Segment<T>> _import_lz4_segment(std::ifstream& file, ChunkOffset row_count);
+  static std::shared_ptr<LZ4Segment<T>> _import_lz4_segment(std::istream& file, ChunkOffset row_count);
+
+  static std::shared_ptr<FSSTSegment<pmr_string>> _import_fsst_segment(std::istream& file, ChunkOffset row_count);
+
+  template <typename T>
+  static std::shared_ptr<ALPSegment<T>> _import_alp_segment(std::istream& file, ChunkOffset row_count);
 
   // Calls the _import_attribute_vector<uintX_t> function that corresponds to the given attribute_vector_width.
-  static std::shared_ptr<BaseCompressedVector> _import_attribute_vector(std::ifstream& file, ChunkOffset row_count,
-                                                                        AttributeVectorWidth attribute_vector_width);
+  static std::shared_ptr<BaseCompressedVector> _import_attribute_vector(std::istream& file, ChunkOffset row_count,
+                                                                        AttributeVectorWidth attribute_vector_width,
+                                                                        const BinaryFileLayout layout);
 
   static std::unique_ptr<const BaseCompressedVector> _import_offset_value_vector(
-      std::ifstream& file, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width);
+      std::istream& file, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width);
 
-  static std::shared_ptr<FixedStringVector> _import_fixed_string_vector(std::ifstream& file, const size_t count);
+  static std::shared_ptr<FixedStringVector> _import_fixed_string_vector(std::istream& file, const size_t count,
+                                                                        const BinaryFileLayout layout);
 
   // Reads row_count many values from type T and returns them in a vector
   template <typename T>
-  static pmr_vector<T> _read_values(std::ifstream& file, const size_t count);
+  static pmr_vector<T> _read_values(std::istream& file, const size_t count);
+
+  // Like _read_values, but skips the page alignment in files with the indexed layout (see BinaryWriter::write()).
+  // If the file is memory-mapped, the values are not copied, but the returned vector uses the pages of the mapping.
+  template <typename T>
+  static pmr_vector<T> _read_page_aligned_values(std::istream& file, const size_t count,
+                                                 const BinaryFileLayout layout);
 
   // Reads row_count many strings from input file. String lengths are encoded in type T.
-  static pmr_vector<pmr_string> _read_string_values(std::ifstream& file, const size_t count);
+  static pmr_vector<pmr_string> _read_string_values(std::istream& file, const size_t count);
 
   // Reads a single value of type T from the input file.
   template <typename T>
-  static T _read_value(std::ifstream& file);
+  static T _read_value(std::istream& file);
 };
 
 }  // namespace opossum
@@ -1,11 +1,16 @@
 #include "binary_writer.hpp"
 
+#include <algorithm>
 #include <cstring>
 #include <fstream>
 #include <memory>
+#include <sstream>
 #include <string>
 #include <vector>
 
+#include "hyrise.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/encoding_type.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/vector_compression/compressed_vector_type.hpp"
@@ -20,18 +25,18 @@ namespace {
 
 using namespace opossum;  // NOLINT
 
-// Writes the content of the vector to the ofstream
+// Writes the content of the vector to the stream
 template <typename T, typename Alloc>
-void export_values(std::ofstream& ofstream, const std::vector<T, Alloc>& values);
+void export_values(std::ostream& ostream, const std::vector<T, Alloc>& values);
 
-/* Writes the given strings to the ofstream. First an array of string lengths is written. After that the strings are
+/* Writes the given strings to the stream. First an array of string lengths is written. After that the strings are
  * written without any gaps between them.
  * In order to reduce the number of memory allocations we iterate twice over the string vector.
  * After the first iteration we know the number of byte that must be written to the file and can construct a buffer of
  * this size.
  * This approach is indeed faster than a dynamic approach with a stringstream.
  */
-void export_string_values(std::ofstream& ofstream, const pmr_vector<pmr_string>& values) {
+void export_string_values(std::ostream& ostream, const pmr_vector<pmr_string>& values) {
   pmr_vector<size_t> string_lengths(values.size());
   size_t total_length = 0;
 
@@ -41,7 +46,7 @@ void export_string_values(std::ofstream& ofstream, const pmr_vector<pmr_string>&
     total_length += values[i].size();
   }
 
-  export_values(ofstream, string_lengths);
+  export_values(ostream, string_lengths);
 
   // We do not have to iterate over values if all strings are empty.
   if (total_length == 0) return;
@@ -54,59 +59,112 @@ void export_string_values(std::ofstream& ofstream, const pmr_vector<pmr_string>&
     start += str.size();
   }
 
-  export_values(ofstream, buffer);
+  export_values(ostream, buffer);
 }
 
 template <typename T, typename Alloc>
-void export_values(std::ofstream& ofstream, const std::vector<T, Alloc>& values) {
-  ofstream.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+void export_values(std::ostream& ostream, const std::vector<T, Alloc>& values) {
+  ostream.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
 }
 
-void export_values(std::ofstream& ofstream, const FixedStringVector& values) {
-  ofstream.write(values.data(), values.size() * values.string_length());
+void export_values(std::ostream& ostream, const FixedStringVector& values) {
+  ostream.write(values.data(), values.size() * values.string_length());
 }
 
 // specialized implementation for string values
 template <>
-void export_values(std::ofstream& ofstream, const pmr_vector<pmr_string>& values) {
-  export_string_values(ofstream, values);
+void export_values(std::ostream& ostream, const pmr_vector<pmr_string>& values) {
+  export_string_values(ostream, values);
 }
 
 // specialized implementation for bool values
 template <typename Alloc>
-void export_values(std::ofstream& ofstream, const std::vector<bool, Alloc>& values) {
+void export_values(std::ostream& ostream, const std::vector<bool, Alloc>& values) {
   // Cast to fixed-size format used in binary file
   const auto writable_bools = pmr_vector<BoolAsByteType>(values.begin(), values.end());
-  export_values(ofstream, writable_bools);
+  export_values(ostream, writable_bools);
 }
 
-// Writes a shallow copy of the given value to the ofstream
+// Writes a shallow copy of the given value to the stream
 template <typename T>
-void export_value(std::ofstream& ofstream, const T& value) {
-  ofstream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+void export_value(std::ostream& ostream, const T& value) {
+  ostream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+// In files with the indexed layout, writes zero bytes so that a following field of byte_count bytes starts at a page
+// boundary (see BinaryWriter::write()). BinaryParser skips the same number of bytes.
+void export_page_alignment(std::ostream& ostream, const size_t byte_count, const BinaryFileLayout layout) {
+  if (layout == BinaryFileLayout::Sequential || byte_count < BinaryWriter::PAGE_ALIGNMENT) return;
+
+  const auto offset = static_cast<size_t>(ostream.tellp());
+  const auto padding = (BinaryWriter::PAGE_ALIGNMENT - offset % BinaryWriter::PAGE_ALIGNMENT) %
+                       BinaryWriter::PAGE_ALIGNMENT;
+  const auto zeros = std::vector<char>(padding);
+  ostream.write(zeros.data(), static_cast<std::streamsize>(padding));
 }
 
 }  // namespace
 
 namespace opossum {
 
-void BinaryWriter::write(const Table& table, const std::string& filename) {
+void BinaryWriter::write(const Table& table, const std::string& filename, const BinaryFileLayout layout) {
   std::ofstream ofstream;
   ofstream.exceptions(std::ofstream::failbit | std::ofstream::badbit);
   ofstream.open(filename, std::ios::binary);
 
-  _write_header(table, ofstream);
+  _write_header(table, ofstream, layout);
 
-  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); chunk_id++) {
-    _write_chunk(table, ofstream, chunk_id);
+  const auto chunk_count = table.chunk_count();
+  if (layout == BinaryFileLayout::Sequential) {
+    for (ChunkID chunk_id{0}; chunk_id < chunk_count; chunk_id++) {
+      _write_chunk(table, ofstream, chunk_id, layout);
+    }
+    return;
   }
+
+  // The chunk offsets are known once the chunks have been written.
+  const auto directory_position = ofstream.tellp();
+  auto chunk_offsets = std::vector<uint64_t>(chunk_count);
+  export_values(ofstream, chunk_offsets);
+
+  // The chunks are serialized into buffers in parallel. Only a few chunks per CPU are buffered at a time.
+  const auto batch_size = static_cast<ChunkID::base_type>(std::max(size_t{1}, Hyrise::get().topology.num_cpus() * 2));
+  auto buffers = std::vector<std::stringstream>(batch_size);
+
+  for (auto batch_begin = ChunkID{0}; batch_begin < chunk_count; batch_begin += batch_size) {
+    const auto batch_end = std::min(ChunkID{batch_begin + batch_size}, chunk_count);
+
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto chunk_id = batch_begin; chunk_id < batch_end; ++chunk_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+        auto& buffer = buffers[chunk_id - batch_begin];
+        buffer.str({});
+        _write_chunk(table, buffer, chunk_id, layout);
+      }));
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+    for (auto chunk_id = batch_begin; chunk_id < batch_end; ++chunk_id) {
+      auto& buffer = buffers[chunk_id - batch_begin];
+
+      // Page alignment within the chunk is relative to its beginning (see write()).
+      export_page_alignment(ofstream, static_cast<size_t>(buffer.tellp()), layout);
+      chunk_offsets[chunk_id] = static_cast<uint64_t>(ofstream.tellp());
+      ofstream << buffer.rdbuf();
+    }
+  }
+
+  ofstream.seekp(directory_position);
+  export_values(ofstream, chunk_offsets);
 }
 
-void BinaryWriter::_write_header(const Table& table, std::ofstream& ofstream) {
+void BinaryWriter::_write_header(const Table& table, std::ostream& ostream, const BinaryFileLayout layout) {
+  if (layout == BinaryFileLayout::Indexed) export_value(ostream, INDEXED_LAYOUT_MARKER);
+
   const auto target_chunk_size = table.type() == TableType::Data ? table.target_chunk_size() : Chunk::DEFAULT_SIZE;
-  export_value(ofstream, static_cast<ChunkOffset>(target_chunk_size));
-  export_value(ofstream, static_cast<ChunkID::base_type>(table.chunk_count()));
-  export_value(ofstream, static_cast<ColumnID::base_type>(table.column_count()));
+  export_value(ostream, static_cast<ChunkOffset>(target_chunk_size));
+  export_value(ostream, static_cast<ChunkID::base_type>(table.chunk_count()));
+  export_value(ostream, static_cast<ColumnID::base_type>(table.column_count()));
 
   pmr_vector<pmr_string> column_types(table.column_count());
   pmr_vector<pmr_string> column_names(table.column_count());
@@ -118,46 +176,51 @@ void BinaryWriter::_write_header(const Table& table, std::ofstream& ofstream) {
     column_names[column_id] = table.column_name(column_id);
     columns_are_nullable[column_id] = table.column_is_nullable(column_id);
   }
-  export_values(ofstream, column_types);
-  export_values(ofstream, columns_are_nullable);
-  export_string_values(ofstream, column_names);
+  export_values(ostream, column_types);
+  export_values(ostream, columns_are_nullable);
+  export_string_values(ostream, column_names);
 }
 
-void BinaryWriter::_write_chunk(const Table& table, std::ofstream& ofstream, const ChunkID& chunk_id) {
+void BinaryWriter::_write_chunk(const Table& table, std::ostream& ostream, const ChunkID& chunk_id,
+                                const BinaryFileLayout layout) {
   const auto chunk = table.get_chunk(chunk_id);
   Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
-  export_value(ofstream, static_cast<ChunkOffset>(chunk->size()));
+  export_value(ostream, static_cast<ChunkOffset>(chunk->size()));
 
   // Export sort column definitions
   const auto& sorted_columns = chunk->individually_sorted_by();
-  export_value(ofstream, static_cast<uint32_t>(sorted_columns.size()));
+  export_value(ostream, static_cast<uint32_t>(sorted_columns.size()));
   for (const auto& [column, sort_mode] : sorted_columns) {
-    export_value(ofstream, column);
-    export_value(ofstream, sort_mode);
+    export_value(ostream, column);
+    export_value(ostream, sort_mode);
   }
 
   // Iterating over all segments of this chunk and exporting them
   for (ColumnID column_id{0}; column_id < chunk->column_count(); column_id++) {
     resolve_data_and_segment_type(
         *chunk->get_segment(column_id),
-        [&](const auto data_type_t, const auto& resolved_segment) { _write_segment(resolved_segment, ofstream); });
+        [&](const auto data_type_t, const auto& resolved_segment) {
+          _write_segment(resolved_segment, ostream, layout);
+        });
   }
 }
 
 template <typename T>
-void BinaryWriter::_write_segment(const ValueSegment<T>& value_segment, std::ofstream& ofstream) {
-  export_value(ofstream, EncodingType::Unencoded);
+void BinaryWriter::_write_segment(const ValueSegment<T>& value_segment, std::ostream& ostream,
+                                  const BinaryFileLayout layout) {
+  export_value(ostream, EncodingType::Unencoded);
 
   if (value_segment.is_nullable()) {
-    export_values(ofstream, value_segment.null_values());
+    export_values(ostream, value_segment.null_values());
   }
 
-  export_values(ofstream, value_segment.values());
+  export_values(ostream, value_segment.values());
 }
 
-void BinaryWriter::_write_segment(const ReferenceSegment& reference_segment, std::ofstream& ofstream) {
+void BinaryWriter::_write_segment(const ReferenceSegment& reference_segment, std::ostream& ostream,
+                                  const BinaryFileLayout layout) {
   // We materialize reference segments and save them as value segments
-  export_value(ofstream, EncodingType::Unencoded);
+  export_value(ostream, EncodingType::Unencoded);
 
   if (reference_segment.size() == 0) return;
   resolve_data_type(reference_segment.data_type(), [&](auto type) {
@@ -174,188 +237,293 @@ void BinaryWriter::_write_segment(const ReferenceSegment& reference_segment, std
         values << value.value();
       });
 
-      export_values(ofstream, string_lengths);
-      ofstream << values.rdbuf();
+      export_values(ostream, string_lengths);
+      ostream << values.rdbuf();
 
     } else {
       // Unfortunately, we have to iterate over all values of the reference segment
       // to materialize its contents. Then we can write them to the file
-      iterable.for_each([&](const auto& value) { export_value(ofstream, value.value()); });
+      iterable.for_each([&](const auto& value) { export_value(ostream, value.value()); });
     }
   });
 }
 
 template <typename T>
-void BinaryWriter::_write_segment(const DictionarySegment<T>& dictionary_segment, std::ofstream& ofstream) {
-  export_value(ofstream, EncodingType::Dictionary);
+void BinaryWriter::_write_segment(const DictionarySegment<T>& dictionary_segment, std::ostream& ostream,
+                                  const BinaryFileLayout layout) {
+  export_value(ostream, EncodingType::Dictionary);
 
   // Write attribute vector width
   const auto attribute_vector_width = _compressed_vector_width<T>(dictionary_segment);
-  export_value(ofstream, static_cast<AttributeVectorWidth>(attribute_vector_width));
+  export_value(ostream, static_cast<AttributeVectorWidth>(attribute_vector_width));
 
   // Write the dictionary size and dictionary
-  export_value(ofstream, static_cast<ValueID::base_type>(dictionary_segment.dictionary()->size()));
-  export_values(ofstream, *dictionary_segment.dictionary());
+  const auto& dictionary = *dictionary_segment.dictionary();
+  export_value(ostream, static_cast<ValueID::base_type>(dictionary.size()));
+  if constexpr (!std::is_same_v<T, pmr_string>) {
+    export_page_alignment(ostream, dictionary.size() * sizeof(T), layout);
+  }
+  export_values(ostream, dictionary);
 
   // Write attribute vector
-  _export_compressed_vector(ofstream, *dictionary_segment.compressed_vector_type(),
-                            *dictionary_segment.attribute_vector());
+  _export_compressed_vector(ostream, *dictionary_segment.compressed_vector_type(),
+                            *dictionary_segment.attribute_vector(), layout);
 }
 
 template <typename T>
 void BinaryWriter::_write_segment(const FixedStringDictionarySegment<T>& fixed_string_dictionary_segment,
-                                  std::ofstream& ofstream) {
-  export_value(ofstream, EncodingType::FixedStringDictionary);
+                                  std::ostream& ostream, const BinaryFileLayout layout) {
+  export_value(ostream, EncodingType::FixedStringDictionary);
 
   // Write attribute vector width
   const auto attribute_vector_width = _compressed_vector_width<T>(fixed_string_dictionary_segment);
-  export_value(ofstream, static_cast<AttributeVectorWidth>(attribute_vector_width));
+  export_value(ostream, static_cast<AttributeVectorWidth>(attribute_vector_width));
 
   // Write the dictionary size, string length and dictionary
   const auto dictionary_size = fixed_string_dictionary_segment.fixed_string_dictionary()->size();
   const auto string_length = fixed_string_dictionary_segment.fixed_string_dictionary()->string_length();
-  export_value(ofstream, static_cast<ValueID::base_type>(dictionary_size));
-  export_value(ofstream, static_cast<uint32_t>(string_length));
-  export_values(ofstream, *fixed_string_dictionary_segment.fixed_string_dictionary());
+  export_value(ostream, static_cast<ValueID::base_type>(dictionary_size));
+  export_value(ostream, static_cast<uint32_t>(string_length));
+  export_page_alignment(ostream, dictionary_size * string_length, layout);
+  export_values(ostream, *fixed_string_dictionary_segment.fixed_string_dictionary());
 
   // Write attribute vector
-  _export_compressed_vector(ofstream, *fixed_string_dictionary_segment.compressed_vector_type(),
-                            *fixed_string_dictionary_segment.attribute_vector());
+  _export_compressed_vector(ostream, *fixed_string_dictionary_segment.compressed_vector_type(),
+                            *fixed_string_dictionary_segment.attribute_vector(), layout);
 }
 
 template <typename T>
-void BinaryWriter::_write_segment(const RunLengthSegment<T>& run_length_segment, std::ofstream& ofstream) {
-  export_value(ofstream, EncodingType::RunLength);
+void BinaryWriter::_write_segment(const RunLengthSegment<T>& run_length_segment, std::ostream& ostream,
+                                  const BinaryFileLayout layout) {
+  export_value(ostream, EncodingType::RunLength);
 
   // Write size and values
-  export_value(ofstream, static_cast<uint32_t>(run_length_segment.values()->size()));
-  export_values(ofstream, *run_length_segment.values());
+  export_value(ostream, static_cast<uint32_t>(run_length_segment.values()->size()));
+  export_values(ostream, *run_length_segment.values());
 
   // Write NULL values
-  export_values(ofstream, *run_length_segment.null_values());
+  export_values(ostream, *run_length_segment.null_values());
 
   // Write end positions
-  export_values(ofstream, *run_length_segment.end_positions());
+  export_values(ostream, *run_length_segment.end_positions());
 }
 
-template <>
-void BinaryWriter::_write_segment(const FrameOfReferenceSegment<int32_t>& frame_of_reference_segment,
-                                  std::ofstream& ofstream) {
-  export_value(ofstream, EncodingType::FrameOfReference);
+template <typename T>
+void BinaryWriter::_write_segment(const FrameOfReferenceSegment<T>& frame_of_reference_segment, std::ostream& ostream,
+                                  const BinaryFileLayout layout) {
+  export_value(ostream, EncodingType::FrameOfReference);
 
   // Write attribute vector width
-  const auto offset_value_vector_width = _compressed_vector_width<int32_t>(frame_of_reference_segment);
-  export_value(ofstream, static_cast<AttributeVectorWidth>(offset_value_vector_width));
+  const auto offset_value_vector_width = _compressed_vector_width<T>(frame_of_reference_segment);
+  export_value(ostream, static_cast<AttributeVectorWidth>(offset_value_vector_width));
 
   // Write number of blocks and block minima
-  export_value(ofstream, static_cast<uint32_t>(frame_of_reference_segment.block_minima().size()));
-  export_values(ofstream, frame_of_reference_segment.block_minima());
+  export_value(ostream, static_cast<uint32_t>(frame_of_reference_segment.block_minima().size()));
+  export_values(ostream, frame_of_reference_segment.block_minima());
 
   // Write flag if optional NULL value vector is written
-  export_value(ofstream, static_cast<BoolAsByteType>(frame_of_reference_segment.null_values().has_value()));
+  export_value(ostream, static_cast<BoolAsByteType>(frame_of_reference_segment.null_values().has_value()));
   if (frame_of_reference_segment.null_values()) {
     // Write NULL values
-    export_values(ofstream, *frame_of_reference_segment.null_values());
+    export_values(ostream, *frame_of_reference_segment.null_values());
   }
 
   // Write offset values
-  _export_compressed_vector(ofstream, *frame_of_reference_segment.compressed_vector_type(),
+  _export_compressed_vector(ostream, *frame_of_reference_segment.compressed_vector_type(),
                             frame_of_reference_segment.offset_values());
+
+  if constexpr (std::is_same_v<T, int64_t>) {
+    // Write flag if optional high offset value vector is written
+    const auto* high_offset_values = frame_of_reference_segment.high_offset_values();
+    export_value(ostream, static_cast<BoolAsByteType>(high_offset_values != nullptr));
+    if (high_offset_values) {
+      // Write high offset value vector width and high offset values
+      export_value(ostream, static_cast<AttributeVectorWidth>(_compressed_vector_width(high_offset_values->type())));
+      _export_compressed_vector(ostream, high_offset_values->type(), *high_offset_values);
+    }
+  }
 }
 
 template <typename T>
-void BinaryWriter::_write_segment(const LZ4Segment<T>& lz4_segment, std::ofstream& ofstream) {
-  export_value(ofstream, EncodingType::LZ4);
+void BinaryWriter::_write_segment(const LZ4Segment<T>& lz4_segment, std::ostream& ostream,
+                                  const BinaryFileLayout layout) {
+  export_value(ostream, EncodingType::LZ4);
 
   // Write num elements (rows in segment)
-  export_value(ofstream, static_cast<uint32_t>(lz4_segment.size()));
+  export_value(ostream, static_cast<uint32_t>(lz4_segment.size()));
 
   // Write number of blocks
-  export_value(ofstream, static_cast<uint32_t>(lz4_segment.lz4_blocks().size()));
+  export_value(ostream, static_cast<uint32_t>(lz4_segment.lz4_blocks().size()));
 
   // Write block size
-  export_value(ofstream, static_cast<uint32_t>(lz4_segment.block_size()));
+  export_value(ostream, static_cast<uint32_t>(lz4_segment.block_size()));
 
   // Write last block size
-  export_value(ofstream, static_cast<uint32_t>(lz4_segment.last_block_size()));
+  export_value(ostream, static_cast<uint32_t>(lz4_segment.last_block_size()));
 
   // Write compressed size for each LZ4 Block
   for (const auto& lz4_block : lz4_segment.lz4_blocks()) {
-    export_value(ofstream, static_cast<uint32_t>(lz4_block.size()));
+    export_value(ostream, static_cast<uint32_t>(lz4_block.size()));
   }
 
   // Write LZ4 Blocks
   for (const auto& lz4_block : lz4_segment.lz4_blocks()) {
-    export_values(ofstream, lz4_block);
+    export_values(ostream, lz4_block);
   }
 
   if (lz4_segment.null_values()) {
     // Write NULL value size
-    export_value(ofstream, static_cast<uint32_t>(lz4_segment.null_values()->size()));
+    export_value(ostream, static_cast<uint32_t>(lz4_segment.null_values()->size()));
     // Write NULL values
-    export_values(ofstream, *lz4_segment.null_values());
+    export_values(ostream, *lz4_segment.null_values());
   } else {
     // No NULL values
-    export_value(ofstream, uint32_t{0});
+    export_value(ostream, uint32_t{0});
   }
 
   // Write dictionary size
-  export_value(ofstream, static_cast<uint32_t>(lz4_segment.dictionary().size()));
+  export_value(ostream, static_cast<uint32_t>(lz4_segment.dictionary().size()));
 
   // Write dictionary
-  export_values(ofstream, lz4_segment.dictionary());
+  export_values(ostream, lz4_segment.dictionary());
 
   if (lz4_segment.string_offsets() && *lz4_segment.string_offsets()) {
     // Write string_offset size
-    export_value(ofstream, static_cast<uint32_t>((*lz4_segment.string_offsets())->size()));
+    export_value(ostream, static_cast<uint32_t>((*lz4_segment.string_offsets())->size()));
     // Write string_offset data_size
-    export_value(ofstream,
+    export_value(ostream,
                  static_cast<uint32_t>(
                      dynamic_cast<const SimdBp128Vector&>(*lz4_segment.string_offsets().value()).data().size()));
     // Write string offsets
-    _export_compressed_vector(ofstream, *lz4_segment.compressed_vector_type(), *lz4_segment.string_offsets().value());
+    _export_compressed_vector(ostream, *lz4_segment.compressed_vector_type(), *lz4_segment.string_offsets().value());
   } else {
     // Write string_offset size = 0
-    export_value(ofstream, uint32_t{0});
+    export_value(ostream, uint32_t{0});
   }
 }
 
+template <typename T>
+void BinaryWriter::_write_segment(const FSSTSegment<T>& fsst_segment, std::ostream& ostream,
+                                  const BinaryFileLayout layout) {
+  export_value(ostream, EncodingType::FSST);
+
+  // Write offset vector width
+  const auto offset_vector_width = _compressed_vector_width<T>(fsst_segment);
+  export_value(ostream, static_cast<AttributeVectorWidth>(offset_vector_width));
+
+  // Write the symbol table
+  const auto& symbol_table = fsst_segment.symbol_table();
+  auto symbols = pmr_vector<pmr_string>{};
+  symbols.reserve(symbol_table.symbol_count());
+  for (auto code = size_t{0}; code < symbol_table.symbol_count(); ++code) {
+    symbols.emplace_back(symbol_table.symbol(static_cast<uint8_t>(code)));
+  }
+  export_value(ostream, static_cast<uint32_t>(symbols.size()));
+  export_values(ostream, symbols);
+
+  // Write compressed values
+  export_value(ostream, static_cast<uint32_t>(fsst_segment.compressed_values().size()));
+  export_values(ostream, fsst_segment.compressed_values());
+
+  // Write flag if optional NULL value vector is written
+  export_value(ostream, static_cast<BoolAsByteType>(fsst_segment.null_values().has_value()));
+  if (fsst_segment.null_values()) {
+    // Write NULL values
+    export_values(ostream, *fsst_segment.null_values());
+  }
+
+  // Write offsets
+  _export_compressed_vector(ostream, *fsst_segment.compressed_vector_type(), fsst_segment.offsets());
+}
+
+template <typename T>
+void BinaryWriter::_write_segment(const ALPSegment<T>& alp_segment, std::ostream& ostream,
+                                  const BinaryFileLayout layout) {
+  export_value(ostream, EncodingType::ALP);
+
+  // Write offset value vector width
+  const auto offset_value_vector_width = _compressed_vector_width<T>(alp_segment);
+  export_value(ostream, static_cast<AttributeVectorWidth>(offset_value_vector_width));
+
+  // Write the block parameters, one vector per member to avoid writing padding bytes
+  const auto& blocks = alp_segment.blocks();
+  auto block_minima = pmr_vector<int64_t>{};
+  auto block_first_exceptions = pmr_vector<uint32_t>{};
+  auto block_exponents = pmr_vector<uint8_t>{};
+  auto block_factors = pmr_vector<uint8_t>{};
+  for (const auto& block : blocks) {
+    block_minima.push_back(block.minimum);
+    block_first_exceptions.push_back(block.first_exception);
+    block_exponents.push_back(block.exponent);
+    block_factors.push_back(block.factor);
+  }
+  export_value(ostream, static_cast<uint32_t>(blocks.size()));
+  export_values(ostream, block_minima);
+  export_values(ostream, block_first_exceptions);
+  export_values(ostream, block_exponents);
+  export_values(ostream, block_factors);
+
+  // Write exceptions
+  export_value(ostream, static_cast<uint32_t>(alp_segment.exception_chunk_offsets().size()));
+  export_values(ostream, alp_segment.exception_chunk_offsets());
+  export_values(ostream, alp_segment.exception_values());
+
+  // Write flag if optional NULL value vector is written
+  export_value(ostream, static_cast<BoolAsByteType>(alp_segment.null_values().has_value()));
+  if (alp_segment.null_values()) {
+    // Write NULL values
+    export_values(ostream, *alp_segment.null_values());
+  }
+
+  // Write offset values
+  _export_compressed_vector(ostream, *alp_segment.compressed_vector_type(), alp_segment.offset_values());
+}
+
 template <typename T>
 uint32_t BinaryWriter::_compressed_vector_width(const AbstractEncodedSegment& abstract_encoded_segment) {
   uint32_t vector_width = 0u;
   resolve_encoded_segment_type<T>(abstract_encoded_segment, [&vector_width](auto& typed_segment) {
     Assert(typed_segment.compressed_vector_type(), "Expected Segment to use vector compression");
-    switch (*typed_segment.compressed_vector_type()) {
-      case CompressedVectorType::FixedSize4ByteAligned:
-        vector_width = 4u;
-        break;
-      case CompressedVectorType::FixedSize2ByteAligned:
-        vector_width = 2u;
-        break;
-      case CompressedVectorType::FixedSize1ByteAligned:
-        vector_width = 1u;
-        break;
-      default:
-        Fail("Export of specified CompressedVectorType is not yet supported");
-    }
+    vector_width = _compressed_vector_width(*typed_segment.compressed_vector_type());
   });
   return vector_width;
 }
 
-void BinaryWriter::_export_compressed_vector(std::ofstream& ofstream, const CompressedVectorType type,
-                                             const BaseCompressedVector& compressed_vector) {
+uint32_t BinaryWriter::_compressed_vector_width(const CompressedVectorType type) {
+  switch (type) {
+    case CompressedVectorType::FixedSize4ByteAligned:
+      return 4u;
+    case CompressedVectorType::FixedSize2ByteAligned:
+      return 2u;
+    case CompressedVectorType::FixedSize1ByteAligned:
+      return 1u;
+    default:
+      Fail("Export of specified CompressedVectorType is not yet supported");
+  }
+}
+
+void BinaryWriter::_export_compressed_vector(std::ostream& ostream, const CompressedVectorType type,
+                                             const BaseCompressedVector& compressed_vector,
+                                             const BinaryFileLayout layout) {
+  // Only vectors of a fixed width are page-aligned, as the size of SimdBp128 vectors is not known in advance.
+  const auto export_fixed_size_values = [&](const auto& values) {
+    using ValueType = typename std::decay_t<decltype(values)>::value_type;
+    export_page_alignment(ostream, values.size() * sizeof(ValueType), layout);
+    export_values(ostream, values);
+  };
+
   switch (type) {
     case CompressedVectorType::FixedSize4ByteAligned:
-      export_values(ofstream, dynamic_cast<const FixedSizeByteAlignedVector<uint32_t>&>(compressed_vector).data());
+      export_fixed_size_values(dynamic_cast<const FixedSizeByteAlignedVector<uint32_t>&>(compressed_vector).data());
       return;
     case CompressedVectorType::FixedSize2ByteAligned:
-      export_values(ofstream, dynamic_cast<const FixedSizeByteAlignedVector<uint16_t>&>(compressed_vector).data());
+      export_fixed_size_values(dynamic_cast<const FixedSizeByteAlignedVector<uint16_t>&>(compressed_vector).data());
       return;
     case CompressedVectorType::FixedSize1ByteAligned:
-      export_values(ofstream, dynamic_cast<const FixedSizeByteAlignedVector<uint8_t>&>(compressed_vector).data());
+      export_fixed_size_values(dynamic_cast<const FixedSizeByteAlignedVector<uint8_t>&>(compressed_vector).data());
       return;
     case CompressedVectorType::SimdBp128:
-      export_values(ofstream, dynamic_cast<const SimdBp128Vector&>(compressed_vector).data());
+      export_values(ostream, dynamic_cast<const SimdBp128Vector&>(compressed_vector).data());
       return;
     default:
       Fail("Any other type should have been caught before.");
@@ -4,9 +4,11 @@
 #include <string>
 #include <vector>
 
+#include "storage/alp_segment.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/fixed_string_dictionary_segment.hpp"
 #include "storage/frame_of_reference_segment.hpp"
+#include "storage/fsst_segment.hpp"
 #include "storage/lz4_segment.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/run_length_segment.hpp"
@@ -18,16 +20,33 @@ namespace opossum {
 class BaseCompressedVector;
 enum class CompressedVectorType : uint8_t;
 
+enum class BinaryFileLayout : uint8_t { Sequential, Indexed };
+
 class BinaryWriter {
  public:
-  static void write(const Table& table, const std::string& filename);
+  /**
+   * Writes the table to the given file. Files with the sequential layout consist of the header followed by the chunks.
+   *
+   * Files with the indexed layout start with INDEXED_LAYOUT_MARKER, which is never a valid chunk size, followed by the
+   * header and a directory of the chunks' offsets within the file. Thus, BinaryParser can read the chunks in parallel.
+   * When writing, the chunks are serialized in parallel by JobTasks as well. Additionally, dictionaries and attribute
+   * vectors of at least PAGE_ALIGNMENT bytes are preceded by zero bytes so that they start at a multiple of
+   * PAGE_ALIGNMENT within the file, which allows BinaryParser to map them into memory. For this, chunks of at least
+   * PAGE_ALIGNMENT bytes start at a page boundary.
+   */
+  static void write(const Table& table, const std::string& filename,
+                    const BinaryFileLayout layout = BinaryFileLayout::Sequential);
+
+  static constexpr auto INDEXED_LAYOUT_MARKER = INVALID_CHUNK_OFFSET;
+  static constexpr auto PAGE_ALIGNMENT = size_t{4096};
 
  private:
   /**
-   * This methods writes the header of this table into the given ofstream.
+   * This methods writes the header of this table into the given stream.
    *
    * Description                 | Type                                | Size in bytes
    * --------------------------------------------------------------------------------------------------------
+   * Indexed layout marker¹      | ChunkOffset                         | 4
    * Chunk size                  | ChunkOffset                         | 4
    * Chunk count                 | ChunkID                             | 4
    * Column count                | ColumnID                            | 2
@@ -35,11 +54,14 @@ class BinaryWriter {
    * Column nullable             | bool (stored as BoolAsByteType)     | Column Count * 1
    * Column name lengths         | size_t array                        | Column Count * 1
    * Column names                | std::string array                   | Sum of lengths of all names
+   * Chunk offsets¹              | uint64_t array                      | Chunk count * 8
+   *
+   * ¹: These fields are only written in files with the indexed layout
    */
-  static void _write_header(const Table& table, std::ofstream& ofstream);
+  static void _write_header(const Table& table, std::ostream& ostream, const BinaryFileLayout layout);
 
   /**
-   * Writes the contents of the chunk into the given ofstream.
+   * Writes the contents of the chunk into the given stream.
    * First, it creates a chunk header with the following contents:
    *
    * Description                 | Type                                | Size in bytes
@@ -51,7 +73,8 @@ class BinaryWriter {
    * Next, it dumps the contents of the segments in the respective format (depending on the type
    * of the segment, such as ValueSegment, ReferenceSegment, DictionarySegment, RunLengthSegment).
    */
-  static void _write_chunk(const Table& table, std::ofstream& ofstream, const ChunkID& chunk_id);
+  static void _write_chunk(const Table& table, std::ostream& ostream, const ChunkID& chunk_id,
+                           const BinaryFileLayout layout);
 
   /**
    * ValueSegments are dumped with the following layout:
@@ -72,7 +95,8 @@ class BinaryWriter {
    * °: This field is writen if the type of the column is NOT a string
    */
   template <typename T>
-  static void _write_segment(const ValueSegment<T>& value_segment, std::ofstream& ofstream);
+  static void _write_segment(const ValueSegment<T>& value_segment, std::ostream& ostream,
+                             const BinaryFileLayout layout);
 
   /**
    * ReferenceSegments are dumped with the following layout, which is similar to value segments:
@@ -90,7 +114,8 @@ class BinaryWriter {
    * ^: These fields are only written if the type of the column IS a string.
    * °: This field is writen if the type of the column is NOT a string
    */
-  static void _write_segment(const ReferenceSegment& reference_segment, std::ofstream& ofstream);
+  static void _write_segment(const ReferenceSegment& reference_segment, std::ostream& ostream,
+                             const BinaryFileLayout layout);
 
   /**
    * DictionarySegments are dumped with the following layout:
@@ -100,19 +125,21 @@ class BinaryWriter {
    * Encoding Type               | EncodingType                        | 1
    * Width of attribute vector   | AttributeVectorWidth                | 1
    * Size of dictionary vector   | ValueID                             | 4
-   * Dictionary Values°          | T (int, float, double, long)        | Dictionary size * sizeof(T)
+   * Dictionary Values°*         | T (int, float, double, long)        | Dictionary size * sizeof(T)
    * Dictionary String Length^   | size_t                              | Dictionary size * 2
    * Dictionary Values^          | std::string                         | Sum of all string lengths
-   * Attribute vector values     | uintX                               | Rows * width of attribute vector
+   * Attribute vector values*    | uintX                               | Rows * width of attribute vector
    *
    * Please note that the number of rows are written in the header of the chunk.
    * The type of the column can be found in the global header of the file.
    *
    * ^: These fields are only written if the type of the column IS a string.
    * °: This field is written if the type of the column is NOT a string
+   * *: These fields are page-aligned in files with the indexed layout (see write())
    */
   template <typename T>
-  static void _write_segment(const DictionarySegment<T>& dictionary_segment, std::ofstream& ofstream);
+  static void _write_segment(const DictionarySegment<T>& dictionary_segment, std::ostream& ostream,
+                             const BinaryFileLayout layout);
 
   /**
    * FixedStringDictionarySegments are dumped with the following layout:
@@ -123,15 +150,17 @@ class BinaryWriter {
    * Width of attribute vector   | AttributeVectorWidth                | 1
    * Size of dictionary vector   | ValueID                             | 4
    * FixedString length          | uint32_t                            | 8
-   * Dictionary Values           | char array                          | Dictionary size * FixedString length
-   * Attribute vector values     | uintX                               | Rows * width of attribute vector
+   * Dictionary Values*          | char array                          | Dictionary size * FixedString length
+   * Attribute vector values*    | uintX                               | Rows * width of attribute vector
    *
    * Please note that the number of rows are written in the header of the chunk.
    * The type of the column can be found in the global header of the file.
+   *
+   * *: These fields are page-aligned in files with the indexed layout (see write())
    */
   template <typename T>
   static void _write_segment(const FixedStringDictionarySegment<T>& fixed_string_dictionary_segment,
-                             std::ofstream& ofstream);
+                             std::ostream& ostream, const BinaryFileLayout layout);
 
   /**
    * RunLengthSegments are dumped with the following layout:
@@ -148,7 +177,8 @@ class BinaryWriter {
    * The type of the column can be found in the global header of the file.
    */
   template <typename T>
-  static void _write_segment(const RunLengthSegment<T>& run_length_segment, std::ofstream& ofstream);
+  static void _write_segment(const RunLengthSegment<T>& run_length_segment, std::ostream& ostream,
+                             const BinaryFileLayout layout);
 
   /**
    * FrameOfReferenceSegments are dumped with the following layout:
@@ -162,14 +192,20 @@ class BinaryWriter {
    * Stores NULL values          | bool (stored as BoolAsByteType)     | 1
    * NULL values¹                | vector<bool> (BoolAsByteType)       | size * 1
    * Offset values               | uint32_t                            | size * 4
+   * Stores high offset values²  | bool (stored as BoolAsByteType)     | 1
+   * Width of high offset vector³| AttributeVectorWidth                | 1
+   * High offset values³         | uint32_t                            | size * 4
    *
    * Please note that the number of rows are written in the header of the chunk.
    * The type of the column can be found in the global header of the file.
    *
    * ¹: This field is only written when the optional NULL values are stored
+   * ²: This field is only written for int64_t segments, as the offsets of int32_t segments always fit into 32 bits
+   * ³: These fields are only written when the optional high offset values are stored
    */
   template <typename T>
-  static void _write_segment(const FrameOfReferenceSegment<T>& frame_of_reference_segment, std::ofstream& ofstream);
+  static void _write_segment(const FrameOfReferenceSegment<T>& frame_of_reference_segment, std::ostream& ostream,
+                             const BinaryFileLayout layout);
 
   /**
    * LZ4Segments are dumped with the following layout:
@@ -198,14 +234,70 @@ class BinaryWriter {
    * ²: These fields are only written if string offset size is not 0
    */
   template <typename T>
-  static void _write_segment(const LZ4Segment<T>& lz4_segment, std::ofstream& ofstream);
+  static void _write_segment(const LZ4Segment<T>& lz4_segment, std::ostream& ostream,
+                             const BinaryFileLayout layout);
+
+  /**
+   * FSSTSegments are dumped with the following layout:
+   *
+   * Description                 | Type                                | Size in bytes
+   * --------------------------------------------------------------------------------------------------------
+   * Encoding Type               | EncodingType                        | 1
+   * Width of offset vector      | AttributeVectorWidth                | 1
+   * Number of symbols           | uint32_t                            | 4
+   * Symbol lengths              | size_t                              | Number of symbols * 8
+   * Symbols                     | char array                          | Sum(symbol lengths)
+   * Compressed values' size     | uint32_t                            | 4
+   * Compressed values           | char array                          | Compressed values' size
+   * Stores NULL values          | bool (stored as BoolAsByteType)     | 1
+   * NULL values¹                | vector<bool> (BoolAsByteType)       | Rows * 1
+   * Offsets                     | uintX                               | Rows * width of offset vector
+   *
+   * Please note that the number of rows are written in the header of the chunk.
+   * The type of the column can be found in the global header of the file.
+   *
+   * ¹: This field is only written when the optional NULL values are stored
+   */
+  template <typename T>
+  static void _write_segment(const FSSTSegment<T>& fsst_segment, std::ostream& ostream,
+                             const BinaryFileLayout layout);
+
+  /**
+   * ALPSegments are dumped with the following layout:
+   *
+   * Description                 | Type                                | Size in bytes
+   * --------------------------------------------------------------------------------------------------------
+   * Encoding Type               | EncodingType                        | 1
+   * Width of offset vector      | AttributeVectorWidth                | 1
+   * Number of Blocks            | uint32_t                            | 4
+   * Block minima                | int64_t                             | Number of blocks * 8
+   * Block first exceptions      | uint32_t                            | Number of blocks * 4
+   * Block exponents             | uint8_t                             | Number of blocks * 1
+   * Block factors               | uint8_t                             | Number of blocks * 1
+   * Number of exceptions        | uint32_t                            | 4
+   * Exception chunk offsets     | ChunkOffset                         | Number of exceptions * 4
+   * Exception values            | T                                   | Number of exceptions * sizeof(T)
+   * Stores NULL values          | bool (stored as BoolAsByteType)     | 1
+   * NULL values¹                | vector<bool> (BoolAsByteType)       | size * 1
+   * Offset values               | uintX                               | size * width of offset vector
+   *
+   * Please note that the number of rows are written in the header of the chunk.
+   * The type of the column can be found in the global header of the file.
+   *
+   * ¹: This field is only written when the optional NULL values are stored
+   */
+  template <typename T>
+  static void _write_segment(const ALPSegment<T>& alp_segment, std::ostream& ostream, const BinaryFileLayout layout);
 
   template <typename T>
   static uint32_t _compressed_vector_width(const AbstractEncodedSegment& abstract_encoded_segment);
 
+  static uint32_t _compressed_vector_width(const CompressedVectorType type);
+
   // Chooses the right Compressed Vector depending on the CompressedVectorType and exports it.
-  static void _export_compressed_vector(std::ofstream& ofstream, const CompressedVectorType type,
-                                        const BaseCompressedVector& compressed_vector);
+  static void _export_compressed_vector(std::ostream& ostream, const CompressedVectorType type,
+                                        const BaseCompressedVector& compressed_vector,
+                                        const BinaryFileLayout layout = BinaryFileLayout::Sequential);
 
   template <typename T>
   static size_t _size(const T& object);
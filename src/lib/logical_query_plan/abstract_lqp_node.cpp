@@ -1,6 +1,7 @@
 #include "abstract_lqp_node.hpp"
 
 #include <algorithm>
+#include <mutex>
 #include <unordered_map>
 
 #include "boost/functional/hash.hpp"
@@ -156,12 +157,11 @@ LQPInputSide AbstractLQPNode::get_input_side(const std::shared_ptr<AbstractLQPNo
 }
 
 std::vector<LQPInputSide> AbstractLQPNode::get_input_sides() const {
+  const auto outputs = this->outputs();
   std::vector<LQPInputSide> input_sides;
-  input_sides.reserve(_outputs.size());
+  input_sides.reserve(outputs.size());
 
-  for (const auto& output_weak_ptr : _outputs) {
-    const auto output = output_weak_ptr.lock();
-    DebugAssert(output, "Failed to lock output");
+  for (const auto& output : outputs) {
     input_sides.emplace_back(get_input_side(output));
   }
 
@@ -169,6 +169,7 @@ std::vector<LQPInputSide> AbstractLQPNode::get_input_sides() const {
 }
 
 std::vector<std::shared_ptr<AbstractLQPNode>> AbstractLQPNode::outputs() const {
+  auto lock = std::lock_guard<std::mutex>{_outputs_mutex};
   std::vector<std::shared_ptr<AbstractLQPNode>> outputs;
   outputs.reserve(_outputs.size());
 
@@ -211,7 +212,10 @@ std::vector<LQPOutputRelation> AbstractLQPNode::output_relations() const {
   return output_relations;
 }
 
-size_t AbstractLQPNode::output_count() const { return _outputs.size(); }
+size_t AbstractLQPNode::output_count() const {
+  auto lock = std::lock_guard<std::mutex>{_outputs_mutex};
+  return _outputs.size();
+}
 
 std::shared_ptr<AbstractLQPNode> AbstractLQPNode::deep_copy(LQPNodeMapping input_node_mapping) const {
   return _deep_copy_impl(input_node_mapping);
@@ -362,6 +366,10 @@ std::shared_ptr<AbstractLQPNode> AbstractLQPNode::_shallow_copy(LQPNodeMapping&
 }
 
 void AbstractLQPNode::_remove_output_pointer(const AbstractLQPNode& output) {
+  // Releasing the last reference to an output calls back into this function. Thus, the outputs locked during the
+  // search are only released after _outputs_mutex.
+  auto locked_outputs = std::vector<std::shared_ptr<AbstractLQPNode>>{};
+  auto lock = std::lock_guard<std::mutex>{_outputs_mutex};
   const auto iter = std::find_if(_outputs.begin(), _outputs.end(), [&](const auto& other) {
     /**
      * HACK!
@@ -376,7 +384,8 @@ void AbstractLQPNode::_remove_output_pointer(const AbstractLQPNode& output) {
      * node_b.reset(); // node_b::~AbstractLQPNode() will call `node_a.remove_output_pointer(node_b)`
      *                 // But we can't lock node_b anymore, since its ref count is already 0
      */
-    return &output == other.lock().get() || other.expired();
+    const auto& other_output = locked_outputs.emplace_back(other.lock());
+    return &output == other_output.get() || !other_output;
   });
   DebugAssert(iter != _outputs.end(), "Specified output node is not actually a output node of this node.");
 
@@ -389,6 +398,7 @@ void AbstractLQPNode::_remove_output_pointer(const AbstractLQPNode& output) {
 
 void AbstractLQPNode::_add_output_pointer(const std::shared_ptr<AbstractLQPNode>& output) {
   // Having the same output multiple times is allowed, e.g. for self joins
+  auto lock = std::lock_guard<std::mutex>{_outputs_mutex};
   _outputs.emplace_back(output);
 }
 
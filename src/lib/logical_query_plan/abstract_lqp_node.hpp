@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -235,12 +236,14 @@ class AbstractLQPNode : public std::enable_shared_from_this<AbstractLQPNode> {
    * @{
    * For internal usage in set_left_input(), set_right_input(), set_input(), remove_output()
    * Add or remove a output without manipulating this output's input ptr.
+   * Both are guarded by _outputs_mutex, as parallel join enumeration concurrently builds plans that share subplans.
    */
   void _add_output_pointer(const std::shared_ptr<AbstractLQPNode>& output);
   void _remove_output_pointer(const AbstractLQPNode& output);
   /** @} */
 
   std::vector<std::weak_ptr<AbstractLQPNode>> _outputs;
+  mutable std::mutex _outputs_mutex;
   std::array<std::shared_ptr<AbstractLQPNode>, 2> _inputs;
 };
 
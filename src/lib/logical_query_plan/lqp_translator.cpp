@@ -1,16 +1,15 @@
 #include "lqp_translator.hpp"
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
-#include <boost/hana/for_each.hpp>
-#include <boost/hana/tuple.hpp>
-
 #include "abstract_lqp_node.hpp"
 #include "aggregate_node.hpp"
 #include "alias_node.hpp"
 #include "change_meta_table_node.hpp"
+#include "cost_estimation/join_cost_model.hpp"
 #include "create_prepared_plan_node.hpp"
 #include "create_table_node.hpp"
 #include "create_view_node.hpp"
@@ -33,6 +32,7 @@
 #include "intersect_node.hpp"
 #include "join_node.hpp"
 #include "limit_node.hpp"
+#include "lqp_utils.hpp"
 #include "operators/aggregate_hash.hpp"
 #include "operators/alias_operator.hpp"
 #include "operators/change_meta_table.hpp"
@@ -43,6 +43,7 @@
 #include "operators/index_scan.hpp"
 #include "operators/insert.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/join_index.hpp"
 #include "operators/join_nested_loop.hpp"
 #include "operators/join_sort_merge.hpp"
 #include "operators/limit.hpp"
@@ -58,6 +59,7 @@
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
 #include "operators/union_all.hpp"
 #include "operators/union_positions.hpp"
 #include "operators/update.hpp"
@@ -66,12 +68,89 @@
 #include "projection_node.hpp"
 #include "sort_node.hpp"
 #include "static_table_node.hpp"
+#include "statistics/cardinality_estimator.hpp"
 #include "stored_table_node.hpp"
 #include "union_node.hpp"
 #include "update_node.hpp"
 
 using namespace std::string_literals;  // NOLINT
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Whether the statistics required to estimate the cardinality of @param lqp are available
+bool statistics_available(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  auto available = true;
+  visit_lqp(lqp, [&](const auto& node) {
+    if (node->type == LQPNodeType::StoredTable) {
+      const auto& table_name = static_cast<const StoredTableNode&>(*node).table_name;
+      available &= Hyrise::get().storage_manager.get_table(table_name)->table_statistics() != nullptr;
+    } else if (node->type == LQPNodeType::StaticTable) {
+      available &= static_cast<const StaticTableNode&>(*node).table->table_statistics() != nullptr;
+    } else if (node->type == LQPNodeType::Mock) {
+      available = false;
+    }
+    return available ? LQPVisitation::VisitInputs : LQPVisitation::DoNotVisitInputs;
+  });
+  return available;
+}
+
+// Whether @param node is a SortNode that sorts ascendingly by @param column_expression first
+bool sorted_by_column(const std::shared_ptr<AbstractLQPNode>& node, const AbstractExpression& column_expression) {
+  if (node->type != LQPNodeType::Sort) return false;
+
+  const auto& sort_node = static_cast<const SortNode&>(*node);
+  return *sort_node.node_expressions.front() == column_expression &&
+         sort_node.sort_modes.front() == SortMode::Ascending;
+}
+
+/**
+ * @return the number of chunks that a JoinIndex on @param column_expression has to probe, if @param node is a
+ *         StoredTableNode (possibly below ValidateNodes and PredicateNodes) whose non-pruned chunks all have an index
+ *         on the column. std::nullopt otherwise.
+ */
+std::optional<size_t> indexed_chunk_count(std::shared_ptr<AbstractLQPNode> node,
+                                          const AbstractExpression& column_expression) {
+  while (node->type == LQPNodeType::Validate || node->type == LQPNodeType::Predicate) {
+    node = node->left_input();
+  }
+  if (node->type != LQPNodeType::StoredTable) return std::nullopt;
+
+  const auto lqp_column_expression = dynamic_cast<const LQPColumnExpression*>(&column_expression);
+  if (!lqp_column_expression || lqp_column_expression->original_node.lock() != node) return std::nullopt;
+
+  const auto& stored_table_node = static_cast<const StoredTableNode&>(*node);
+  const auto& pruned_chunk_ids = stored_table_node.pruned_chunk_ids();
+  const auto table = Hyrise::get().storage_manager.get_table(stored_table_node.table_name);
+  const auto column_ids = std::vector<ColumnID>{lqp_column_expression->original_column_id};
+
+  auto chunk_count = size_t{0};
+  auto pruned_chunk_ids_iter = pruned_chunk_ids.cbegin();
+
+  const auto table_chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < table_chunk_count; ++chunk_id) {
+    if (pruned_chunk_ids_iter != pruned_chunk_ids.cend() && chunk_id == *pruned_chunk_ids_iter) {
+      ++pruned_chunk_ids_iter;
+      continue;
+    }
+
+    const auto chunk = table->get_chunk(chunk_id);
+    if (!chunk) continue;
+    if (chunk->get_indexes(column_ids).empty()) return std::nullopt;
+    ++chunk_count;
+  }
+
+  return chunk_count;
+}
+
+// GetTable outputs the stored data table, the operators above it output reference tables
+TableType output_table_type(const std::shared_ptr<AbstractLQPNode>& node) {
+  return node->type == LQPNodeType::StoredTable ? TableType::Data : TableType::References;
+}
+
+}  // namespace
+
 namespace opossum {
 
 std::shared_ptr<AbstractOperator> LQPTranslator::translate_node(const std::shared_ptr<AbstractLQPNode>& node) const {
@@ -289,11 +368,14 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_sort_node(
   const auto sort_node = std::dynamic_pointer_cast<SortNode>(node);
   auto input_operator = translate_node(node->left_input());
 
-  std::shared_ptr<AbstractOperator> current_pqp = input_operator;
-  const auto& pqp_expressions = _translate_expressions(sort_node->node_expressions, node->left_input());
+  return std::make_shared<Sort>(input_operator, _translate_sort_column_definitions(*sort_node));
+}
+
+std::vector<SortColumnDefinition> LQPTranslator::_translate_sort_column_definitions(const SortNode& sort_node) const {
+  const auto& pqp_expressions = _translate_expressions(sort_node.node_expressions, sort_node.left_input());
 
   auto pqp_expression_iter = pqp_expressions.begin();
-  auto sort_mode_iter = sort_node->sort_modes.begin();
+  auto sort_mode_iter = sort_node.sort_modes.begin();
 
   std::vector<SortColumnDefinition> column_definitions;
   column_definitions.reserve(pqp_expressions.size());
@@ -305,9 +387,8 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_sort_node(
 
     column_definitions.emplace_back(SortColumnDefinition{pqp_column_expression->column_id, *sort_mode_iter});
   }
-  current_pqp = std::make_shared<Sort>(current_pqp, column_definitions);
 
-  return current_pqp;
+  return column_definitions;
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
@@ -339,28 +420,112 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
   const auto& primary_join_predicate = join_predicates.front();
   std::vector<OperatorJoinPredicate> secondary_join_predicates(join_predicates.cbegin() + 1, join_predicates.cend());
 
-  auto join_operator = std::shared_ptr<AbstractOperator>{};
-
   const auto left_data_type = join_node->join_predicates().front()->arguments[0]->data_type();
   const auto right_data_type = join_node->join_predicates().front()->arguments[1]->data_type();
 
-  // Lacking a proper cost model, we assume JoinHash is always faster than JoinSortMerge, which is faster than
-  // JoinNestedLoop and thus check for an operator compatible with the JoinNode in that order
-  constexpr auto JOIN_OPERATOR_PREFERENCE_ORDER =
-      hana::to_tuple(hana::tuple_t<JoinHash, JoinSortMerge, JoinNestedLoop>);
+  auto join_configuration = JoinConfiguration{join_node->join_mode, primary_join_predicate.predicate_condition,
+                                              left_data_type, right_data_type, !secondary_join_predicates.empty()};
 
-  boost::hana::for_each(JOIN_OPERATOR_PREFERENCE_ORDER, [&](const auto join_operator_t) {
-    using JoinOperator = typename decltype(join_operator_t)::type;
+  /**
+   * Choose the join implementation with the lowest cost according to the JoinCostModel. If the cardinalities of the
+   * inputs cannot be estimated because statistics are missing, JoinHash is preferred over JoinSortMerge. JoinNestedLoop
+   * is only used if no other implementation supports the JoinNode.
+   */
+  const auto use_cost_model = statistics_available(node);
+  const auto& join_cost_model = *Hyrise::get().join_cost_model;
+
+  const auto left_column_expression =
+      node->left_input()->output_expressions().at(primary_join_predicate.column_ids.first);
+  const auto right_column_expression =
+      node->right_input()->output_expressions().at(primary_join_predicate.column_ids.second);
+
+  auto join_properties = JoinCostModel::JoinProperties{};
+  if (use_cost_model) {
+    // The LQP is not modified during the translation, so that the estimated cardinalities can be cached
+    if (!_cardinality_estimator) {
+      _cardinality_estimator = std::make_shared<CardinalityEstimator>();
+      _cardinality_estimator->guarantee_bottom_up_construction();
+    }
 
-    if (join_operator) return;
+    join_properties.left_row_count = _cardinality_estimator->estimate_cardinality(node->left_input());
+    join_properties.right_row_count = _cardinality_estimator->estimate_cardinality(node->right_input());
+    join_properties.output_row_count = _cardinality_estimator->estimate_cardinality(node);
+    join_properties.left_input_sorted = sorted_by_column(node->left_input(), *left_column_expression);
+    join_properties.right_input_sorted = sorted_by_column(node->right_input(), *right_column_expression);
+  }
+
+  auto join_type = std::optional<OperatorType>{};
+  auto join_cost = Cost{0};
+  auto index_side = IndexSide::Right;
 
-    if (JoinOperator::supports({join_node->join_mode, primary_join_predicate.predicate_condition, left_data_type,
-                                right_data_type, !secondary_join_predicates.empty()})) {
-      join_operator = std::make_shared<JoinOperator>(left_input_operator, right_input_operator, join_node->join_mode,
-                                                     primary_join_predicate, std::move(secondary_join_predicates));
+  const auto consider_join_type = [&](const OperatorType candidate_join_type,
+                                      const JoinCostModel::JoinProperties& candidate_join_properties) {
+    if (!use_cost_model) {
+      if (!join_type) join_type = candidate_join_type;
+      return false;
     }
-  });
-  Assert(join_operator, "No operator implementation available for join '"s + join_node->description() + "'");
+
+    const auto candidate_join_cost = join_cost_model.estimate_cost(candidate_join_type, candidate_join_properties);
+    if (join_type && candidate_join_cost >= join_cost) return false;
+
+    join_type = candidate_join_type;
+    join_cost = candidate_join_cost;
+    return true;
+  };
+
+  if (JoinHash::supports(join_configuration)) consider_join_type(OperatorType::JoinHash, join_properties);
+  if (JoinSortMerge::supports(join_configuration)) consider_join_type(OperatorType::JoinSortMerge, join_properties);
+
+  // JoinIndex probes the index of each chunk of the index side. Thus, it requires that all chunks of the stored table
+  // on the index side have an index on the join column. The index is looked up with the values of the probe side,
+  // which therefore need to have the same data type.
+  if (use_cost_model && left_data_type == right_data_type) {
+    for (const auto candidate_index_side : {IndexSide::Left, IndexSide::Right}) {
+      const auto& index_input_node = candidate_index_side == IndexSide::Left ? node->left_input() : node->right_input();
+      const auto& index_column_expression =
+          candidate_index_side == IndexSide::Left ? left_column_expression : right_column_expression;
+
+      const auto index_chunk_count = indexed_chunk_count(index_input_node, *index_column_expression);
+      if (!index_chunk_count) continue;
+
+      join_configuration.left_table_type = output_table_type(node->left_input());
+      join_configuration.right_table_type = output_table_type(node->right_input());
+      join_configuration.index_side = candidate_index_side;
+      if (!JoinIndex::supports(join_configuration)) continue;
+
+      auto index_join_properties = join_properties;
+      index_join_properties.index_side = candidate_index_side;
+      index_join_properties.index_chunk_count = *index_chunk_count;
+      if (consider_join_type(OperatorType::JoinIndex, index_join_properties)) index_side = candidate_index_side;
+    }
+  }
+
+  if (!join_type && JoinNestedLoop::supports(join_configuration)) join_type = OperatorType::JoinNestedLoop;
+  Assert(join_type, "No operator implementation available for join '"s + join_node->description() + "'");
+
+  auto join_operator = std::shared_ptr<AbstractOperator>{};
+  switch (*join_type) {
+    case OperatorType::JoinHash:
+      join_operator = std::make_shared<JoinHash>(left_input_operator, right_input_operator, join_node->join_mode,
+                                                 primary_join_predicate, std::move(secondary_join_predicates));
+      break;
+    case OperatorType::JoinSortMerge:
+      join_operator = std::make_shared<JoinSortMerge>(left_input_operator, right_input_operator, join_node->join_mode,
+                                                      primary_join_predicate, std::move(secondary_join_predicates));
+      break;
+    case OperatorType::JoinIndex:
+      join_operator = std::make_shared<JoinIndex>(left_input_operator, right_input_operator, join_node->join_mode,
+                                                  primary_join_predicate, std::move(secondary_join_predicates),
+                                                  index_side);
+      break;
+    case OperatorType::JoinNestedLoop:
+      join_operator = std::make_shared<JoinNestedLoop>(left_input_operator, right_input_operator,
+                                                       join_node->join_mode, primary_join_predicate,
+                                                       std::move(secondary_join_predicates));
+      break;
+    default:
+      Fail("Unexpected join operator type");
+  }
 
   return join_operator;
 }
@@ -406,10 +571,20 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_limit_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
-  const auto input_operator = translate_node(node->left_input());
+  const auto input_node = node->left_input();
   auto limit_node = std::dynamic_pointer_cast<LimitNode>(node);
-  return std::make_shared<Limit>(
-      input_operator, _translate_expressions({limit_node->num_rows_expression()}, node->left_input()).front());
+  const auto row_count_expression =
+      _translate_expressions({limit_node->num_rows_expression()}, node->left_input()).front();
+
+  // ORDER BY ... LIMIT: If the Limit is the only consumer of the Sort, there is no need to sort the entire input.
+  // Instead, both nodes are translated into a single TopK operator.
+  if (input_node->type == LQPNodeType::Sort && input_node->output_count() == 1) {
+    const auto& sort_node = static_cast<const SortNode&>(*input_node);
+    return std::make_shared<TopK>(translate_node(sort_node.left_input()),
+                                  _translate_sort_column_definitions(sort_node), row_count_expression);
+  }
+
+  return std::make_shared<Limit>(translate_node(input_node), row_count_expression);
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_insert_node(
@@ -9,10 +9,12 @@
 
 namespace opossum {
 
+class AbstractCardinalityEstimator;
 class AbstractOperator;
 class TransactionContext;
 class AbstractExpression;
 class PredicateNode;
+class SortNode;
 class TableScan;
 struct OperatorScanPredicate;
 struct OperatorJoinPredicate;
@@ -40,6 +42,7 @@ class LQPTranslator {
   std::shared_ptr<AbstractOperator> _translate_alias_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_projection_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_sort_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+  std::vector<SortColumnDefinition> _translate_sort_column_definitions(const SortNode& sort_node) const;
   std::shared_ptr<AbstractOperator> _translate_join_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_aggregate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_limit_node(const std::shared_ptr<AbstractLQPNode>& node) const;
@@ -78,6 +81,9 @@ class LQPTranslator {
   //   - identical operators (operators below a diamond shape)
   //   - equal but not identical operators
   mutable LQPNodeUnorderedMap<std::shared_ptr<AbstractOperator>> _operator_by_lqp_node;
+
+  // Estimates the input and output cardinalities of JoinNodes to choose the join implementation, created on first use
+  mutable std::shared_ptr<AbstractCardinalityEstimator> _cardinality_estimator;
 };
 
 }  // namespace opossum
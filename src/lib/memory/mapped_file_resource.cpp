@@ -0,0 +1,113 @@
+#include "mapped_file_resource.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <string>
+
+namespace {
+
+size_t page_size() {
+  static const auto size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  return size;
+}
+
+size_t round_up_to_page_size(const size_t byte_count) {
+  return (byte_count + page_size() - 1) / page_size() * page_size();
+}
+
+}  // namespace
+
+namespace opossum {
+
+MappedFileResource* MappedFileResource::create(const std::string& filename) { return new MappedFileResource(filename); }
+
+MappedFileResource::MappedFileResource(const std::string& filename) {
+  _file_descriptor = ::open(filename.c_str(), O_RDONLY);
+  Assert(_file_descriptor >= 0, "Cannot open " + filename + ": " + std::strerror(errno));
+
+  struct stat file_status {};
+  Assert(::fstat(_file_descriptor, &file_status) == 0, "Cannot determine the size of " + filename);
+  _size = static_cast<size_t>(file_status.st_size);
+  Assert(_size > 0, "Cannot map empty file " + filename);
+
+  // The mapping is writable, as the containers using it are. As it is private, the file is never modified.
+  const auto mapping = ::mmap(nullptr, _size, PROT_READ | PROT_WRITE, MAP_PRIVATE, _file_descriptor, 0);
+  Assert(mapping != MAP_FAILED, "Cannot map " + filename + ": " + std::strerror(errno));
+  _data = static_cast<char*>(mapping);
+}
+
+MappedFileResource::~MappedFileResource() {
+  ::munmap(_data, _size);
+  ::close(_file_descriptor);
+}
+
+void MappedFileResource::release() { _remove_reference(); }
+
+const char* MappedFileResource::data() const { return _data; }
+
+size_t MappedFileResource::size() const { return _size; }
+
+bool MappedFileResource::is_page_aligned(const size_t offset) { return offset % page_size() == 0; }
+
+void* MappedFileResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+  ++_reference_count;
+
+  {
+    // Allocations from other threads wait until a concurrent map_values() has taken its pending allocation
+    const auto lock = std::lock_guard<std::recursive_mutex>{_mutex};
+    if (_pending_allocation && bytes == _pending_allocation_size) {
+      const auto pointer = _pending_allocation;
+      _pending_allocation = nullptr;
+      return pointer;
+    }
+  }
+
+  return boost::container::pmr::get_default_resource()->allocate(bytes, alignment);
+}
+
+void MappedFileResource::do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) {
+  const auto* address = static_cast<const char*>(pointer);
+  if (address < _data || address >= _data + _size) {
+    boost::container::pmr::get_default_resource()->deallocate(pointer, bytes, alignment);
+  }
+
+  _remove_reference();
+}
+
+bool MappedFileResource::do_is_equal(const memory_resource& other) const noexcept { return &other == this; }
+
+void MappedFileResource::_prepare_mapped_allocation(const size_t offset, const size_t byte_count) {
+  DebugAssert(is_page_aligned(offset), "Only page-aligned ranges can be mapped");
+
+  // The vector will overwrite the range with zeros. Writing to the file pages would copy them, so we replace them by
+  // anonymous pages first. The last page might also contain other data, which is read concurrently. It is copied
+  // instead, which keeps that data intact.
+  const auto full_page_bytes = byte_count / page_size() * page_size();
+  if (full_page_bytes > 0) {
+    const auto mapping = ::mmap(_data + offset, full_page_bytes, PROT_READ | PROT_WRITE,
+                                MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0);
+    Assert(mapping != MAP_FAILED, "Cannot replace file pages: " + std::string{std::strerror(errno)});
+  }
+
+  _pending_allocation = _data + offset;
+  _pending_allocation_size = byte_count;
+}
+
+void MappedFileResource::_restore_file_pages(const size_t offset, const size_t byte_count) {
+  Assert(!_pending_allocation, "Mapped range was not allocated");
+
+  const auto mapping = ::mmap(_data + offset, round_up_to_page_size(byte_count), PROT_READ | PROT_WRITE,
+                              MAP_PRIVATE | MAP_FIXED, _file_descriptor, static_cast<off_t>(offset));
+  Assert(mapping != MAP_FAILED, "Cannot map file pages: " + std::string{std::strerror(errno)});
+}
+
+void MappedFileResource::_remove_reference() {
+  if (--_reference_count == 0) delete this;
+}
+
+}  // namespace opossum
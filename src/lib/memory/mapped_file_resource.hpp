@@ -0,0 +1,81 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <string>
+
+#include <boost/container/pmr/memory_resource.hpp>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * Memory resource backed by a private, copy-on-write mapping of a file. It allows containers to directly use the
+ * pages of the file instead of copying its contents into freshly allocated memory. This makes loading large files
+ * almost free and lets processes that map the same file share its pages through the OS page cache.
+ *
+ * map_values() creates a pmr_vector whose data is the given page-aligned range of the file. As std::vector
+ * value-initializes its elements, the pages of the range are temporarily replaced while the vector is constructed.
+ * Afterwards, the file pages are mapped at the same address again. All other allocations are forwarded
+ * to the default resource.
+ *
+ * The resource is reference-counted: It is created with one reference, which is dropped by release(), and each
+ * allocation holds another one. Once all references are gone, the file is unmapped and the resource deletes itself.
+ * Thus, it can be passed to long-living segments without anyone having to track their lifetime.
+ *
+ * map_values() can be called concurrently, e.g., by JobTasks that read different parts of the file.
+ */
+class MappedFileResource : public boost::container::pmr::memory_resource, private Noncopyable {
+ public:
+  static MappedFileResource* create(const std::string& filename);
+
+  void release();
+
+  const char* data() const;
+  size_t size() const;
+
+  // Returns whether the given offset of the file can be mapped to a memory address (see map_values()).
+  static bool is_page_aligned(const size_t offset);
+
+  template <typename T>
+  pmr_vector<T> map_values(const size_t offset, const size_t count) {
+    const auto byte_count = count * sizeof(T);
+    DebugAssert(count > 0 && offset + byte_count <= _size, "Cannot map values outside of the file");
+
+    const auto lock = std::lock_guard<std::recursive_mutex>{_mutex};
+    _prepare_mapped_allocation(offset, byte_count);
+    auto values = pmr_vector<T>(count, PolymorphicAllocator<T>{this});
+    _restore_file_pages(offset, byte_count);
+
+    return values;
+  }
+
+ protected:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override;
+  bool do_is_equal(const memory_resource& other) const noexcept override;
+
+ private:
+  explicit MappedFileResource(const std::string& filename);
+  ~MappedFileResource() override;
+
+  void _prepare_mapped_allocation(const size_t offset, const size_t byte_count);
+  void _restore_file_pages(const size_t offset, const size_t byte_count);
+  void _remove_reference();
+
+  int _file_descriptor;
+  char* _data;
+  size_t _size;
+
+  // Address and size that the next allocation returns, set by map_values() while holding _mutex. As map_values()
+  // allocates while holding the mutex, and do_allocate() reads them under the mutex as well, it is recursive.
+  char* _pending_allocation{nullptr};
+  size_t _pending_allocation_size{0};
+  std::recursive_mutex _mutex;
+
+  std::atomic<size_t> _reference_count{1};
+};
+
+}  // namespace opossum
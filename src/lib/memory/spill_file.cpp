@@ -0,0 +1,49 @@
+#include "spill_file.hpp"
+
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <string>
+
+namespace opossum {
+
+SpillFile::SpillFile() {
+  auto path = (std::filesystem::temp_directory_path() / "hyrise_spill_XXXXXX").string();
+  _file_descriptor = ::mkstemp(path.data());
+  Assert(_file_descriptor >= 0, "Cannot create spill file " + path + ": " + std::strerror(errno));
+  ::unlink(path.c_str());
+}
+
+SpillFile::~SpillFile() { ::close(_file_descriptor); }
+
+SpillFile::Range SpillFile::append(const char* data, const size_t size) {
+  // Reserving the range first allows multiple threads to write at the same time.
+  const auto begin = _size.fetch_add(size);
+
+  auto written_bytes = size_t{0};
+  while (written_bytes < size) {
+    const auto result = ::pwrite(_file_descriptor, data + written_bytes, size - written_bytes,
+                                 static_cast<off_t>(begin + written_bytes));
+    Assert(result > 0, "Cannot write to spill file: " + std::string{std::strerror(errno)});
+    written_bytes += static_cast<size_t>(result);
+  }
+
+  return {begin, begin + size};
+}
+
+void SpillFile::read(const size_t offset, char* data, const size_t size) const {
+  auto read_bytes = size_t{0};
+  while (read_bytes < size) {
+    const auto result =
+        ::pread(_file_descriptor, data + read_bytes, size - read_bytes, static_cast<off_t>(offset + read_bytes));
+    Assert(result > 0, "Cannot read from spill file: " + std::string{std::strerror(errno)});
+    read_bytes += static_cast<size_t>(result);
+  }
+}
+
+size_t SpillFile::size() const { return _size; }
+
+}  // namespace opossum
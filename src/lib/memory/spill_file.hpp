@@ -0,0 +1,216 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <optional>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * Temporary file that operators use to spill intermediate results to disk if they would otherwise exceed their memory
+ * budget (see MemoryBudgetSetting). The file is created in std::filesystem::temp_directory_path(), which can be set
+ * using the TMPDIR environment variable. It is unlinked right away, so that it disappears when the SpillFile is
+ * destroyed or the process terminates.
+ *
+ * Data is appended in blocks. SpillWriter and SpillReader (de)serialize values into and from these blocks.
+ */
+class SpillFile : private Noncopyable {
+ public:
+  // Begin and end offset of a part of the file
+  using Range = std::pair<size_t, size_t>;
+
+  SpillFile();
+  ~SpillFile();
+
+  // Appends the bytes and returns the range they were written to. Can be called concurrently.
+  Range append(const char* data, const size_t size);
+
+  // Reads size bytes starting at offset. Can be called concurrently.
+  void read(const size_t offset, char* data, const size_t size) const;
+
+  size_t size() const;
+
+ private:
+  int _file_descriptor;
+  std::atomic<size_t> _size{0};
+};
+
+/**
+ * Serializes values into a buffer, which is appended to a SpillFile once it grows larger than BUFFER_SIZE or the
+ * writer is finished. Supported are trivially copyable types, strings, and std::optional, std::vector, and std::set
+ * of those. Values are read back in the same order using a SpillReader.
+ *
+ * All values that a writer wrote are stored in a single range of the file as long as no other writer appends to the
+ * same file in the meantime. When multiple threads spill into the same file, each of them can write a block using
+ * write_block(), which is appended in one piece.
+ */
+class SpillWriter : private Noncopyable {
+ public:
+  static constexpr auto BUFFER_SIZE = size_t{1} << 20;
+
+  explicit SpillWriter(SpillFile& file) : _file(file), _begin(file.size()) {}
+
+  template <typename T>
+  void write(const T& value) {
+    if constexpr (std::is_same_v<T, pmr_string> || std::is_same_v<T, std::string>) {
+      write(value.size());
+      _write_bytes(value.data(), value.size());
+    } else if constexpr (IsOptional<T>::value) {
+      write(value.has_value());
+      if (value) write(*value);
+    } else if constexpr (IsContainer<T>::value) {
+      write(value.size());
+      for (const auto& element : value) {
+        write(element);
+      }
+    } else {
+      static_assert(std::is_trivially_copyable_v<T>, "Cannot spill values of this type");
+      _write_bytes(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    if (_buffer.size() >= BUFFER_SIZE) _flush();
+  }
+
+  // Appends the remaining buffer to the file and returns the range of everything written by this writer.
+  SpillFile::Range finish() {
+    _flush();
+    return {_begin, _file.size()};
+  }
+
+  // Appends a block of values written by write_values, which is called with the writer, in one piece. Other threads
+  // can concurrently write blocks into the same file.
+  template <typename Functor>
+  static SpillFile::Range write_block(SpillFile& file, const Functor& write_values) {
+    auto block_writer = SpillWriter{file};
+    block_writer._flush_to_file = false;
+    write_values(block_writer);
+    return file.append(block_writer._buffer.data(), block_writer._buffer.size());
+  }
+
+ private:
+  template <typename T>
+  struct IsOptional : std::false_type {};
+  template <typename T>
+  struct IsOptional<std::optional<T>> : std::true_type {};
+
+  template <typename T>
+  struct IsContainer : std::false_type {};
+  template <typename T, typename Allocator>
+  struct IsContainer<std::vector<T, Allocator>> : std::true_type {};
+  template <typename T, typename Compare, typename Allocator>
+  struct IsContainer<std::set<T, Compare, Allocator>> : std::true_type {};
+
+  void _write_bytes(const char* data, const size_t size) { _buffer.insert(_buffer.end(), data, data + size); }
+
+  void _flush() {
+    if (!_flush_to_file || _buffer.empty()) return;
+    _file.append(_buffer.data(), _buffer.size());
+    _buffer.clear();
+  }
+
+  SpillFile& _file;
+  const size_t _begin;
+  bool _flush_to_file{true};
+  std::vector<char> _buffer;
+};
+
+/**
+ * Reads the values of a range of a SpillFile in the order in which they were written by a SpillWriter. The range is
+ * read in pieces of up to BUFFER_SIZE bytes.
+ */
+class SpillReader : private Noncopyable {
+ public:
+  static constexpr auto BUFFER_SIZE = size_t{1} << 20;
+
+  SpillReader(const SpillFile& file, const SpillFile::Range& range)
+      : _file(file), _position(range.first), _end(range.second) {}
+
+  bool at_end() const { return _position == _end && _buffer_position == _buffer.size(); }
+
+  template <typename T>
+  T read() {
+    auto value = T{};
+    read(value);
+    return value;
+  }
+
+  template <typename T>
+  void read(T& value) {
+    if constexpr (std::is_same_v<T, pmr_string> || std::is_same_v<T, std::string>) {
+      value.resize(read<size_t>());
+      _read_bytes(value.data(), value.size());
+    } else if constexpr (IsOptional<T>::value) {
+      if (read<bool>()) {
+        value = read<typename T::value_type>();
+      } else {
+        value.reset();
+      }
+    } else if constexpr (IsVector<T>::value) {
+      value.resize(read<size_t>());
+      // Index-based, as the elements of std::vector<bool> cannot be bound to references
+      for (auto index = size_t{0}; index < value.size(); ++index) {
+        value[index] = read<typename T::value_type>();
+      }
+    } else if constexpr (IsSet<T>::value) {
+      value.clear();
+      const auto size = read<size_t>();
+      for (auto index = size_t{0}; index < size; ++index) {
+        value.emplace_hint(value.end(), read<typename T::value_type>());
+      }
+    } else {
+      static_assert(std::is_trivially_copyable_v<T>, "Cannot read spilled values of this type");
+      _read_bytes(reinterpret_cast<char*>(&value), sizeof(T));
+    }
+  }
+
+ private:
+  template <typename T>
+  struct IsOptional : std::false_type {};
+  template <typename T>
+  struct IsOptional<std::optional<T>> : std::true_type {};
+
+  template <typename T>
+  struct IsVector : std::false_type {};
+  template <typename T, typename Allocator>
+  struct IsVector<std::vector<T, Allocator>> : std::true_type {};
+
+  template <typename T>
+  struct IsSet : std::false_type {};
+  template <typename T, typename Compare, typename Allocator>
+  struct IsSet<std::set<T, Compare, Allocator>> : std::true_type {};
+
+  void _read_bytes(char* data, size_t size) {
+    while (size > 0) {
+      if (_buffer_position == _buffer.size()) {
+        Assert(_position < _end, "Tried to read beyond the end of the spilled range");
+        _buffer.resize(std::min(BUFFER_SIZE, _end - _position));
+        _file.read(_position, _buffer.data(), _buffer.size());
+        _position += _buffer.size();
+        _buffer_position = 0;
+      }
+
+      const auto byte_count = std::min(size, _buffer.size() - _buffer_position);
+      std::memcpy(data, _buffer.data() + _buffer_position, byte_count);
+      _buffer_position += byte_count;
+      data += byte_count;
+      size -= byte_count;
+    }
+  }
+
+  const SpillFile& _file;
+  size_t _position;
+  const size_t _end;
+  std::vector<char> _buffer;
+  size_t _buffer_position{0};
+};
+
+}  // namespace opossum
@@ -1,9 +1,12 @@
 #include "aggregate_hash.hpp"
 
+#include <atomic>
 #include <cmath>
+#include <iterator>
 #include <memory>
 #include <optional>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -15,6 +18,7 @@
 #include "constant_mappings.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "hyrise.hpp"
+#include "memory/spill_file.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
@@ -23,6 +27,7 @@
 #include "utils/aligned_size.hpp"
 #include "utils/assert.hpp"
 #include "utils/performance_warning.hpp"
+#include "utils/settings/memory_budget_setting.hpp"
 #include "utils/timer.hpp"
 
 namespace {
@@ -75,6 +80,81 @@ const AggregateKey& get_aggregate_key([[maybe_unused]] const KeysPerChunk<Aggreg
   }
 }
 
+// Merges a partial result of a group, which was computed for a subset of the input rows, into the result of the same
+// group. Used by AggregateHash::_aggregate_chunks_in_parallel().
+template <typename ColumnDataType, typename AggregateType, AggregateFunction function>
+void merge_aggregate_results(AggregateResult<ColumnDataType, AggregateType>& result,
+                             const AggregateResult<ColumnDataType, AggregateType>& partial_result) {
+  result.aggregate_count += partial_result.aggregate_count;
+
+  if constexpr (function == AggregateFunction::StandardDeviationSample) {
+    if constexpr (std::is_arithmetic_v<AggregateType>) {
+      // Combines the count, mean, and squared_distance_from_mean of Welford's algorithm (see AggregateFunctionBuilder)
+      // https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Parallel_algorithm
+      const auto& partial_secondary_aggregates = partial_result.current_secondary_aggregates;
+      if (partial_secondary_aggregates.empty()) return;
+
+      auto& secondary_aggregates = result.current_secondary_aggregates;
+      if (secondary_aggregates.empty()) {
+        secondary_aggregates = partial_secondary_aggregates;
+        result.current_primary_aggregate = partial_result.current_primary_aggregate;
+        return;
+      }
+
+      const auto count = secondary_aggregates[0] + partial_secondary_aggregates[0];
+      const auto delta = partial_secondary_aggregates[1] - secondary_aggregates[1];
+      secondary_aggregates[1] += delta * partial_secondary_aggregates[0] / count;
+      secondary_aggregates[2] += partial_secondary_aggregates[2] +
+                                 delta * delta * secondary_aggregates[0] * partial_secondary_aggregates[0] / count;
+      secondary_aggregates[0] = count;
+
+      // Both results contain at least one value, so count is greater than one.
+      result.current_primary_aggregate = std::sqrt(secondary_aggregates[2] / (count - 1));
+    }
+  } else if constexpr (function == AggregateFunction::CountDistinct) {  // NOLINT
+    result.distinct_values.insert(partial_result.distinct_values.begin(), partial_result.distinct_values.end());
+  } else {
+    if (!partial_result.current_primary_aggregate) return;
+
+    if (!result.current_primary_aggregate) {
+      result.current_primary_aggregate = partial_result.current_primary_aggregate;
+      return;
+    }
+
+    // COUNT only uses the aggregate_count, ANY keeps its current value.
+    if constexpr (function == AggregateFunction::Min) {
+      if (value_smaller(*partial_result.current_primary_aggregate, *result.current_primary_aggregate)) {
+        result.current_primary_aggregate = partial_result.current_primary_aggregate;
+      }
+    } else if constexpr (function == AggregateFunction::Max) {
+      if (value_greater(*partial_result.current_primary_aggregate, *result.current_primary_aggregate)) {
+        result.current_primary_aggregate = partial_result.current_primary_aggregate;
+      }
+    } else if constexpr (function == AggregateFunction::Sum || function == AggregateFunction::Avg) {
+      *result.current_primary_aggregate += *partial_result.current_primary_aggregate;
+    }
+  }
+}
+
+// Write and read the partial results that AggregateHash::_aggregate_chunks_in_parallel() spills to disk.
+template <typename ColumnDataType, typename AggregateType>
+void write_aggregate_result(SpillWriter& writer, const AggregateResult<ColumnDataType, AggregateType>& result) {
+  writer.write(result.current_primary_aggregate);
+  writer.write(result.current_secondary_aggregates);
+  writer.write(result.aggregate_count);
+  writer.write(result.distinct_values);
+  writer.write(result.row_id);
+}
+
+template <typename ColumnDataType, typename AggregateType>
+void read_aggregate_result(SpillReader& reader, AggregateResult<ColumnDataType, AggregateType>& result) {
+  reader.read(result.current_primary_aggregate);
+  reader.read(result.current_secondary_aggregates);
+  reader.read(result.aggregate_count);
+  reader.read(result.distinct_values);
+  reader.read(result.row_id);
+}
+
 }  // namespace
 
 namespace opossum {
@@ -129,14 +209,14 @@ struct AggregateContext : public AggregateResultContext<ColumnDataType, Aggregat
 };
 
 template <typename ColumnDataType, AggregateFunction function, typename AggregateKey>
-void AggregateHash::_aggregate_segment(ChunkID chunk_id, ColumnID column_index, const AbstractSegment& abstract_segment,
-                                       const KeysPerChunk<AggregateKey>& keys_per_chunk) {
+void AggregateHash::_aggregate_segment(ChunkID chunk_id, const AbstractSegment& abstract_segment,
+                                       const KeysPerChunk<AggregateKey>& keys_per_chunk,
+                                       SegmentVisitorContext& base_context) {
   using AggregateType = typename AggregateTraits<ColumnDataType, function>::AggregateType;
 
   auto aggregator = AggregateFunctionBuilder<ColumnDataType, AggregateType, function>().get_aggregate_function();
 
-  auto& context = *std::static_pointer_cast<AggregateContext<ColumnDataType, AggregateType, AggregateKey>>(
-      _contexts_per_column[column_index]);
+  auto& context = static_cast<AggregateContext<ColumnDataType, AggregateType, AggregateKey>&>(base_context);
 
   auto& result_ids = *context.result_ids;
   auto& results = context.results;
@@ -455,24 +535,43 @@ void AggregateHash::_aggregate() {
   /**
    * AGGREGATION STEP
    */
-  _contexts_per_column = std::vector<std::shared_ptr<SegmentVisitorContext>>(_aggregates.size());
+  _contexts_per_column = _create_aggregate_contexts<AggregateKey>();
+
+  // Process Chunks and perform aggregations
+  const auto chunk_count = input_table->chunk_count();
+  const auto memory_budget = MemoryBudgetSetting::operator_memory_budget();
+  if (chunk_count > 1 && (Hyrise::get().is_multi_threaded() || memory_budget)) {
+    _aggregate_chunks_in_parallel<AggregateKey>(keys_per_chunk, memory_budget);
+  } else {
+    for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+      _aggregate_chunk<AggregateKey>(chunk_id, keys_per_chunk, _contexts_per_column);
+    }
+  }
+  step_performance_data.set_step_runtime(OperatorSteps::Aggregating, timer.lap());
+}  // NOLINT(readability/fn_size)
+
+template <typename AggregateKey>
+std::vector<std::shared_ptr<SegmentVisitorContext>> AggregateHash::_create_aggregate_contexts() const {
+  const auto& input_table = left_input_table();
+
+  auto contexts = std::vector<std::shared_ptr<SegmentVisitorContext>>(_aggregates.size());
 
   if (_aggregates.empty()) {
     /*
     Insert a dummy context for the DISTINCT implementation.
-    That way, _contexts_per_column will always have at least one context with results.
+    That way, there will always be at least one context with results.
     This is important later on when we write the group keys into the table.
 
     We choose int8_t for column type and aggregate type because it's small.
     */
     auto context = std::make_shared<AggregateContext<DistinctColumnType, DistinctAggregateType, AggregateKey>>();
-    _contexts_per_column.push_back(context);
+    contexts.push_back(context);
   }
 
   /**
    * Create an AggregateContext for each column in the input table that a normal (i.e. non-DISTINCT) aggregate is
-   * created on. We do this here, and not in the per-chunk-loop below, because there might be no Chunks in the input
-   * and _write_aggregate_output() needs these contexts anyway.
+   * created on. We do this before processing the chunks, because there might be no Chunks in the input and
+   * _write_aggregate_output() needs these contexts anyway.
    */
   for (ColumnID aggregate_idx{0}; aggregate_idx < _aggregates.size(); ++aggregate_idx) {
     const auto& aggregate = _aggregates[aggregate_idx];
@@ -484,148 +583,402 @@ void AggregateHash::_aggregate() {
       Assert(aggregate->aggregate_function == AggregateFunction::Count, "Only COUNT may have an invalid ColumnID");
       // SELECT COUNT(*) - we know the template arguments, so we don't need a visitor
       auto context = std::make_shared<AggregateContext<CountColumnType, CountAggregateType, AggregateKey>>();
-      _contexts_per_column[aggregate_idx] = context;
+      contexts[aggregate_idx] = context;
       continue;
     }
     const auto data_type = input_table->column_data_type(input_column_id);
-    _contexts_per_column[aggregate_idx] =
-        _create_aggregate_context<AggregateKey>(data_type, aggregate->aggregate_function);
+    contexts[aggregate_idx] = _create_aggregate_context<AggregateKey>(data_type, aggregate->aggregate_function);
   }
 
-  // Process Chunks and perform aggregations
-  const auto chunk_count = input_table->chunk_count();
-  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
-    const auto chunk_in = input_table->get_chunk(chunk_id);
-    if (!chunk_in) continue;
+  return contexts;
+}
+
+template <typename AggregateKey>
+void AggregateHash::_aggregate_chunk(const ChunkID chunk_id, const KeysPerChunk<AggregateKey>& keys_per_chunk,
+                                     std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts) {
+  const auto& input_table = left_input_table();
+  const auto chunk_in = input_table->get_chunk(chunk_id);
+  if (!chunk_in) return;
 
-    // Sometimes, gcc is really bad at accessing loop conditions only once, so we cache that here.
-    const auto input_chunk_size = chunk_in->size();
+  // Sometimes, gcc is really bad at accessing loop conditions only once, so we cache that here.
+  const auto input_chunk_size = chunk_in->size();
 
-    if (_aggregates.empty()) {
+  if (_aggregates.empty()) {
+    /**
+     * DISTINCT implementation
+     *
+     * In Opossum we handle the SQL keyword DISTINCT by grouping without aggregation.
+     *
+     * For a query like "SELECT DISTINCT * FROM A;"
+     * we would assume that all columns from A are part of 'groupby_columns',
+     * respectively any columns that were specified in the projection.
+     * The optimizer is responsible to take care of passing in the correct columns.
+     *
+     * How does this operation work?
+     * Distinct rows are retrieved by grouping by vectors of values. Similar as for the usual aggregation
+     * these vectors are used as keys in the 'column_results' map.
+     *
+     * At this point we've got all the different keys from the chunks and accumulate them in 'column_results'.
+     * In order to reuse the aggregation implementation, we add a dummy AggregateResult.
+     * One could optimize here in the future.
+     *
+     * Obviously this implementation is also used for plain GroupBy's.
+     */
+
+    auto context =
+        std::static_pointer_cast<AggregateContext<DistinctColumnType, DistinctAggregateType, AggregateKey>>(
+            contexts[0]);
+
+    auto& result_ids = *context->result_ids;
+    auto& results = context->results;
+
+    for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
+      // Make sure the value or combination of values is added to the list of distinct value(s)
+      get_or_add_result(result_ids, results, get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
+                        RowID{chunk_id, chunk_offset});
+    }
+  } else {
+    ColumnID aggregate_idx{0};
+    for (const auto& aggregate : _aggregates) {
       /**
-       * DISTINCT implementation
-       *
-       * In Opossum we handle the SQL keyword DISTINCT by grouping without aggregation.
-       *
-       * For a query like "SELECT DISTINCT * FROM A;"
-       * we would assume that all columns from A are part of 'groupby_columns',
-       * respectively any columns that were specified in the projection.
-       * The optimizer is responsible to take care of passing in the correct columns.
-       *
-       * How does this operation work?
-       * Distinct rows are retrieved by grouping by vectors of values. Similar as for the usual aggregation
-       * these vectors are used as keys in the 'column_results' map.
-       *
-       * At this point we've got all the different keys from the chunks and accumulate them in 'column_results'.
-       * In order to reuse the aggregation implementation, we add a dummy AggregateResult.
-       * One could optimize here in the future.
-       *
-       * Obviously this implementation is also used for plain GroupBy's.
+       * Special COUNT(*) implementation.
+       * Because COUNT(*) does not have a specific target column, we use the maximum ColumnID.
+       * We then go through the keys_per_chunk map and count the occurrences of each group key.
+       * The results are saved in the regular aggregate_count variable so that we don't need a
+       * specific output logic for COUNT(*).
        */
 
-      auto context =
-          std::static_pointer_cast<AggregateContext<DistinctColumnType, DistinctAggregateType, AggregateKey>>(
-              _contexts_per_column[0]);
+      const auto& pqp_column = static_cast<const PQPColumnExpression&>(*aggregate->argument());
+      const auto input_column_id = pqp_column.column_id;
 
-      auto& result_ids = *context->result_ids;
-      auto& results = context->results;
+      if (input_column_id == INVALID_COLUMN_ID) {
+        Assert(aggregate->aggregate_function == AggregateFunction::Count, "Only COUNT may have an invalid ColumnID");
+        auto context = std::static_pointer_cast<AggregateContext<CountColumnType, CountAggregateType, AggregateKey>>(
+            contexts[aggregate_idx]);
 
-      for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
-        // Make sure the value or combination of values is added to the list of distinct value(s)
-        get_or_add_result(result_ids, results, get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
-                          RowID{chunk_id, chunk_offset});
-      }
-    } else {
-      ColumnID aggregate_idx{0};
-      for (const auto& aggregate : _aggregates) {
-        /**
-         * Special COUNT(*) implementation.
-         * Because COUNT(*) does not have a specific target column, we use the maximum ColumnID.
-         * We then go through the keys_per_chunk map and count the occurrences of each group key.
-         * The results are saved in the regular aggregate_count variable so that we don't need a
-         * specific output logic for COUNT(*).
-         */
-
-        const auto& pqp_column = static_cast<const PQPColumnExpression&>(*aggregate->argument());
-        const auto input_column_id = pqp_column.column_id;
-
-        if (input_column_id == INVALID_COLUMN_ID) {
-          Assert(aggregate->aggregate_function == AggregateFunction::Count, "Only COUNT may have an invalid ColumnID");
-          auto context = std::static_pointer_cast<AggregateContext<CountColumnType, CountAggregateType, AggregateKey>>(
-              _contexts_per_column[aggregate_idx]);
-
-          auto& result_ids = *context->result_ids;
-          auto& results = context->results;
-
-          if constexpr (std::is_same_v<AggregateKey, EmptyAggregateKey>) {
-            // Not grouped by anything, simply count the number of rows
-            results.resize(1);
-            results[0].aggregate_count += input_chunk_size;
-          } else {
-            // count occurrences for each group key
-            for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
-              auto& result = get_or_add_result(result_ids, results,
-                                               get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
-                                               RowID{chunk_id, chunk_offset});
-              ++result.aggregate_count;
-            }
+        auto& result_ids = *context->result_ids;
+        auto& results = context->results;
+
+        if constexpr (std::is_same_v<AggregateKey, EmptyAggregateKey>) {
+          // Not grouped by anything, simply count the number of rows
+          results.resize(1);
+          results[0].aggregate_count += input_chunk_size;
+        } else {
+          // count occurrences for each group key
+          for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
+            auto& result = get_or_add_result(result_ids, results,
+                                             get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
+                                             RowID{chunk_id, chunk_offset});
+            ++result.aggregate_count;
           }
+        }
 
-          ++aggregate_idx;
-          continue;
+        ++aggregate_idx;
+        continue;
+      }
+
+      const auto abstract_segment = chunk_in->get_segment(input_column_id);
+      const auto data_type = input_table->column_data_type(input_column_id);
+
+      /*
+      Invoke correct aggregator for each segment
+      */
+
+      resolve_data_type(data_type, [&, aggregate](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+
+        switch (aggregate->aggregate_function) {
+          case AggregateFunction::Min:
+            _aggregate_segment<ColumnDataType, AggregateFunction::Min, AggregateKey>(
+                chunk_id, *abstract_segment, keys_per_chunk, *contexts[aggregate_idx]);
+            break;
+          case AggregateFunction::Max:
+            _aggregate_segment<ColumnDataType, AggregateFunction::Max, AggregateKey>(
+                chunk_id, *abstract_segment, keys_per_chunk, *contexts[aggregate_idx]);
+            break;
+          case AggregateFunction::Sum:
+            _aggregate_segment<ColumnDataType, AggregateFunction::Sum, AggregateKey>(
+                chunk_id, *abstract_segment, keys_per_chunk, *contexts[aggregate_idx]);
+            break;
+          case AggregateFunction::Avg:
+            _aggregate_segment<ColumnDataType, AggregateFunction::Avg, AggregateKey>(
+                chunk_id, *abstract_segment, keys_per_chunk, *contexts[aggregate_idx]);
+            break;
+          case AggregateFunction::Count:
+            _aggregate_segment<ColumnDataType, AggregateFunction::Count, AggregateKey>(
+                chunk_id, *abstract_segment, keys_per_chunk, *contexts[aggregate_idx]);
+            break;
+          case AggregateFunction::CountDistinct:
+            _aggregate_segment<ColumnDataType, AggregateFunction::CountDistinct, AggregateKey>(
+                chunk_id, *abstract_segment, keys_per_chunk, *contexts[aggregate_idx]);
+            break;
+          case AggregateFunction::StandardDeviationSample:
+            _aggregate_segment<ColumnDataType, AggregateFunction::StandardDeviationSample, AggregateKey>(
+                chunk_id, *abstract_segment, keys_per_chunk, *contexts[aggregate_idx]);
+            break;
+          case AggregateFunction::Any:
+            _aggregate_segment<ColumnDataType, AggregateFunction::Any, AggregateKey>(
+                chunk_id, *abstract_segment, keys_per_chunk, *contexts[aggregate_idx]);
+        }
+      });
+
+      ++aggregate_idx;
+    }
+  }
+}
+
+template <typename Functor>
+void AggregateHash::_resolve_aggregate_context_types(const ColumnID aggregate_idx, const Functor& functor) const {
+  if (_aggregates.empty()) {
+    // The results of the DISTINCT implementation only hold row ids. COUNT results are merged in the same way.
+    functor(hana::type_c<DistinctColumnType>, hana::type_c<DistinctAggregateType>,
+            std::integral_constant<AggregateFunction, AggregateFunction::Count>{});
+    return;
+  }
+
+  const auto& aggregate = _aggregates[aggregate_idx];
+  const auto input_column_id = static_cast<const PQPColumnExpression&>(*aggregate->argument()).column_id;
+  if (input_column_id == INVALID_COLUMN_ID) {
+    functor(hana::type_c<CountColumnType>, hana::type_c<CountAggregateType>,
+            std::integral_constant<AggregateFunction, AggregateFunction::Count>{});
+    return;
+  }
+
+  resolve_data_type(left_input_table()->column_data_type(input_column_id), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    const auto resolve_function = [&](auto function) {
+      using AggregateType = typename AggregateTraits<ColumnDataType, decltype(function)::value>::AggregateType;
+      functor(type, hana::type_c<AggregateType>, function);
+    };
+
+    switch (aggregate->aggregate_function) {
+      case AggregateFunction::Min:
+        resolve_function(std::integral_constant<AggregateFunction, AggregateFunction::Min>{});
+        break;
+      case AggregateFunction::Max:
+        resolve_function(std::integral_constant<AggregateFunction, AggregateFunction::Max>{});
+        break;
+      case AggregateFunction::Sum:
+        resolve_function(std::integral_constant<AggregateFunction, AggregateFunction::Sum>{});
+        break;
+      case AggregateFunction::Avg:
+        resolve_function(std::integral_constant<AggregateFunction, AggregateFunction::Avg>{});
+        break;
+      case AggregateFunction::Count:
+        resolve_function(std::integral_constant<AggregateFunction, AggregateFunction::Count>{});
+        break;
+      case AggregateFunction::CountDistinct:
+        resolve_function(std::integral_constant<AggregateFunction, AggregateFunction::CountDistinct>{});
+        break;
+      case AggregateFunction::StandardDeviationSample:
+        resolve_function(std::integral_constant<AggregateFunction, AggregateFunction::StandardDeviationSample>{});
+        break;
+      case AggregateFunction::Any:
+        resolve_function(std::integral_constant<AggregateFunction, AggregateFunction::Any>{});
+        break;
+    }
+  });
+}
+
+/**
+ * Two-phase aggregation, used for inputs with multiple chunks if a multi-threaded scheduler is active or an operator
+ * memory budget is set (see MemoryBudgetSetting).
+ *
+ * In the first phase, every chunk is pre-aggregated by a JobTask into contexts of its own. The JobTask then assigns
+ * the partial results to radix partitions based on the hash of their AggregateKey. In the second phase, one JobTask
+ * per partition merges the partial results of all chunks that belong to the partition. As the groups of different
+ * partitions are disjoint, no synchronization is needed and each of the hash maps only holds a fraction of the
+ * groups. Finally, the results of the partitions are concatenated.
+ *
+ * If the partial results that are kept in memory exceed the memory budget, the JobTask of a chunk writes its partial
+ * results to a SpillFile, one block per partition, and frees them. The second phase reads these blocks back while it
+ * merges the partition.
+ */
+template <typename AggregateKey>
+void AggregateHash::_aggregate_chunks_in_parallel(const KeysPerChunk<AggregateKey>& keys_per_chunk,
+                                                  const std::optional<size_t>& memory_budget) {
+  const auto& input_table = left_input_table();
+  const auto chunk_count = input_table->chunk_count();
+  const auto context_count = _contexts_per_column.size();
+
+  // Use a power of two so that the partition can be taken from the lowest bits of the hash. Having more partitions
+  // than CPUs reduces the impact of skewed partitions.
+  auto partition_count = size_t{1};
+  if constexpr (!std::is_same_v<AggregateKey, EmptyAggregateKey>) {
+    while (partition_count < Hyrise::get().topology.num_cpus() * 4) {
+      partition_count *= 2;
+    }
+  }
+  const auto partition_mask = partition_count - 1;
+
+  // For every chunk, the contexts with its partial results and, per partition, the keys and ids of these results.
+  // All contexts of a chunk hold the same groups with the same ids.
+  using PartitionedResultIds = std::vector<std::vector<std::pair<AggregateKey, AggregateResultId>>>;
+  auto partial_contexts = std::vector<std::vector<std::shared_ptr<SegmentVisitorContext>>>(chunk_count);
+  auto partial_result_ids = std::vector<PartitionedResultIds>(chunk_count);
+
+  // For chunks whose partial results were spilled, the range of each partition's block in spill_file
+  auto spill_file = std::unique_ptr<SpillFile>{};
+  auto spilled_ranges = std::vector<std::vector<SpillFile::Range>>{};
+  auto partial_memory_usage = std::atomic<size_t>{0};
+  if (memory_budget) {
+    spill_file = std::make_unique<SpillFile>();
+    spilled_ranges.resize(chunk_count);
+  }
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = input_table->get_chunk(chunk_id);
+    if (!chunk || chunk->size() == 0) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      auto& contexts = partial_contexts[chunk_id];
+      contexts = _create_aggregate_contexts<AggregateKey>();
+      _aggregate_chunk<AggregateKey>(chunk_id, keys_per_chunk, contexts);
+
+      auto& partitions = partial_result_ids[chunk_id];
+      partitions.resize(partition_count);
+      auto result_count = size_t{0};
+      _resolve_aggregate_context_types(ColumnID{0}, [&](auto column_data_type, auto aggregate_type, auto function) {
+        using ColumnDataType = typename decltype(column_data_type)::type;
+        using AggregateType = typename decltype(aggregate_type)::type;
+
+        const auto& results =
+            static_cast<const AggregateResultContext<ColumnDataType, AggregateType>&>(*contexts[0]).results;
+        result_count = results.size();
+        for (auto result_id = AggregateResultId{0}; result_id < result_count; ++result_id) {
+          const auto& row_id = results[result_id].row_id;
+          const auto& key = get_aggregate_key<AggregateKey>(keys_per_chunk, row_id.chunk_id, row_id.chunk_offset);
+          partitions[std::hash<AggregateKey>{}(key) & partition_mask].emplace_back(key, result_id);
         }
+      });
 
-        const auto abstract_segment = chunk_in->get_segment(input_column_id);
-        const auto data_type = input_table->column_data_type(input_column_id);
+      if (!memory_budget) return;
 
-        /*
-        Invoke correct aggregator for each segment
-        */
+      // Estimate the memory of the partial results, ignoring data on the heap (e.g., strings or distinct values).
+      auto memory_usage = result_count * sizeof(std::pair<AggregateKey, AggregateResultId>);
+      for (auto context_id = ColumnID{0}; context_id < context_count; ++context_id) {
+        _resolve_aggregate_context_types(context_id, [&](auto column_data_type, auto aggregate_type, auto function) {
+          using ColumnDataType = typename decltype(column_data_type)::type;
+          using AggregateType = typename decltype(aggregate_type)::type;
+          memory_usage += result_count * sizeof(AggregateResult<ColumnDataType, AggregateType>);
+        });
+      }
 
-        resolve_data_type(data_type, [&, aggregate](auto type) {
-          using ColumnDataType = typename decltype(type)::type;
+      if (partial_memory_usage.fetch_add(memory_usage) + memory_usage <= *memory_budget) return;
 
-          switch (aggregate->aggregate_function) {
-            case AggregateFunction::Min:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Min, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Max:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Max, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Sum:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Sum, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Avg:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Avg, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Count:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Count, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::CountDistinct:
-              _aggregate_segment<ColumnDataType, AggregateFunction::CountDistinct, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::StandardDeviationSample:
-              _aggregate_segment<ColumnDataType, AggregateFunction::StandardDeviationSample, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Any:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Any, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
+      auto& ranges = spilled_ranges[chunk_id];
+      ranges.resize(partition_count);
+      for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+        const auto& entries = partitions[partition_id];
+        ranges[partition_id] = SpillWriter::write_block(*spill_file, [&](SpillWriter& writer) {
+          writer.write(entries.size());
+          for (const auto& [key, result_id] : entries) {
+            writer.write(key);
+          }
+
+          for (auto context_id = ColumnID{0}; context_id < context_count; ++context_id) {
+            _resolve_aggregate_context_types(context_id, [&](auto column_data_type, auto aggregate_type,
+                                                             auto function) {
+              using ColumnDataType = typename decltype(column_data_type)::type;
+              using AggregateType = typename decltype(aggregate_type)::type;
+
+              const auto& results =
+                  static_cast<const AggregateResultContext<ColumnDataType, AggregateType>&>(*contexts[context_id])
+                      .results;
+              for (const auto& [key, result_id] : entries) {
+                write_aggregate_result(writer, results[result_id]);
+              }
+            });
           }
         });
+      }
 
-        ++aggregate_idx;
+      contexts.clear();
+      partitions = PartitionedResultIds{};
+      partial_memory_usage -= memory_usage;
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  auto partition_contexts = std::vector<std::vector<std::shared_ptr<SegmentVisitorContext>>>(partition_count);
+
+  jobs.clear();
+  jobs.reserve(partition_count);
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+      auto& contexts = partition_contexts[partition_id];
+      contexts = _create_aggregate_contexts<AggregateKey>();
+
+      // The partial results of a chunk are merged in the same order for every context, so that the contexts' results
+      // stay aligned.
+      for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+        if (!spilled_ranges.empty() && !spilled_ranges[chunk_id].empty()) {
+          auto reader = SpillReader{*spill_file, spilled_ranges[chunk_id][partition_id]};
+          const auto keys = reader.read<std::vector<AggregateKey>>();
+
+          for (auto context_id = ColumnID{0}; context_id < context_count; ++context_id) {
+            _resolve_aggregate_context_types(context_id, [&](auto column_data_type, auto aggregate_type,
+                                                             auto function) {
+              using ColumnDataType = typename decltype(column_data_type)::type;
+              using AggregateType = typename decltype(aggregate_type)::type;
+
+              auto& context =
+                  static_cast<AggregateContext<ColumnDataType, AggregateType, AggregateKey>&>(*contexts[context_id]);
+              auto partial_result = AggregateResult<ColumnDataType, AggregateType>{};
+              for (const auto& key : keys) {
+                read_aggregate_result(reader, partial_result);
+                auto& result = get_or_add_result(*context.result_ids, context.results, key, partial_result.row_id);
+                merge_aggregate_results<ColumnDataType, AggregateType, decltype(function)::value>(result,
+                                                                                                 partial_result);
+              }
+            });
+          }
+          continue;
+        }
+
+        if (partial_contexts[chunk_id].empty()) continue;
+
+        for (auto context_id = ColumnID{0}; context_id < context_count; ++context_id) {
+          _resolve_aggregate_context_types(context_id, [&](auto column_data_type, auto aggregate_type, auto function) {
+            using ColumnDataType = typename decltype(column_data_type)::type;
+            using AggregateType = typename decltype(aggregate_type)::type;
+
+            auto& context =
+                static_cast<AggregateContext<ColumnDataType, AggregateType, AggregateKey>&>(*contexts[context_id]);
+            const auto& partial_results = static_cast<const AggregateResultContext<ColumnDataType, AggregateType>&>(
+                                              *partial_contexts[chunk_id][context_id])
+                                              .results;
+            for (const auto& [key, result_id] : partial_result_ids[chunk_id][partition_id]) {
+              const auto& partial_result = partial_results[result_id];
+              auto& result = get_or_add_result(*context.result_ids, context.results, key, partial_result.row_id);
+              merge_aggregate_results<ColumnDataType, AggregateType, decltype(function)::value>(result,
+                                                                                               partial_result);
+            }
+          });
+        }
       }
-    }
+    }));
   }
-  step_performance_data.set_step_runtime(OperatorSteps::Aggregating, timer.lap());
-}  // NOLINT(readability/fn_size)
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  for (auto context_id = ColumnID{0}; context_id < context_count; ++context_id) {
+    _resolve_aggregate_context_types(context_id, [&](auto column_data_type, auto aggregate_type, auto function) {
+      using ColumnDataType = typename decltype(column_data_type)::type;
+      using AggregateType = typename decltype(aggregate_type)::type;
+      using Context = AggregateResultContext<ColumnDataType, AggregateType>;
+
+      auto& results = static_cast<Context&>(*_contexts_per_column[context_id]).results;
+      for (const auto& contexts : partition_contexts) {
+        auto& partition_results = static_cast<Context&>(*contexts[context_id]).results;
+        results.insert(results.end(), std::make_move_iterator(partition_results.begin()),
+                       std::make_move_iterator(partition_results.end()));
+      }
+    });
+  }
+}
 
 std::shared_ptr<const Table> AggregateHash::_on_execute() {
   auto& step_performance_data = static_cast<OperatorPerformanceData<OperatorSteps>&>(*performance_data);
@@ -38,6 +38,11 @@ Operator to aggregate columns by certain functions, such as min, max, sum, avera
  i.e. your sorting order.
 
 For implementation details, please check the wiki: https://github.com/hyrise/hyrise/wiki/Operators_Aggregate
+
+If the input has multiple chunks and a multi-threaded scheduler is used, the chunks are pre-aggregated in parallel and
+the partial results are merged in radix partitions of the groups (see _aggregate_chunks_in_parallel). The same is done
+if an operator memory budget is set, so that partial results can be spilled to disk. Otherwise, the chunks are
+aggregated one after another.
 */
 
 /*
@@ -123,6 +128,25 @@ class AggregateHash : public AbstractAggregateOperator {
   template <typename AggregateKey>
   void _aggregate();
 
+  template <typename AggregateKey>
+  std::vector<std::shared_ptr<SegmentVisitorContext>> _create_aggregate_contexts() const;
+
+  // Aggregates the rows of a single chunk into the given contexts
+  template <typename AggregateKey>
+  void _aggregate_chunk(const ChunkID chunk_id, const KeysPerChunk<AggregateKey>& keys_per_chunk,
+                        std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts);
+
+  // Pre-aggregates the chunks in parallel and merges the partial results in radix partitions. Partial results that do
+  // not fit into the memory budget are spilled to disk (see implementation).
+  template <typename AggregateKey>
+  void _aggregate_chunks_in_parallel(const KeysPerChunk<AggregateKey>& keys_per_chunk,
+                                     const std::optional<size_t>& memory_budget);
+
+  // Calls functor with the ColumnDataType, AggregateType (both as hana types), and AggregateFunction (as
+  // std::integral_constant) of the AggregateContext that belongs to the given aggregate
+  template <typename Functor>
+  void _resolve_aggregate_context_types(const ColumnID aggregate_idx, const Functor& functor) const;
+
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_left_input,
       const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
@@ -138,8 +162,8 @@ class AggregateHash : public AbstractAggregateOperator {
   void _write_groupby_output(RowIDPosList& pos_list);
 
   template <typename ColumnDataType, AggregateFunction function, typename AggregateKey>
-  void _aggregate_segment(ChunkID chunk_id, ColumnID column_index, const AbstractSegment& abstract_segment,
-                          const KeysPerChunk<AggregateKey>& keys_per_chunk);
+  void _aggregate_segment(ChunkID chunk_id, const AbstractSegment& abstract_segment,
+                          const KeysPerChunk<AggregateKey>& keys_per_chunk, SegmentVisitorContext& base_context);
 
   template <typename AggregateKey>
   std::shared_ptr<SegmentVisitorContext> _create_aggregate_context(const DataType data_type,
@@ -20,6 +20,8 @@ const std::string& Delete::name() const {
   return name;
 }
 
+const std::shared_ptr<const Table>& Delete::referencing_table() const { return _referencing_table; }
+
 std::shared_ptr<const Table> Delete::_on_execute(std::shared_ptr<TransactionContext> context) {
   _referencing_table = left_input_table();
 
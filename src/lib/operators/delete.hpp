@@ -20,6 +20,11 @@ class Delete : public AbstractReadWriteOperator {
 
   const std::string& name() const override;
 
+  /**
+   * The input table, which references the rows to be deleted. Only available after the operator was executed.
+   */
+  const std::shared_ptr<const Table>& referencing_table() const;
+
  protected:
   std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> context) override;
   std::shared_ptr<AbstractOperator> _on_deep_copy(
@@ -32,7 +32,7 @@ std::shared_ptr<const Table> Export::_on_execute() {
       CsvWriter::write(*left_input_table(), _filename);
       break;
     case FileType::Binary:
-      BinaryWriter::write(*left_input_table(), _filename);
+      BinaryWriter::write(*left_input_table(), _filename, BinaryFileLayout::Indexed);
       break;
     case FileType::Auto:
     case FileType::Tbl:
@@ -80,6 +80,19 @@ const std::string& Insert::name() const {
   return name;
 }
 
+const std::string& Insert::target_table_name() const { return _target_table_name; }
+
+RowIDPosList Insert::inserted_row_ids() const {
+  auto row_ids = RowIDPosList{};
+  for (const auto& target_chunk_range : _target_chunk_ranges) {
+    for (auto chunk_offset = target_chunk_range.begin_chunk_offset; chunk_offset < target_chunk_range.end_chunk_offset;
+         ++chunk_offset) {
+      row_ids.emplace_back(RowID{target_chunk_range.chunk_id, chunk_offset});
+    }
+  }
+  return row_ids;
+}
+
 std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionContext> context) {
   _target_table = Hyrise::get().storage_manager.get_table(_target_table_name);
 
@@ -125,10 +138,12 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
 
       // Mark new (but still empty) rows as being under modification by current transaction.
       // Do so before resizing the Segments, because the resize of `Chunk::_segments.front()` is what releases the
-      // new row count.
+      // new row count. For the same reason, the Insert registers with the chunk's MVCC data before, so that no one
+      // considers the chunk completed once it is full (see ChunkCompressionTask::chunk_is_completed).
       {
         const auto& mvcc_data = target_chunk->mvcc_data();
         DebugAssert(mvcc_data, "Insert cannot operate on a table without MVCC data");
+        mvcc_data->register_insert();
         const auto transaction_id = context->transaction_id();
         const auto end_offset = target_chunk->size() + num_rows_for_target_chunk;
         for (auto target_chunk_offset = target_chunk->size(); target_chunk_offset < end_offset; ++target_chunk_offset) {
@@ -229,6 +244,8 @@ void Insert::_on_commit_records(const CommitID cid) {
 
     // This fence ensures that the changes to TID (which are not sequentially consistent) are visible to other threads.
     std::atomic_thread_fence(std::memory_order_release);
+
+    mvcc_data->deregister_insert();
   }
 }
 
@@ -247,7 +264,8 @@ void Insert::_on_rollback_records() {
      * the other transaction would consider the row (that is in the process of being rolled back and should have never
      * been visible) as visible.
      *
-     * We need to set `begin_cid = 0` so that the ChunkCompressionTask can identify "completed" Chunks.
+     * We need to set `begin_cid = 0` so that rolled-back rows are not mistaken for rows of an uncommitted Insert
+     * (e.g., when the chunk is finalized).
      */
 
     for (auto chunk_offset = target_chunk_range.begin_chunk_offset; chunk_offset < target_chunk_range.end_chunk_offset;
@@ -270,6 +288,8 @@ void Insert::_on_rollback_records() {
 
     // This fence ensures that the changes to TID (which are not sequentially consistent) are visible to other threads.
     std::atomic_thread_fence(std::memory_order_release);
+
+    mvcc_data->deregister_insert();
   }
 }
 
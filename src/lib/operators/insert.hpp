@@ -26,6 +26,14 @@ class Insert : public AbstractReadWriteOperator {
 
   const std::string& name() const override;
 
+  const std::string& target_table_name() const;
+
+  /**
+   * Positions of the inserted rows in the target table, in the order of the input rows. Only available after the
+   * operator was executed. Used by the WriteAheadLog.
+   */
+  RowIDPosList inserted_row_ids() const;
+
  protected:
   std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> context) override;
   std::shared_ptr<AbstractOperator> _on_deep_copy(
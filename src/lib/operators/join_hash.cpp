@@ -1,8 +1,10 @@
 #include "join_hash.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
@@ -15,11 +17,14 @@
 #include "hyrise.hpp"
 #include "join_hash/join_hash_steps.hpp"
 #include "join_hash/join_hash_traits.hpp"
+#include "memory/spill_file.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
 #include "type_comparison.hpp"
 #include "utils/assert.hpp"
 #include "utils/format_duration.hpp"
+#include "utils/performance_warning.hpp"
+#include "utils/settings/memory_budget_setting.hpp"
 #include "utils/timer.hpp"
 
 namespace {
@@ -192,6 +197,15 @@ std::shared_ptr<const Table> JoinHash::_on_execute() {
         if (!_radix_bits) {
           _radix_bits =
               calculate_radix_bits<BuildColumnDataType>(build_input_table->row_count(), probe_input_table->row_count());
+
+          // Spilling works on radix partitions (see JoinHashImpl). If the join might exceed the operator memory
+          // budget, at least two partitions are used.
+          const auto memory_budget = MemoryBudgetSetting::operator_memory_budget();
+          if (*_radix_bits == 0 && memory_budget &&
+              estimate_partition_memory_usage<BuildColumnDataType, ProbeColumnDataType>(
+                  build_input_table->row_count(), probe_input_table->row_count()) > *memory_budget) {
+            _radix_bits = 1;
+          }
         }
 
         // It needs to be ensured that the build partition does not get too large, because the
@@ -317,87 +331,174 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
      *                          Probing (actual Join)
      */
 
+    auto build_side_bloom_filter = BloomFilter{};
+    auto probe_side_bloom_filter = BloomFilter{};
+
     /**
-     * 1.1. Materialize the build partition, which is expected to be smaller. Create a bloom filter.
+     * If the materialized inputs, together with the hash tables, might exceed the operator memory budget (see
+     * MemoryBudgetSetting), each input chunk is radix partitioned and written to disk right after it has been
+     * materialized. Afterwards, batches of partitions that fit into the budget are read back, built, and probed one
+     * after another (see 3. and 4.). The input row counts are used as an upper bound for the number of materialized
+     * elements. As the number of radix bits is chosen so that each partition fits into the cache, a batch usually
+     * covers many partitions.
      */
+    const auto memory_budget = MemoryBudgetSetting::operator_memory_budget();
+    const auto estimated_memory_usage = estimate_partition_memory_usage<BuildColumnType, ProbeColumnType>(
+        _build_input_table->row_count(), _probe_input_table->row_count());
+    const auto spill_inputs = memory_budget && _radix_bits > 0 && estimated_memory_usage > *memory_budget;
+    if (memory_budget && _radix_bits == 0 && estimated_memory_usage > *memory_budget) {
+      PerformanceWarning("JoinHash exceeds the operator memory budget, but cannot spill without radix partitions");
+    }
 
-    auto build_side_bloom_filter = BloomFilter{};
+    auto build_spill_file = std::optional<SpillFile>{};
+    auto probe_spill_file = std::optional<SpillFile>{};
+    auto spilled_build_column = SpilledPartitions{};
+    auto spilled_probe_column = SpilledPartitions{};
+
+    if (spill_inputs) {
+      /**
+       * 1.-2. Materialize, radix partition, and spill the build side, then the probe side. Instead of reducing the
+       *       build side in a separate step (see 1.3), the probe side's bloom filter is applied when the hash tables
+       *       are built.
+       */
+      Timer timer_materialization;
+      build_spill_file.emplace();
+      if (keep_nulls_build_column) {
+        spilled_build_column = materialize_and_spill_input<BuildColumnType, HashedType, true>(
+            _build_input_table, _column_ids.first, _radix_bits, *build_spill_file, build_side_bloom_filter);
+      } else {
+        spilled_build_column = materialize_and_spill_input<BuildColumnType, HashedType, false>(
+            _build_input_table, _column_ids.first, _radix_bits, *build_spill_file, build_side_bloom_filter);
+      }
+      _performance.set_step_runtime(OperatorSteps::BuildSideMaterializing, timer_materialization.lap());
 
-    Timer timer_materialization;
-    if (keep_nulls_build_column) {
-      materialized_build_column = materialize_input<BuildColumnType, HashedType, true>(
-          _build_input_table, _column_ids.first, histograms_build_column, _radix_bits, build_side_bloom_filter);
+      probe_spill_file.emplace();
+      if (keep_nulls_probe_column) {
+        spilled_probe_column = materialize_and_spill_input<ProbeColumnType, HashedType, true>(
+            _probe_input_table, _column_ids.second, _radix_bits, *probe_spill_file, probe_side_bloom_filter,
+            build_side_bloom_filter);
+      } else {
+        spilled_probe_column = materialize_and_spill_input<ProbeColumnType, HashedType, false>(
+            _probe_input_table, _column_ids.second, _radix_bits, *probe_spill_file, probe_side_bloom_filter,
+            build_side_bloom_filter);
+      }
+      _performance.set_step_runtime(OperatorSteps::ProbeSideMaterializing, timer_materialization.lap());
     } else {
-      materialized_build_column = materialize_input<BuildColumnType, HashedType, false>(
-          _build_input_table, _column_ids.first, histograms_build_column, _radix_bits, build_side_bloom_filter);
-    }
-    _performance.set_step_runtime(OperatorSteps::BuildSideMaterializing, timer_materialization.lap());
+      /**
+       * 1.1. Materialize the build partition, which is expected to be smaller. Create a bloom filter.
+       */
+
+      Timer timer_materialization;
+      if (keep_nulls_build_column) {
+        materialized_build_column = materialize_input<BuildColumnType, HashedType, true>(
+            _build_input_table, _column_ids.first, histograms_build_column, _radix_bits, build_side_bloom_filter);
+      } else {
+        materialized_build_column = materialize_input<BuildColumnType, HashedType, false>(
+            _build_input_table, _column_ids.first, histograms_build_column, _radix_bits, build_side_bloom_filter);
+      }
+      // The build side is reduced after the probe side has been materialized (see 1.3). Both are measured together.
+      auto build_side_materialization_duration = timer_materialization.lap();
+
+      /**
+       * 1.2. Materialize the larger probe partition. Use the bloom filter from the build partition to skip rows that
+       *       will not find a join partner.
+       */
+      if (keep_nulls_probe_column) {
+        materialized_probe_column = materialize_input<ProbeColumnType, HashedType, true>(
+            _probe_input_table, _column_ids.second, histograms_probe_column, _radix_bits, probe_side_bloom_filter,
+            build_side_bloom_filter);
+      } else {
+        materialized_probe_column = materialize_input<ProbeColumnType, HashedType, false>(
+            _probe_input_table, _column_ids.second, histograms_probe_column, _radix_bits, probe_side_bloom_filter,
+            build_side_bloom_filter);
+      }
+      _performance.set_step_runtime(OperatorSteps::ProbeSideMaterializing, timer_materialization.lap());
+
+      /**
+       * 1.3. Use the bloom filter from the probe side to remove rows from the build side that will not find a join
+       *      partner. This makes partitioning and building cheaper. Build side rows never need to be kept for the join
+       *      result (see materialization for the modes in which the probe side's rows are kept).
+       */
+      if (keep_nulls_build_column) {
+        reduce_by_bloom_filter<BuildColumnType, HashedType, true>(materialized_build_column, histograms_build_column,
+                                                                  _radix_bits, probe_side_bloom_filter);
+      } else {
+        reduce_by_bloom_filter<BuildColumnType, HashedType, false>(materialized_build_column, histograms_build_column,
+                                                                   _radix_bits, probe_side_bloom_filter);
+      }
+      build_side_materialization_duration += timer_materialization.lap();
+      _performance.set_step_runtime(OperatorSteps::BuildSideMaterializing, build_side_materialization_duration);
+
+      /**
+       * 2. Perform radix partitioning for build and probe sides.
+       */
+      if (_radix_bits > 0) {
+        Timer timer_clustering;
+        auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+
+        jobs.emplace_back(std::make_shared<JobTask>([&]() {
+          // radix partition the build table
+          if (keep_nulls_build_column) {
+            radix_build_column = partition_by_radix<BuildColumnType, HashedType, true>(
+                materialized_build_column, histograms_build_column, _radix_bits);
+          } else {
+            radix_build_column = partition_by_radix<BuildColumnType, HashedType, false>(
+                materialized_build_column, histograms_build_column, _radix_bits);
+          }
 
-    /**
-     * 1.2. Materialize the larger probe partition. Use the bloom filter from the probe partition to skip rows that
-     *       will not find a join partner.
-     */
-    auto probe_side_bloom_filter = BloomFilter{};
+          // After the data in materialized_build_column has been partitioned, it is not needed anymore.
+          materialized_build_column.clear();
+        }));
+
+        jobs.emplace_back(std::make_shared<JobTask>([&]() {
+          // radix partition the probe column.
+          if (keep_nulls_probe_column) {
+            radix_probe_column = partition_by_radix<ProbeColumnType, HashedType, true>(
+                materialized_probe_column, histograms_probe_column, _radix_bits);
+          } else {
+            radix_probe_column = partition_by_radix<ProbeColumnType, HashedType, false>(
+                materialized_probe_column, histograms_probe_column, _radix_bits);
+          }
 
-    if (keep_nulls_probe_column) {
-      materialized_probe_column = materialize_input<ProbeColumnType, HashedType, true>(
-          _probe_input_table, _column_ids.second, histograms_probe_column, _radix_bits, probe_side_bloom_filter,
-          build_side_bloom_filter);
-    } else {
-      materialized_probe_column = materialize_input<ProbeColumnType, HashedType, false>(
-          _probe_input_table, _column_ids.second, histograms_probe_column, _radix_bits, probe_side_bloom_filter,
-          build_side_bloom_filter);
-    }
-    _performance.set_step_runtime(OperatorSteps::ProbeSideMaterializing, timer_materialization.lap());
+          // After the data in materialized_probe_column has been partitioned, it is not needed anymore.
+          materialized_probe_column.clear();
+        }));
 
-    /**
-     * 2. Perform radix partitioning for build and probe sides. The bloom filters are not used in this step. Future work
-     *    could use them on the build side to exclude them for values that are not seen on the probe side. That would
-     *    reduce the size of the intermediary results, but would require an adapted calculation of the output offsets
-     *    within partition_by_radix.
-     */
-    if (_radix_bits > 0) {
-      Timer timer_clustering;
-      auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
-
-      jobs.emplace_back(std::make_shared<JobTask>([&]() {
-        // radix partition the build table
-        if (keep_nulls_build_column) {
-          radix_build_column = partition_by_radix<BuildColumnType, HashedType, true>(
-              materialized_build_column, histograms_build_column, _radix_bits);
-        } else {
-          radix_build_column = partition_by_radix<BuildColumnType, HashedType, false>(
-              materialized_build_column, histograms_build_column, _radix_bits);
-        }
+        Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
 
-        // After the data in materialized_build_column has been partitioned, it is not needed anymore.
-        materialized_build_column.clear();
-      }));
-
-      jobs.emplace_back(std::make_shared<JobTask>([&]() {
-        // radix partition the probe column.
-        if (keep_nulls_probe_column) {
-          radix_probe_column = partition_by_radix<ProbeColumnType, HashedType, true>(
-              materialized_probe_column, histograms_probe_column, _radix_bits);
-        } else {
-          radix_probe_column = partition_by_radix<ProbeColumnType, HashedType, false>(
-              materialized_probe_column, histograms_probe_column, _radix_bits);
-        }
+        histograms_build_column.clear();
+        histograms_probe_column.clear();
 
-        // After the data in materialized_probe_column has been partitioned, it is not needed anymore.
-        materialized_probe_column.clear();
-      }));
+        _performance.set_step_runtime(OperatorSteps::Clustering, timer_clustering.lap());
+      } else {
+        // short cut: skip radix partitioning and use materialized data directly
+        radix_build_column = std::move(materialized_build_column);
+        radix_probe_column = std::move(materialized_probe_column);
+      }
 
-      Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+    }
 
-      histograms_build_column.clear();
-      histograms_probe_column.clear();
+    /**
+     * Short cut for AntiNullAsTrue:
+     *   If there is any NULL value on the build side, do not bother building and probing as no tuples can be emitted
+     *   anyway (as long as JoinHash/AntiNullAsTrue doesn't support secondary predicates). Doing this early out right
+     *   here is hacky, but during probing we assume NULL values on the build side do not matter, so we'd have no
+     *   chance detecting a NULL value on the build side there.
+     */
+    if (_mode == JoinMode::AntiNullAsTrue) {
+      auto build_side_has_null_values = spilled_build_column.has_null_values;
+      for (const auto& build_side_partition : radix_build_column) {
+        build_side_has_null_values |= std::find(build_side_partition.null_values.cbegin(),
+                                                build_side_partition.null_values.cend(),
+                                                true) != build_side_partition.null_values.cend();
+      }
 
-      _performance.set_step_runtime(OperatorSteps::Clustering, timer_clustering.lap());
-    } else {
-      // short cut: skip radix partitioning and use materialized data directly
-      radix_build_column = std::move(materialized_build_column);
-      radix_probe_column = std::move(materialized_probe_column);
+      if (build_side_has_null_values) {
+        Timer timer_output_writing;
+        const auto result = _join_hash._build_output_table({});
+        _performance.set_step_runtime(OperatorSteps::OutputWriting, timer_output_writing.lap());
+        return result;
+      }
     }
 
     /**
@@ -405,94 +506,135 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
      *    In the case of semi or anti joins, we do not need to track all rows on the hashed side, just one per value.
      *    value. However, if we have secondary predicates, those might fail on that single row. In that case, we DO need
      *    all rows.
-     *    We use the probe side's bloom filter to exclude values from the hash table that will not be accessed in the
-     *    probe step.
-     */
-    Timer timer_hash_map_building;
-    if (_secondary_predicates.empty() &&
-        (_mode == JoinMode::Semi || _mode == JoinMode::AntiNullAsTrue || _mode == JoinMode::AntiNullAsFalse)) {
-      hash_tables = build<BuildColumnType, HashedType>(radix_build_column, JoinHashBuildMode::SinglePosition,
-                                                       _radix_bits, probe_side_bloom_filter);
-    } else {
-      hash_tables = build<BuildColumnType, HashedType>(radix_build_column, JoinHashBuildMode::AllPositions, _radix_bits,
-                                                       probe_side_bloom_filter);
-    }
-    _performance.set_step_runtime(OperatorSteps::Building, timer_hash_map_building.lap());
-
-    /**
-     * Short cut for AntiNullAsTrue:
-     *   If there is any NULL value on the build side, do not bother probing as no tuples can be emitted anyway (as
-     *   long as JoinHash/AntiNullAsTrue doesn't support secondary predicates). Doing this early out right here is
-     *   hacky, but during probing we assume NULL values on the build side do not matter, so we'd have no chance
-     *   detecting a NULL value on the build side there.
+     *    The probe side's bloom filter has already been applied to the build side in step 1.3, unless the inputs have
+     *    been spilled.
      */
-    if (_mode == JoinMode::AntiNullAsTrue) {
-      for (const auto& build_side_partition : radix_build_column) {
-        for (const auto null_value : build_side_partition.null_values) {
-          if (null_value) {
-            Timer timer_output_writing;
-            const auto result = _join_hash._build_output_table({});
-            _performance.set_step_runtime(OperatorSteps::OutputWriting, timer_output_writing.lap());
-            return result;
-          }
-        }
+    const auto build_hash_tables = [&](const RadixContainer<BuildColumnType>& partitions,
+                                       const BloomFilter& input_bloom_filter) {
+      if (_secondary_predicates.empty() &&
+          (_mode == JoinMode::Semi || _mode == JoinMode::AntiNullAsTrue || _mode == JoinMode::AntiNullAsFalse)) {
+        return build<BuildColumnType, HashedType>(partitions, JoinHashBuildMode::SinglePosition, _radix_bits,
+                                                  input_bloom_filter);
       }
-    }
+      return build<BuildColumnType, HashedType>(partitions, JoinHashBuildMode::AllPositions, _radix_bits,
+                                                input_bloom_filter);
+    };
 
     /**
      * 4. Probe step
      */
+    const auto probe_partitions = [&](const RadixContainer<ProbeColumnType>& partitions,
+                                      std::vector<RowIDPosList>& build_side_pos_lists,
+                                      std::vector<RowIDPosList>& probe_side_pos_lists) {
+      switch (_mode) {
+        case JoinMode::Inner:
+          probe<ProbeColumnType, HashedType, false>(partitions, hash_tables, build_side_pos_lists,
+                                                    probe_side_pos_lists, _mode, *_build_input_table,
+                                                    *_probe_input_table, _secondary_predicates);
+          break;
+
+        case JoinMode::Left:
+        case JoinMode::Right:
+          probe<ProbeColumnType, HashedType, true>(partitions, hash_tables, build_side_pos_lists,
+                                                   probe_side_pos_lists, _mode, *_build_input_table,
+                                                   *_probe_input_table, _secondary_predicates);
+          break;
+
+        case JoinMode::Semi:
+          probe_semi_anti<ProbeColumnType, HashedType, JoinMode::Semi>(partitions, hash_tables,
+                                                                       probe_side_pos_lists, *_build_input_table,
+                                                                       *_probe_input_table, _secondary_predicates);
+          break;
+
+        case JoinMode::AntiNullAsTrue:
+          probe_semi_anti<ProbeColumnType, HashedType, JoinMode::AntiNullAsTrue>(
+              partitions, hash_tables, probe_side_pos_lists, *_build_input_table, *_probe_input_table,
+              _secondary_predicates);
+          break;
+
+        case JoinMode::AntiNullAsFalse:
+          probe_semi_anti<ProbeColumnType, HashedType, JoinMode::AntiNullAsFalse>(
+              partitions, hash_tables, probe_side_pos_lists, *_build_input_table, *_probe_input_table,
+              _secondary_predicates);
+          break;
+
+        default:
+          Fail("JoinMode not supported by JoinHash");
+      }
+    };
+
     std::vector<RowIDPosList> build_side_pos_lists;
     std::vector<RowIDPosList> probe_side_pos_lists;
-    const size_t partition_count = radix_probe_column.size();
+    const size_t partition_count = spill_inputs ? spilled_probe_column.blocks.size() : radix_probe_column.size();
     build_side_pos_lists.resize(partition_count);
     probe_side_pos_lists.resize(partition_count);
 
-    // simple heuristic: half of the rows of the probe relation will match
-    const size_t result_rows_per_partition =
-        _probe_input_table->row_count() > 0 ? _probe_input_table->row_count() / partition_count / 2 : 0;
-    for (size_t i = 0; i < partition_count; i++) {
-      build_side_pos_lists[i].reserve(result_rows_per_partition);
-      probe_side_pos_lists[i].reserve(result_rows_per_partition);
-    }
+    if (spill_inputs) {
+      auto partition_memory_usages = std::vector<size_t>(partition_count);
+      for (auto partition_idx = size_t{0}; partition_idx < partition_count; ++partition_idx) {
+        partition_memory_usages[partition_idx] = estimate_partition_memory_usage<BuildColumnType, ProbeColumnType>(
+            spilled_build_column.element_counts[partition_idx], spilled_probe_column.element_counts[partition_idx]);
+      }
+
+      auto building_duration = std::chrono::nanoseconds{};
+      auto probing_duration = std::chrono::nanoseconds{};
+      auto batch_begin = size_t{0};
+      while (batch_begin < partition_count) {
+        auto batch_end = batch_begin + 1;
+        auto batch_memory_usage = partition_memory_usages[batch_begin];
+        while (batch_end < partition_count &&
+               batch_memory_usage + partition_memory_usages[batch_end] <= *memory_budget) {
+          batch_memory_usage += partition_memory_usages[batch_end];
+          ++batch_end;
+        }
+
+        const auto batch_size = batch_end - batch_begin;
+        auto build_batch = RadixContainer<BuildColumnType>(batch_size);
+        auto probe_batch = RadixContainer<ProbeColumnType>(batch_size);
+        for (auto batch_idx = size_t{0}; batch_idx < batch_size; ++batch_idx) {
+          build_batch[batch_idx] = load_spilled_partition<BuildColumnType>(
+              *build_spill_file, spilled_build_column.blocks[batch_begin + batch_idx]);
+          probe_batch[batch_idx] = load_spilled_partition<ProbeColumnType>(
+              *probe_spill_file, spilled_probe_column.blocks[batch_begin + batch_idx]);
+        }
+
+        Timer timer_batch;
+        hash_tables = build_hash_tables(build_batch, probe_side_bloom_filter);
+        building_duration += timer_batch.lap();
+
+        auto batch_build_side_pos_lists = std::vector<RowIDPosList>(batch_size);
+        auto batch_probe_side_pos_lists = std::vector<RowIDPosList>(batch_size);
+        probe_partitions(probe_batch, batch_build_side_pos_lists, batch_probe_side_pos_lists);
+        probing_duration += timer_batch.lap();
+
+        for (auto batch_idx = size_t{0}; batch_idx < batch_size; ++batch_idx) {
+          build_side_pos_lists[batch_begin + batch_idx] = std::move(batch_build_side_pos_lists[batch_idx]);
+          probe_side_pos_lists[batch_begin + batch_idx] = std::move(batch_probe_side_pos_lists[batch_idx]);
+        }
+        hash_tables.clear();
+
+        batch_begin = batch_end;
+      }
+
+      _performance.set_step_runtime(OperatorSteps::Building, building_duration);
+      _performance.set_step_runtime(OperatorSteps::Probing, probing_duration);
+    } else {
+      Timer timer_hash_map_building;
+      hash_tables = build_hash_tables(radix_build_column, BloomFilter{});
+      _performance.set_step_runtime(OperatorSteps::Building, timer_hash_map_building.lap());
+
+      // simple heuristic: half of the rows of the probe relation will match
+      const size_t result_rows_per_partition =
+          _probe_input_table->row_count() > 0 ? _probe_input_table->row_count() / partition_count / 2 : 0;
+      for (size_t i = 0; i < partition_count; i++) {
+        build_side_pos_lists[i].reserve(result_rows_per_partition);
+        probe_side_pos_lists[i].reserve(result_rows_per_partition);
+      }
 
-    Timer timer_probing;
-    switch (_mode) {
-      case JoinMode::Inner:
-        probe<ProbeColumnType, HashedType, false>(radix_probe_column, hash_tables, build_side_pos_lists,
-                                                  probe_side_pos_lists, _mode, *_build_input_table, *_probe_input_table,
-                                                  _secondary_predicates);
-        break;
-
-      case JoinMode::Left:
-      case JoinMode::Right:
-        probe<ProbeColumnType, HashedType, true>(radix_probe_column, hash_tables, build_side_pos_lists,
-                                                 probe_side_pos_lists, _mode, *_build_input_table, *_probe_input_table,
-                                                 _secondary_predicates);
-        break;
-
-      case JoinMode::Semi:
-        probe_semi_anti<ProbeColumnType, HashedType, JoinMode::Semi>(radix_probe_column, hash_tables,
-                                                                     probe_side_pos_lists, *_build_input_table,
-                                                                     *_probe_input_table, _secondary_predicates);
-        break;
-
-      case JoinMode::AntiNullAsTrue:
-        probe_semi_anti<ProbeColumnType, HashedType, JoinMode::AntiNullAsTrue>(
-            radix_probe_column, hash_tables, probe_side_pos_lists, *_build_input_table, *_probe_input_table,
-            _secondary_predicates);
-        break;
-
-      case JoinMode::AntiNullAsFalse:
-        probe_semi_anti<ProbeColumnType, HashedType, JoinMode::AntiNullAsFalse>(
-            radix_probe_column, hash_tables, probe_side_pos_lists, *_build_input_table, *_probe_input_table,
-            _secondary_predicates);
-        break;
-
-      default:
-        Fail("JoinMode not supported by JoinHash");
+      Timer timer_probing;
+      probe_partitions(radix_probe_column, build_side_pos_lists, probe_side_pos_lists);
+      _performance.set_step_runtime(OperatorSteps::Probing, timer_probing.lap());
     }
-    _performance.set_step_runtime(OperatorSteps::Probing, timer_probing.lap());
 
     // After probing, the partitioned columns are not needed anymore.
     radix_build_column.clear();
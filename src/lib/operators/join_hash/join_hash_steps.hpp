@@ -1,12 +1,15 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+
 #include <boost/container/small_vector.hpp>
-#include <boost/dynamic_bitset.hpp>
 #include <boost/lexical_cast.hpp>
 #include <uninitialized_vector.hpp>
 
 #include "bytell_hash_map.hpp"
 #include "hyrise.hpp"
+#include "memory/spill_file.hpp"
 #include "operators/multi_predicate_join/multi_predicate_join_evaluator.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
@@ -183,64 +186,242 @@ class PosHashTable {
   std::optional<std::vector<std::pair<HashedType, Offset>>> _values{std::nullopt};
 };
 
-// The bloom filter (with k=1) is used during the materialization and build phases. It contains `true` for each
-// `hash_function(value) % BLOOM_FILTER_SIZE`. Much of how the bloom filter is used in the hash join could be improved:
-// (1) Dynamically check whether bloom filters are worth the memory and computational costs This could be based on the
-//     input table sizes, the expected cardinalities, the hardware characteristics, or other factors.
-// (2) Choosing an appropriate filter size. 2^20 was experimentally found to be good for TPC-H SF 10, but is certainly
-//     not optimal in every situation.
-// (3) Check whether using multiple hash functions (k>1) brings any improvement.
-// (4) Use the probe side bloom filter when partitioning the build side. By doing that, we reduce the size of the
-//     intermediary results. When a bloom filter-supported materialization has been done (i.e., materialization has not
-//     been skipped), we do not need to use a bloom filter in the build phase anymore.
-// Some of these points could be addressed with relatively low effort and should bring additional, significant benefits.
-// We did not yet work on this because the bloom filter was a byproduct of a research project and we have not had the
-// resources to optimize it at the time.
-static constexpr auto BLOOM_FILTER_SIZE = 1 << 20;
-static constexpr auto BLOOM_FILTER_MASK = BLOOM_FILTER_SIZE - 1;
-
-// Using dynamic_bitset because, different from vector<bool>, it has an efficient operator| implementation, which is
-// needed for merging partial bloom filters created by different threads. Note that the dynamic_bitset(n, value)
-// constructor does not do what you would expect it to, so try to avoid it.
-using BloomFilter = boost::dynamic_bitset<>;
+// Blocked bloom filter used by the hash join to skip rows that cannot find a join partner. The build side's filter is
+// used when the probe side is materialized, and the probe side's filter is used to remove build rows before the build
+// side is partitioned (see reduce_by_bloom_filter()). Each value sets HASH_FUNCTION_COUNT bits within the same block of
+// 512 bits, which is the size of a cache line. Thus, inserting or testing a value touches a single cache line, no
+// matter how large the filter is. The number of blocks is chosen based on the expected number of values so that the
+// false positive rate stays low without wasting memory on small inputs.
+//
+// A default-constructed filter is disabled: It holds no blocks and may_contain() returns true for every hash. Values
+// can be inserted concurrently.
+class BloomFilter {
+ public:
+  static constexpr auto HASH_FUNCTION_COUNT = size_t{3};
+  static constexpr auto BLOCK_BITS = size_t{512};
+  static constexpr auto WORDS_PER_BLOCK = BLOCK_BITS / 64;
+
+  // Filter size per expected value and upper bound of the filter size (32 MB)
+  static constexpr auto BITS_PER_EXPECTED_VALUE = size_t{16};
+  static constexpr auto MAX_BLOCK_COUNT = (size_t{1} << 28) / BLOCK_BITS;
+
+  BloomFilter() = default;
+
+  explicit BloomFilter(const size_t expected_value_count) {
+    auto block_count = size_t{1};
+    while (block_count < MAX_BLOCK_COUNT && block_count * BLOCK_BITS < expected_value_count * BITS_PER_EXPECTED_VALUE) {
+      block_count *= 2;
+    }
+    _block_mask = block_count - 1;
+    _words = std::vector<std::atomic<uint64_t>>(block_count * WORDS_PER_BLOCK);
+  }
+
+  bool is_enabled() const { return !_words.empty(); }
+
+  size_t block_count() const { return _words.size() / WORDS_PER_BLOCK; }
+
+  void insert(const Hash hash) {
+    DebugAssert(is_enabled(), "Cannot insert into a disabled bloom filter");
+    auto* block = _block(hash);
+    const auto bit_hash = hash * BIT_MULTIPLIER;
+    for (auto bit_idx = size_t{0}; bit_idx < HASH_FUNCTION_COUNT; ++bit_idx) {
+      const auto bit = _bit(bit_hash, bit_idx);
+      auto& word = block[bit / 64];
+      const auto mask = uint64_t{1} << (bit % 64);
+      // Avoid writing to (and thus invalidating) cache lines that other threads read if the bit is already set.
+      if (!(word.load(std::memory_order_relaxed) & mask)) word.fetch_or(mask, std::memory_order_relaxed);
+    }
+  }
+
+  bool may_contain(const Hash hash) const {
+    if (!is_enabled()) return true;
+
+    const auto* block = _block(hash);
+    const auto bit_hash = hash * BIT_MULTIPLIER;
+    for (auto bit_idx = size_t{0}; bit_idx < HASH_FUNCTION_COUNT; ++bit_idx) {
+      const auto bit = _bit(bit_hash, bit_idx);
+      if (!(block[bit / 64].load(std::memory_order_relaxed) & (uint64_t{1} << (bit % 64)))) return false;
+    }
+    return true;
+  }
+
+ private:
+  // std::hash is the identity for integers. The hash is thus scrambled by multiplying it with two different odd
+  // constants, whose upper bits select the block and the bits within the block, respectively.
+  static constexpr auto BLOCK_MULTIPLIER = uint64_t{0x9E3779B97F4A7C15};
+  static constexpr auto BIT_MULTIPLIER = uint64_t{0xC2B2AE3D27D4EB4F};
+
+  const std::atomic<uint64_t>* _block(const Hash hash) const {
+    return &_words[(((hash * BLOCK_MULTIPLIER) >> 32) & _block_mask) * WORDS_PER_BLOCK];
+  }
+
+  std::atomic<uint64_t>* _block(const Hash hash) {
+    return &_words[(((hash * BLOCK_MULTIPLIER) >> 32) & _block_mask) * WORDS_PER_BLOCK];
+  }
+
+  static size_t _bit(const uint64_t bit_hash, const size_t bit_idx) { return (bit_hash >> (55 - 9 * bit_idx)) & 511; }
+
+  size_t _block_mask{0};
+  std::vector<std::atomic<uint64_t>> _words;
+};
+
+// When a bloom filter is applied, the first BLOOM_FILTER_SAMPLE_SIZE values of each chunk are used to check whether it
+// is selective. If more than BLOOM_FILTER_MAX_PASS_RATE of them pass, the filter costs more than it saves and it is not
+// used for the remainder of the chunk.
+static constexpr auto BLOOM_FILTER_SAMPLE_SIZE = size_t{1'024};
+static constexpr auto BLOOM_FILTER_MAX_PASS_RATE = 0.75;
+
+// Tracks the values tested against a bloom filter within a chunk and decides whether to keep using the filter.
+class BloomFilterSampler {
+ public:
+  explicit BloomFilterSampler(const bool is_active) : _is_active(is_active) {}
+
+  bool is_active() const { return _is_active; }
+
+  void record(const bool passed) {
+    if (_tested_count == BLOOM_FILTER_SAMPLE_SIZE) return;
+
+    _passed_count += passed;
+    if (++_tested_count == BLOOM_FILTER_SAMPLE_SIZE &&
+        static_cast<double>(_passed_count) > BLOOM_FILTER_MAX_PASS_RATE * static_cast<double>(_tested_count)) {
+      _is_active = false;
+    }
+  }
+
+ private:
+  bool _is_active;
+  size_t _tested_count{0};
+  size_t _passed_count{0};
+};
+
+// Materializes the values of column_id in chunk_in into a Partition (see materialize_input()). If radix_bits > 0,
+// histogram is set to the number of materialized elements per radix partition.
+template <typename T, typename HashedType, bool keep_null_values>
+Partition<T> materialize_chunk(const Chunk& chunk_in, const ChunkID chunk_id, const ColumnID column_id,
+                               std::vector<size_t>& histogram, const size_t radix_bits,
+                               BloomFilter& output_bloom_filter, const BloomFilter& input_bloom_filter) {
+  const std::hash<HashedType> hash_function;
+
+  // Currently, we just do one pass
+  const auto pass = size_t{0};
+  const auto radix_mask = static_cast<size_t>(pow(2, radix_bits * (pass + 1)) - 1);
+
+  auto partition = Partition<T>{};
+  auto& elements = partition.elements;
+  auto& null_values = partition.null_values;
+
+  elements.resize(chunk_in.size());
+  if constexpr (keep_null_values) {
+    null_values.resize(chunk_in.size());
+  }
+
+  auto elements_iter = elements.begin();
+  [[maybe_unused]] auto null_values_iter = null_values.begin();
+
+  // prepare histogram
+  histogram = std::vector<size_t>(size_t{1} << radix_bits);
+
+  auto reference_chunk_offset = ChunkOffset{0};
+
+  // If NULL values are kept, the rows of this side must not be dropped (e.g., the outer side of a left join).
+  auto input_bloom_filter_sampler = BloomFilterSampler{!keep_null_values && input_bloom_filter.is_enabled()};
+
+  const auto segment = chunk_in.get_segment(column_id);
+  segment_with_iterators<T>(*segment, [&](auto it, const auto end) {
+    using IterableType = typename decltype(it)::IterableType;
+
+    while (it != end) {
+      const auto& value = *it;
+
+      if (!value.is_null() || keep_null_values) {
+        // TODO(anyone): static_cast is almost always safe, since HashType is big enough. Only for double-vs-long
+        // joins an information loss is possible when joining with longs that cannot be losslessly converted to
+        // double. See #1550 for details.
+        const Hash hashed_value = hash_function(static_cast<HashedType>(value.value()));
+
+        auto skip = false;
+        if (!value.is_null() && input_bloom_filter_sampler.is_active()) {
+          // Value in not present in input bloom filter and can be skipped
+          skip = !input_bloom_filter.may_contain(hashed_value);
+          input_bloom_filter_sampler.record(!skip);
+        }
+
+        if (!skip) {
+          output_bloom_filter.insert(hashed_value);
+
+          /*
+          For ReferenceSegments we do not use the RowIDs from the referenced tables.
+          Instead, we use the index in the ReferenceSegment itself. This way we can later correctly dereference
+          values from different inputs (important for Multi Joins).
+          */
+          if constexpr (is_reference_segment_iterable_v<IterableType>) {
+            *elements_iter = PartitionedElement<T>{RowID{chunk_id, reference_chunk_offset}, value.value()};
+          } else {
+            *elements_iter = PartitionedElement<T>{RowID{chunk_id, value.chunk_offset()}, value.value()};
+          }
+          ++elements_iter;
+
+          // In case we care about NULL values, store the NULL flag
+          if constexpr (keep_null_values) {
+            if (value.is_null()) {
+              *null_values_iter = true;
+            }
+            ++null_values_iter;
+          }
+
+          if (radix_bits > 0) {
+            const Hash radix = hashed_value & radix_mask;
+            ++histogram[radix];
+          }
+        }
+      }
+
+      // reference_chunk_offset is only used for ReferenceSegments
+      if constexpr (is_reference_segment_iterable_v<IterableType>) {
+        ++reference_chunk_offset;
+      }
+
+      ++it;
+
+      if (elements_iter == elements.end()) {
+        // The last chunk has changed its size since we allocated elements. This is due to a concurrent insert
+        // into that chunk. In any case, those inserts will not be visible to our current transaction, so we can
+        // ignore them.
+        break;
+      }
+    }
+  });
+
+  // elements was allocated with the size of the chunk. As we might have skipped NULL values, we need to resize the
+  // vector to the number of values actually written.
+  elements.resize(std::distance(elements.begin(), elements_iter));
+
+  return partition;
+}
 
 // @param in_table             Table to materialize
 // @param column_id            Column within that table to materialize
 // @param histograms           Out: If radix_bits > 0, contains one histogram per chunk where each histogram contains
 //                             1 << radix_bits slots
 // @param radix_bits           Number of radix_bits, needed only for histogram calculation
-// @param output_bloom_filter  Out: A filled BloomFilter where `value & BLOOM_FILTER_MASK == true` for each value
-//                             encountered in the input column
-// @param input_bloom_filter   Optional: Materialization is skipped for each value where the corresponding slot in the
-//                             bloom filter is false
+// @param output_bloom_filter  Out: A BloomFilter, sized for the input table, that contains each value encountered in
+//                             the input column
+// @param input_bloom_filter   Optional: Materialization is skipped for each value not contained in the bloom filter
+//                             (unless NULL values are kept or the filter turns out not to be selective)
 template <typename T, typename HashedType, bool keep_null_values>
 RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table, const ColumnID column_id,
                                     std::vector<std::vector<size_t>>& histograms, const size_t radix_bits,
                                     BloomFilter& output_bloom_filter,
-                                    const BloomFilter& input_bloom_filter = ~BloomFilter(BLOOM_FILTER_SIZE)) {
-  // input_bloom_filter is default-initialized by creating a BloomFilter with every value being false and using bitwise
-  // negation (~x).
-
+                                    const BloomFilter& input_bloom_filter = BloomFilter{}) {
   // Retrieve input chunk_count as it might change during execution if we work on a non-reference table
   auto chunk_count = in_table->chunk_count();
 
-  const std::hash<HashedType> hash_function;
   // List of all elements that will be partitioned
   auto radix_container = RadixContainer<T>{};
   radix_container.resize(chunk_count);
 
-  // Fan-out
-  const size_t num_radix_partitions = 1ull << radix_bits;
-
-  // Currently, we just do one pass
-  const auto pass = size_t{0};
-  const auto radix_mask = static_cast<size_t>(pow(2, radix_bits * (pass + 1)) - 1);
-
-  Assert(output_bloom_filter.empty(), "output_bloom_filter should be empty");
-  output_bloom_filter.resize(BLOOM_FILTER_SIZE);
-  std::mutex output_bloom_filter_mutex;
-
-  Assert(input_bloom_filter.size() == BLOOM_FILTER_SIZE, "Invalid input_bloom_filter");
+  Assert(!output_bloom_filter.is_enabled(), "output_bloom_filter should be empty");
+  output_bloom_filter = BloomFilter{in_table->row_count()};
 
   // Create histograms per chunk
   histograms.resize(chunk_count);
@@ -251,130 +432,89 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
     if (!in_table->get_chunk(chunk_id)) continue;
 
     jobs.emplace_back(std::make_shared<JobTask>([&, in_table, chunk_id]() {
-      auto local_output_bloom_filter = BloomFilter{};
-      std::reference_wrapper<BloomFilter> used_output_bloom_filter = output_bloom_filter;
-      if (Hyrise::get().is_multi_threaded()) {
-        // We cannot write to BloomFilter concurrently, so we build a local one first.
-        local_output_bloom_filter = BloomFilter(BLOOM_FILTER_SIZE, false);
-        used_output_bloom_filter = local_output_bloom_filter;
-      }
-
       const auto chunk_in = in_table->get_chunk(chunk_id);
 
       // Skip chunks that were physically deleted
       if (!chunk_in) return;
 
-      auto& elements = radix_container[chunk_id].elements;
-      auto& null_values = radix_container[chunk_id].null_values;
-
-      elements.resize(chunk_in->size());
-      if constexpr (keep_null_values) {
-        null_values.resize(chunk_in->size());
-      }
-
-      auto elements_iter = elements.begin();
-      [[maybe_unused]] auto null_values_iter = null_values.begin();
-
-      // prepare histogram
-      auto histogram = std::vector<size_t>(num_radix_partitions);
-
-      auto reference_chunk_offset = ChunkOffset{0};
-
-      const auto segment = chunk_in->get_segment(column_id);
-      segment_with_iterators<T>(*segment, [&](auto it, const auto end) {
-        using IterableType = typename decltype(it)::IterableType;
-
-        while (it != end) {
-          const auto& value = *it;
+      radix_container[chunk_id] = materialize_chunk<T, HashedType, keep_null_values>(
+          *chunk_in, chunk_id, column_id, histograms[chunk_id], radix_bits, output_bloom_filter, input_bloom_filter);
+    }));
+    jobs.back()->schedule();
+  }
+  Hyrise::get().scheduler()->wait_for_tasks(jobs);
 
-          if (!value.is_null() || keep_null_values) {
-            // TODO(anyone): static_cast is almost always safe, since HashType is big enough. Only for double-vs-long
-            // joins an information loss is possible when joining with longs that cannot be losslessly converted to
-            // double. See #1550 for details.
-            const Hash hashed_value = hash_function(static_cast<HashedType>(value.value()));
+  return radix_container;
+}
 
-            auto skip = false;
-            if (!value.is_null() && !input_bloom_filter[hashed_value & BLOOM_FILTER_MASK] && !keep_null_values) {
-              // Value in not present in input bloom filter and can be skipped
-              skip = true;
-            }
+// Semi-join reduction of a materialized input: Removes the elements whose values are not contained in bloom_filter
+// (usually the filter of the other join side) and updates the histograms accordingly. This way, the removed elements
+// are neither partitioned nor inserted into a hash table. Elements with NULL values are kept if keep_null_values is
+// set. As in materialize_input(), the filter is not used for chunks where it turns out not to be selective.
+template <typename T, typename HashedType, bool keep_null_values>
+void reduce_by_bloom_filter(RadixContainer<T>& radix_container, std::vector<std::vector<size_t>>& histograms,
+                            const size_t radix_bits, const BloomFilter& bloom_filter) {
+  if (!bloom_filter.is_enabled()) return;
 
-            if (!skip) {
-              // Fill the corresponding slot in the bloom filter
-              used_output_bloom_filter.get()[hashed_value & BLOOM_FILTER_MASK] = true;
-
-              /*
-              For ReferenceSegments we do not use the RowIDs from the referenced tables.
-              Instead, we use the index in the ReferenceSegment itself. This way we can later correctly dereference
-              values from different inputs (important for Multi Joins).
-              */
-              if constexpr (is_reference_segment_iterable_v<IterableType>) {
-                *elements_iter = PartitionedElement<T>{RowID{chunk_id, reference_chunk_offset}, value.value()};
-              } else {
-                *elements_iter = PartitionedElement<T>{RowID{chunk_id, value.chunk_offset()}, value.value()};
-              }
-              ++elements_iter;
+  const std::hash<HashedType> hash_function;
+  const auto radix_mask = (size_t{1} << radix_bits) - 1;
 
-              // In case we care about NULL values, store the NULL flag
-              if constexpr (keep_null_values) {
-                if (value.is_null()) {
-                  *null_values_iter = true;
-                }
-                ++null_values_iter;
-              }
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(radix_container.size());
+  for (auto partition_idx = size_t{0}; partition_idx < radix_container.size(); ++partition_idx) {
+    if (radix_container[partition_idx].elements.empty()) continue;
 
-              if (radix_bits > 0) {
-                const Hash radix = hashed_value & radix_mask;
-                ++histogram[radix];
-              }
-            }
-          }
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_idx]() {
+      auto& elements = radix_container[partition_idx].elements;
+      auto& null_values = radix_container[partition_idx].null_values;
+      auto sampler = BloomFilterSampler{true};
 
-          // reference_chunk_offset is only used for ReferenceSegments
-          if constexpr (is_reference_segment_iterable_v<IterableType>) {
-            ++reference_chunk_offset;
-          }
+      auto& histogram = histograms[partition_idx];
+      std::fill(histogram.begin(), histogram.end(), size_t{0});
 
-          ++it;
+      auto kept_count = size_t{0};
+      for (auto element_idx = size_t{0}; element_idx < elements.size(); ++element_idx) {
+        const auto hashed_value = hash_function(static_cast<HashedType>(elements[element_idx].value));
 
-          if (elements_iter == elements.end()) {
-            // The last chunk has changed its size since we allocated elements. This is due to a concurrent insert
-            // into that chunk. In any case, those inserts will not be visible to our current transaction, so we can
-            // ignore them.
-            break;
+        auto keep = true;
+        if (sampler.is_active()) {
+          if constexpr (keep_null_values) {
+            keep = null_values[element_idx] || bloom_filter.may_contain(hashed_value);
+          } else {
+            keep = bloom_filter.may_contain(hashed_value);
           }
+          sampler.record(keep);
         }
-      });
+        if (!keep) continue;
 
-      // elements was allocated with the size of the chunk. As we might have skipped NULL values, we need to resize the
-      // vector to the number of values actually written.
-      elements.resize(std::distance(elements.begin(), elements_iter));
+        if (radix_bits > 0) ++histogram[hashed_value & radix_mask];
 
-      histograms[chunk_id] = std::move(histogram);
+        elements[kept_count] = elements[element_idx];
+        if constexpr (keep_null_values) {
+          null_values[kept_count] = null_values[element_idx];
+        }
+        ++kept_count;
+      }
 
-      if (Hyrise::get().is_multi_threaded()) {
-        // Merge the local_output_bloom_filter into output_bloom_filter
-        std::lock_guard<std::mutex> lock{output_bloom_filter_mutex};
-        output_bloom_filter |= local_output_bloom_filter;
+      elements.resize(kept_count);
+      if constexpr (keep_null_values) {
+        null_values.resize(kept_count);
       }
     }));
     jobs.back()->schedule();
   }
   Hyrise::get().scheduler()->wait_for_tasks(jobs);
-
-  return radix_container;
 }
 
 /*
-Build all the hash tables for the partitions of the build column. One job per partition
+Build all the hash tables for the partitions of the build column. One job per partition. Values that are not contained
+in input_bloom_filter are not inserted.
 */
 
 template <typename BuildColumnType, typename HashedType>
 std::vector<std::optional<PosHashTable<HashedType>>> build(const RadixContainer<BuildColumnType>& radix_container,
                                                            const JoinHashBuildMode mode, const size_t radix_bits,
-                                                           const BloomFilter& input_bloom_filter) {
-  Assert(input_bloom_filter.size() == BLOOM_FILTER_SIZE, "invalid input_bloom_filter");
-
+                                                           const BloomFilter& input_bloom_filter = BloomFilter{}) {
   if (radix_container.empty()) return {};
 
   /*
@@ -415,8 +555,8 @@ std::vector<std::optional<PosHashTable<HashedType>>> build(const RadixContainer<
       for (const auto& element : elements) {
         DebugAssert(!(element.row_id == NULL_ROW_ID), "No NULL_ROW_IDs should make it to this point");
 
-        const Hash hashed_value = hash_function(static_cast<HashedType>(element.value));
-        if (!input_bloom_filter[hashed_value & BLOOM_FILTER_MASK]) {
+        if (input_bloom_filter.is_enabled() &&
+            !input_bloom_filter.may_contain(hash_function(static_cast<HashedType>(element.value)))) {
           continue;
         }
 
@@ -448,10 +588,7 @@ std::vector<std::optional<PosHashTable<HashedType>>> build(const RadixContainer<
 
 template <typename T, typename HashedType, bool keep_null_values>
 RadixContainer<T> partition_by_radix(const RadixContainer<T>& radix_container,
-                                     std::vector<std::vector<size_t>>& histograms, const size_t radix_bits,
-                                     const BloomFilter& input_bloom_filter = ~BloomFilter(BLOOM_FILTER_SIZE)) {
-  // input_bloom_filter is default-initialized by creating a BloomFilter with every value being false and using bitwise
-  // negation (~x).
+                                     std::vector<std::vector<size_t>>& histograms, const size_t radix_bits) {
   if (radix_container.empty()) return radix_container;
 
   if constexpr (keep_null_values) {
@@ -553,6 +690,141 @@ RadixContainer<T> partition_by_radix(const RadixContainer<T>& radix_container,
   return output;
 }
 
+// Rough estimate of the memory needed to build the hash table of a radix-partitioned build partition and to probe it
+// with the matching probe partition. The hash table is assumed to need about twice the memory of the build elements.
+template <typename BuildColumnType, typename ProbeColumnType>
+size_t estimate_partition_memory_usage(const size_t build_element_count, const size_t probe_element_count) {
+  return build_element_count * sizeof(PartitionedElement<BuildColumnType>) * 3 +
+         probe_element_count * sizeof(PartitionedElement<ProbeColumnType>);
+}
+
+// Writes a partition as a block of a SpillFile. It is read back by load_spilled_partition().
+template <typename T>
+void write_spilled_partition(SpillWriter& writer, const Partition<T>& partition) {
+  writer.write(partition.elements.size());
+  for (const auto& element : partition.elements) {
+    writer.write(element.row_id);
+    writer.write(element.value);
+  }
+  writer.write(partition.null_values);
+}
+
+// Radix partitions that have been written to a SpillFile. A partition can consist of multiple blocks of the file,
+// which are concatenated when it is loaded (see load_spilled_partition()).
+struct SpilledPartitions {
+  // Ranges of the blocks of each partition
+  std::vector<std::vector<SpillFile::Range>> blocks;
+
+  // Number of elements of each partition
+  std::vector<size_t> element_counts;
+
+  // Whether any of the elements is NULL. Only set if NULL values are kept.
+  bool has_null_values{false};
+};
+
+// Loads a partition by reading and concatenating its blocks
+template <typename T>
+Partition<T> load_spilled_partition(const SpillFile& spill_file, const std::vector<SpillFile::Range>& blocks) {
+  auto partition = Partition<T>{};
+  for (const auto& block : blocks) {
+    auto reader = SpillReader{spill_file, block};
+    const auto begin = partition.elements.size();
+    partition.elements.resize(begin + reader.read<size_t>());
+    for (auto element_idx = begin; element_idx < partition.elements.size(); ++element_idx) {
+      reader.read(partition.elements[element_idx].row_id);
+      reader.read(partition.elements[element_idx].value);
+    }
+
+    const auto null_values = reader.read<std::vector<bool>>();
+    partition.null_values.insert(partition.null_values.end(), null_values.cbegin(), null_values.cend());
+  }
+  return partition;
+}
+
+/**
+ * Combines materialize_input() and partition_by_radix() for inputs that would exceed the operator memory budget (see
+ * MemoryBudgetSetting) if they were materialized in memory. Each chunk is materialized, radix-partitioned, and written
+ * to spill_file right away, so that only the chunks that are currently processed are held in memory. Every chunk
+ * writes one block per radix partition that it has elements for. The blocks of a partition are ordered by chunk, so
+ * that loading the partition yields the same elements in the same order as partition_by_radix().
+ *
+ * For the parameters, see materialize_input(). radix_bits must be greater than zero.
+ */
+template <typename T, typename HashedType, bool keep_null_values>
+SpilledPartitions materialize_and_spill_input(const std::shared_ptr<const Table>& in_table, const ColumnID column_id,
+                                              const size_t radix_bits, SpillFile& spill_file,
+                                              BloomFilter& output_bloom_filter,
+                                              const BloomFilter& input_bloom_filter = BloomFilter{}) {
+  Assert(radix_bits > 0, "Spilling during materialization requires radix partitioning");
+
+  const auto chunk_count = in_table->chunk_count();
+  const auto partition_count = size_t{1} << radix_bits;
+
+  Assert(!output_bloom_filter.is_enabled(), "output_bloom_filter should be empty");
+  output_bloom_filter = BloomFilter{in_table->row_count()};
+
+  // The partition index and range of each block, and the number of elements per partition, by chunk
+  auto blocks_by_chunk = std::vector<std::vector<std::pair<size_t, SpillFile::Range>>>(chunk_count);
+  auto histograms = std::vector<std::vector<size_t>>(chunk_count);
+  auto has_null_values = std::atomic_bool{false};
+
+  std::vector<std::shared_ptr<AbstractTask>> jobs;
+  jobs.reserve(chunk_count);
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (!in_table->get_chunk(chunk_id)) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, in_table, chunk_id]() {
+      const auto chunk_in = in_table->get_chunk(chunk_id);
+
+      // Skip chunks that were physically deleted
+      if (!chunk_in) return;
+
+      auto chunk_histograms = std::vector<std::vector<size_t>>(1);
+      auto materialized_chunk = RadixContainer<T>{};
+      materialized_chunk.emplace_back(materialize_chunk<T, HashedType, keep_null_values>(
+          *chunk_in, chunk_id, column_id, chunk_histograms[0], radix_bits, output_bloom_filter, input_bloom_filter));
+
+      const auto& null_values = materialized_chunk[0].null_values;
+      if (std::find(null_values.cbegin(), null_values.cend(), true) != null_values.cend()) {
+        has_null_values = true;
+      }
+
+      auto chunk_partitions =
+          partition_by_radix<T, HashedType, keep_null_values>(materialized_chunk, chunk_histograms, radix_bits);
+      materialized_chunk.clear();
+
+      for (auto partition_idx = size_t{0}; partition_idx < partition_count; ++partition_idx) {
+        auto& partition = chunk_partitions[partition_idx];
+        if (partition.elements.empty()) continue;
+
+        const auto range = SpillWriter::write_block(
+            spill_file, [&](SpillWriter& writer) { write_spilled_partition(writer, partition); });
+        blocks_by_chunk[chunk_id].emplace_back(partition_idx, range);
+        partition = Partition<T>{};
+      }
+
+      histograms[chunk_id] = std::move(chunk_histograms[0]);
+    }));
+    jobs.back()->schedule();
+  }
+  Hyrise::get().scheduler()->wait_for_tasks(jobs);
+
+  auto spilled_partitions = SpilledPartitions{};
+  spilled_partitions.blocks.resize(partition_count);
+  spilled_partitions.element_counts.resize(partition_count);
+  spilled_partitions.has_null_values = has_null_values;
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    for (const auto& [partition_idx, range] : blocks_by_chunk[chunk_id]) {
+      spilled_partitions.blocks[partition_idx].emplace_back(range);
+    }
+    for (auto partition_idx = size_t{0}; partition_idx < histograms[chunk_id].size(); ++partition_idx) {
+      spilled_partitions.element_counts[partition_idx] += histograms[chunk_id][partition_idx];
+    }
+  }
+
+  return spilled_partitions;
+}
+
 /*
   In the probe phase we take all partitions from the probe partition, iterate over them and compare each join candidate
   with the values in the hash table. Since build and probe are hashed using the same hash function, we can reduce the
@@ -11,9 +11,12 @@
 #include <magic_enum.hpp>
 
 #include "all_type_variant.hpp"
+#include "hyrise.hpp"
 #include "join_nested_loop.hpp"
 #include "multi_predicate_join/multi_predicate_join_evaluator.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/index/abstract_index.hpp"
 #include "storage/segment_iterate.hpp"
 #include "type_comparison.hpp"
@@ -66,6 +69,8 @@ const std::string& JoinIndex::name() const {
   return name;
 }
 
+IndexSide JoinIndex::index_side() const { return _index_side; }
+
 std::string JoinIndex::description(DescriptionMode description_mode) const {
   const auto* const separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
   const auto* const index_side_str = _index_side == IndexSide::Left ? "Left" : "Right";
@@ -145,97 +150,54 @@ std::shared_ptr<const Table> JoinIndex::_on_execute() {
 
   auto& join_index_performance_data = static_cast<PerformanceData&>(*performance_data);
 
-  auto secondary_predicate_evaluator = MultiPredicateJoinEvaluator{*_probe_input_table, *_index_input_table, _mode, {}};
+  if (track_probe_matches) {
+    _probe_matches_mutexes = std::vector<std::mutex>(_probe_input_table->chunk_count());
+  }
+
+  // Each chunk of the index side is joined with all chunks of the probe side by a separate job
+  const auto chunk_count_index_input_table = _index_input_table->chunk_count();
+  auto matches_by_index_chunk = std::vector<IndexChunkMatches>(chunk_count_index_input_table);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count_index_input_table);
+  for (ChunkID index_chunk_id{0}; index_chunk_id < chunk_count_index_input_table; ++index_chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, index_chunk_id]() {
+      auto& index_chunk_matches = matches_by_index_chunk[index_chunk_id];
+      Timer job_timer;
+      _join_index_chunk(index_chunk_id, track_probe_matches, track_index_matches, is_semi_or_anti_join,
+                        index_chunk_matches);
+      index_chunk_matches.runtime = job_timer.lap();
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
 
+  // As the jobs run concurrently, the step runtimes are the accumulated runtimes of the jobs
   auto index_joining_duration = std::chrono::nanoseconds{0};
   auto nested_loop_joining_duration = std::chrono::nanoseconds{0};
-  Timer timer;
-  if (_mode == JoinMode::Inner && _index_input_table->type() == TableType::References &&
-      _secondary_predicates.empty()) {  // INNER REFERENCE JOIN
-    // Scan all chunks for index input
-    const auto chunk_count_index_input_table = _index_input_table->chunk_count();
-    for (ChunkID index_chunk_id{0}; index_chunk_id < chunk_count_index_input_table; ++index_chunk_id) {
-      const auto index_chunk = _index_input_table->get_chunk(index_chunk_id);
-      Assert(index_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
-
-      const auto& reference_segment =
-          std::dynamic_pointer_cast<ReferenceSegment>(index_chunk->get_segment(_primary_predicate.column_ids.second));
-      Assert(reference_segment != nullptr,
-             "Non-empty index input table (reference table) has to have only reference segments.");
-      auto index_data_table = reference_segment->referenced_table();
-      const std::vector<ColumnID> index_data_table_column_ids{reference_segment->referenced_column_id()};
-      const auto& reference_segment_pos_list = reference_segment->pos_list();
-
-      if (reference_segment_pos_list->references_single_chunk()) {
-        const auto index_data_table_chunk = index_data_table->get_chunk((*reference_segment_pos_list)[0].chunk_id);
-        Assert(index_data_table_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
-        const auto& indexes = index_data_table_chunk->get_indexes(index_data_table_column_ids);
-
-        if (!indexes.empty()) {
-          // We assume the first index to be efficient for our join
-          // as we do not want to spend time on evaluating the best index inside of this join loop
-          const auto& index = indexes.front();
-
-          // Scan all chunks from the probe side input
-          const auto chunk_count_probe_input_table = _probe_input_table->chunk_count();
-          for (ChunkID probe_chunk_id{0}; probe_chunk_id < chunk_count_probe_input_table; ++probe_chunk_id) {
-            const auto chunk = _probe_input_table->get_chunk(probe_chunk_id);
-            Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
-
-            const auto& probe_segment = chunk->get_segment(_adjusted_primary_predicate.column_ids.first);
-            segment_with_iterators(*probe_segment, [&](auto probe_iter, const auto probe_end) {
-              _reference_join_two_segments_using_index(probe_iter, probe_end, probe_chunk_id, index_chunk_id, index,
-                                                       reference_segment_pos_list);
-            });
-          }
-          index_joining_duration += timer.lap();
-          join_index_performance_data.chunks_scanned_with_index++;
-        } else {
-          _fallback_nested_loop(index_chunk_id, track_probe_matches, track_index_matches, is_semi_or_anti_join,
-                                secondary_predicate_evaluator);
-          nested_loop_joining_duration += timer.lap();
-        }
-      } else {
-        _fallback_nested_loop(index_chunk_id, track_probe_matches, track_index_matches, is_semi_or_anti_join,
-                              secondary_predicate_evaluator);
-        nested_loop_joining_duration += timer.lap();
-      }
+  for (auto& index_chunk_matches : matches_by_index_chunk) {
+    if (index_chunk_matches.scanned_with_index) {
+      index_joining_duration += index_chunk_matches.runtime;
+      ++join_index_performance_data.chunks_scanned_with_index;
+    } else {
+      PerformanceWarning("Fallback nested loop used.");
+      nested_loop_joining_duration += index_chunk_matches.runtime;
+      ++join_index_performance_data.chunks_scanned_without_index;
     }
-  } else {  // DATA JOIN since only inner joins are supported for a reference table on the index side
-    // Scan all chunks for index input
-    const auto chunk_count_index_input_table = _index_input_table->chunk_count();
-    for (ChunkID index_chunk_id{0}; index_chunk_id < chunk_count_index_input_table; ++index_chunk_id) {
-      const auto index_chunk = _index_input_table->get_chunk(index_chunk_id);
-      Assert(index_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
-
-      const auto& indexes =
-          index_chunk->get_indexes(std::vector<ColumnID>{_adjusted_primary_predicate.column_ids.second});
-
-      if (!indexes.empty()) {
-        // We assume the first index to be efficient for our join
-        // as we do not want to spend time on evaluating the best index inside of this join loop
-        const auto& index = indexes.front();
 
-        // Scan all chunks from the probe side input
-        const auto chunk_count_probe_input_table = _probe_input_table->chunk_count();
-        for (ChunkID probe_chunk_id{0}; probe_chunk_id < chunk_count_probe_input_table; ++probe_chunk_id) {
-          const auto chunk = _probe_input_table->get_chunk(probe_chunk_id);
-          Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+    _probe_pos_list->insert(_probe_pos_list->end(), index_chunk_matches.probe_pos_list.begin(),
+                            index_chunk_matches.probe_pos_list.end());
+    _index_pos_list->insert(_index_pos_list->end(), index_chunk_matches.index_pos_list.begin(),
+                            index_chunk_matches.index_pos_list.end());
+    _index_pos_dereferenced.insert(_index_pos_dereferenced.end(), index_chunk_matches.index_pos_dereferenced.begin(),
+                                   index_chunk_matches.index_pos_dereferenced.end());
+    index_chunk_matches = IndexChunkMatches{};
+  }
 
-          const auto& probe_segment = chunk->get_segment(_adjusted_primary_predicate.column_ids.first);
-          segment_with_iterators(*probe_segment, [&](auto probe_iter, const auto probe_end) {
-            _data_join_two_segments_using_index(probe_iter, probe_end, probe_chunk_id, index_chunk_id, index);
-          });
-        }
-        index_joining_duration += timer.lap();
-        join_index_performance_data.chunks_scanned_with_index++;
-      } else {
-        _fallback_nested_loop(index_chunk_id, track_probe_matches, track_index_matches, is_semi_or_anti_join,
-                              secondary_predicate_evaluator);
-        nested_loop_joining_duration += timer.lap();
-      }
-    }
+  Timer timer;
 
+  // Only inner joins are supported for a reference table on the index side
+  if (!(_mode == JoinMode::Inner && _index_input_table->type() == TableType::References &&
+        _secondary_predicates.empty())) {
     _append_matches_non_inner(is_semi_or_anti_join);
   }
 
@@ -275,27 +237,110 @@ std::shared_ptr<const Table> JoinIndex::_on_execute() {
   return _build_output_table(std::move(chunks));
 }
 
+void JoinIndex::_join_index_chunk(const ChunkID index_chunk_id, const bool track_probe_matches,
+                                  const bool track_index_matches, const bool is_semi_or_anti_join,
+                                  IndexChunkMatches& index_chunk_matches) {
+  const auto index_chunk = _index_input_table->get_chunk(index_chunk_id);
+  Assert(index_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+  const auto chunk_count_probe_input_table = _probe_input_table->chunk_count();
+
+  if (_mode == JoinMode::Inner && _index_input_table->type() == TableType::References &&
+      _secondary_predicates.empty()) {  // INNER REFERENCE JOIN
+    const auto& reference_segment = std::dynamic_pointer_cast<ReferenceSegment>(
+        index_chunk->get_segment(_adjusted_primary_predicate.column_ids.second));
+    Assert(reference_segment != nullptr,
+           "Non-empty index input table (reference table) has to have only reference segments.");
+    auto index_data_table = reference_segment->referenced_table();
+    const std::vector<ColumnID> index_data_table_column_ids{reference_segment->referenced_column_id()};
+    const auto& reference_segment_pos_list = reference_segment->pos_list();
+
+    if (reference_segment_pos_list->references_single_chunk()) {
+      const auto index_data_table_chunk = index_data_table->get_chunk((*reference_segment_pos_list)[0].chunk_id);
+      Assert(index_data_table_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+      const auto& indexes = index_data_table_chunk->get_indexes(index_data_table_column_ids);
+
+      if (!indexes.empty()) {
+        // We assume the first index to be efficient for our join
+        // as we do not want to spend time on evaluating the best index inside of this join loop
+        const auto& index = indexes.front();
+
+        // Scan all chunks from the probe side input
+        for (ChunkID probe_chunk_id{0}; probe_chunk_id < chunk_count_probe_input_table; ++probe_chunk_id) {
+          const auto chunk = _probe_input_table->get_chunk(probe_chunk_id);
+          Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+          const auto& probe_segment = chunk->get_segment(_adjusted_primary_predicate.column_ids.first);
+          segment_with_iterators(*probe_segment, [&](auto probe_iter, const auto probe_end) {
+            _reference_join_two_segments_using_index(probe_iter, probe_end, probe_chunk_id, index_chunk_id, index,
+                                                     reference_segment_pos_list, index_chunk_matches);
+          });
+        }
+        index_chunk_matches.scanned_with_index = true;
+        return;
+      }
+    }
+  } else {  // DATA JOIN since only inner joins are supported for a reference table on the index side
+    const auto& indexes =
+        index_chunk->get_indexes(std::vector<ColumnID>{_adjusted_primary_predicate.column_ids.second});
+
+    if (!indexes.empty()) {
+      // We assume the first index to be efficient for our join
+      // as we do not want to spend time on evaluating the best index inside of this join loop
+      const auto& index = indexes.front();
+
+      // Scan all chunks from the probe side input
+      for (ChunkID probe_chunk_id{0}; probe_chunk_id < chunk_count_probe_input_table; ++probe_chunk_id) {
+        const auto chunk = _probe_input_table->get_chunk(probe_chunk_id);
+        Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+        if (track_probe_matches) {
+          index_chunk_matches.probe_chunk_matches.assign(chunk->size(), false);
+        }
+
+        const auto& probe_segment = chunk->get_segment(_adjusted_primary_predicate.column_ids.first);
+        segment_with_iterators(*probe_segment, [&](auto probe_iter, const auto probe_end) {
+          _data_join_two_segments_using_index(probe_iter, probe_end, probe_chunk_id, index_chunk_id, index,
+                                              index_chunk_matches);
+        });
+
+        if (track_probe_matches) {
+          _merge_probe_chunk_matches(probe_chunk_id, index_chunk_matches.probe_chunk_matches);
+        }
+      }
+      index_chunk_matches.scanned_with_index = true;
+      return;
+    }
+  }
+
+  _fallback_nested_loop(index_chunk_id, track_probe_matches, track_index_matches, is_semi_or_anti_join,
+                        index_chunk_matches);
+}
+
 void JoinIndex::_fallback_nested_loop(const ChunkID index_chunk_id, const bool track_probe_matches,
                                       const bool track_index_matches, const bool is_semi_or_anti_join,
-                                      MultiPredicateJoinEvaluator& secondary_predicate_evaluator) {
-  PerformanceWarning("Fallback nested loop used.");
-  auto& join_index_performance_data = static_cast<PerformanceData&>(*performance_data);
-
+                                      IndexChunkMatches& index_chunk_matches) {
   const auto index_chunk = _index_input_table->get_chunk(index_chunk_id);
   Assert(index_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
   const auto& index_segment = index_chunk->get_segment(_adjusted_primary_predicate.column_ids.second);
-  const auto& index_pos_list_size_pre_fallback = _index_pos_list->size();
+
+  // As accessors are not thread-safe, each job needs its own evaluator
+  auto secondary_predicate_evaluator = MultiPredicateJoinEvaluator{*_probe_input_table, *_index_input_table, _mode, {}};
 
   const auto chunk_count = _probe_input_table->chunk_count();
   for (ChunkID probe_chunk_id{0}; probe_chunk_id < chunk_count; ++probe_chunk_id) {
     const auto chunk = _probe_input_table->get_chunk(probe_chunk_id);
     Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
+    if (track_probe_matches) {
+      index_chunk_matches.probe_chunk_matches.assign(chunk->size(), false);
+    }
+
     const auto& probe_segment = chunk->get_segment(_adjusted_primary_predicate.column_ids.first);
-    JoinNestedLoop::JoinParams params{*_probe_pos_list,
-                                      *_index_pos_list,
-                                      _probe_matches[probe_chunk_id],
+    JoinNestedLoop::JoinParams params{index_chunk_matches.probe_pos_list,
+                                      index_chunk_matches.index_pos_list,
+                                      index_chunk_matches.probe_chunk_matches,
                                       _index_matches[index_chunk_id],
                                       track_probe_matches,
                                       track_index_matches,
@@ -304,11 +349,12 @@ void JoinIndex::_fallback_nested_loop(const ChunkID index_chunk_id, const bool t
                                       secondary_predicate_evaluator,
                                       !is_semi_or_anti_join};
     JoinNestedLoop::_join_two_untyped_segments(*probe_segment, *index_segment, probe_chunk_id, index_chunk_id, params);
+
+    if (track_probe_matches) {
+      _merge_probe_chunk_matches(probe_chunk_id, index_chunk_matches.probe_chunk_matches);
+    }
   }
-  const auto& index_pos_list_size_post_fallback = _index_pos_list->size();
-  const auto& count_index_positions = index_pos_list_size_post_fallback - index_pos_list_size_pre_fallback;
-  std::fill_n(std::back_inserter(_index_pos_dereferenced), count_index_positions, false);
-  join_index_performance_data.chunks_scanned_without_index++;
+  index_chunk_matches.index_pos_dereferenced.resize(index_chunk_matches.index_pos_list.size(), false);
 }
 
 // join loop that joins two segments of two columns using an iterator for the probe side,
@@ -316,12 +362,14 @@ void JoinIndex::_fallback_nested_loop(const ChunkID index_chunk_id, const bool t
 template <typename ProbeIterator>
 void JoinIndex::_data_join_two_segments_using_index(ProbeIterator probe_iter, ProbeIterator probe_end,
                                                     const ChunkID probe_chunk_id, const ChunkID index_chunk_id,
-                                                    const std::shared_ptr<AbstractIndex>& index) {
+                                                    const std::shared_ptr<AbstractIndex>& index,
+                                                    IndexChunkMatches& index_chunk_matches) {
   for (; probe_iter != probe_end; ++probe_iter) {
     const auto probe_side_position = *probe_iter;
     const auto index_ranges = _index_ranges_for_value(probe_side_position, index);
     for (const auto& [index_begin, index_end] : index_ranges) {
-      _append_matches(index_begin, index_end, probe_side_position.chunk_offset(), probe_chunk_id, index_chunk_id);
+      _append_matches(index_begin, index_end, probe_side_position.chunk_offset(), probe_chunk_id, index_chunk_id,
+                      index_chunk_matches);
     }
   }
 }
@@ -330,7 +378,7 @@ template <typename ProbeIterator>
 void JoinIndex::_reference_join_two_segments_using_index(
     ProbeIterator probe_iter, ProbeIterator probe_end, const ChunkID probe_chunk_id, const ChunkID index_chunk_id,
     const std::shared_ptr<AbstractIndex>& index,
-    const std::shared_ptr<const AbstractPosList>& reference_segment_pos_list) {
+    const std::shared_ptr<const AbstractPosList>& reference_segment_pos_list, IndexChunkMatches& index_chunk_matches) {
   for (; probe_iter != probe_end; ++probe_iter) {
     RowIDPosList index_scan_pos_list;
     const auto probe_side_position = *probe_iter;
@@ -350,7 +398,8 @@ void JoinIndex::_reference_join_two_segments_using_index(
     RowIDPosList index_table_matches{};
     std::set_intersection(mutable_ref_seg_pos_list.begin(), mutable_ref_seg_pos_list.end(), index_scan_pos_list.begin(),
                           index_scan_pos_list.end(), std::back_inserter(index_table_matches));
-    _append_matches_dereferenced(probe_chunk_id, probe_side_position.chunk_offset(), index_table_matches);
+    _append_matches_dereferenced(probe_chunk_id, probe_side_position.chunk_offset(), index_table_matches,
+                                 index_chunk_matches);
   }
 }
 
@@ -424,7 +473,7 @@ std::vector<IndexRange> JoinIndex::_index_ranges_for_value(const SegmentPosition
 
 void JoinIndex::_append_matches(const AbstractIndex::Iterator& range_begin, const AbstractIndex::Iterator& range_end,
                                 const ChunkOffset probe_chunk_offset, const ChunkID probe_chunk_id,
-                                const ChunkID index_chunk_id) {
+                                const ChunkID index_chunk_id, IndexChunkMatches& index_chunk_matches) {
   const auto num_index_matches = std::distance(range_begin, range_end);
 
   if (num_index_matches == 0) {
@@ -437,14 +486,15 @@ void JoinIndex::_append_matches(const AbstractIndex::Iterator& range_begin, cons
   // Remember the matches for non-inner joins
   if (((is_semi_or_anti_join || _mode == JoinMode::Left) && _index_side == IndexSide::Right) ||
       (_mode == JoinMode::Right && _index_side == IndexSide::Left) || _mode == JoinMode::FullOuter) {
-    _probe_matches[probe_chunk_id][probe_chunk_offset] = true;
+    index_chunk_matches.probe_chunk_matches[probe_chunk_offset] = true;
   }
 
   if (!is_semi_or_anti_join) {
     // we replicate the probe side value for each index side value
-    std::fill_n(std::back_inserter(*_probe_pos_list), num_index_matches, RowID{probe_chunk_id, probe_chunk_offset});
+    std::fill_n(std::back_inserter(index_chunk_matches.probe_pos_list), num_index_matches,
+                RowID{probe_chunk_id, probe_chunk_offset});
 
-    std::transform(range_begin, range_end, std::back_inserter(*_index_pos_list),
+    std::transform(range_begin, range_end, std::back_inserter(index_chunk_matches.index_pos_list),
                    [index_chunk_id](ChunkOffset index_chunk_offset) {
                      return RowID{index_chunk_id, index_chunk_offset};
                    });
@@ -460,11 +510,20 @@ void JoinIndex::_append_matches(const AbstractIndex::Iterator& range_begin, cons
 }
 
 void JoinIndex::_append_matches_dereferenced(const ChunkID& probe_chunk_id, const ChunkOffset& probe_chunk_offset,
-                                             const RowIDPosList& index_table_matches) {
+                                             const RowIDPosList& index_table_matches,
+                                             IndexChunkMatches& index_chunk_matches) {
   for (const auto& index_side_row_id : index_table_matches) {
-    _probe_pos_list->emplace_back(RowID{probe_chunk_id, probe_chunk_offset});
-    _index_pos_list->emplace_back(index_side_row_id);
-    _index_pos_dereferenced.emplace_back(true);
+    index_chunk_matches.probe_pos_list.emplace_back(RowID{probe_chunk_id, probe_chunk_offset});
+    index_chunk_matches.index_pos_list.emplace_back(index_side_row_id);
+    index_chunk_matches.index_pos_dereferenced.emplace_back(true);
+  }
+}
+
+void JoinIndex::_merge_probe_chunk_matches(const ChunkID probe_chunk_id, const std::vector<bool>& probe_chunk_matches) {
+  auto& probe_matches = _probe_matches[probe_chunk_id];
+  const auto lock = std::lock_guard<std::mutex>{_probe_matches_mutexes[probe_chunk_id]};
+  for (auto chunk_offset = size_t{0}; chunk_offset < probe_chunk_matches.size(); ++chunk_offset) {
+    if (probe_chunk_matches[chunk_offset]) probe_matches[chunk_offset] = true;
   }
 }
 
@@ -600,6 +659,7 @@ void JoinIndex::_on_cleanup() {
   _index_pos_list.reset();
   _probe_matches.clear();
   _index_matches.clear();
+  _probe_matches_mutexes.clear();
 }
 
 void JoinIndex::PerformanceData::output_to_stream(std::ostream& stream, DescriptionMode description_mode) const {
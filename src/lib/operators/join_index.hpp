@@ -1,6 +1,8 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <utility>
@@ -13,7 +15,6 @@
 
 namespace opossum {
 
-class MultiPredicateJoinEvaluator;
 using IndexRange = std::pair<AbstractIndex::Iterator, AbstractIndex::Iterator>;
 
 /**
@@ -39,6 +40,8 @@ class JoinIndex : public AbstractJoinOperator {
 
   const std::string& name() const override;
 
+  IndexSide index_side() const;
+
   enum class OperatorSteps : uint8_t { IndexJoining, NestedLoopJoining, OutputWriting };
 
   struct PerformanceData : public OperatorPerformanceData<OperatorSteps> {
@@ -57,20 +60,38 @@ class JoinIndex : public AbstractJoinOperator {
       const std::shared_ptr<AbstractOperator>& copied_left_input,
       const std::shared_ptr<AbstractOperator>& copied_right_input) const override;
 
+  // Matches found by the job that joins a single chunk of the index side with all chunks of the probe side. The results
+  // of all jobs are concatenated in the order of the index side chunks.
+  struct IndexChunkMatches {
+    RowIDPosList probe_pos_list;
+    RowIDPosList index_pos_list;
+    std::vector<bool> index_pos_dereferenced;
+
+    // Matches of the probe chunk that is currently joined, merged into _probe_matches after each probe chunk
+    std::vector<bool> probe_chunk_matches;
+
+    bool scanned_with_index{false};
+    std::chrono::nanoseconds runtime{0};
+  };
+
+  void _join_index_chunk(const ChunkID index_chunk_id, const bool track_probe_matches, const bool track_index_matches,
+                         const bool is_semi_or_anti_join, IndexChunkMatches& index_chunk_matches);
+
   void _fallback_nested_loop(const ChunkID index_chunk_id, const bool track_probe_matches,
                              const bool track_index_matches, const bool is_semi_or_anti_join,
-                             MultiPredicateJoinEvaluator& secondary_predicate_evaluator);
+                             IndexChunkMatches& index_chunk_matches);
 
   template <typename ProbeIterator>
   void _data_join_two_segments_using_index(ProbeIterator probe_iter, ProbeIterator probe_end,
                                            const ChunkID probe_chunk_id, const ChunkID index_chunk_id,
-                                           const std::shared_ptr<AbstractIndex>& index);
+                                           const std::shared_ptr<AbstractIndex>& index,
+                                           IndexChunkMatches& index_chunk_matches);
 
   template <typename ProbeIterator>
   void _reference_join_two_segments_using_index(
       ProbeIterator probe_iter, ProbeIterator probe_end, const ChunkID probe_chunk_id, const ChunkID index_chunk_id,
       const std::shared_ptr<AbstractIndex>& index,
-      const std::shared_ptr<const AbstractPosList>& reference_segment_pos_list);
+      const std::shared_ptr<const AbstractPosList>& reference_segment_pos_list, IndexChunkMatches& index_chunk_matches);
 
   template <typename SegmentPosition>
   std::vector<IndexRange> _index_ranges_for_value(const SegmentPosition probe_side_position,
@@ -78,10 +99,12 @@ class JoinIndex : public AbstractJoinOperator {
 
   void _append_matches(const AbstractIndex::Iterator& range_begin, const AbstractIndex::Iterator& range_end,
                        const ChunkOffset probe_chunk_offset, const ChunkID probe_chunk_id,
-                       const ChunkID index_chunk_id);
+                       const ChunkID index_chunk_id, IndexChunkMatches& index_chunk_matches);
 
   void _append_matches_dereferenced(const ChunkID& probe_chunk_id, const ChunkOffset& probe_chunk_offset,
-                                    const RowIDPosList& index_table_matches);
+                                    const RowIDPosList& index_table_matches, IndexChunkMatches& index_chunk_matches);
+
+  void _merge_probe_chunk_matches(const ChunkID probe_chunk_id, const std::vector<bool>& probe_chunk_matches);
 
   void _append_matches_non_inner(const bool is_semi_or_anti_join);
 
@@ -105,6 +128,10 @@ class JoinIndex : public AbstractJoinOperator {
   // The outer vector enumerates chunks, the inner enumerates chunk_offsets
   std::vector<std::vector<bool>> _probe_matches;
   std::vector<std::vector<bool>> _index_matches;
+
+  // Protect the entries of _probe_matches, which are written by the jobs of all index side chunks. _index_matches only
+  // has a single writer per chunk.
+  std::vector<std::mutex> _probe_matches_mutexes;
 };
 
 }  // namespace opossum
@@ -1,11 +1,16 @@
 #include "join_nested_loop.hpp"
 
+#include <algorithm>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "hyrise.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/segment_iterables/any_segment_iterable.hpp"
 #include "storage/segment_iterate.hpp"
@@ -125,10 +130,6 @@ std::shared_ptr<const Table> JoinNestedLoop::_on_execute() {
     }
   }
 
-  // Track pairs of matching RowIDs
-  const auto pos_list_left = std::make_shared<RowIDPosList>();
-  const auto pos_list_right = std::make_shared<RowIDPosList>();
-
   const auto is_outer_join = _mode == JoinMode::Left || _mode == JoinMode::Right || _mode == JoinMode::FullOuter;
   const auto is_semi_or_anti_join =
       _mode == JoinMode::Semi || _mode == JoinMode::AntiNullAsFalse || _mode == JoinMode::AntiNullAsTrue;
@@ -147,40 +148,112 @@ std::shared_ptr<const Table> JoinNestedLoop::_on_execute() {
     right_matches_by_chunk[chunk_id_right].resize(chunk_right->size());
   }
 
-  auto secondary_predicate_evaluator =
-      MultiPredicateJoinEvaluator{*left_table, *right_table, _mode, maybe_flipped_secondary_predicates};
+  // Multiple jobs may find matches for the same right chunk. They collect them in a local vector first and merge them
+  // into right_matches_by_chunk while holding the chunk's mutex.
+  auto right_matches_mutexes = std::vector<std::mutex>(track_right_matches ? chunk_count_right : 0);
 
-  // Scan all chunks from left input
+  // Each job joins one left chunk with a range of right chunks. If the left input has fewer chunks than there are
+  // CPUs, the right chunks are split into multiple ranges, so that all CPUs are used. The jobs write their matches to
+  // separate pairs of PosLists, which are concatenated in the order of the left chunks and the right ranges afterwards.
   const auto chunk_count_left = left_table->chunk_count();
+  const auto right_range_count =
+      std::clamp(Hyrise::get().topology.num_cpus() / std::max(size_t{1}, static_cast<size_t>(chunk_count_left)),
+                 size_t{1}, std::max(size_t{1}, static_cast<size_t>(chunk_count_right)));
+  const auto right_range_size = (chunk_count_right + right_range_count - 1) / right_range_count;
+  const auto right_chunk_count = static_cast<size_t>(chunk_count_right);
+
+  const auto job_count = chunk_count_left * right_range_count;
+  auto pos_lists_left = std::vector<RowIDPosList>(job_count);
+  auto pos_lists_right = std::vector<RowIDPosList>(job_count);
+  auto left_matches_by_job = std::vector<std::vector<bool>>(job_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(job_count);
   for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < chunk_count_left; ++chunk_id_left) {
-    const auto chunk_left = left_table->get_chunk(chunk_id_left);
-    Assert(chunk_left, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+    for (auto right_range_id = size_t{0}; right_range_id < right_range_count; ++right_range_id) {
+      const auto job_id = chunk_id_left * right_range_count + right_range_id;
+      const auto right_range_begin = std::min(right_range_id * right_range_size, right_chunk_count);
+      const auto right_range_end = std::min(right_range_begin + right_range_size, right_chunk_count);
+
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id_left, job_id, right_range_begin, right_range_end]() {
+        const auto chunk_left = left_table->get_chunk(chunk_id_left);
+        Assert(chunk_left, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+        auto segment_left = chunk_left->get_segment(left_column_id);
+
+        auto& pos_list_left = pos_lists_left[job_id];
+        auto& pos_list_right = pos_lists_right[job_id];
 
-    auto segment_left = chunk_left->get_segment(left_column_id);
+        auto& left_matches = left_matches_by_job[job_id];
+        if (track_left_matches) {
+          left_matches.resize(segment_left->size());
+        }
+
+        // As accessors are not thread-safe, each job needs its own evaluator
+        auto secondary_predicate_evaluator =
+            MultiPredicateJoinEvaluator{*left_table, *right_table, _mode, maybe_flipped_secondary_predicates};
+
+        std::vector<bool> right_matches;
+
+        for (auto chunk_id_right = ChunkID{static_cast<ChunkID::base_type>(right_range_begin)};
+             chunk_id_right < right_range_end; ++chunk_id_right) {
+          const auto chunk_right = right_table->get_chunk(chunk_id_right);
+          Assert(chunk_right, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
-    std::vector<bool> left_matches;
+          const auto segment_right = chunk_right->get_segment(right_column_id);
 
-    if (track_left_matches) {
-      left_matches.resize(segment_left->size());
+          if (track_right_matches) {
+            right_matches.assign(segment_right->size(), false);
+          }
+
+          JoinParams params{pos_list_left,
+                            pos_list_right,
+                            left_matches,
+                            right_matches,
+                            track_left_matches,
+                            track_right_matches,
+                            _mode,
+                            maybe_flipped_predicate_condition,
+                            secondary_predicate_evaluator,
+                            !is_semi_or_anti_join};
+          _join_two_untyped_segments(*segment_left, *segment_right, chunk_id_left, chunk_id_right, params);
+
+          if (track_right_matches) {
+            auto& merged_right_matches = right_matches_by_chunk[chunk_id_right];
+            const auto lock = std::lock_guard<std::mutex>{right_matches_mutexes[chunk_id_right]};
+            for (auto chunk_offset = size_t{0}; chunk_offset < right_matches.size(); ++chunk_offset) {
+              if (right_matches[chunk_offset]) merged_right_matches[chunk_offset] = true;
+            }
+          }
+        }
+      }));
     }
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
 
-    for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < chunk_count_right; ++chunk_id_right) {
-      const auto chunk_right = right_table->get_chunk(chunk_id_right);
-      Assert(chunk_right, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+  // Track pairs of matching RowIDs
+  const auto pos_list_left = std::make_shared<RowIDPosList>();
+  const auto pos_list_right = std::make_shared<RowIDPosList>();
+
+  auto match_count = size_t{0};
+  for (const auto& job_pos_list_left : pos_lists_left) {
+    match_count += job_pos_list_left.size();
+  }
+  pos_list_left->reserve(match_count);
+  pos_list_right->reserve(match_count);
 
-      const auto segment_right = chunk_right->get_segment(right_column_id);
-
-      JoinParams params{*pos_list_left,
-                        *pos_list_right,
-                        left_matches,
-                        right_matches_by_chunk[chunk_id_right],
-                        track_left_matches,
-                        track_right_matches,
-                        _mode,
-                        maybe_flipped_predicate_condition,
-                        secondary_predicate_evaluator,
-                        !is_semi_or_anti_join};
-      _join_two_untyped_segments(*segment_left, *segment_right, chunk_id_left, chunk_id_right, params);
+  for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < chunk_count_left; ++chunk_id_left) {
+    auto& left_matches = left_matches_by_chunk[chunk_id_left];
+    for (auto job_id = chunk_id_left * right_range_count; job_id < (chunk_id_left + 1) * right_range_count; ++job_id) {
+      pos_list_left->insert(pos_list_left->end(), pos_lists_left[job_id].begin(), pos_lists_left[job_id].end());
+      pos_list_right->insert(pos_list_right->end(), pos_lists_right[job_id].begin(), pos_lists_right[job_id].end());
+
+      // Merge the matches that the jobs of this left chunk found in their ranges of right chunks
+      const auto& job_left_matches = left_matches_by_job[job_id];
+      left_matches.resize(job_left_matches.size());
+      for (auto chunk_offset = size_t{0}; chunk_offset < job_left_matches.size(); ++chunk_offset) {
+        if (job_left_matches[chunk_offset]) left_matches[chunk_offset] = true;
+      }
     }
 
     if (is_outer_join) {
@@ -192,8 +265,6 @@ std::shared_ptr<const Table> JoinNestedLoop::_on_execute() {
         }
       }
     }
-
-    left_matches_by_chunk[chunk_id_left] = std::move(left_matches);
   }
 
   // For Full Outer we need to add all unmatched rows for the right side.
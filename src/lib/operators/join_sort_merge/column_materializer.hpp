@@ -161,9 +161,9 @@ class ColumnMaterializer {
       }
     });
 
-    if (_sort) {
-      std::sort(output.begin(), output.end(),
-                [](const auto& left, const auto& right) { return left.value < right.value; });
+    const auto value_less = [](const auto& left, const auto& right) { return left.value < right.value; };
+    if (_sort && !std::is_sorted(output.begin(), output.end(), value_less)) {
+      std::sort(output.begin(), output.end(), value_less);
     }
 
     _gather_samples_from_segment(output, subsample);
@@ -312,11 +312,14 @@ class RadixClusterSort {
   }
 
   /**
-  * Sorts all clusters of a materialized table.
+  * Sorts all clusters of a materialized table. As the clustering is stable, the clusters of an input that is already
+  * sorted (e.g., by a preceding Sort operator) are sorted, too. Checking this first is cheap compared to sorting.
   **/
   void _sort_clusters(std::unique_ptr<MaterializedSegmentList<T>>& clusters) {
+    const auto value_less = [](const auto& left, const auto& right) { return left.value < right.value; };
     for (auto cluster : *clusters) {
-      std::sort(cluster->begin(), cluster->end(), [](auto& left, auto& right) { return left.value < right.value; });
+      if (std::is_sorted(cluster->begin(), cluster->end(), value_less)) continue;
+      std::sort(cluster->begin(), cluster->end(), value_less);
     }
   }
 
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <numeric>
 #include <string>
 #include <utility>
@@ -12,6 +13,8 @@
 #include "expression/expression_utils.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "expression/value_expression.hpp"
+#include "hyrise.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/resolve_encoded_segment_type.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
@@ -66,138 +69,178 @@ std::shared_ptr<const Table> Projection::_on_execute() {
    * Perform the projection
    */
   auto output_chunk_segments = std::vector<Segments>(input_table.chunk_count());
+  auto column_is_nullable_mutex = std::mutex{};
+
+  // Projects the chunks from job_start_chunk_id to job_end_chunk_id (inclusive). Chunks are independent, so multiple
+  // calls can run in parallel.
+  const auto project_chunks = [&](const ChunkID job_start_chunk_id, const ChunkID job_end_chunk_id) {
+    auto job_column_is_nullable = std::vector<bool>(expressions.size(), false);
+
+    for (auto chunk_id = job_start_chunk_id; chunk_id <= job_end_chunk_id; ++chunk_id) {
+      const auto input_chunk = input_table.get_chunk(chunk_id);
+      Assert(input_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+      auto output_segments = Segments{expressions.size()};
+
+      ExpressionEvaluator evaluator(left_input_table(), chunk_id, uncorrelated_subquery_results);
+
+      for (auto column_id = ColumnID{0}; column_id < expressions.size(); ++column_id) {
+        const auto& expression = expressions[column_id];
+
+        // Forward input column if possible
+        if (expression->type == ExpressionType::PQPColumn && forward_columns) {
+          const auto pqp_column_expression = std::static_pointer_cast<PQPColumnExpression>(expression);
+          output_segments[column_id] = input_chunk->get_segment(pqp_column_expression->column_id);
+          job_column_is_nullable[column_id] =
+              job_column_is_nullable[column_id] || input_table.column_is_nullable(pqp_column_expression->column_id);
+        } else if (expression->type == ExpressionType::PQPColumn && !forward_columns) {
+          // The current column will be returned without any logical modifications. As other columns do get modified
+          // (and returned as a ValueSegment), all segments (including this one) need to become ValueSegments. This
+          // segment is not yet a ValueSegment (otherwise forward_columns would be true); thus we need to materialize
+          // it.
+
+          // TODO(jk): Once we have a smart pos list that knows that a single chunk is referenced in its entirety, we
+          //           can simply forward that chunk here instead of materializing it.
+
+          const auto pqp_column_expression = std::static_pointer_cast<PQPColumnExpression>(expression);
+          const auto segment = input_chunk->get_segment(pqp_column_expression->column_id);
+
+          resolve_data_type(expression->data_type(), [&](const auto data_type) {
+            using ColumnDataType = typename decltype(data_type)::type;
+
+            const auto reference_segment = std::dynamic_pointer_cast<ReferenceSegment>(segment);
+            DebugAssert(reference_segment, "Expected ReferenceSegment");
+
+            // If the ReferenceSegment references a single (FixedString)DictionarySegment, do not materialize it as a
+            // ValueSegment, but re-use its dictionary and only copy the value ids.
+            auto referenced_dictionary_segment = std::shared_ptr<BaseDictionarySegment>{};
+
+            const auto& pos_list = reference_segment->pos_list();
+            if (pos_list->references_single_chunk()) {
+              const auto& referenced_table = reference_segment->referenced_table();
+              const auto& referenced_chunk = referenced_table->get_chunk(pos_list->common_chunk_id());
+              const auto& referenced_segment = referenced_chunk->get_segment(reference_segment->referenced_column_id());
+              referenced_dictionary_segment = std::dynamic_pointer_cast<BaseDictionarySegment>(referenced_segment);
+            }
 
-  const auto chunk_count_input_table = input_table.chunk_count();
-  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count_input_table; ++chunk_id) {
-    const auto input_chunk = input_table.get_chunk(chunk_id);
-    Assert(input_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+            if (referenced_dictionary_segment) {
+              // Resolving the BaseDictionarySegment so that we can handle both regular and fixed-string dictionaries
+              resolve_encoded_segment_type<ColumnDataType>(
+                  *referenced_dictionary_segment, [&](const auto& typed_segment) {
+                    using DictionarySegmentType = std::decay_t<decltype(typed_segment)>;
+
+                    // Write new a attribute vector containing only positions given from the input_pos_list.
+                    [[maybe_unused]] auto materialize_filtered_attribute_vector = [](const auto& dictionary_segment,
+                                                                                     const auto& input_pos_list) {
+                      auto filtered_attribute_vector = pmr_vector<ValueID::base_type>(input_pos_list->size());
+                      auto iterable = create_iterable_from_attribute_vector(dictionary_segment);
+                      auto chunk_offset = ChunkOffset{0};
+                      iterable.with_iterators(input_pos_list, [&](auto it, auto end) {
+                        while (it != end) {
+                          filtered_attribute_vector[chunk_offset] = it->value();
+                          ++it;
+                          ++chunk_offset;
+                        }
+                      });
+                      // DictionarySegments take BaseCompressedVectors, not an std::vector<ValueId> for the attribute
+                      // vector. But the latter can be wrapped into a FixedSizeByteAligned<uint32_t> without copying.
+                      return std::make_shared<FixedSizeByteAlignedVector<uint32_t>>(
+                          std::move(filtered_attribute_vector));
+                    };
+
+                    if constexpr (std::is_same_v<DictionarySegmentType, DictionarySegment<ColumnDataType>>) {  // NOLINT
+                      const auto compressed_attribute_vector =
+                          materialize_filtered_attribute_vector(typed_segment, pos_list);
+                      const auto& dictionary = typed_segment.dictionary();
+
+                      output_segments[column_id] = std::make_shared<DictionarySegment<ColumnDataType>>(
+                          dictionary, std::move(compressed_attribute_vector));
+                    } else if constexpr (std::is_same_v<DictionarySegmentType,  // NOLINT - lint.sh wants {} here
+                                                        FixedStringDictionarySegment<ColumnDataType>>) {
+                      const auto compressed_attribute_vector =
+                          materialize_filtered_attribute_vector(typed_segment, pos_list);
+                      const auto& dictionary = typed_segment.fixed_string_dictionary();
+
+                      output_segments[column_id] = std::make_shared<FixedStringDictionarySegment<ColumnDataType>>(
+                          dictionary, std::move(compressed_attribute_vector));
+                    } else {
+                      Fail("Referenced segment was dynamically casted to BaseDictionarySegment, but resolve failed");
+                    }
+                    // clang-format on
+                  });
+            } else {
+              // End of dictionary segment shortcut - handle all other referenced segments and ReferenceSegments that
+              // reference more than a single chunk by materializing them into a ValueSegment
+              bool has_null = false;
+              auto values = pmr_vector<ColumnDataType>(segment->size());
+              auto null_values = pmr_vector<bool>(
+                  input_table.column_is_nullable(pqp_column_expression->column_id) ? segment->size() : 0);
+
+              auto chunk_offset = ChunkOffset{0};
+              segment_iterate<ColumnDataType>(*segment, [&](const auto& position) {
+                if (position.is_null()) {
+                  DebugAssert(!null_values.empty(), "Mismatching NULL information");
+                  has_null = true;
+                  null_values[chunk_offset] = true;
+                } else {
+                  values[chunk_offset] = position.value();
+                }
+                ++chunk_offset;
+              });
+
+              auto value_segment = std::shared_ptr<ValueSegment<ColumnDataType>>{};
+              if (has_null) {
+                value_segment =
+                    std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values));
+              } else {
+                value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values));
+              }
 
-    auto output_segments = Segments{expressions.size()};
+              output_segments[column_id] = std::move(value_segment);
+              job_column_is_nullable[column_id] = job_column_is_nullable[column_id] || has_null;
+            }
+          });
+        } else {
+          auto output_segment = evaluator.evaluate_expression_to_segment(*expression);
+          job_column_is_nullable[column_id] = job_column_is_nullable[column_id] || output_segment->is_nullable();
+          output_segments[column_id] = std::move(output_segment);
+        }
+      }
 
-    ExpressionEvaluator evaluator(left_input_table(), chunk_id, uncorrelated_subquery_results);
+      output_chunk_segments[chunk_id] = std::move(output_segments);
+    }
 
+    const auto lock = std::lock_guard<std::mutex>{column_is_nullable_mutex};
     for (auto column_id = ColumnID{0}; column_id < expressions.size(); ++column_id) {
-      const auto& expression = expressions[column_id];
-
-      // Forward input column if possible
-      if (expression->type == ExpressionType::PQPColumn && forward_columns) {
-        const auto pqp_column_expression = std::static_pointer_cast<PQPColumnExpression>(expression);
-        output_segments[column_id] = input_chunk->get_segment(pqp_column_expression->column_id);
-        column_is_nullable[column_id] =
-            column_is_nullable[column_id] || input_table.column_is_nullable(pqp_column_expression->column_id);
-      } else if (expression->type == ExpressionType::PQPColumn && !forward_columns) {
-        // The current column will be returned without any logical modifications. As other columns do get modified (and
-        // returned as a ValueSegment), all segments (including this one) need to become ValueSegments. This segment is
-        // not yet a ValueSegment (otherwise forward_columns would be true); thus we need to materialize it.
-
-        // TODO(jk): Once we have a smart pos list that knows that a single chunk is referenced in its entirety, we can
-        //           simply forward that chunk here instead of materializing it.
-
-        const auto pqp_column_expression = std::static_pointer_cast<PQPColumnExpression>(expression);
-        const auto segment = input_chunk->get_segment(pqp_column_expression->column_id);
-
-        resolve_data_type(expression->data_type(), [&](const auto data_type) {
-          using ColumnDataType = typename decltype(data_type)::type;
-
-          const auto reference_segment = std::dynamic_pointer_cast<ReferenceSegment>(segment);
-          DebugAssert(reference_segment, "Expected ReferenceSegment");
-
-          // If the ReferenceSegment references a single (FixedString)DictionarySegment, do not materialize it as a
-          // ValueSegment, but re-use its dictionary and only copy the value ids.
-          auto referenced_dictionary_segment = std::shared_ptr<BaseDictionarySegment>{};
-
-          const auto& pos_list = reference_segment->pos_list();
-          if (pos_list->references_single_chunk()) {
-            const auto& referenced_table = reference_segment->referenced_table();
-            const auto& referenced_chunk = referenced_table->get_chunk(pos_list->common_chunk_id());
-            const auto& referenced_segment = referenced_chunk->get_segment(reference_segment->referenced_column_id());
-            referenced_dictionary_segment = std::dynamic_pointer_cast<BaseDictionarySegment>(referenced_segment);
-          }
-
-          if (referenced_dictionary_segment) {
-            // Resolving the BaseDictionarySegment so that we can handle both regular and fixed-string dictionaries
-            resolve_encoded_segment_type<ColumnDataType>(
-                *referenced_dictionary_segment, [&](const auto& typed_segment) {
-                  using DictionarySegmentType = std::decay_t<decltype(typed_segment)>;
-
-                  // Write new a attribute vector containing only positions given from the input_pos_list.
-                  [[maybe_unused]] auto materialize_filtered_attribute_vector = [](const auto& dictionary_segment,
-                                                                                   const auto& input_pos_list) {
-                    auto filtered_attribute_vector = pmr_vector<ValueID::base_type>(input_pos_list->size());
-                    auto iterable = create_iterable_from_attribute_vector(dictionary_segment);
-                    auto chunk_offset = ChunkOffset{0};
-                    iterable.with_iterators(input_pos_list, [&](auto it, auto end) {
-                      while (it != end) {
-                        filtered_attribute_vector[chunk_offset] = it->value();
-                        ++it;
-                        ++chunk_offset;
-                      }
-                    });
-                    // DictionarySegments take BaseCompressedVectors, not an std::vector<ValueId> for the attribute
-                    // vector. But the latter can be wrapped into a FixedSizeByteAligned<uint32_t> without copying.
-                    return std::make_shared<FixedSizeByteAlignedVector<uint32_t>>(std::move(filtered_attribute_vector));
-                  };
-
-                  if constexpr (std::is_same_v<DictionarySegmentType, DictionarySegment<ColumnDataType>>) {  // NOLINT
-                    const auto compressed_attribute_vector =
-                        materialize_filtered_attribute_vector(typed_segment, pos_list);
-                    const auto& dictionary = typed_segment.dictionary();
-
-                    output_segments[column_id] = std::make_shared<DictionarySegment<ColumnDataType>>(
-                        dictionary, std::move(compressed_attribute_vector));
-                  } else if constexpr (std::is_same_v<DictionarySegmentType,  // NOLINT - lint.sh wants {} on same line
-                                                      FixedStringDictionarySegment<ColumnDataType>>) {
-                    const auto compressed_attribute_vector =
-                        materialize_filtered_attribute_vector(typed_segment, pos_list);
-                    const auto& dictionary = typed_segment.fixed_string_dictionary();
-
-                    output_segments[column_id] = std::make_shared<FixedStringDictionarySegment<ColumnDataType>>(
-                        dictionary, std::move(compressed_attribute_vector));
-                  } else {
-                    Fail("Referenced segment was dynamically casted to BaseDictionarySegment, but resolve failed");
-                  }
-                  // clang-format on
-                });
-          } else {
-            // End of dictionary segment shortcut - handle all other referenced segments and ReferenceSegments that
-            // reference more than a single chunk by materializing them into a ValueSegment
-            bool has_null = false;
-            auto values = pmr_vector<ColumnDataType>(segment->size());
-            auto null_values = pmr_vector<bool>(
-                input_table.column_is_nullable(pqp_column_expression->column_id) ? segment->size() : 0);
-
-            auto chunk_offset = ChunkOffset{0};
-            segment_iterate<ColumnDataType>(*segment, [&](const auto& position) {
-              if (position.is_null()) {
-                DebugAssert(!null_values.empty(), "Mismatching NULL information");
-                has_null = true;
-                null_values[chunk_offset] = true;
-              } else {
-                values[chunk_offset] = position.value();
-              }
-              ++chunk_offset;
-            });
+      column_is_nullable[column_id] = column_is_nullable[column_id] || job_column_is_nullable[column_id];
+    }
+  };
 
-            auto value_segment = std::shared_ptr<ValueSegment<ColumnDataType>>{};
-            if (has_null) {
-              value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values));
-            } else {
-              value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values));
-            }
+  // As in the Validate operator, small chunks are bundled into jobs of at least Chunk::DEFAULT_SIZE rows to avoid
+  // scheduling overhead. If all chunks fit into a single job, it is executed directly.
+  const auto chunk_count_input_table = input_table.chunk_count();
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  auto job_start_chunk_id = ChunkID{0};
+  auto job_row_count = size_t{0};
+  for (auto job_end_chunk_id = ChunkID{0}; job_end_chunk_id < chunk_count_input_table; ++job_end_chunk_id) {
+    const auto input_chunk = input_table.get_chunk(job_end_chunk_id);
+    Assert(input_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
-            output_segments[column_id] = std::move(value_segment);
-            column_is_nullable[column_id] = has_null;
-          }
-        });
-      } else {
-        auto output_segment = evaluator.evaluate_expression_to_segment(*expression);
-        column_is_nullable[column_id] = column_is_nullable[column_id] || output_segment->is_nullable();
-        output_segments[column_id] = std::move(output_segment);
-      }
+    job_row_count += input_chunk->size();
+    if (job_row_count < Chunk::DEFAULT_SIZE && job_end_chunk_id < chunk_count_input_table - 1) continue;
+
+    if (job_start_chunk_id == 0 && job_end_chunk_id == chunk_count_input_table - 1) {
+      project_chunks(job_start_chunk_id, job_end_chunk_id);
+    } else {
+      jobs.emplace_back(std::make_shared<JobTask>([&, job_start_chunk_id, job_end_chunk_id]() {
+        project_chunks(job_start_chunk_id, job_end_chunk_id);
+      }));
     }
 
-    output_chunk_segments[chunk_id] = std::move(output_segments);
+    job_start_chunk_id = job_end_chunk_id + 1;
+    job_row_count = 0;
   }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
 
   /**
    * Determine the TableColumnDefinitions and build the output table
@@ -1,6 +1,13 @@
 #include "sort.hpp"
 
+#include <queue>
+
+#include "hyrise.hpp"
+#include "memory/spill_file.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/segment_iterate.hpp"
+#include "utils/settings/memory_budget_setting.hpp"
 
 namespace {
 
@@ -21,14 +28,13 @@ std::shared_ptr<Table> write_materialized_output_table(const std::shared_ptr<con
   // Ceiling of integer division
   const auto div_ceil = [](auto x, auto y) { return (x + y - 1u) / y; };
   const auto output_chunk_count = div_ceil(pos_list.size(), output_chunk_size);
-  Assert(pos_list.size() == unsorted_table->row_count(), "Mismatching size of input table and PosList");
 
   // Vector of segments for each chunk
   std::vector<Segments> output_segments_by_chunk(output_chunk_count);
 
   // Materialize column by column, starting a new ValueSegment whenever output_chunk_size is reached
   const auto input_chunk_count = unsorted_table->chunk_count();
-  const auto row_count = unsorted_table->row_count();
+  const auto row_count = pos_list.size();
   for (ColumnID column_id{0u}; column_id < output->column_count(); ++column_id) {
     const auto column_data_type = output->column_data_type(column_id);
 
@@ -119,7 +125,6 @@ std::shared_ptr<Table> write_reference_output_table(const std::shared_ptr<const
   // Ceiling of integer division
   const auto div_ceil = [](auto x, auto y) { return (x + y - 1u) / y; };
   const auto output_chunk_count = div_ceil(input_pos_list.size(), output_chunk_size);
-  Assert(input_pos_list.size() == unsorted_table->row_count(), "Mismatching size of input table and PosList");
 
   // Vector of segments for each chunk
   auto output_segments_by_chunk = std::vector<Segments>(output_chunk_count, Segments(column_count));
@@ -246,8 +251,6 @@ std::shared_ptr<const Table> Sort::_on_execute() {
     }
   }
 
-  std::shared_ptr<Table> sorted_table;
-
   // After the first (least significant) sort operation has been completed, this holds the order of the table as it has
   // been determined so far. This is not a completely proper PosList on the input table as it might point to
   // ReferenceSegments.
@@ -265,12 +268,24 @@ std::shared_ptr<const Table> Sort::_on_execute() {
     });
   }
 
+  Assert(previously_sorted_pos_list->size() == input_table->row_count(),
+         "Mismatching size of input table and PosList");
+  return write_sorted_output_table(input_table, std::move(*previously_sorted_pos_list), _sort_definitions[0],
+                                   _output_chunk_size, _force_materialization);
+}
+
+std::shared_ptr<Table> write_sorted_output_table(const std::shared_ptr<const Table>& input_table, RowIDPosList pos_list,
+                                                 const SortColumnDefinition& most_significant_sort_definition,
+                                                 const ChunkOffset output_chunk_size,
+                                                 const Sort::ForceMaterialization force_materialization) {
+  std::shared_ptr<Table> sorted_table;
+
   // We have to materialize the output (i.e., write ValueSegments) if
   //  (a) it is requested by the user,
   //  (b) a column in the table references multiple tables (see write_reference_output_table for details), or
   //  (c) a column in the table references multiple columns in the same table (which is an unlikely edge case).
   // Cases (b) and (c) can only occur if there is more than one ReferenceSegment in an input chunk.
-  auto must_materialize = _force_materialization == ForceMaterialization::Yes;
+  auto must_materialize = force_materialization == Sort::ForceMaterialization::Yes;
   const auto input_chunk_count = input_table->chunk_count();
   if (!must_materialize && input_table->type() == TableType::References && input_chunk_count > 1) {
     const auto input_column_count = input_table->column_count();
@@ -297,21 +312,18 @@ std::shared_ptr<const Table> Sort::_on_execute() {
   }
 
   if (must_materialize) {
-    sorted_table =
-        write_materialized_output_table(input_table, std::move(*previously_sorted_pos_list), _output_chunk_size);
+    sorted_table = write_materialized_output_table(input_table, std::move(pos_list), output_chunk_size);
   } else {
-    sorted_table =
-        write_reference_output_table(input_table, std::move(*previously_sorted_pos_list), _output_chunk_size);
+    sorted_table = write_reference_output_table(input_table, std::move(pos_list), output_chunk_size);
   }
 
-  const auto& final_sort_definition = _sort_definitions[0];
   // Set the sorted_by attribute of the output's chunks according to the most significant sort operation, which is the
   // column the table was sorted by last.
   const auto output_chunk_count = sorted_table->chunk_count();
   for (auto output_chunk_id = ChunkID{0}; output_chunk_id < output_chunk_count; ++output_chunk_id) {
     const auto& output_chunk = sorted_table->get_chunk(output_chunk_id);
     output_chunk->finalize();
-    output_chunk->set_individually_sorted_by(final_sort_definition);
+    output_chunk->set_individually_sorted_by(most_significant_sort_definition);
   }
   return sorted_table;
 }
@@ -323,23 +335,32 @@ class Sort::SortImpl {
 
   SortImpl(const std::shared_ptr<const Table>& table_in, const ColumnID column_id,
            const SortMode sort_mode = SortMode::Ascending)
-      : _table_in(table_in), _column_id(column_id), _sort_mode(sort_mode) {
-    const auto row_count = _table_in->row_count();
-    _row_id_value_vector.reserve(row_count);
-    _null_value_rows.reserve(row_count);
-  }
+      : _table_in(table_in), _column_id(column_id), _sort_mode(sort_mode) {}
 
   // Sorts table_in, potentially taking the pre-existing order of previously_sorted_pos_list into account.
   // Returns a PosList, which can either be used as an input to the next call of sort or for materializing the
   // output table.
   RowIDPosList sort(const std::optional<RowIDPosList>& previously_sorted_pos_list) {
+    const auto row_count = _table_in->row_count();
+    const auto memory_budget = MemoryBudgetSetting::operator_memory_budget();
+    if (memory_budget && row_count * sizeof(RowIDValuePair) > *memory_budget) {
+      if (_sort_mode == SortMode::Ascending) {
+        return _sort_with_spilling(previously_sorted_pos_list, *memory_budget, std::less<>{});
+      } else {
+        return _sort_with_spilling(previously_sorted_pos_list, *memory_budget, std::greater<>{});
+      }
+    }
+
     // 1. Prepare Sort: Creating RowID-value-Structure
-    _materialize_sort_column(previously_sorted_pos_list);
+    _row_id_value_vector.reserve(row_count);
+    _null_value_rows.reserve(row_count);
+    _materialize_sort_column(previously_sorted_pos_list, [] {});
 
     // 2. After we got our ValueRowID Map we sort the map by the value of the pair
     const auto sort_with_comparator = [&](auto comparator) {
-      std::stable_sort(_row_id_value_vector.begin(), _row_id_value_vector.end(),
-                       [comparator](RowIDValuePair a, RowIDValuePair b) { return comparator(a.second, b.second); });
+      _sort_row_id_value_vector([comparator](const RowIDValuePair& a, const RowIDValuePair& b) {
+        return comparator(a.second, b.second);
+      });
     };
     if (_sort_mode == SortMode::Ascending) {
       sort_with_comparator(std::less<>{});
@@ -366,13 +387,207 @@ class Sort::SortImpl {
   }
 
  protected:
-  // completely materializes the sort column to create a vector of RowID-Value pairs
-  void _materialize_sort_column(const std::optional<RowIDPosList>& previously_sorted_pos_list) {
+  // Sorts _row_id_value_vector stably. Small inputs, or inputs sorted without a multi-threaded scheduler, are sorted
+  // using a single std::stable_sort. Otherwise, the vector is split into runs of PARALLEL_SORT_RUN_SIZE rows, which
+  // are sorted by individual JobTasks. Afterwards, neighboring runs are merged pairwise until a single run remains.
+  // Each of these merges is again split into independent parts (see _add_merge_jobs) so that the final merge steps
+  // do not degrade to a single thread. As std::stable_sort and std::merge are stable and runs are only merged with
+  // their direct neighbors, the result is identical to that of a single std::stable_sort.
+  template <typename Comparator>
+  void _sort_row_id_value_vector(const Comparator& comparator) {
+    const auto row_count = _row_id_value_vector.size();
+    if (row_count < 2 * PARALLEL_SORT_RUN_SIZE || !Hyrise::get().is_multi_threaded()) {
+      std::stable_sort(_row_id_value_vector.begin(), _row_id_value_vector.end(), comparator);
+      return;
+    }
+
+    // Run i covers the rows [run_begins[i], run_begins[i + 1]). The last entry is the end of the vector.
+    auto run_begins = std::vector<size_t>{};
+    for (auto run_begin = size_t{0}; run_begin < row_count; run_begin += PARALLEL_SORT_RUN_SIZE) {
+      run_begins.emplace_back(run_begin);
+    }
+    run_begins.emplace_back(row_count);
+
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(run_begins.size() - 1);
+    for (auto run_id = size_t{0}; run_id < run_begins.size() - 1; ++run_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, run_id]() {
+        std::stable_sort(_row_id_value_vector.begin() + run_begins[run_id],
+                         _row_id_value_vector.begin() + run_begins[run_id + 1], comparator);
+      }));
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+    // Merge rounds alternate between _row_id_value_vector and a buffer of the same size.
+    auto buffer = std::vector<RowIDValuePair>(row_count);
+    auto* source = &_row_id_value_vector;
+    auto* target = &buffer;
+
+    while (run_begins.size() > 2) {
+      jobs.clear();
+      auto merged_run_begins = std::vector<size_t>{};
+      merged_run_begins.reserve(run_begins.size() / 2 + 2);
+
+      const auto run_count = run_begins.size() - 1;
+      for (auto run_id = size_t{0}; run_id < run_count; run_id += 2) {
+        merged_run_begins.emplace_back(run_begins[run_id]);
+
+        if (run_id + 1 == run_count) {
+          // Odd number of runs: The last run has no partner in this round and is copied as-is.
+          jobs.emplace_back(std::make_shared<JobTask>([&, run_id]() {
+            std::copy(source->begin() + run_begins[run_id], source->begin() + run_begins[run_id + 1],
+                      target->begin() + run_begins[run_id]);
+          }));
+          continue;
+        }
+
+        _add_merge_jobs(*source, *target, run_begins[run_id], run_begins[run_id + 1], run_begins[run_id + 2],
+                        comparator, jobs);
+      }
+      merged_run_begins.emplace_back(row_count);
+
+      Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+      std::swap(source, target);
+      run_begins = std::move(merged_run_begins);
+    }
+
+    if (source != &_row_id_value_vector) {
+      _row_id_value_vector = std::move(buffer);
+    }
+  }
+
+  // Adds jobs that stably merge the sorted ranges [begin, middle) and [middle, end) of source into the same positions
+  // of target. The longer of both ranges is cut into parts of PARALLEL_SORT_RUN_SIZE rows and the matching split
+  // positions in the other range are found using binary search. Ties are resolved in favor of the left range: a split
+  // at left position l corresponds to the first right position whose value is not less than source[l]; a split at
+  // right position r corresponds to the first left position whose value is greater than source[r].
+  template <typename Comparator>
+  void _add_merge_jobs(const std::vector<RowIDValuePair>& source, std::vector<RowIDValuePair>& target,
+                       const size_t begin, const size_t middle, const size_t end, const Comparator& comparator,
+                       std::vector<std::shared_ptr<AbstractTask>>& jobs) {
+    const auto source_begin = source.begin();
+
+    // Pairs of (left position, right position) at which the merge is split.
+    auto split_positions = std::vector<std::pair<size_t, size_t>>{{begin, middle}};
+    if (middle - begin >= end - middle) {
+      for (auto left_split = begin + PARALLEL_SORT_RUN_SIZE; left_split < middle;
+           left_split += PARALLEL_SORT_RUN_SIZE) {
+        const auto right_split =
+            std::lower_bound(source_begin + middle, source_begin + end, source[left_split], comparator) - source_begin;
+        split_positions.emplace_back(left_split, right_split);
+      }
+    } else {
+      for (auto right_split = middle + PARALLEL_SORT_RUN_SIZE; right_split < end;
+           right_split += PARALLEL_SORT_RUN_SIZE) {
+        const auto left_split =
+            std::upper_bound(source_begin + begin, source_begin + middle, source[right_split], comparator) -
+            source_begin;
+        split_positions.emplace_back(left_split, right_split);
+      }
+    }
+    split_positions.emplace_back(middle, end);
+
+    for (auto part_id = size_t{0}; part_id < split_positions.size() - 1; ++part_id) {
+      const auto [left_begin, right_begin] = split_positions[part_id];
+      const auto [left_end, right_end] = split_positions[part_id + 1];
+      const auto target_begin = begin + (left_begin - begin) + (right_begin - middle);
+
+      jobs.emplace_back(std::make_shared<JobTask>([&, left_begin, left_end, right_begin, right_end, target_begin]() {
+        std::merge(source.begin() + left_begin, source.begin() + left_end, source.begin() + right_begin,
+                   source.begin() + right_end, target.begin() + target_begin, comparator);
+      }));
+    }
+  }
+
+  // External merge sort used if the materialized sort column would exceed the operator memory budget (see
+  // MemoryBudgetSetting). While the column is materialized, every run of as many values as fit into the budget is
+  // sorted and written to a SpillFile. Afterwards, the runs are read back and merged using a priority queue. On ties,
+  // the queue prefers the earlier run, which keeps the sort stable. Only the RowIDs of the result are kept in memory.
+  template <typename ValueComparator>
+  RowIDPosList _sort_with_spilling(const std::optional<RowIDPosList>& previously_sorted_pos_list,
+                                   const size_t memory_budget, const ValueComparator& value_comparator) {
+    const auto run_size = std::max(size_t{1}, memory_budget / sizeof(RowIDValuePair));
+    const auto comparator = [&value_comparator](const RowIDValuePair& a, const RowIDValuePair& b) {
+      return value_comparator(a.second, b.second);
+    };
+
+    auto spill_file = SpillFile{};
+    auto run_ranges = std::vector<SpillFile::Range>{};
+    const auto sort_and_spill_run = [&] {
+      _sort_row_id_value_vector(comparator);
+
+      auto writer = SpillWriter{spill_file};
+      for (const auto& [row_id, value] : _row_id_value_vector) {
+        writer.write(row_id);
+        writer.write(value);
+      }
+      run_ranges.emplace_back(writer.finish());
+      _row_id_value_vector.clear();
+    };
+
+    _row_id_value_vector.reserve(std::min(run_size, static_cast<size_t>(_table_in->row_count())));
+    _materialize_sort_column(previously_sorted_pos_list, [&] {
+      if (_row_id_value_vector.size() == run_size) sort_and_spill_run();
+    });
+    if (!_row_id_value_vector.empty()) sort_and_spill_run();
+    _row_id_value_vector = std::vector<RowIDValuePair>{};
+
+    // NULLs come first, see sort().
+    auto pos_list = RowIDPosList{};
+    pos_list.reserve(_table_in->row_count());
+    for (const auto& [row_id, _] : _null_value_rows) {
+      pos_list.emplace_back(row_id);
+    }
+    _null_value_rows = std::vector<RowIDValuePair>{};
+
+    struct RunHead {
+      SortColumnType value;
+      RowID row_id;
+      size_t run_id;
+    };
+
+    // std::priority_queue returns its greatest element, so the comparator tells whether a comes after b.
+    const auto comes_after = [&value_comparator](const RunHead& a, const RunHead& b) {
+      return value_comparator(b.value, a.value) || (!value_comparator(a.value, b.value) && a.run_id > b.run_id);
+    };
+    auto run_heads = std::priority_queue<RunHead, std::vector<RunHead>, decltype(comes_after)>{comes_after};
+
+    const auto run_count = run_ranges.size();
+    auto readers = std::vector<std::unique_ptr<SpillReader>>(run_count);
+    const auto read_run_head = [&](const size_t run_id) {
+      auto& reader = *readers[run_id];
+      if (reader.at_end()) return;
+
+      const auto row_id = reader.read<RowID>();
+      run_heads.push(RunHead{reader.read<SortColumnType>(), row_id, run_id});
+    };
+
+    for (auto run_id = size_t{0}; run_id < run_count; ++run_id) {
+      readers[run_id] = std::make_unique<SpillReader>(spill_file, run_ranges[run_id]);
+      read_run_head(run_id);
+    }
+
+    while (!run_heads.empty()) {
+      const auto run_id = run_heads.top().run_id;
+      pos_list.emplace_back(run_heads.top().row_id);
+      run_heads.pop();
+      read_run_head(run_id);
+    }
+
+    return pos_list;
+  }
+
+  // completely materializes the sort column to create a vector of RowID-Value pairs. after_value_materialized is
+  // called whenever a value was added to _row_id_value_vector.
+  template <typename AfterValueMaterialized>
+  void _materialize_sort_column(const std::optional<RowIDPosList>& previously_sorted_pos_list,
+                                const AfterValueMaterialized& after_value_materialized) {
     // If there was no PosList passed, this is the first sorting run and we simply fill our values and nulls data
     // structures from our input table. Otherwise we will materialize according to the PosList which is the result of
     // the last run.
     if (previously_sorted_pos_list) {
-      _materialize_column_from_pos_list(*previously_sorted_pos_list);
+      _materialize_column_from_pos_list(*previously_sorted_pos_list, after_value_materialized);
     } else {
       const auto chunk_count = _table_in->chunk_count();
       for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
@@ -386,6 +601,7 @@ class Sort::SortImpl {
             _null_value_rows.emplace_back(RowID{chunk_id, position.chunk_offset()}, SortColumnType{});
           } else {
             _row_id_value_vector.emplace_back(RowID{chunk_id, position.chunk_offset()}, position.value());
+            after_value_materialized();
           }
         });
       }
@@ -393,7 +609,9 @@ class Sort::SortImpl {
   }
 
   // When there was a preceding sorting run, we materialize by retaining the order of the values in the passed PosList.
-  void _materialize_column_from_pos_list(const RowIDPosList& pos_list) {
+  template <typename AfterValueMaterialized>
+  void _materialize_column_from_pos_list(const RowIDPosList& pos_list,
+                                         const AfterValueMaterialized& after_value_materialized) {
     const auto input_chunk_count = _table_in->chunk_count();
     auto accessor_by_chunk_id =
         std::vector<std::unique_ptr<AbstractSegmentAccessor<SortColumnType>>>(input_chunk_count);
@@ -411,6 +629,7 @@ class Sort::SortImpl {
         _null_value_rows.emplace_back(row_id, SortColumnType{});
       } else {
         _row_id_value_vector.emplace_back(row_id, typed_value.value());
+        after_value_materialized();
       }
     }
   }
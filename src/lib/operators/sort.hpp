@@ -44,9 +44,22 @@ class Sort : public AbstractReadOnlyOperator {
   template <typename SortColumnType>
   class SortImplMaterializeOutput;
 
+  // Inputs with at least twice as many rows are sorted in parallel. Runs of this size are sorted and merged by
+  // individual JobTasks (see SortImpl::_sort_row_id_value_vector).
+  static constexpr auto PARALLEL_SORT_RUN_SIZE = size_t{Chunk::DEFAULT_SIZE};
+
   const std::vector<SortColumnDefinition> _sort_definitions;
   const ChunkOffset _output_chunk_size;
   const ForceMaterialization _force_materialization;
 };
 
+// Creates the output table of a sort operation from pos_list, which lists the rows of input_table in their output
+// order. pos_list does not need to cover all rows of input_table, as is the case for TopK. The output references the
+// input data unless materialization is forced or the input's ReferenceSegments do not allow for it. All output chunks
+// are marked as sorted by most_significant_sort_definition.
+std::shared_ptr<Table> write_sorted_output_table(const std::shared_ptr<const Table>& input_table, RowIDPosList pos_list,
+                                                 const SortColumnDefinition& most_significant_sort_definition,
+                                                 const ChunkOffset output_chunk_size,
+                                                 const Sort::ForceMaterialization force_materialization);
+
 }  // namespace opossum
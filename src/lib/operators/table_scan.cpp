@@ -26,6 +26,7 @@
 #include "scheduler/job_task.hpp"
 #include "storage/abstract_segment.hpp"
 #include "storage/chunk.hpp"
+#include "storage/pos_lists/bitmap_pos_list.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
 #include "table_scan/column_between_table_scan_impl.hpp"
@@ -119,7 +120,8 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
        */
       auto keep_chunk_sort_order = true;
       if (in_table->type() == TableType::References) {
-        auto filtered_pos_lists = std::map<std::shared_ptr<const AbstractPosList>, std::shared_ptr<RowIDPosList>>{};
+        auto filtered_pos_lists =
+            std::map<std::shared_ptr<const AbstractPosList>, std::shared_ptr<const AbstractPosList>>{};
 
         for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
           auto segment_in = chunk_in->get_segment(column_id);
@@ -135,22 +137,32 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
           auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
 
           if (!filtered_pos_list) {
-            filtered_pos_list = std::make_shared<RowIDPosList>(matches_out->size());
-            if (pos_list_in->references_single_chunk()) {
-              filtered_pos_list->guarantee_single_chunk();
+            const auto bitmap_pos_list_in = std::dynamic_pointer_cast<const BitmapPosList>(pos_list_in);
+            if (bitmap_pos_list_in &&
+                BitmapPosList::is_preferable(matches_out->size(),
+                                             bitmap_pos_list_in->bitmap().size() * BitmapPosList::BITS_PER_WORD)) {
+              // The matches are a subset of the rows of the input bitmap. Thus, the result of a chain of scans is the
+              // conjunction of their bitmaps.
+              filtered_pos_list = _filter_bitmap_pos_list(*bitmap_pos_list_in, *matches_out);
             } else {
-              // When segments reference multiple chunks, we do not keep the sort order of the input chunk. The main
-              // reason is that several table scan implementations split the pos lists by chunks (see
-              // AbstractDereferencedColumnTableScanImpl::_scan_reference_segment) and thus shuffle the data. While this
-              // does not affect all scan implementations, we chose the safe and defensive path for now.
-              keep_chunk_sort_order = false;
-            }
-
-            size_t offset = 0;
-            for (const auto& match : *matches_out) {
-              const auto row_id = (*pos_list_in)[match.chunk_offset];
-              (*filtered_pos_list)[offset] = row_id;
-              ++offset;
+              auto filtered_row_id_pos_list = std::make_shared<RowIDPosList>(matches_out->size());
+              if (pos_list_in->references_single_chunk()) {
+                filtered_row_id_pos_list->guarantee_single_chunk();
+              } else {
+                // When segments reference multiple chunks, we do not keep the sort order of the input chunk. The main
+                // reason is that several table scan implementations split the pos lists by chunks (see
+                // AbstractDereferencedColumnTableScanImpl::_scan_reference_segment) and thus shuffle the data. While
+                // this does not affect all scan implementations, we chose the safe and defensive path for now.
+                keep_chunk_sort_order = false;
+              }
+
+              size_t offset = 0;
+              for (const auto& match : *matches_out) {
+                const auto row_id = (*pos_list_in)[match.chunk_offset];
+                (*filtered_row_id_pos_list)[offset] = row_id;
+                ++offset;
+              }
+              filtered_pos_list = std::move(filtered_row_id_pos_list);
             }
           }
 
@@ -158,9 +170,18 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
           out_segments.push_back(ref_segment_out);
         }
       } else {
-        matches_out->guarantee_single_chunk();
+        // For scans that select a large part of the chunk, a bitmap is used as the pos list of the output segments.
+        auto pos_list_out = std::shared_ptr<const AbstractPosList>{};
+        const auto chunk_size = chunk_in->size();
+        if (BitmapPosList::is_preferable(matches_out->size(), chunk_size)) {
+          pos_list_out = _create_bitmap_pos_list(chunk_id, chunk_size, *matches_out);
+        } else {
+          matches_out->guarantee_single_chunk();
+          pos_list_out = matches_out;
+        }
+
         for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
-          auto ref_segment_out = std::make_shared<ReferenceSegment>(in_table, column_id, matches_out);
+          auto ref_segment_out = std::make_shared<ReferenceSegment>(in_table, column_id, pos_list_out);
           out_segments.push_back(ref_segment_out);
         }
       }
@@ -187,6 +208,26 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
   return std::make_shared<Table>(in_table->column_definitions(), TableType::References, std::move(output_chunks));
 }
 
+std::shared_ptr<const BitmapPosList> TableScan::_create_bitmap_pos_list(const ChunkID chunk_id, const size_t chunk_size,
+                                                                        const RowIDPosList& matches) {
+  auto bitmap = BitmapPosList::Bitmap(BitmapPosList::word_count(chunk_size));
+  for (const auto& match : matches) {
+    const auto chunk_offset = match.chunk_offset;
+    bitmap[chunk_offset / BitmapPosList::BITS_PER_WORD] |= uint64_t{1} << (chunk_offset % BitmapPosList::BITS_PER_WORD);
+  }
+  return std::make_shared<BitmapPosList>(chunk_id, std::move(bitmap));
+}
+
+std::shared_ptr<const BitmapPosList> TableScan::_filter_bitmap_pos_list(const BitmapPosList& pos_list_in,
+                                                                        const RowIDPosList& matches) {
+  auto bitmap = BitmapPosList::Bitmap(pos_list_in.bitmap().size());
+  for (const auto& match : matches) {
+    const auto chunk_offset = pos_list_in[match.chunk_offset].chunk_offset;
+    bitmap[chunk_offset / BitmapPosList::BITS_PER_WORD] |= uint64_t{1} << (chunk_offset % BitmapPosList::BITS_PER_WORD);
+  }
+  return std::make_shared<BitmapPosList>(pos_list_in.common_chunk_id(), std::move(bitmap));
+}
+
 std::shared_ptr<AbstractExpression> TableScan::_resolve_uncorrelated_subqueries(
     const std::shared_ptr<AbstractExpression>& predicate) {
   // If the predicate has an uncorrelated subquery as an argument, we resolve that subquery first. That way, we can
@@ -14,6 +14,7 @@
 
 namespace opossum {
 
+class BitmapPosList;
 class Table;
 
 class TableScan : public AbstractReadOnlyOperator {
@@ -89,6 +90,14 @@ class TableScan : public AbstractReadOnlyOperator {
   static std::shared_ptr<AbstractExpression> _resolve_uncorrelated_subqueries(
       const std::shared_ptr<AbstractExpression>& predicate);
 
+  // Turns the matches of a scan on a data chunk into a BitmapPosList
+  static std::shared_ptr<const BitmapPosList> _create_bitmap_pos_list(const ChunkID chunk_id, const size_t chunk_size,
+                                                                      const RowIDPosList& matches);
+
+  // Keeps the rows of the input pos list at the positions given by the matches of a scan on a reference chunk
+  static std::shared_ptr<const BitmapPosList> _filter_bitmap_pos_list(const BitmapPosList& pos_list_in,
+                                                                      const RowIDPosList& matches);
+
  private:
   const std::shared_ptr<AbstractExpression> _predicate;
 
@@ -11,6 +11,7 @@
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/table.hpp"
+#include "value_id_range_scan.hpp"
 
 #include "utils/assert.hpp"
 
@@ -139,6 +140,13 @@ void ColumnBetweenTableScanImpl::_scan_dictionary_segment(
     upper_bound_value_id = segment.unique_values_count();
   }
 
+  // Without a position filter, the value IDs are compared directly on the compressed attribute vector
+  if (!position_filter) {
+    scan_value_id_range(*segment.attribute_vector(), lower_bound_value_id, upper_bound_value_id,
+                        segment.null_value_id(), chunk_id, matches);
+    return;
+  }
+
   const auto value_id_diff = upper_bound_value_id - lower_bound_value_id;
   const auto comparator = [lower_bound_value_id, value_id_diff](const auto& position) {
     // Using < here because the right value id is the upper_bound. Also, because the value ids are integers, we can do
@@ -4,13 +4,14 @@
 #include <array>
 #include <map>
 #include <memory>
-#include <regex>
 #include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/fsst_segment.hpp"
+#include "storage/fsst_segment/fsst_segment_iterable.hpp"
 #include "storage/resolve_encoded_segment_type.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
@@ -24,7 +25,13 @@ ColumnLikeTableScanImpl::ColumnLikeTableScanImpl(const std::shared_ptr<const Tab
                                                  const pmr_string& pattern)
     : AbstractDereferencedColumnTableScanImpl{in_table, column_id, init_predicate_condition},
       _matcher{pattern},
-      _invert_results(predicate_condition == PredicateCondition::NotLike) {}
+      _invert_results(predicate_condition == PredicateCondition::NotLike) {
+  const auto tokens = LikeMatcher::pattern_string_to_tokens(pattern);
+  if (tokens.size() == 2 && std::holds_alternative<pmr_string>(tokens[0]) &&
+      tokens[1] == LikeMatcher::PatternToken{LikeMatcher::Wildcard::AnyChars}) {
+    _starts_with_prefix = std::get<pmr_string>(tokens[0]);
+  }
+}
 
 std::string ColumnLikeTableScanImpl::description() const { return "ColumnLike"; }
 
@@ -37,6 +44,9 @@ void ColumnLikeTableScanImpl::_scan_non_reference_segment(
       dictionary_segment &&
       (!position_filter || dictionary_segment->unique_values_count() <= position_filter->size())) {
     _scan_dictionary_segment(*dictionary_segment, chunk_id, matches, position_filter);
+  } else if (const auto* fsst_segment = dynamic_cast<const FSSTSegment<pmr_string>*>(&segment);
+             fsst_segment && _starts_with_prefix) {
+    _scan_fsst_segment(*fsst_segment, chunk_id, matches, position_filter);
   } else {
     _scan_generic_segment(segment, chunk_id, matches, position_filter);
   }
@@ -111,6 +121,21 @@ void ColumnLikeTableScanImpl::_scan_dictionary_segment(const BaseDictionarySegme
   });
 }
 
+void ColumnLikeTableScanImpl::_scan_fsst_segment(const FSSTSegment<pmr_string>& segment, const ChunkID chunk_id,
+                                                 RowIDPosList& matches,
+                                                 const std::shared_ptr<const AbstractPosList>& position_filter) const {
+  const auto& symbol_table = segment.symbol_table();
+  const auto& prefix = *_starts_with_prefix;
+
+  const auto iterable = erase_type_from_iterable_if_debug(FSSTSegmentIterable<pmr_string, false>{segment});
+  iterable.with_iterators(position_filter, [&](auto it, auto end) {
+    const auto matcher = [&](const auto& position) {
+      return symbol_table.decompressed_value_starts_with(position.value(), prefix) ^ _invert_results;
+    };
+    _scan_with_iterators<true>(matcher, it, end, chunk_id, matches);
+  });
+}
+
 template <typename D>
 std::pair<size_t, std::vector<bool>> ColumnLikeTableScanImpl::_find_matches_in_dictionary(const D& dictionary) const {
   auto result = std::pair<size_t, std::vector<bool>>{};
@@ -2,7 +2,7 @@
 
 #include <map>
 #include <memory>
-#include <regex>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -17,6 +17,9 @@ namespace opossum {
 
 class Table;
 
+template <typename T>
+class FSSTSegment;
+
 /**
  * @brief Implements a column scan using the LIKE operator
  *
@@ -25,9 +28,11 @@ class Table;
  * - For dictionary segments, we check the values in the dictionary and store the matches in a vector
  *   in order to avoid having to look up each value ID of the attribute vector in the dictionary. This also
  *   enables us to detect if all or none of the values in the segment satisfy the expression.
+ * - For FSST segments and prefix patterns (e.g., 'abc%'), we match the prefix against the compressed values and only
+ *   decompress each value until the prefix is covered.
  *
- * Performance Notes: Uses std::regex as a slow fallback and resorts to much faster Pattern matchers for special cases,
- *                    e.g., StartsWithPattern. 
+ * Performance Notes: Uses LikeMatcher::GeneralPattern as a fallback and resorts to faster Pattern matchers for
+ *                    special cases, e.g., StartsWithPattern.
  */
 class ColumnLikeTableScanImpl : public AbstractDereferencedColumnTableScanImpl {
  public:
@@ -44,6 +49,8 @@ class ColumnLikeTableScanImpl : public AbstractDereferencedColumnTableScanImpl {
                              const std::shared_ptr<const AbstractPosList>& position_filter) const;
   void _scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
                                 const std::shared_ptr<const AbstractPosList>& position_filter);
+  void _scan_fsst_segment(const FSSTSegment<pmr_string>& segment, const ChunkID chunk_id, RowIDPosList& matches,
+                          const std::shared_ptr<const AbstractPosList>& position_filter) const;
 
   /**
    * Used for dictionary segments
@@ -54,6 +61,9 @@ class ColumnLikeTableScanImpl : public AbstractDereferencedColumnTableScanImpl {
 
   const LikeMatcher _matcher;
 
+  // Set if the pattern is of the form 'abc%', used for FSST segments
+  std::optional<pmr_string> _starts_with_prefix;
+
   // For NOT LIKE support
   const bool _invert_results;
 };
@@ -7,9 +7,14 @@
 #include "sorted_segment_search.hpp"
 #include "storage/base_dictionary_segment.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/frame_of_reference_segment.hpp"
+#include "storage/fsst_segment.hpp"
+#include "storage/fsst_segment/fsst_segment_iterable.hpp"
 #include "storage/resolve_encoded_segment_type.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+#include "value_id_range_scan.hpp"
 
 #include "resolve_type.hpp"
 #include "type_comparison.hpp"
@@ -47,6 +52,14 @@ void ColumnVsValueTableScanImpl::_scan_non_reference_segment(
 
   if (const auto* dictionary_segment = dynamic_cast<const BaseDictionarySegment*>(&segment)) {
     _scan_dictionary_segment(*dictionary_segment, chunk_id, matches, position_filter);
+  } else if (const auto* fsst_segment = dynamic_cast<const FSSTSegment<pmr_string>*>(&segment);
+             fsst_segment && (predicate_condition == PredicateCondition::Equals ||
+                              predicate_condition == PredicateCondition::NotEquals)) {
+    _scan_fsst_segment(*fsst_segment, chunk_id, matches, position_filter);
+  } else if (const auto* encoded_segment = dynamic_cast<const AbstractEncodedSegment*>(&segment);
+             encoded_segment && encoded_segment->encoding_type() == EncodingType::FrameOfReference &&
+             !position_filter) {
+    _scan_frame_of_reference_segment(*encoded_segment, chunk_id, matches);
   } else {
     _scan_generic_segment(segment, chunk_id, matches, position_filter);
   }
@@ -77,6 +90,91 @@ void ColumnVsValueTableScanImpl::_scan_generic_segment(
   });
 }
 
+void ColumnVsValueTableScanImpl::_scan_fsst_segment(
+    const FSSTSegment<pmr_string>& segment, const ChunkID chunk_id, RowIDPosList& matches,
+    const std::shared_ptr<const AbstractPosList>& position_filter) const {
+  // FSST compresses each string deterministically. Thus, a value equals the search value if and only if their codes
+  // are equal. We compress the search value once and compare it to the codes of each row without decompressing them.
+  auto compressed_search_value = pmr_vector<char>{};
+  segment.symbol_table().compress(boost::get<pmr_string>(value), compressed_search_value);
+  const auto search_codes = std::string_view{compressed_search_value.data(), compressed_search_value.size()};
+  const auto invert_results = predicate_condition == PredicateCondition::NotEquals;
+
+  const auto iterable = erase_type_from_iterable_if_debug(FSSTSegmentIterable<pmr_string, false>{segment});
+  iterable.with_iterators(position_filter, [&](auto it, auto end) {
+    const auto comparator = [&](const auto& position) { return (position.value() == search_codes) ^ invert_results; };
+    _scan_with_iterators<true>(comparator, it, end, chunk_id, matches);
+  });
+}
+
+void ColumnVsValueTableScanImpl::_scan_frame_of_reference_segment(const AbstractEncodedSegment& segment,
+                                                                  const ChunkID chunk_id,
+                                                                  RowIDPosList& matches) const {
+  resolve_data_type(segment.data_type(), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    if constexpr (encoding_supports_data_type(enum_c<EncodingType, EncodingType::FrameOfReference>,
+                                              hana::type_c<ColumnDataType>)) {
+      using UnsignedColumnDataType = std::make_unsigned_t<ColumnDataType>;
+      constexpr auto block_size = FrameOfReferenceSegment<ColumnDataType>::block_size;
+
+      const auto& typed_segment = static_cast<const FrameOfReferenceSegment<ColumnDataType>&>(segment);
+      if (typed_segment.high_offset_values()) {
+        // The offsets of wide blocks do not fit into 32 bits, so we cannot compare them to a 32 bit search offset
+        _scan_generic_segment(segment, chunk_id, matches, nullptr);
+        return;
+      }
+
+      const auto& block_minima = typed_segment.block_minima();
+      const auto& null_values = typed_segment.null_values();
+      const auto segment_size = typed_segment.size();
+      const auto typed_value = boost::get<ColumnDataType>(value);
+
+      resolve_compressed_vector_type(typed_segment.offset_values(), [&](const auto& offset_values) {
+        auto decompressor = offset_values.create_decompressor();
+
+        with_comparator(predicate_condition, [&](auto predicate_comparator) {
+          for (auto block_id = size_t{0}; block_id < block_minima.size(); ++block_id) {
+            const auto block_begin = static_cast<ChunkOffset>(block_id * block_size);
+            const auto block_end = std::min(static_cast<ChunkOffset>(block_begin + block_size), segment_size);
+            const auto minimum = block_minima[block_id];
+
+            // Instead of adding the block's minimum to each offset, we subtract it from the search value once. If the
+            // search value lies below the minimum or above the largest representable offset, the predicate evaluates
+            // to the same result for all values of the block.
+            const auto search_value_below_block = typed_value < minimum;
+            const auto search_offset =
+                static_cast<UnsignedColumnDataType>(static_cast<UnsignedColumnDataType>(typed_value) -
+                                                    static_cast<UnsignedColumnDataType>(minimum));
+            if (search_value_below_block || search_offset > std::numeric_limits<uint32_t>::max()) {
+              const auto all_values_match = search_value_below_block ? predicate_comparator(uint32_t{1}, uint32_t{0})
+                                                                     : predicate_comparator(uint32_t{0}, uint32_t{1});
+              if (!all_values_match) continue;
+
+              for (auto chunk_offset = block_begin; chunk_offset < block_end; ++chunk_offset) {
+                if (!null_values || !(*null_values)[chunk_offset]) {
+                  matches.emplace_back(RowID{chunk_id, chunk_offset});
+                }
+              }
+              continue;
+            }
+
+            const auto typed_search_offset = static_cast<uint32_t>(search_offset);
+            for (auto chunk_offset = block_begin; chunk_offset < block_end; ++chunk_offset) {
+              if (predicate_comparator(decompressor.get(chunk_offset), typed_search_offset) &&
+                  (!null_values || !(*null_values)[chunk_offset])) {
+                matches.emplace_back(RowID{chunk_id, chunk_offset});
+              }
+            }
+          }
+        });
+      });
+    } else {
+      Fail("FrameOfReferenceSegment is not supported for this data type");
+    }
+  });
+}
+
 void ColumnVsValueTableScanImpl::_scan_dictionary_segment(
     const BaseDictionarySegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
     const std::shared_ptr<const AbstractPosList>& position_filter) {
@@ -127,6 +225,39 @@ void ColumnVsValueTableScanImpl::_scan_dictionary_segment(
     return;
   }
 
+  // Without a position filter, the entire attribute vector is scanned. In this case, we translate the predicate into a
+  // range of value IDs, which is compared directly on the compressed attribute vector.
+  if (!position_filter) {
+    const auto null_value_id = segment.null_value_id();
+    auto lower_value_id = ValueID{0};
+    auto upper_value_id = null_value_id;
+    auto excluded_value_id = null_value_id;
+
+    switch (predicate_condition) {
+      case PredicateCondition::Equals:
+        lower_value_id = search_value_id;
+        upper_value_id = ValueID{search_value_id + 1};
+        break;
+      case PredicateCondition::NotEquals:
+        excluded_value_id = search_value_id;
+        break;
+      case PredicateCondition::LessThan:
+      case PredicateCondition::LessThanEquals:
+        upper_value_id = search_value_id;
+        break;
+      case PredicateCondition::GreaterThan:
+      case PredicateCondition::GreaterThanEquals:
+        lower_value_id = search_value_id;
+        break;
+      default:
+        Fail("Unsupported comparison type encountered");
+    }
+
+    scan_value_id_range(*segment.attribute_vector(), lower_value_id, upper_value_id, excluded_value_id, chunk_id,
+                        matches);
+    return;
+  }
+
   _with_operator_for_dict_segment_scan([&](auto predicate_comparator) {
     auto comparator = [predicate_comparator, search_value_id](const auto& position) {
       return predicate_comparator(position.value(), search_value_id);
@@ -14,6 +14,11 @@
 
 namespace opossum {
 
+class AbstractEncodedSegment;
+
+template <typename T>
+class FSSTSegment;
+
 /**
  * @brief Compares one column to a literal (i.e., an AllTypeVariant)
  *
@@ -21,6 +26,8 @@ namespace opossum {
  * - For dictionary segments, we basically look up the value ID of the constant value in the dictionary
  *   in order to avoid having to look up each value ID of the attribute vector in the dictionary. This also
  *   enables us to detect if all or none of the values in the segment satisfy the expression.
+ * - For frame-of-reference segments, the search value is translated into an offset for each block
+ * - For FSST segments, Equals and NotEquals compare the compressed search value to the compressed values
  */
 class ColumnVsValueTableScanImpl : public AbstractDereferencedColumnTableScanImpl {
  public:
@@ -40,6 +47,15 @@ class ColumnVsValueTableScanImpl : public AbstractDereferencedColumnTableScanImp
   void _scan_dictionary_segment(const BaseDictionarySegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
                                 const std::shared_ptr<const AbstractPosList>& position_filter);
 
+  // Predicates on FrameOfReferenceSegments are evaluated on the offsets of each block, without adding the minima.
+  // Segments with offsets wider than 32 bits are scanned by _scan_generic_segment.
+  void _scan_frame_of_reference_segment(const AbstractEncodedSegment& segment, const ChunkID chunk_id,
+                                        RowIDPosList& matches) const;
+
+  // Equals and NotEquals on FSSTSegments are evaluated on the compressed values
+  void _scan_fsst_segment(const FSSTSegment<pmr_string>& segment, const ChunkID chunk_id, RowIDPosList& matches,
+                          const std::shared_ptr<const AbstractPosList>& position_filter) const;
+
   void _scan_sorted_segment(const AbstractSegment& segment, const ChunkID chunk_id, RowIDPosList& matches,
                             const std::shared_ptr<const AbstractPosList>& position_filter,
                             const SortMode sort_mode) const;
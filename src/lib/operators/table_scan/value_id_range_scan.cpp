@@ -0,0 +1,150 @@
+#include "value_id_range_scan.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// As in AbstractTableScanImpl, we assume a maximum SIMD register size of 256 bit. On machines with smaller registers,
+// the compiler splits each comparison into multiple instructions.
+constexpr auto SIMD_SIZE = size_t{256 / 8};
+
+// GCC vector extensions (see also SimdBp128Packing) are used so that the comparisons compile to the SIMD instructions
+// of the target without using platform-specific intrinsics. They are spelled out for each type because not all
+// compilers accept the attribute on dependent types.
+template <typename ValueIDType>
+struct SimdVector;
+
+template <>
+struct SimdVector<uint8_t> {
+  using type = uint8_t __attribute__((vector_size(SIMD_SIZE)));
+};
+
+template <>
+struct SimdVector<uint16_t> {
+  using type = uint16_t __attribute__((vector_size(SIMD_SIZE)));
+};
+
+template <>
+struct SimdVector<uint32_t> {
+  using type = uint32_t __attribute__((vector_size(SIMD_SIZE)));
+};
+
+template <typename ValueIDType>
+void scan_values(const ValueIDType* const values, const size_t value_count, const size_t first_chunk_offset,
+                 const ValueIDType lower_value_id, const ValueIDType value_id_diff, const ValueIDType excluded_value_id,
+                 const ChunkID chunk_id, RowIDPosList& matches) {
+  using SimdType = typename SimdVector<ValueIDType>::type;
+  constexpr auto LANE_COUNT = SIMD_SIZE / sizeof(ValueIDType);
+  static_assert(LANE_COUNT <= 32, "Bitmask does not fit into 32 bits");
+
+  auto lower_value_id_vector = SimdType{};
+  auto value_id_diff_vector = SimdType{};
+  auto excluded_value_id_vector = SimdType{};
+  for (auto lane = size_t{0}; lane < LANE_COUNT; ++lane) {
+    lower_value_id_vector[lane] = lower_value_id;
+    value_id_diff_vector[lane] = value_id_diff;
+    excluded_value_id_vector[lane] = excluded_value_id;
+  }
+
+  auto index = size_t{0};
+  for (; index + LANE_COUNT <= value_count; index += LANE_COUNT) {
+    auto value_ids = SimdType{};
+    std::memcpy(&value_ids, values + index, SIMD_SIZE);
+
+    // Same trick as in ColumnBetweenTableScanImpl: (x >= a && x < b) === ((x - a) < (b - a)) for unsigned integers.
+    // As the vector elements are not promoted, the subtraction wraps around in the width of ValueIDType.
+    const auto lane_matches = ((value_ids - lower_value_id_vector) < value_id_diff_vector) &
+                              (value_ids != excluded_value_id_vector);
+
+    auto mask = uint32_t{0};
+    for (auto lane = size_t{0}; lane < LANE_COUNT; ++lane) {
+      mask |= static_cast<uint32_t>(lane_matches[lane] & 1) << lane;
+    }
+
+    while (mask) {
+      const auto lane = static_cast<size_t>(__builtin_ctz(mask));
+      matches.emplace_back(RowID{chunk_id, static_cast<ChunkOffset>(first_chunk_offset + index + lane)});
+      mask &= mask - 1;
+    }
+  }
+
+  // Remainder that does not fill an entire SIMD register
+  for (; index < value_count; ++index) {
+    const auto value_id = values[index];
+    if (static_cast<ValueIDType>(value_id - lower_value_id) < value_id_diff && value_id != excluded_value_id) {
+      matches.emplace_back(RowID{chunk_id, static_cast<ChunkOffset>(first_chunk_offset + index)});
+    }
+  }
+}
+
+void scan_simd_bp128_vector(const SimdBp128Vector& vector, const ValueID lower_value_id,
+                            const ValueID upper_value_id, const ValueID excluded_value_id, const ChunkID chunk_id,
+                            RowIDPosList& matches) {
+  using Packing = SimdBp128Packing;
+
+  const auto* data = vector.data().data();
+  const auto size = vector.size();
+
+  alignas(16) auto bit_sizes = std::array<uint8_t, Packing::blocks_in_meta_block>{};
+  alignas(16) auto block = std::array<uint32_t, Packing::block_size>{};
+
+  // A meta block consists of one 128-bit word holding the bit sizes of its blocks, followed by the blocks. A block
+  // with a bit size of b takes up b 128-bit words.
+  for (auto meta_block_begin = size_t{0}; meta_block_begin < size; meta_block_begin += Packing::meta_block_size) {
+    Packing::read_meta_info(data, bit_sizes.data());
+    ++data;
+
+    for (auto block_index = size_t{0}; block_index < Packing::blocks_in_meta_block; ++block_index) {
+      const auto block_begin = meta_block_begin + block_index * Packing::block_size;
+      if (block_begin >= size) break;
+
+      const auto bit_size = bit_sizes[block_index];
+      const auto* const block_data = data;
+      data += bit_size;
+
+      // All value IDs of the block are smaller than 2^bit_size, so none of them can be in the range.
+      if (bit_size < 32 && (uint64_t{1} << bit_size) <= lower_value_id) continue;
+
+      Packing::unpack_block(block_data, block.data(), bit_size);
+      scan_values<uint32_t>(block.data(), std::min(size_t{Packing::block_size}, size - block_begin), block_begin,
+                            lower_value_id, upper_value_id - lower_value_id, excluded_value_id, chunk_id, matches);
+    }
+  }
+}
+
+}  // namespace
+
+void scan_value_id_range(const BaseCompressedVector& attribute_vector, const ValueID lower_value_id,
+                         const ValueID upper_value_id, const ValueID excluded_value_id, const ChunkID chunk_id,
+                         RowIDPosList& matches) {
+  if (lower_value_id >= upper_value_id) return;
+
+  resolve_compressed_vector_type(attribute_vector, [&](const auto& vector) {
+    using CompressedVectorType = std::decay_t<decltype(vector)>;
+
+    if constexpr (std::is_same_v<CompressedVectorType, SimdBp128Vector>) {
+      scan_simd_bp128_vector(vector, lower_value_id, upper_value_id, excluded_value_id, chunk_id, matches);
+    } else {
+      using ValueIDType = typename std::decay_t<decltype(vector.data())>::value_type;
+      DebugAssert(upper_value_id <= std::numeric_limits<ValueIDType>::max() &&
+                      excluded_value_id <= std::numeric_limits<ValueIDType>::max(),
+                  "Value IDs of the range do not fit into the attribute vector");
+
+      const auto& data = vector.data();
+      scan_values<ValueIDType>(data.data(), data.size(), 0, static_cast<ValueIDType>(lower_value_id),
+                               static_cast<ValueIDType>(upper_value_id - lower_value_id),
+                               static_cast<ValueIDType>(excluded_value_id), chunk_id, matches);
+    }
+  });
+}
+
+}  // namespace opossum
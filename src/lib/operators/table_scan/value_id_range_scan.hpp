@@ -0,0 +1,33 @@
+#pragma once
+
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseCompressedVector;
+
+/**
+ * Scans the attribute vector of a dictionary segment for value IDs x with lower_value_id <= x < upper_value_id and
+ * x != excluded_value_id and appends the matching rows to `matches`. The table scan impls translate their predicates
+ * into such a range in the value ID domain (see ColumnVsValueTableScanImpl and ColumnBetweenTableScanImpl). NULLs are
+ * not matched as long as the range does not include the null value ID of the segment.
+ *
+ * Instead of going through the (decompressor-based) iterators of the attribute vector, the value IDs are compared
+ * directly on the compressed data:
+ *  - FixedSizeByteAlignedVectors are compared in their native width, so that a 256-bit SIMD comparison covers 32, 16,
+ *    or 8 value IDs.
+ *  - SimdBp128Vectors are unpacked block by block (128 value IDs) into a buffer, which is then compared in the same
+ *    way. Blocks whose bit width rules out any match (i.e., all values are smaller than lower_value_id) are skipped
+ *    without unpacking them.
+ *
+ * Each comparison results in a bitmask of matching lanes, which is then converted into RowIDs.
+ *
+ * The range bounds and the excluded value ID must not be larger than the null value ID of the segment, which is
+ * guaranteed to fit into the compressed vector.
+ */
+void scan_value_id_range(const BaseCompressedVector& attribute_vector, const ValueID lower_value_id,
+                         const ValueID upper_value_id, const ValueID excluded_value_id, const ChunkID chunk_id,
+                         RowIDPosList& matches);
+
+}  // namespace opossum
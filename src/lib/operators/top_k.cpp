@@ -0,0 +1,268 @@
+#include "top_k.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <queue>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "expression/expression_utils.hpp"
+#include "hyrise.hpp"
+#include "operators/limit.hpp"
+#include "operators/sort.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Materialized values of a single sort column for a number of rows. Used to hide the column's data type from the
+// row comparison, which has to consider all sort columns.
+class AbstractColumnValues {
+ public:
+  virtual ~AbstractColumnValues() = default;
+
+  // Returns a negative value if the row at lhs_index comes before the row at rhs_index of rhs_values (which must be of
+  // the same type), a positive value if it comes after it, and zero if both rows share the same value.
+  virtual int compare(const size_t lhs_index, const AbstractColumnValues& rhs_values, const size_t rhs_index) const = 0;
+
+  // Returns the values at the given indices, in the order of the indices.
+  virtual std::unique_ptr<AbstractColumnValues> gather(const std::vector<ChunkOffset>& indices) const = 0;
+};
+
+template <typename ColumnDataType>
+class ColumnValues : public AbstractColumnValues {
+ public:
+  ColumnValues(const SortMode sort_mode, const size_t size) : sort_mode(sort_mode), values(size), null_values(size) {}
+
+  int compare(const size_t lhs_index, const AbstractColumnValues& rhs_values, const size_t rhs_index) const final {
+    const auto& typed_rhs_values = static_cast<const ColumnValues<ColumnDataType>&>(rhs_values);
+
+    // As in the Sort operator, NULLs come before all values, independent of the sort mode.
+    const auto lhs_is_null = null_values[lhs_index];
+    const auto rhs_is_null = typed_rhs_values.null_values[rhs_index];
+    if (lhs_is_null || rhs_is_null) {
+      return static_cast<int>(rhs_is_null) - static_cast<int>(lhs_is_null);
+    }
+
+    const auto& lhs_value = values[lhs_index];
+    const auto& rhs_value = typed_rhs_values.values[rhs_index];
+    const auto direction = sort_mode == SortMode::Ascending ? 1 : -1;
+    if (lhs_value < rhs_value) return -direction;
+    if (rhs_value < lhs_value) return direction;
+    return 0;
+  }
+
+  std::unique_ptr<AbstractColumnValues> gather(const std::vector<ChunkOffset>& indices) const final {
+    auto gathered_values = std::make_unique<ColumnValues<ColumnDataType>>(sort_mode, indices.size());
+    for (auto index = size_t{0}; index < indices.size(); ++index) {
+      gathered_values->values[index] = values[indices[index]];
+      gathered_values->null_values[index] = null_values[indices[index]];
+    }
+    return gathered_values;
+  }
+
+  const SortMode sort_mode;
+  std::vector<ColumnDataType> values;
+  std::vector<bool> null_values;
+};
+
+// One entry per sort column, in the order of the sort definitions.
+using SortColumnValues = std::vector<std::unique_ptr<AbstractColumnValues>>;
+
+int compare_rows(const SortColumnValues& lhs_values, const size_t lhs_index, const SortColumnValues& rhs_values,
+                 const size_t rhs_index) {
+  for (auto sort_column_idx = size_t{0}; sort_column_idx < lhs_values.size(); ++sort_column_idx) {
+    const auto comparison = lhs_values[sort_column_idx]->compare(lhs_index, *rhs_values[sort_column_idx], rhs_index);
+    if (comparison != 0) return comparison;
+  }
+  return 0;
+}
+
+// The first rows of a chunk in output order, together with the values of the sort columns for these rows.
+struct ChunkCandidates {
+  std::vector<ChunkOffset> chunk_offsets;
+  SortColumnValues sort_column_values;
+};
+
+ChunkCandidates select_chunk_candidates(const Table& input_table, const ChunkID chunk_id,
+                                        const std::vector<SortColumnDefinition>& sort_definitions,
+                                        const size_t row_count) {
+  auto candidates = ChunkCandidates{};
+
+  const auto chunk = input_table.get_chunk(chunk_id);
+  if (!chunk) return candidates;
+
+  const auto chunk_size = chunk->size();
+
+  // Materialize the sort columns for the entire chunk.
+  auto chunk_values = SortColumnValues{};
+  chunk_values.reserve(sort_definitions.size());
+  for (const auto& sort_definition : sort_definitions) {
+    resolve_data_type(input_table.column_data_type(sort_definition.column), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      auto column_values = std::make_unique<ColumnValues<ColumnDataType>>(sort_definition.sort_mode, chunk_size);
+      segment_iterate<ColumnDataType>(*chunk->get_segment(sort_definition.column), [&](const auto& position) {
+        const auto chunk_offset = position.chunk_offset();
+        if (position.is_null()) {
+          column_values->null_values[chunk_offset] = true;
+        } else {
+          column_values->values[chunk_offset] = position.value();
+        }
+      });
+      chunk_values.emplace_back(std::move(column_values));
+    });
+  }
+
+  // Rows with the same values are ordered by their position in the chunk, which makes the order strict and the
+  // selection equivalent to that of a stable sort.
+  const auto row_before = [&](const ChunkOffset lhs, const ChunkOffset rhs) {
+    const auto comparison = compare_rows(chunk_values, lhs, chunk_values, rhs);
+    return comparison != 0 ? comparison < 0 : lhs < rhs;
+  };
+
+  // Max-heap of the best rows seen so far: The front is the row that would be dropped first.
+  auto& heap = candidates.chunk_offsets;
+  const auto heap_size = std::min(row_count, static_cast<size_t>(chunk_size));
+  heap.reserve(heap_size);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+    if (heap.size() < heap_size) {
+      heap.emplace_back(chunk_offset);
+      std::push_heap(heap.begin(), heap.end(), row_before);
+      continue;
+    }
+
+    if (!row_before(chunk_offset, heap.front())) continue;
+
+    std::pop_heap(heap.begin(), heap.end(), row_before);
+    heap.back() = chunk_offset;
+    std::push_heap(heap.begin(), heap.end(), row_before);
+  }
+  std::sort_heap(heap.begin(), heap.end(), row_before);
+
+  // Only keep the sort column values of the selected rows so that the memory consumption of the merge phase does not
+  // depend on the input size.
+  candidates.sort_column_values.reserve(chunk_values.size());
+  for (const auto& column_values : chunk_values) {
+    candidates.sort_column_values.emplace_back(column_values->gather(heap));
+  }
+
+  return candidates;
+}
+
+}  // namespace
+
+namespace opossum {
+
+TopK::TopK(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
+           const std::shared_ptr<AbstractExpression>& row_count_expression)
+    : AbstractReadOnlyOperator(OperatorType::TopK, in),
+      _sort_definitions(sort_definitions),
+      _row_count_expression(row_count_expression) {
+  DebugAssert(!_sort_definitions.empty(), "Expected at least one sort criterion");
+}
+
+const std::string& TopK::name() const {
+  static const auto name = std::string{"TopK"};
+  return name;
+}
+
+std::string TopK::description(DescriptionMode description_mode) const {
+  const auto* const separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+
+  std::stringstream stream;
+  stream << name() << separator << "Rows: " << _row_count_expression->as_column_name() << separator << "Sort:";
+  for (const auto& sort_definition : _sort_definitions) {
+    stream << " Column #" << sort_definition.column << " " << sort_mode_to_string.left.at(sort_definition.sort_mode);
+  }
+
+  return stream.str();
+}
+
+const std::vector<SortColumnDefinition>& TopK::sort_definitions() const { return _sort_definitions; }
+
+std::shared_ptr<AbstractExpression> TopK::row_count_expression() const { return _row_count_expression; }
+
+std::shared_ptr<AbstractOperator> TopK::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& copied_right_input) const {
+  return std::make_shared<TopK>(copied_left_input, _sort_definitions, _row_count_expression->deep_copy());
+}
+
+void TopK::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
+  expression_set_parameters(_row_count_expression, parameters);
+}
+
+void TopK::_on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) {
+  expression_set_transaction_context(_row_count_expression, transaction_context);
+}
+
+std::shared_ptr<const Table> TopK::_on_execute() {
+  const auto& input_table = left_input_table();
+
+  for (const auto& sort_definition : _sort_definitions) {
+    Assert(sort_definition.column != INVALID_COLUMN_ID, "TopK: Invalid column in sort definition");
+    Assert(sort_definition.column < input_table->column_count(),
+           "TopK: Column ID is greater than table's column count");
+  }
+
+  const auto row_count = Limit::evaluate_row_count(*_row_count_expression);
+
+  if (input_table->row_count() == 0) return input_table;
+  if (row_count == 0) return std::make_shared<Table>(input_table->column_definitions(), TableType::References);
+
+  // 1. Select the first row_count rows of each chunk.
+  const auto chunk_count = input_table->chunk_count();
+  auto candidates_by_chunk = std::vector<ChunkCandidates>(chunk_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      candidates_by_chunk[chunk_id] = select_chunk_candidates(*input_table, chunk_id, _sort_definitions, row_count);
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  // 2. Merge the sorted candidates of all chunks until row_count rows have been found. Ties between chunks are
+  // resolved by the ChunkID so that the input order is kept for rows with the same values.
+  struct Cursor {
+    ChunkID chunk_id;
+    size_t index;
+  };
+
+  const auto cursor_after = [&](const Cursor& lhs, const Cursor& rhs) {
+    const auto comparison = compare_rows(candidates_by_chunk[lhs.chunk_id].sort_column_values, lhs.index,
+                                         candidates_by_chunk[rhs.chunk_id].sort_column_values, rhs.index);
+    return comparison != 0 ? comparison > 0 : lhs.chunk_id > rhs.chunk_id;
+  };
+
+  auto cursors = std::priority_queue<Cursor, std::vector<Cursor>, decltype(cursor_after)>{cursor_after};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (!candidates_by_chunk[chunk_id].chunk_offsets.empty()) cursors.push(Cursor{chunk_id, 0});
+  }
+
+  auto pos_list = RowIDPosList{};
+  pos_list.reserve(std::min(row_count, static_cast<size_t>(input_table->row_count())));
+  while (!cursors.empty() && pos_list.size() < row_count) {
+    const auto cursor = cursors.top();
+    cursors.pop();
+
+    const auto& chunk_offsets = candidates_by_chunk[cursor.chunk_id].chunk_offsets;
+    pos_list.emplace_back(RowID{cursor.chunk_id, chunk_offsets[cursor.index]});
+
+    if (cursor.index + 1 < chunk_offsets.size()) cursors.push(Cursor{cursor.chunk_id, cursor.index + 1});
+  }
+
+  return write_sorted_output_table(input_table, std::move(pos_list), _sort_definitions[0], Chunk::DEFAULT_SIZE,
+                                   Sort::ForceMaterialization::No);
+}
+
+}  // namespace opossum
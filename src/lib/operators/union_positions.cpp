@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <map>
 #include <memory>
 #include <numeric>
 #include <string>
@@ -9,6 +10,7 @@
 #include <vector>
 
 #include "storage/chunk.hpp"
+#include "storage/pos_lists/bitmap_pos_list.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -78,6 +80,11 @@ std::shared_ptr<const Table> UnionPositions::_on_execute() {
     return early_result;
   }
 
+  auto bitmap_result = _union_bitmap_pos_lists();
+  if (bitmap_result) {
+    return bitmap_result;
+  }
+
   const auto& left_in_table = *left_input_table();
 
   /**
@@ -312,6 +319,59 @@ std::shared_ptr<const Table> UnionPositions::_prepare_operator() {
   return nullptr;
 }
 
+std::shared_ptr<const Table> UnionPositions::_union_bitmap_pos_lists() const {
+  if (_column_cluster_offsets.size() != 1) {
+    return nullptr;
+  }
+
+  // Bitmaps of the output, by referenced chunk
+  auto bitmaps = std::map<ChunkID, BitmapPosList::Bitmap>{};
+
+  for (const auto& input_table : {left_input_table(), right_input_table()}) {
+    const auto chunk_count = input_table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = input_table->get_chunk(chunk_id);
+      const auto ref_segment = std::static_pointer_cast<const ReferenceSegment>(chunk->get_segment(ColumnID{0}));
+      const auto& pos_list = ref_segment->pos_list();
+      if (pos_list->empty()) continue;
+
+      const auto bitmap_pos_list = std::dynamic_pointer_cast<const BitmapPosList>(pos_list);
+      if (!bitmap_pos_list) {
+        return nullptr;
+      }
+
+      const auto& input_bitmap = bitmap_pos_list->bitmap();
+      auto& bitmap = bitmaps[bitmap_pos_list->common_chunk_id()];
+      if (bitmap.size() < input_bitmap.size()) {
+        bitmap.resize(input_bitmap.size());
+      }
+
+      for (auto word_index = size_t{0}; word_index < input_bitmap.size(); ++word_index) {
+        bitmap[word_index] |= input_bitmap[word_index];
+      }
+    }
+  }
+
+  const auto& left_in_table = *left_input_table();
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  output_chunks.reserve(bitmaps.size());
+
+  for (auto& [referenced_chunk_id, bitmap] : bitmaps) {
+    const auto pos_list = std::make_shared<BitmapPosList>(referenced_chunk_id, std::move(bitmap));
+
+    auto output_segments = Segments{};
+    for (auto column_id = ColumnID{0}; column_id < left_in_table.column_count(); ++column_id) {
+      output_segments.emplace_back(
+          std::make_shared<ReferenceSegment>(_referenced_tables[0], _referenced_column_ids[column_id], pos_list));
+    }
+    const auto chunk = std::make_shared<Chunk>(output_segments);
+    chunk->finalize();
+    output_chunks.emplace_back(chunk);
+  }
+
+  return std::make_shared<Table>(left_in_table.column_definitions(), TableType::References, std::move(output_chunks));
+}
+
 UnionPositions::ReferenceMatrix UnionPositions::_build_reference_matrix(
     const std::shared_ptr<const Table>& input_table) const {
   ReferenceMatrix reference_matrix;
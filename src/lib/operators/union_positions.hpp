@@ -107,6 +107,16 @@ class UnionPositions : public AbstractReadOnlyOperator {
    */
   std::shared_ptr<const Table> _prepare_operator();
 
+  /**
+   * If both inputs have a single ColumnCluster and all of their pos lists are BitmapPosLists (as produced by
+   * TableScans that select a large part of a chunk), the union is computed by combining the bitmaps of each referenced
+   * chunk with a bitwise OR, which avoids materializing and sorting the ReferenceMatrices. The output contains one
+   * chunk per referenced chunk.
+   *
+   * @returns the result table or nullptr if the inputs do not qualify.
+   */
+  std::shared_ptr<const Table> _union_bitmap_pos_lists() const;
+
   UnionPositions::ReferenceMatrix _build_reference_matrix(const std::shared_ptr<const Table>& input_table) const;
   static bool _compare_reference_matrix_rows(const ReferenceMatrix& left_matrix, size_t left_row_idx,
                                              const ReferenceMatrix& right_matrix, size_t right_row_idx);
@@ -1,9 +1,15 @@
 #include "abstract_join_ordering_algorithm.hpp"
 
+#include <algorithm>
+
 #include "cost_estimation/abstract_cost_estimator.hpp"
+#include "hyrise.hpp"
 #include "join_graph.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
 #include "operators/operator_join_predicate.hpp"
+#include "scheduler/job_task.hpp"
 #include "statistics/cardinality_estimator.hpp"
+#include "statistics/join_graph_statistics_cache.hpp"
 
 namespace opossum {
 
@@ -105,4 +111,115 @@ std::shared_ptr<AbstractLQPNode> AbstractJoinOrderingAlgorithm::_add_join_to_pla
   return lqp;
 }
 
+std::vector<std::shared_ptr<AbstractLQPNode>> AbstractJoinOrderingAlgorithm::_build_vertex_plans(
+    const JoinGraph& join_graph, const std::shared_ptr<AbstractCostEstimator>& cost_estimator) {
+  auto vertex_plans = join_graph.vertices;
+
+  // Collect the uncorrelated predicates
+  auto uncorrelated_predicates = std::vector<std::shared_ptr<AbstractExpression>>{};
+  for (const auto& edge : join_graph.edges) {
+    if (!edge.vertex_set.none()) continue;
+    uncorrelated_predicates.insert(uncorrelated_predicates.end(), edge.predicates.begin(), edge.predicates.end());
+  }
+
+  // Find the largest vertex and place the uncorrelated predicates on top of it
+  if (!uncorrelated_predicates.empty()) {
+    auto largest_vertex_idx = size_t{0};
+    auto largest_vertex_cardinality = cost_estimator->cardinality_estimator->estimate_cardinality(vertex_plans.front());
+
+    for (auto vertex_idx = size_t{1}; vertex_idx < vertex_plans.size(); ++vertex_idx) {
+      const auto vertex_cardinality =
+          cost_estimator->cardinality_estimator->estimate_cardinality(vertex_plans[vertex_idx]);
+      if (vertex_cardinality > largest_vertex_cardinality) {
+        largest_vertex_idx = vertex_idx;
+        largest_vertex_cardinality = vertex_cardinality;
+      }
+    }
+
+    auto& largest_vertex_plan = vertex_plans[largest_vertex_idx];
+    for (const auto& uncorrelated_predicate : uncorrelated_predicates) {
+      largest_vertex_plan = PredicateNode::make(uncorrelated_predicate, largest_vertex_plan);
+    }
+  }
+
+  // Add the local predicates on top of the vertices
+  for (auto vertex_idx = size_t{0}; vertex_idx < vertex_plans.size(); ++vertex_idx) {
+    const auto vertex_predicates = join_graph.find_local_predicates(vertex_idx);
+    vertex_plans[vertex_idx] = _add_predicates_to_plan(vertex_plans[vertex_idx], vertex_predicates, cost_estimator);
+  }
+
+  return vertex_plans;
+}
+
+std::vector<std::shared_ptr<AbstractCostEstimator>> AbstractJoinOrderingAlgorithm::_worker_cost_estimators(
+    const JoinGraph& join_graph, const std::shared_ptr<AbstractCostEstimator>& cost_estimator) {
+  if (!Hyrise::get().is_multi_threaded()) return {cost_estimator};
+
+  for (const auto& vertex : join_graph.vertices) {
+    visit_lqp(vertex, [](const auto& node) {
+      node->output_expressions();
+      return LQPVisitation::VisitInputs;
+    });
+  }
+
+  auto join_graph_statistics_cache =
+      cost_estimator->cardinality_estimator->cardinality_estimation_cache.join_graph_statistics_cache;
+  if (!join_graph_statistics_cache) {
+    join_graph_statistics_cache = JoinGraphStatisticsCache::from_join_graph(join_graph);
+  }
+
+  const auto worker_count = Hyrise::get().scheduler()->workers().size();
+  auto cost_estimators = std::vector<std::shared_ptr<AbstractCostEstimator>>{};
+  cost_estimators.reserve(worker_count);
+  for (auto worker_idx = size_t{0}; worker_idx < worker_count; ++worker_idx) {
+    const auto worker_cost_estimator = cost_estimator->new_instance();
+    worker_cost_estimator->guarantee_bottom_up_construction();
+    worker_cost_estimator->cardinality_estimator->guarantee_join_graph(join_graph_statistics_cache);
+    cost_estimators.emplace_back(worker_cost_estimator);
+  }
+
+  return cost_estimators;
+}
+
+void AbstractJoinOrderingAlgorithm::_parallel_for(
+    const size_t item_count, const std::vector<std::shared_ptr<AbstractCostEstimator>>& cost_estimators,
+    const std::function<void(const size_t, const std::shared_ptr<AbstractCostEstimator>&)>& functor) {
+  Assert(!cost_estimators.empty(), "Expected at least one CostEstimator");
+
+  const auto job_count = std::min(item_count, cost_estimators.size());
+  if (job_count < 2) {
+    for (auto item_idx = size_t{0}; item_idx < item_count; ++item_idx) {
+      functor(item_idx, cost_estimators.front());
+    }
+    return;
+  }
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(job_count);
+  for (auto job_idx = size_t{0}; job_idx < job_count; ++job_idx) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, job_idx]() {
+      for (auto item_idx = job_idx; item_idx < item_count; item_idx += job_count) {
+        functor(item_idx, cost_estimators[job_idx]);
+      }
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+}
+
+Cost AbstractJoinOrderingAlgorithm::_join_plan_cost(const std::shared_ptr<AbstractLQPNode>& join_plan,
+                                                    const Cost left_input_plan_cost, const Cost right_input_plan_cost,
+                                                    const std::shared_ptr<AbstractCostEstimator>& cost_estimator) {
+  // _add_join_to_plan() places the post-join predicates on top of the JoinNode
+  auto cost = Cost{0};
+  auto node = join_plan;
+  while (node->type != LQPNodeType::Join) {
+    DebugAssert(node->type == LQPNodeType::Predicate, "Expected only PredicateNodes on top of the JoinNode");
+    cost += cost_estimator->estimate_node_cost(node);
+    node = node->left_input();
+  }
+  cost += cost_estimator->estimate_node_cost(node);
+
+  return cost + left_input_plan_cost + right_input_plan_cost;
+}
+
 }  // namespace opossum
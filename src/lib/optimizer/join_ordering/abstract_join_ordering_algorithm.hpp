@@ -1,8 +1,11 @@
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <vector>
 
+#include "types.hpp"
+
 namespace opossum {
 
 class AbstractExpression;
@@ -70,6 +73,47 @@ class AbstractJoinOrderingAlgorithm {
   static std::shared_ptr<AbstractLQPNode> _add_predicates_to_plan(
       const std::shared_ptr<AbstractLQPNode>& lqp, const std::vector<std::shared_ptr<AbstractExpression>>& predicates,
       const std::shared_ptr<AbstractCostEstimator>& cost_estimator);
+
+  /**
+   * Builds the initial plans of the JoinGraph's vertices, i.e., each vertex with its local predicates on top.
+   * Uncorrelated predicates (think "6 > 4": not referencing any vertex) are placed on top of the largest vertex: They
+   * are either False or True for *all* rows. If such a predicate is False, we avoid processing the many rows of the
+   * largest vertex in later joins.
+   */
+  static std::vector<std::shared_ptr<AbstractLQPNode>> _build_vertex_plans(
+      const JoinGraph& join_graph, const std::shared_ptr<AbstractCostEstimator>& cost_estimator);
+
+  /**
+   * @{
+   * Helpers for enumerating candidate plans in parallel.
+   *
+   * _worker_cost_estimators() returns one CostEstimator per worker of the scheduler, or only @param cost_estimator if
+   * Hyrise runs single-threaded. The estimators are new instances of @param cost_estimator with their own caches,
+   * except for the JoinGraphStatisticsCache, which is shared among them (and with @param cost_estimator, if it has
+   * one). Thus, statistics estimated by one worker are reused by all others.
+   *
+   * _parallel_for() calls @param functor for each item in [0, @param item_count), distributed over one JobTask per
+   * estimator. The functor receives the estimator of its JobTask and must not modify state shared with other items.
+   *
+   * Nodes such as the StoredTableNode lazily create their output expressions, which is not thread-safe. Thus,
+   * _worker_cost_estimators() creates them for all nodes in the vertices upfront.
+   */
+  static std::vector<std::shared_ptr<AbstractCostEstimator>> _worker_cost_estimators(
+      const JoinGraph& join_graph, const std::shared_ptr<AbstractCostEstimator>& cost_estimator);
+
+  static void _parallel_for(
+      const size_t item_count, const std::vector<std::shared_ptr<AbstractCostEstimator>>& cost_estimators,
+      const std::function<void(const size_t, const std::shared_ptr<AbstractCostEstimator>&)>& functor);
+  /** @} */
+
+  /**
+   * @return the cost of @param join_plan, as built by _add_join_to_plan(), given the costs of its two input plans.
+   * Unlike AbstractCostEstimator::estimate_plan_cost(), this only costs the nodes added on top of the input plans and
+   * does not traverse the input plans.
+   */
+  static Cost _join_plan_cost(const std::shared_ptr<AbstractLQPNode>& join_plan, const Cost left_input_plan_cost,
+                              const Cost right_input_plan_cost,
+                              const std::shared_ptr<AbstractCostEstimator>& cost_estimator);
 };
 
 }  // namespace opossum
@@ -1,6 +1,7 @@
 #include "dp_ccp.hpp"
 
-#include <unordered_map>
+#include <map>
+#include <vector>
 
 #include "cost_estimation/abstract_cost_estimator.hpp"
 #include "enumerate_ccp.hpp"
@@ -10,129 +11,130 @@
 #include "statistics/abstract_cardinality_estimator.hpp"
 #include "statistics/cardinality_estimator.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+struct PlanAndCost {
+  std::shared_ptr<AbstractLQPNode> plan;
+  Cost cost{0};
+};
+
+// The CsgCmpPairs that join the same set of vertices
+struct CandidateJoins {
+  JoinGraphVertexSet joined_vertex_set;
+  std::vector<CsgCmpPair> csg_cmp_pairs;
+};
+
+}  // namespace
+
 namespace opossum {
 
 std::shared_ptr<AbstractLQPNode> DpCcp::operator()(const JoinGraph& join_graph,
                                                    const std::shared_ptr<AbstractCostEstimator>& cost_estimator) {
   Assert(!join_graph.vertices.empty(), "Code below relies on the JoinGraph having vertices");
 
+  const auto vertex_count = join_graph.vertices.size();
+
   // No std::unordered_map, since hashing of JoinGraphVertexSet is not (efficiently) possible because
   // boost::dynamic_bitset hides the data necessary for doing so efficiently.
-  auto best_plan = std::map<JoinGraphVertexSet, std::shared_ptr<AbstractLQPNode>>{};
+  auto best_plan = std::map<JoinGraphVertexSet, PlanAndCost>{};
 
   /**
-   * 1. Initialize best_plan[] with the vertices
+   * 1. Initialize best_plan[] with the vertices, including their local predicates and the uncorrelated predicates
    */
-  for (size_t vertex_idx = 0; vertex_idx < join_graph.vertices.size(); ++vertex_idx) {
-    auto single_vertex_set = JoinGraphVertexSet{join_graph.vertices.size()};
+  const auto vertex_plans = _build_vertex_plans(join_graph, cost_estimator);
+  for (auto vertex_idx = size_t{0}; vertex_idx < vertex_count; ++vertex_idx) {
+    auto single_vertex_set = JoinGraphVertexSet{vertex_count};
     single_vertex_set.set(vertex_idx);
 
-    best_plan[single_vertex_set] = join_graph.vertices[vertex_idx];
+    const auto& vertex_plan = vertex_plans[vertex_idx];
+    best_plan.emplace(single_vertex_set, PlanAndCost{vertex_plan, cost_estimator->estimate_plan_cost(vertex_plan)});
   }
 
   /**
-   * 2. Place Uncorrelated Predicates (think "6 > 4": not referencing any vertex)
-   * 2.1 Collect uncorrelated predicates
+   * 2. Prepare EnumerateCcp: Transform the JoinGraph's vertex-to-vertex edges into index pairs
    */
-  std::vector<std::shared_ptr<AbstractExpression>> uncorrelated_predicates;
+  std::vector<std::pair<size_t, size_t>> enumerate_ccp_edges;
   for (const auto& edge : join_graph.edges) {
-    if (!edge.vertex_set.none()) continue;
-    uncorrelated_predicates.insert(uncorrelated_predicates.end(), edge.predicates.begin(), edge.predicates.end());
-  }
+    // EnumerateCcp only deals with binary join predicates
+    if (edge.vertex_set.count() != 2) continue;
 
-  /**
-   * 2.2 Find the largest vertex and place the uncorrelated predicates for optimal execution.
-   *     Reasoning: Uncorrelated predicates are either False or True for *all* rows. If an uncorrelated
-   *                predicate is False and we place it on top of the largest vertex we avoid processing the vertex'
-   *                many rows in later joins.
-   */
-  if (!uncorrelated_predicates.empty()) {
-    // Find the largest vertex
-    auto largest_vertex_idx = size_t{0};
-    auto largest_vertex_cardinality =
-        cost_estimator->cardinality_estimator->estimate_cardinality(join_graph.vertices.front());
-
-    for (size_t vertex_idx = 1; vertex_idx < join_graph.vertices.size(); ++vertex_idx) {
-      const auto vertex_cardinality =
-          cost_estimator->cardinality_estimator->estimate_cardinality(join_graph.vertices[vertex_idx]);
-      if (vertex_cardinality > largest_vertex_cardinality) {
-        largest_vertex_idx = vertex_idx;
-        largest_vertex_cardinality = vertex_cardinality;
-      }
-    }
+    const auto first_vertex_idx = edge.vertex_set.find_first();
+    const auto second_vertex_idx = edge.vertex_set.find_next(first_vertex_idx);
 
-    // Place the uncorrelated predicates on top of the largest vertex
-    auto largest_vertex_single_vertex_set = JoinGraphVertexSet{join_graph.vertices.size()};
-    largest_vertex_single_vertex_set.set(largest_vertex_idx);
-    auto largest_vertex_plan = best_plan[largest_vertex_single_vertex_set];
-    for (const auto& uncorrelated_predicate : uncorrelated_predicates) {
-      largest_vertex_plan = PredicateNode::make(uncorrelated_predicate, largest_vertex_plan);
-    }
-    best_plan[largest_vertex_single_vertex_set] = largest_vertex_plan;
+    enumerate_ccp_edges.emplace_back(first_vertex_idx, second_vertex_idx);
   }
 
   /**
-   * 3. Add local predicates on top of the vertices
+   * 3. Group the CsgCmpPairs by the number of vertices they join (the "level") and, within a level, by the set of
+   *    vertices they join. A CsgCmpPair only depends on the best plans of its two components, which are from lower
+   *    levels. Thus, all groups of a level can be processed in parallel.
    */
-  for (size_t vertex_idx = 0; vertex_idx < join_graph.vertices.size(); ++vertex_idx) {
-    const auto vertex_predicates = join_graph.find_local_predicates(vertex_idx);
-    auto single_vertex_set = JoinGraphVertexSet{join_graph.vertices.size()};
-    single_vertex_set.set(vertex_idx);
+  const auto csg_cmp_pairs = EnumerateCcp{vertex_count, enumerate_ccp_edges}();  // NOLINT
 
-    auto& vertex_best_plan = best_plan[single_vertex_set];
-    vertex_best_plan = _add_predicates_to_plan(vertex_best_plan, vertex_predicates, cost_estimator);
+  auto candidate_joins_by_level = std::vector<std::vector<CandidateJoins>>(vertex_count + 1);
+  auto candidate_joins_idx_by_vertex_set = std::map<JoinGraphVertexSet, size_t>{};
+  for (const auto& csg_cmp_pair : csg_cmp_pairs) {
+    const auto joined_vertex_set = csg_cmp_pair.first | csg_cmp_pair.second;
+    auto& level = candidate_joins_by_level[joined_vertex_set.count()];
+
+    const auto [candidate_joins_idx_iter, inserted] =
+        candidate_joins_idx_by_vertex_set.try_emplace(joined_vertex_set, level.size());
+    if (inserted) level.emplace_back(CandidateJoins{joined_vertex_set, {}});
+    level[candidate_joins_idx_iter->second].csg_cmp_pairs.emplace_back(csg_cmp_pair);
   }
 
   /**
-   * 4. Prepare EnumerateCcp: Transform the JoinGraph's vertex-to-vertex edges into index pairs
+   * 4. Actual DpCcp algorithm: Build candidate plans for the CsgCmpPairs; keep the cheapest plan for each set of
+   *    vertices. Following the idea of DPE (Han et al., "Parallelizing Query Optimization", VLDB 2008), the groups of a
+   *    level are distributed over the workers, which read the best plans of the lower levels from best_plan. The best
+   *    plans of a level are added to best_plan once the level is complete. The CsgCmpPairs of a group are processed in
+   *    the order of their enumeration, so that the resulting plan does not depend on the number of workers.
    */
-  std::vector<std::pair<size_t, size_t>> enumerate_ccp_edges;
-  for (const auto& edge : join_graph.edges) {
-    // EnumerateCcp only deals with binary join predicates
-    if (edge.vertex_set.count() != 2) continue;
+  const auto cost_estimators = _worker_cost_estimators(join_graph, cost_estimator);
 
-    const auto first_vertex_idx = edge.vertex_set.find_first();
-    const auto second_vertex_idx = edge.vertex_set.find_next(first_vertex_idx);
+  for (const auto& level : candidate_joins_by_level) {
+    auto level_best_plans = std::vector<PlanAndCost>(level.size());
 
-    enumerate_ccp_edges.emplace_back(first_vertex_idx, second_vertex_idx);
-  }
+    _parallel_for(level.size(), cost_estimators, [&](const auto candidate_joins_idx, const auto& estimator) {
+      auto& level_best_plan = level_best_plans[candidate_joins_idx];
 
-  /**
-   * 5. Actual DpCcp algorithm: Enumerate the CsgCmpPairs; build candidate plans; update best_plan if the candidate plan
-   *                            is cheaper than the cheapest currently known plan for a particular subset of vertices.
-   */
-  const auto csg_cmp_pairs = EnumerateCcp{join_graph.vertices.size(), enumerate_ccp_edges}();  // NOLINT
-  for (const auto& csg_cmp_pair : csg_cmp_pairs) {
-    const auto best_plan_left_iter = best_plan.find(csg_cmp_pair.first);
-    const auto best_plan_right_iter = best_plan.find(csg_cmp_pair.second);
-    DebugAssert(best_plan_left_iter != best_plan.end() && best_plan_right_iter != best_plan.end(),
-                "Subplan missing: either the JoinGraph is invalid or EnumerateCcp is buggy");
+      for (const auto& [csg, cmp] : level[candidate_joins_idx].csg_cmp_pairs) {
+        const auto best_plan_left_iter = best_plan.find(csg);
+        const auto best_plan_right_iter = best_plan.find(cmp);
+        DebugAssert(best_plan_left_iter != best_plan.end() && best_plan_right_iter != best_plan.end(),
+                    "Subplan missing: either the JoinGraph is invalid or EnumerateCcp is buggy");
+        const auto& [left_plan, left_cost] = best_plan_left_iter->second;
+        const auto& [right_plan, right_cost] = best_plan_right_iter->second;
 
-    const auto join_predicates = join_graph.find_join_predicates(csg_cmp_pair.first, csg_cmp_pair.second);
+        const auto join_predicates = join_graph.find_join_predicates(csg, cmp);
 
-    auto candidate_plan =
-        _add_join_to_plan(best_plan_left_iter->second, best_plan_right_iter->second, join_predicates, cost_estimator);
+        auto candidate_plan = _add_join_to_plan(left_plan, right_plan, join_predicates, estimator);
+        const auto candidate_cost = _join_plan_cost(candidate_plan, left_cost, right_cost, estimator);
 
-    const auto joined_vertex_set = csg_cmp_pair.first | csg_cmp_pair.second;
+        if (!level_best_plan.plan || candidate_cost < level_best_plan.cost) {
+          level_best_plan = PlanAndCost{std::move(candidate_plan), candidate_cost};
+        }
+      }
+    });
 
-    const auto best_plan_iter = best_plan.find(joined_vertex_set);
-    if (best_plan_iter == best_plan.end() || cost_estimator->estimate_plan_cost(candidate_plan) <
-                                                 cost_estimator->estimate_plan_cost(best_plan_iter->second)) {
-      best_plan.insert_or_assign(joined_vertex_set, candidate_plan);
+    for (auto candidate_joins_idx = size_t{0}; candidate_joins_idx < level.size(); ++candidate_joins_idx) {
+      best_plan.emplace(level[candidate_joins_idx].joined_vertex_set, std::move(level_best_plans[candidate_joins_idx]));
     }
   }
 
   /**
-   * 6. Build vertex set with all vertices and return the plan for it - this will be the best plan for the entire join
+   * 5. Build vertex set with all vertices and return the plan for it - this will be the best plan for the entire join
    *    graph.
    */
-  boost::dynamic_bitset<> all_vertices_set{join_graph.vertices.size()};
+  boost::dynamic_bitset<> all_vertices_set{vertex_count};
   all_vertices_set.flip();  // Turns all bits to '1'
 
   const auto best_plan_iter = best_plan.find(all_vertices_set);
   Assert(best_plan_iter != best_plan.end(), "No plan for all vertices generated. Maybe JoinGraph isn't connected?");
 
-  return best_plan_iter->second;
+  return best_plan_iter->second.plan;
 }
 
 }  // namespace opossum
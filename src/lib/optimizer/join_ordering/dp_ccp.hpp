@@ -14,7 +14,8 @@ class JoinGraph;
  *
  * DpCcp is an optimal join ordering algorithm based on dynamic programming. It handles only inner joins and cross
  * joins and treats outer joins as opaque (i.e. outer joins are not moved and no other joins are moved pass them).
- * DpCcp is driven by EnumerateCcp which enumerates all candidate join operations.
+ * DpCcp is driven by EnumerateCcp which enumerates all candidate join operations. The candidate plans for sets of
+ * vertices of the same size are built and costed in parallel (see DpCcp::operator()).
  *
  * Local predicates are pushed down and sorted by increasing cost.
  */
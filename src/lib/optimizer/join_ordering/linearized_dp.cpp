@@ -0,0 +1,162 @@
+#include "linearized_dp.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include "cost_estimation/abstract_cost_estimator.hpp"
+#include "join_graph.hpp"
+#include "statistics/abstract_cardinality_estimator.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+struct PlanAndCost {
+  std::shared_ptr<AbstractLQPNode> plan;
+  Cost cost{0};
+};
+
+// Whether an edge (with or without predicates) connects the two vertex sets, see JoinGraph::find_join_predicates()
+bool vertex_sets_connected(const JoinGraph& join_graph, const JoinGraphVertexSet& vertex_set_a,
+                           const JoinGraphVertexSet& vertex_set_b) {
+  const auto vertex_set = vertex_set_a | vertex_set_b;
+  return std::any_of(join_graph.edges.cbegin(), join_graph.edges.cend(), [&](const auto& edge) {
+    return edge.vertex_set.intersects(vertex_set_a) && edge.vertex_set.intersects(vertex_set_b) &&
+           edge.vertex_set.is_subset_of(vertex_set);
+  });
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::shared_ptr<AbstractLQPNode> LinearizedDp::operator()(
+    const JoinGraph& join_graph, const std::shared_ptr<AbstractCostEstimator>& cost_estimator) {
+  Assert(!join_graph.vertices.empty(), "Code below relies on the JoinGraph having vertices");
+
+  const auto vertex_count = join_graph.vertices.size();
+
+  /**
+   * 1. Build the vertex plans, including their local predicates and the uncorrelated predicates, and linearize them
+   */
+  const auto vertex_plans = _build_vertex_plans(join_graph, cost_estimator);
+  const auto linear_order = _linearize(join_graph, vertex_plans, cost_estimator);
+
+  /**
+   * 2. Initialize the best plans of the intervals of length one with the vertices. best_plans[begin][end] holds the
+   *    best plan for the vertices from linear_order[begin] to linear_order[end] (inclusive).
+   */
+  auto best_plans = std::vector<std::vector<PlanAndCost>>(vertex_count, std::vector<PlanAndCost>(vertex_count));
+  auto interval_vertex_sets =
+      std::vector<std::vector<JoinGraphVertexSet>>(vertex_count, std::vector<JoinGraphVertexSet>(vertex_count));
+
+  for (auto begin = size_t{0}; begin < vertex_count; ++begin) {
+    const auto& vertex_plan = vertex_plans[linear_order[begin]];
+    best_plans[begin][begin] = PlanAndCost{vertex_plan, cost_estimator->estimate_plan_cost(vertex_plan)};
+
+    auto vertex_set = JoinGraphVertexSet{vertex_count};
+    for (auto end = begin; end < vertex_count; ++end) {
+      vertex_set.set(linear_order[end]);
+      interval_vertex_sets[begin][end] = vertex_set;
+    }
+  }
+
+  /**
+   * 3. Dynamic programming over the intervals: The best plan for an interval is the cheapest join of the best plans of
+   *    two adjacent intervals that it can be split into. Splits without join predicates (i.e., cross joins) are only
+   *    considered if no other split exists. An interval only depends on shorter intervals, so that all intervals of
+   *    the same length are processed in parallel.
+   */
+  const auto cost_estimators = _worker_cost_estimators(join_graph, cost_estimator);
+
+  for (auto interval_length = size_t{2}; interval_length <= vertex_count; ++interval_length) {
+    const auto interval_count = vertex_count - interval_length + 1;
+
+    _parallel_for(interval_count, cost_estimators, [&](const auto begin, const auto& estimator) {
+      const auto end = begin + interval_length - 1;
+      auto& best_plan = best_plans[begin][end];
+
+      for (const auto allow_cross_join : {false, true}) {
+        for (auto split = begin; split < end; ++split) {
+          const auto& left_vertex_set = interval_vertex_sets[begin][split];
+          const auto& right_vertex_set = interval_vertex_sets[split + 1][end];
+          if (!allow_cross_join && !vertex_sets_connected(join_graph, left_vertex_set, right_vertex_set)) continue;
+
+          const auto& [left_plan, left_cost] = best_plans[begin][split];
+          const auto& [right_plan, right_cost] = best_plans[split + 1][end];
+
+          const auto join_predicates = join_graph.find_join_predicates(left_vertex_set, right_vertex_set);
+
+          auto candidate_plan = _add_join_to_plan(left_plan, right_plan, join_predicates, estimator);
+          const auto candidate_cost = _join_plan_cost(candidate_plan, left_cost, right_cost, estimator);
+
+          if (!best_plan.plan || candidate_cost < best_plan.cost) {
+            best_plan = PlanAndCost{std::move(candidate_plan), candidate_cost};
+          }
+        }
+
+        if (best_plan.plan) break;
+      }
+    });
+  }
+
+  return best_plans[0][vertex_count - 1].plan;
+}
+
+std::vector<size_t> LinearizedDp::_linearize(const JoinGraph& join_graph,
+                                             const std::vector<std::shared_ptr<AbstractLQPNode>>& vertex_plans,
+                                             const std::shared_ptr<AbstractCostEstimator>& cost_estimator) {
+  const auto vertex_count = join_graph.vertices.size();
+
+  auto linear_order = std::vector<size_t>{};
+  linear_order.reserve(vertex_count);
+
+  // The left-deep plan of the vertices in linear_order
+  auto linear_plan = std::shared_ptr<AbstractLQPNode>{};
+  auto linear_vertex_set = JoinGraphVertexSet{vertex_count};
+
+  auto remaining_vertex_set = JoinGraphVertexSet{vertex_count};
+  remaining_vertex_set.flip();
+
+  while (remaining_vertex_set.any()) {
+    auto next_vertex_idx = JoinGraphVertexSet::npos;
+    auto next_plan = std::shared_ptr<AbstractLQPNode>{};
+    auto next_cardinality = Cardinality{0};
+    auto next_is_connected = false;
+
+    for (auto vertex_idx = remaining_vertex_set.find_first(); vertex_idx != JoinGraphVertexSet::npos;
+         vertex_idx = remaining_vertex_set.find_next(vertex_idx)) {
+      auto vertex_set = JoinGraphVertexSet{vertex_count};
+      vertex_set.set(vertex_idx);
+
+      const auto is_connected = linear_plan && vertex_sets_connected(join_graph, linear_vertex_set, vertex_set);
+      if (next_is_connected && !is_connected) continue;
+
+      // Without a connection, the join is a cross join and its cardinality grows with that of the vertex
+      auto plan = vertex_plans[vertex_idx];
+      if (linear_plan) {
+        const auto join_predicates = join_graph.find_join_predicates(linear_vertex_set, vertex_set);
+        plan = _add_join_to_plan(linear_plan, plan, join_predicates, cost_estimator);
+      }
+      const auto cardinality = cost_estimator->cardinality_estimator->estimate_cardinality(plan);
+
+      if (next_vertex_idx == JoinGraphVertexSet::npos || (is_connected && !next_is_connected) ||
+          cardinality < next_cardinality) {
+        next_vertex_idx = vertex_idx;
+        next_plan = plan;
+        next_cardinality = cardinality;
+        next_is_connected = is_connected;
+      }
+    }
+
+    linear_order.emplace_back(next_vertex_idx);
+    linear_plan = next_plan;
+    linear_vertex_set.set(next_vertex_idx);
+    remaining_vertex_set.reset(next_vertex_idx);
+  }
+
+  return linear_order;
+}
+
+}  // namespace opossum
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "abstract_join_ordering_algorithm.hpp"
+
+namespace opossum {
+
+class AbstractCostEstimator;
+class JoinGraph;
+
+/**
+ * Join ordering algorithm for JoinGraphs that are too large for DpCcp, based on "Adaptive Optimization of Very Large
+ * Join Queries" (Neumann and Radke, SIGMOD 2018).
+ *
+ * LinearizedDp first brings the vertices into a linear order. Then, it finds the cheapest bushy plan that only joins
+ * adjacent ranges of this order, using dynamic programming over the intervals of the order. For n vertices, this costs
+ * O(n^3) candidate joins, whereas DpCcp costs up to O(3^n) for densely connected JoinGraphs.
+ *
+ * The paper derives the linear order from the optimal left-deep plan determined by IKKBZ. IKKBZ requires an acyclic
+ * JoinGraph and a cost function with the ASI property, neither of which is given here. Instead, the order is built
+ * greedily: Starting with the smallest vertex, the vertex that yields the smallest intermediate result is appended
+ * next, preferring vertices that are connected to the vertices already in the order. For a connected JoinGraph, the
+ * left-deep plan along this order is one of the candidates of the dynamic programming.
+ *
+ * Intervals of the same length are processed in parallel. As in DpCcp, local predicates are pushed down and sorted by
+ * increasing cost. Cross joins are only used for intervals that cannot be split into two connected parts.
+ */
+class LinearizedDp final : public AbstractJoinOrderingAlgorithm {
+ public:
+  std::shared_ptr<AbstractLQPNode> operator()(const JoinGraph& join_graph,
+                                              const std::shared_ptr<AbstractCostEstimator>& cost_estimator) override;
+
+ private:
+  // @return the vertex indices in the order determined by the greedy linearization
+  static std::vector<size_t> _linearize(const JoinGraph& join_graph,
+                                        const std::vector<std::shared_ptr<AbstractLQPNode>>& vertex_plans,
+                                        const std::shared_ptr<AbstractCostEstimator>& cost_estimator);
+};
+
+}  // namespace opossum
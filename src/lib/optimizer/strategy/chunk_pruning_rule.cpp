@@ -235,8 +235,10 @@ std::shared_ptr<TableStatistics> ChunkPruningRule::_prune_table_statistics(const
     }
   }
 
-  return std::make_shared<TableStatistics>(std::move(column_statistics),
-                                           old_statistics.row_count - static_cast<float>(num_rows_pruned));
+  const auto pruned_statistics = std::make_shared<TableStatistics>(
+      std::move(column_statistics), old_statistics.row_count - static_cast<float>(num_rows_pruned));
+  pruned_statistics->column_group_statistics = old_statistics.column_group_statistics;
+  return pruned_statistics;
 }
 
 }  // namespace opossum
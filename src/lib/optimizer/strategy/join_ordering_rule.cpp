@@ -6,6 +6,7 @@
 #include "optimizer/join_ordering/dp_ccp.hpp"
 #include "optimizer/join_ordering/greedy_operator_ordering.hpp"
 #include "optimizer/join_ordering/join_graph.hpp"
+#include "optimizer/join_ordering/linearized_dp.hpp"
 #include "statistics/abstract_cardinality_estimator.hpp"
 #include "statistics/cardinality_estimation_cache.hpp"
 #include "statistics/table_statistics.hpp"
@@ -64,13 +65,15 @@ std::shared_ptr<AbstractLQPNode> JoinOrderingRule::_perform_join_ordering_recurs
   caching_cost_estimator->cardinality_estimator->guarantee_join_graph(*join_graph);
 
   /**
-   * Select and call the actual Join Ordering Algorithm
-   * Simple heuristic: Use DpCcp for any query with less than X tables and GOO for everything more complex
+   * Select and call the actual Join Ordering Algorithm, adapting to the size of the JoinGraph (see "Adaptive
+   * Optimization of Very Large Join Queries", Neumann and Radke, SIGMOD 2018): Use the optimal DpCcp for small
+   * JoinGraphs, LinearizedDp (O(n^3)) for medium-sized ones, and GOO for everything more complex.
    */
-  // TODO(anybody) Increase X once our costing/cardinality estimation is faster/uses internal caching
   auto result_lqp = std::shared_ptr<AbstractLQPNode>{};
-  if (join_graph->vertices.size() < 9) {
+  if (join_graph->vertices.size() <= MAX_DP_CCP_VERTEX_COUNT) {
     result_lqp = DpCcp{}(*join_graph, caching_cost_estimator);  // NOLINT - doesn't like `{}()`
+  } else if (join_graph->vertices.size() <= MAX_LINEARIZED_DP_VERTEX_COUNT) {
+    result_lqp = LinearizedDp{}(*join_graph, caching_cost_estimator);  // NOLINT - doesn't like `{}()`
   } else {
     result_lqp = GreedyOperatorOrdering{}(*join_graph, caching_cost_estimator);  // NOLINT - doesn't like `{}()`
   }
@@ -10,12 +10,17 @@ class AbstractCostEstimator;
 
 /**
  * A rule that brings join operations into a (supposedly) efficient order.
- * Currently only the order of inner joins is modified using a single underlying algorithm, DpCcp.
+ * Currently only the order of inner joins is modified. Depending on the number of vertices in the JoinGraph, DpCcp,
+ * LinearizedDp, or GreedyOperatorOrdering is used.
  */
 class JoinOrderingRule : public AbstractRule {
  public:
   void apply_to(const std::shared_ptr<AbstractLQPNode>& root) const override;
 
+  // Largest JoinGraphs (in number of vertices) that are ordered using DpCcp and LinearizedDp, respectively
+  static constexpr auto MAX_DP_CCP_VERTEX_COUNT = size_t{9};
+  static constexpr auto MAX_LINEARIZED_DP_VERTEX_COUNT = size_t{50};
+
  private:
   std::shared_ptr<AbstractLQPNode> _perform_join_ordering_recursively(
       const std::shared_ptr<AbstractLQPNode>& lqp) const;
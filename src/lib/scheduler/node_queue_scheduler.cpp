@@ -8,6 +8,7 @@
 #include "abstract_task.hpp"
 #include "hyrise.hpp"
 #include "task_queue.hpp"
+#include "wakeup_signal.hpp"
 #include "worker.hpp"
 
 #include "uid_allocator.hpp"
@@ -15,7 +16,9 @@
 
 namespace opossum {
 
-NodeQueueScheduler::NodeQueueScheduler() { _worker_id_allocator = std::make_shared<UidAllocator>(); }
+NodeQueueScheduler::NodeQueueScheduler(Mode mode) : _mode(mode) {
+  _worker_id_allocator = std::make_shared<UidAllocator>();
+}
 
 NodeQueueScheduler::~NodeQueueScheduler() {
   if (HYRISE_DEBUG && _active) {
@@ -31,6 +34,8 @@ void NodeQueueScheduler::begin() {
   _workers.reserve(Hyrise::get().topology.num_cpus());
   _queues.reserve(Hyrise::get().topology.nodes().size());
 
+  if (_mode == Mode::WorkStealing) _wakeup_signal = std::make_shared<WakeupSignal>();
+
   for (auto node_id = NodeID{0}; node_id < Hyrise::get().topology.nodes().size(); node_id++) {
     auto queue = std::make_shared<TaskQueue>(node_id);
 
@@ -39,7 +44,8 @@ void NodeQueueScheduler::begin() {
     const auto& topology_node = Hyrise::get().topology.nodes()[node_id];
 
     for (const auto& topology_cpu : topology_node.cpus) {
-      _workers.emplace_back(std::make_shared<Worker>(queue, _worker_id_allocator->allocate(), topology_cpu.cpu_id));
+      _workers.emplace_back(
+          std::make_shared<Worker>(queue, _worker_id_allocator->allocate(), topology_cpu.cpu_id, _wakeup_signal));
     }
   }
 
@@ -71,16 +77,23 @@ void NodeQueueScheduler::finish() {
     for ([[maybe_unused]] auto& queue : _queues) {
       DebugAssert(queue->empty(), "NodeQueueScheduler bug: Queue wasn't empty even though all tasks finished");
     }
+    for ([[maybe_unused]] auto& worker : _workers) {
+      DebugAssert(worker->deque().empty(), "NodeQueueScheduler bug: Deque wasn't empty even though all tasks finished");
+    }
   }
 
   _active = false;
 
+  // Sleeping workers have to notice that the scheduler is shutting down.
+  if (_wakeup_signal) _wakeup_signal->notify_all();
+
   for (auto& worker : _workers) {
     worker->join();
   }
 
   _workers = {};
   _queues = {};
+  _wakeup_signal = nullptr;
   _task_counter = 0;
 }
 
@@ -88,6 +101,10 @@ bool NodeQueueScheduler::active() const { return _active; }
 
 const std::vector<std::shared_ptr<TaskQueue>>& NodeQueueScheduler::queues() const { return _queues; }
 
+const std::vector<std::shared_ptr<Worker>>& NodeQueueScheduler::workers() const { return _workers; }
+
+NodeQueueScheduler::Mode NodeQueueScheduler::mode() const { return _mode; }
+
 void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID preferred_node_id,
                                   SchedulePriority priority) {
   /**
@@ -104,6 +121,11 @@ void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID pre
   // Lookup node id for current worker.
   if (preferred_node_id == CURRENT_NODE_ID) {
     auto worker = Worker::get_this_thread_worker();
+    if (worker && _mode == Mode::WorkStealing) {
+      worker->push_task(task, priority);
+      return;
+    }
+
     if (worker) {
       preferred_node_id = worker->queue()->node_id();
     } else {
@@ -117,5 +139,7 @@ void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID pre
 
   auto queue = _queues[preferred_node_id];
   queue->push(task, static_cast<uint32_t>(priority));
+
+  if (_wakeup_signal) _wakeup_signal->notify_new_task();
 }
 }  // namespace opossum
@@ -70,18 +70,35 @@ namespace opossum {
  * Afterwards, the current worker is checking its local queue gain.
  *
  * [1] http://frankdenneman.nl/2016/07/13/numa-deep-dive-4-local-memory-optimization/
+ *
+ *
+ * WORK-STEALING MODE
+ *
+ * With Mode::WorkStealing, each worker additionally owns a lock-free TaskDeque. Stealable tasks that are scheduled or
+ * become ready on a worker thread (e.g., the JobTasks spawned by the operator that the worker executes) are pushed to
+ * that worker's deque instead of the node's queue. A worker looks for tasks in the following order:
+ *  1) its own deque, newest task first (LIFO), so that jobs are processed while their data is still cached
+ *  2) the TaskQueue of its node, which receives all tasks scheduled from non-worker threads
+ *  3) the deques of the other workers, starting at a randomly chosen victim and taking the oldest task (FIFO)
+ *  4) the TaskQueues of the other nodes
+ * If none of these contain a task, the worker sleeps on a WakeupSignal until a new task is pushed or, if it waits
+ * for tasks to finish, until another task is done. Unlike the default mode, which polls the queue every 300 µs, this
+ * does not add any delay to short-running queries.
  */
 
 class Worker;
 class TaskQueue;
 class UidAllocator;
+class WakeupSignal;
 
 /**
  * Schedules Tasks
  */
 class NodeQueueScheduler : public AbstractScheduler {
  public:
-  NodeQueueScheduler();
+  enum class Mode { NodeQueues, WorkStealing };
+
+  explicit NodeQueueScheduler(Mode mode = Mode::NodeQueues);
   ~NodeQueueScheduler() override;
 
   /**
@@ -96,6 +113,10 @@ class NodeQueueScheduler : public AbstractScheduler {
 
   const std::vector<std::shared_ptr<TaskQueue>>& queues() const override;
 
+  const std::vector<std::shared_ptr<Worker>>& workers() const override;
+
+  Mode mode() const;
+
   /**
    * @param task
    * @param preferred_node_id The Task will be initially added to this node, but might get stolen by other Nodes later
@@ -107,10 +128,12 @@ class NodeQueueScheduler : public AbstractScheduler {
   void wait_for_all_tasks() override;
 
  private:
+  const Mode _mode;
   std::atomic<TaskID> _task_counter{TaskID{0}};
   std::shared_ptr<UidAllocator> _worker_id_allocator;
   std::vector<std::shared_ptr<TaskQueue>> _queues;
   std::vector<std::shared_ptr<Worker>> _workers;
+  std::shared_ptr<WakeupSignal> _wakeup_signal;
   std::atomic_bool _active{false};
 };
 
@@ -0,0 +1,116 @@
+#include "task_deque.hpp"
+
+#include <memory>
+#include <utility>
+
+#include "abstract_task.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+TaskDeque::Buffer::Buffer(size_t init_capacity)
+    : capacity(init_capacity), slots(std::make_unique<Slot[]>(init_capacity)) {
+  DebugAssert(capacity > 0 && (capacity & (capacity - 1)) == 0, "Capacity of a TaskDeque has to be a power of two");
+}
+
+TaskDeque::Slot& TaskDeque::Buffer::operator[](int64_t index) {
+  return slots[static_cast<size_t>(index) & (capacity - 1)];
+}
+
+TaskDeque::TaskDeque(size_t initial_capacity) {
+  _buffers.emplace_back(std::make_unique<Buffer>(initial_capacity));
+  _buffer.store(_buffers.back().get(), std::memory_order_relaxed);
+}
+
+TaskDeque::~TaskDeque() {
+  // Tasks that are still in the deque are owned by it.
+  auto* const buffer = _buffer.load(std::memory_order_relaxed);
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  for (auto index = _top.load(std::memory_order_relaxed); index < bottom; ++index) {
+    delete (*buffer)[index].load(std::memory_order_relaxed);
+  }
+}
+
+void TaskDeque::push(const std::shared_ptr<AbstractTask>& task) {
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  const auto top = _top.load(std::memory_order_acquire);
+  auto* buffer = _buffer.load(std::memory_order_relaxed);
+
+  if (bottom - top > static_cast<int64_t>(buffer->capacity) - 1) {
+    buffer = _grow(buffer, top, bottom);
+  }
+
+  (*buffer)[bottom].store(new std::shared_ptr<AbstractTask>(task), std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  _bottom.store(bottom + 1, std::memory_order_relaxed);
+}
+
+std::shared_ptr<AbstractTask> TaskDeque::pop() {
+  const auto bottom = _bottom.load(std::memory_order_relaxed) - 1;
+  auto* const buffer = _buffer.load(std::memory_order_relaxed);
+  _bottom.store(bottom, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  auto top = _top.load(std::memory_order_relaxed);
+
+  if (top > bottom) {
+    // The deque was empty.
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  auto* task = (*buffer)[bottom].load(std::memory_order_relaxed);
+  if (top == bottom) {
+    // This is the last task, so we compete with thieves for it.
+    if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+      task = nullptr;
+    }
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+  }
+
+  if (!task) return nullptr;
+
+  auto result = std::move(*task);
+  delete task;
+  return result;
+}
+
+std::shared_ptr<AbstractTask> TaskDeque::steal() {
+  auto top = _top.load(std::memory_order_acquire);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  const auto bottom = _bottom.load(std::memory_order_acquire);
+
+  if (top >= bottom) return nullptr;
+
+  auto* const buffer = _buffer.load(std::memory_order_acquire);
+  auto* const task = (*buffer)[top].load(std::memory_order_relaxed);
+  if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+    // Another thief or the owner was faster.
+    return nullptr;
+  }
+
+  auto result = std::move(*task);
+  delete task;
+  return result;
+}
+
+bool TaskDeque::empty() const { return size() == 0; }
+
+size_t TaskDeque::size() const {
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  const auto top = _top.load(std::memory_order_relaxed);
+  return bottom > top ? static_cast<size_t>(bottom - top) : size_t{0};
+}
+
+TaskDeque::Buffer* TaskDeque::_grow(Buffer* buffer, int64_t top, int64_t bottom) {
+  auto new_buffer = std::make_unique<Buffer>(buffer->capacity * 2);
+  for (auto index = top; index < bottom; ++index) {
+    (*new_buffer)[index].store((*buffer)[index].load(std::memory_order_relaxed), std::memory_order_relaxed);
+  }
+
+  auto* const new_buffer_ptr = new_buffer.get();
+  _buffers.emplace_back(std::move(new_buffer));
+  _buffer.store(new_buffer_ptr, std::memory_order_release);
+  return new_buffer_ptr;
+}
+
+}  // namespace opossum
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+
+/**
+ * Lock-free work-stealing deque as described by Chase and Lev ("Dynamic Circular Work-Stealing Deque", SPAA 2005),
+ * using the memory orderings proposed by Lê et al. ("Correct and Efficient Work-Stealing for Weak Memory Models",
+ * PPoPP 2013).
+ *
+ * Each Worker of a NodeQueueScheduler in WorkStealing mode owns one TaskDeque. Only the owning worker may call push()
+ * and pop(), which operate on the bottom end of the deque (LIFO). Thus, the JobTasks spawned by an operator are
+ * executed by the same worker while their input is still in its caches. All other workers may call steal(), which
+ * takes the oldest task from the top end (FIFO). Stealing does not take locks - contention is resolved by a single CAS.
+ *
+ * The buffer grows if it is full. As thieves might still read from the old buffer, retired buffers are kept until the
+ * deque is destroyed. As the buffer only ever doubles, this at most doubles the memory consumption.
+ */
+class TaskDeque : private Noncopyable {
+ public:
+  explicit TaskDeque(size_t initial_capacity = 64);
+  ~TaskDeque();
+
+  /**
+   * Only to be called by the owning worker.
+   */
+  void push(const std::shared_ptr<AbstractTask>& task);
+  std::shared_ptr<AbstractTask> pop();
+
+  /**
+   * Can be called by any thread. Returns nullptr if the deque is empty or if another thread took the last task first.
+   */
+  std::shared_ptr<AbstractTask> steal();
+
+  /**
+   * Only a snapshot if called while the deque is used by other threads.
+   */
+  bool empty() const;
+  size_t size() const;
+
+ private:
+  // Tasks are stored as pointers to heap-allocated shared_ptrs so that a slot can be read and written atomically. The
+  // thread that successfully removes a task from the deque takes over ownership of the heap-allocated shared_ptr.
+  using Slot = std::atomic<std::shared_ptr<AbstractTask>*>;
+
+  struct Buffer {
+    explicit Buffer(size_t init_capacity);
+
+    Slot& operator[](int64_t index);
+
+    const size_t capacity;
+    std::unique_ptr<Slot[]> slots;
+  };
+
+  Buffer* _grow(Buffer* buffer, int64_t top, int64_t bottom);
+
+  alignas(64) std::atomic<int64_t> _top{0};
+  alignas(64) std::atomic<int64_t> _bottom{0};
+  std::atomic<Buffer*> _buffer;
+
+  // Owns the current buffer as well as all retired ones. Only modified by the owning worker.
+  std::vector<std::unique_ptr<Buffer>> _buffers;
+};
+
+}  // namespace opossum
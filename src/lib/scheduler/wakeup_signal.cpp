@@ -0,0 +1,46 @@
+#include "wakeup_signal.hpp"
+
+namespace opossum {
+
+uint64_t WakeupSignal::epoch() const { return _epoch.load(); }
+
+void WakeupSignal::notify_new_task() {
+  // The increment and the load of the sleeper count are sequentially consistent, as is the increment of the sleeper
+  // count and the load of the epoch in wait(). Either we see the sleeper, or the sleeper sees the new epoch.
+  ++_epoch;
+  if (_sleeping_worker_count == 0) return;
+
+  // Taking the mutex ensures that a worker that has registered itself as a sleeper is actually waiting on the
+  // condition variable (or will see the new epoch when checking the predicate).
+  { std::lock_guard<std::mutex> lock(_mutex); }
+  _condition_variable.notify_one();
+}
+
+void WakeupSignal::notify_task_done() {
+  ++_epoch;
+  if (_waiting_worker_count == 0) return;
+
+  { std::lock_guard<std::mutex> lock(_mutex); }
+  _condition_variable.notify_all();
+}
+
+void WakeupSignal::notify_all() {
+  ++_epoch;
+
+  { std::lock_guard<std::mutex> lock(_mutex); }
+  _condition_variable.notify_all();
+}
+
+void WakeupSignal::wait(uint64_t observed_epoch, bool waiting_for_tasks) {
+  std::unique_lock<std::mutex> lock(_mutex);
+
+  ++_sleeping_worker_count;
+  if (waiting_for_tasks) ++_waiting_worker_count;
+
+  _condition_variable.wait(lock, [&]() { return _epoch != observed_epoch; });
+
+  --_sleeping_worker_count;
+  if (waiting_for_tasks) --_waiting_worker_count;
+}
+
+}  // namespace opossum
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Used by the NodeQueueScheduler in WorkStealing mode to put idle workers to sleep until there is something to do,
+ * instead of polling the queues in fixed time intervals.
+ *
+ * Every event (a new ready task, a finished task, the shutdown of the scheduler) increments an epoch counter. Before a
+ * worker searches for a task, it reads the epoch. If it does not find any task, it passes that epoch to wait(), which
+ * only blocks if no event happened in the meantime. Thus, no notification can get lost between the unsuccessful search
+ * and going to sleep. Notifying is cheap if no worker is sleeping, as the mutex is only taken if there are sleepers.
+ */
+class WakeupSignal : private Noncopyable {
+ public:
+  uint64_t epoch() const;
+
+  /**
+   * Called after a ready task was pushed to a queue or deque. Wakes up one sleeping worker.
+   */
+  void notify_new_task();
+
+  /**
+   * Called after a task was executed. Wakes up all workers that are waiting for tasks to finish (see
+   * Worker::_wait_for_tasks), as we do not know which tasks they are waiting for.
+   */
+  void notify_task_done();
+
+  /**
+   * Wakes up all sleeping workers, e.g., when the scheduler is shut down.
+   */
+  void notify_all();
+
+  /**
+   * Blocks until the epoch differs from observed_epoch. waiting_for_tasks is true if the caller waits for the
+   * completion of tasks, in which case it also has to be woken up by notify_task_done().
+   */
+  void wait(uint64_t observed_epoch, bool waiting_for_tasks);
+
+ private:
+  std::atomic<uint64_t> _epoch{0};
+  std::atomic<uint32_t> _sleeping_worker_count{0};
+  std::atomic<uint32_t> _waiting_worker_count{0};
+
+  std::mutex _mutex;
+  std::condition_variable _condition_variable;
+};
+
+}  // namespace opossum
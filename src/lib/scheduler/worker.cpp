@@ -15,6 +15,7 @@
 #include "abstract_task.hpp"
 #include "hyrise.hpp"
 #include "task_queue.hpp"
+#include "wakeup_signal.hpp"
 
 namespace {
 
@@ -32,8 +33,9 @@ namespace opossum {
 
 std::shared_ptr<Worker> Worker::get_this_thread_worker() { return ::this_thread_worker.lock(); }
 
-Worker::Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID id, CpuID cpu_id)
-    : _queue(queue), _id(id), _cpu_id(cpu_id) {}
+Worker::Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID id, CpuID cpu_id,
+               const std::shared_ptr<WakeupSignal>& wakeup_signal)
+    : _queue(queue), _id(id), _cpu_id(cpu_id), _wakeup_signal(wakeup_signal), _random_engine(id) {}
 
 WorkerID Worker::id() const { return _id; }
 
@@ -54,6 +56,16 @@ void Worker::operator()() {
 }
 
 void Worker::_work() {
+  if (_wakeup_signal) {
+    // The shutdown of the scheduler increments the epoch after deactivating it. Thus, checking whether the scheduler is
+    // still active after reading the epoch guarantees that we do not sleep through the shutdown.
+    const auto observed_epoch = _wakeup_signal->epoch();
+    if (!Hyrise::get().scheduler()->active()) return;
+
+    if (!_try_execute_task()) _wakeup_signal->wait(observed_epoch, false);
+    return;
+  }
+
   auto task = _queue->pull();
 
   if (!task) {
@@ -90,6 +102,78 @@ void Worker::_work() {
   _num_finished_tasks++;
 }
 
+bool Worker::_try_execute_task() {
+  // Local tasks first (LIFO), as their input is most likely still cached. Then, tasks that were scheduled from outside
+  // of the workers. Only if there is neither, we take the oldest tasks of other workers and nodes.
+  auto task = _deque.pop();
+  if (!task) task = _queue->pull();
+  if (!task) task = _steal_from_other_workers();
+  if (!task) {
+    for (const auto& queue : Hyrise::get().scheduler()->queues()) {
+      if (queue == _queue) continue;
+
+      task = queue->steal();
+      if (task) break;
+    }
+  }
+
+  if (!task) return false;
+
+  task->set_node_id(_queue->node_id());
+  task->execute();
+  _num_finished_tasks++;
+
+  _wakeup_signal->notify_task_done();
+  return true;
+}
+
+std::shared_ptr<AbstractTask> Worker::_steal_from_other_workers() {
+  const auto& workers = Hyrise::get().scheduler()->workers();
+  const auto worker_count = workers.size();
+  if (worker_count < 2) return nullptr;
+
+  // Start at a random victim so that idle workers do not all compete for the same deque.
+  const auto first_victim = std::uniform_int_distribution<size_t>{0, worker_count - 1}(_random_engine);
+  for (auto offset = size_t{0}; offset < worker_count; ++offset) {
+    const auto& victim = workers[(first_victim + offset) % worker_count];
+    if (victim.get() == this) continue;
+
+    auto task = victim->steal_task();
+    if (task) return task;
+  }
+
+  return nullptr;
+}
+
+void Worker::push_task(const std::shared_ptr<AbstractTask>& task, SchedulePriority priority) {
+  if (!_wakeup_signal) {
+    _queue->push(task, static_cast<uint32_t>(priority));
+    return;
+  }
+
+  if (task->is_stealable()) {
+    // Someone else was first to enqueue this task? No problem!
+    if (!task->try_mark_as_enqueued()) return;
+
+    task->set_node_id(_queue->node_id());
+    _deque.push(task);
+  } else {
+    _queue->push(task, static_cast<uint32_t>(priority));
+  }
+
+  _wakeup_signal->notify_new_task();
+}
+
+std::shared_ptr<AbstractTask> Worker::steal_task() { return _deque.steal(); }
+
+const TaskDeque& Worker::deque() const { return _deque; }
+
+uint64_t Worker::_wakeup_signal_epoch() const { return _wakeup_signal->epoch(); }
+
+void Worker::_wait_for_wakeup(uint64_t observed_epoch, bool waiting_for_tasks) {
+  _wakeup_signal->wait(observed_epoch, waiting_for_tasks);
+}
+
 void Worker::start() { _thread = std::thread(&Worker::operator(), this); }
 
 void Worker::join() {
@@ -2,19 +2,27 @@
 
 #include <atomic>
 #include <memory>
+#include <random>
 #include <thread>
 #include <vector>
 
+#include "task_deque.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
+class AbstractTask;
 class TaskQueue;
+class WakeupSignal;
 
 /**
  * To be executed on a separate Thread, fetches and executes tasks until the queue is empty AND the shutdown flag is set
  * Ideally there should be one Worker actively doing work per CPU, but multiple might be active occasionally
+ *
+ * If a WakeupSignal is passed, the worker runs in work-stealing mode (see NodeQueueScheduler): It owns a TaskDeque
+ * for the tasks it spawns, steals from the deques of randomly chosen workers when it runs out of work, and sleeps on
+ * the WakeupSignal instead of polling its queue.
  */
 class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable {
   friend class AbstractScheduler;
@@ -22,7 +30,8 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
  public:
   static std::shared_ptr<Worker> get_this_thread_worker();
 
-  Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID id, CpuID cpu_id);
+  Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID id, CpuID cpu_id,
+         const std::shared_ptr<WakeupSignal>& wakeup_signal = nullptr);
 
   /**
    * Unique ID of a worker. Currently not in use, but really helpful for debugging.
@@ -36,6 +45,20 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
 
   uint64_t num_finished_tasks() const;
 
+  /**
+   * Enqueues a ready task that was created or unblocked on this worker's thread. In work-stealing mode, stealable tasks
+   * are pushed to the worker's own deque, where they are executed next (LIFO) unless other workers steal them first.
+   * All other tasks are pushed to the worker's queue.
+   */
+  void push_task(const std::shared_ptr<AbstractTask>& task, SchedulePriority priority);
+
+  /**
+   * Called by other workers in work-stealing mode.
+   */
+  std::shared_ptr<AbstractTask> steal_task();
+
+  const TaskDeque& deque() const;
+
   void operator=(const Worker&) = delete;
   void operator=(Worker&&) = delete;
 
@@ -43,6 +66,10 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
   void operator()();
   void _work();
 
+  // Work-stealing mode: Returns whether a task was executed. The caller is responsible for sleeping otherwise.
+  bool _try_execute_task();
+  std::shared_ptr<AbstractTask> _steal_from_other_workers();
+
   template <typename TaskType>
   void _wait_for_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks) {
     auto tasks_completed = [&tasks]() {
@@ -55,8 +82,18 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
       return true;
     };
 
-    while (!tasks_completed()) {
-      _work();
+    if (!_wakeup_signal) {
+      while (!tasks_completed()) {
+        _work();
+      }
+      return;
+    }
+
+    // The epoch has to be read before checking the tasks so that we do not miss the completion of the last task.
+    while (true) {
+      const auto observed_epoch = _wakeup_signal_epoch();
+      if (tasks_completed()) return;
+      if (!_try_execute_task()) _wait_for_wakeup(observed_epoch, true);
     }
   }
 
@@ -67,11 +104,18 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
    */
   void _set_affinity();
 
+  uint64_t _wakeup_signal_epoch() const;
+  void _wait_for_wakeup(uint64_t observed_epoch, bool waiting_for_tasks);
+
   std::shared_ptr<TaskQueue> _queue;
   WorkerID _id;
   CpuID _cpu_id;
   std::thread _thread;
   std::atomic<uint64_t> _num_finished_tasks{0};
+
+  std::shared_ptr<WakeupSignal> _wakeup_signal;
+  TaskDeque _deque;
+  std::minstd_rand _random_engine;
 };
 
 }  // namespace opossum
@@ -3,8 +3,12 @@
 namespace opossum {
 
 void AbstractCardinalityEstimator::guarantee_join_graph(const JoinGraph& join_graph) {
-  cardinality_estimation_cache.join_graph_statistics_cache.emplace(
-      JoinGraphStatisticsCache::from_join_graph(join_graph));
+  cardinality_estimation_cache.join_graph_statistics_cache = JoinGraphStatisticsCache::from_join_graph(join_graph);
+}
+
+void AbstractCardinalityEstimator::guarantee_join_graph(
+    const std::shared_ptr<JoinGraphStatisticsCache>& join_graph_statistics_cache) {
+  cardinality_estimation_cache.join_graph_statistics_cache = join_graph_statistics_cache;
 }
 
 void AbstractCardinalityEstimator::guarantee_bottom_up_construction() {
@@ -36,6 +36,12 @@ class AbstractCardinalityEstimator {
    */
   void guarantee_join_graph(const JoinGraph& join_graph);
 
+  /**
+   * Same as above, but uses @param join_graph_statistics_cache, which may be shared with other estimators, e.g., by the
+   * workers of a parallel join enumeration.
+   */
+  void guarantee_join_graph(const std::shared_ptr<JoinGraphStatisticsCache>& join_graph_statistics_cache);
+
   /**
    * For increased cardinality estimation performance:
    * Promises to this CardinalityEstimator that it will only be used to estimate bottom-up
@@ -1,7 +1,11 @@
 #include "cardinality_estimator.hpp"
 
+#include <algorithm>
 #include <iostream>
 #include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
 
 #include "attribute_statistics.hpp"
 #include "expression/abstract_expression.hpp"
@@ -65,6 +69,137 @@ std::optional<float> estimate_null_value_ratio_of_column(const TableStatistics&
   return std::nullopt;
 }
 
+std::optional<HistogramCountType> estimate_distinct_count_of_column(const TableStatistics& table_statistics,
+                                                                    const ColumnID column_id) {
+  auto distinct_count = std::optional<HistogramCountType>{};
+  resolve_data_type(table_statistics.column_data_type(column_id), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+    const auto column_statistics =
+        std::dynamic_pointer_cast<AttributeStatistics<ColumnDataType>>(table_statistics.column_statistics[column_id]);
+    if (column_statistics && column_statistics->histogram) {
+      distinct_count = column_statistics->histogram->total_distinct_count();
+    }
+  });
+  return distinct_count;
+}
+
+// Estimates the number of distinct value combinations of @param column_ids, assuming the columns to be independent
+Cardinality estimate_independent_distinct_count(const TableStatistics& table_statistics,
+                                                const std::vector<ColumnID>& column_ids) {
+  auto distinct_count = Cardinality{1};
+  for (const auto column_id : column_ids) {
+    const auto column_distinct_count = estimate_distinct_count_of_column(table_statistics, column_id);
+    if (!column_distinct_count) return table_statistics.row_count;
+    distinct_count *= std::max(*column_distinct_count, HistogramCountType{1});
+  }
+  return std::min(distinct_count, table_statistics.row_count);
+}
+
+// Returns the distinct count of the column group consisting of exactly the sorted @param column_ids, if there is one
+std::optional<Cardinality> find_column_group_distinct_count(const TableStatistics& table_statistics,
+                                                            const std::vector<ColumnID>& column_ids) {
+  auto distinct_count = std::optional<Cardinality>{};
+  for (const auto& column_group : table_statistics.column_group_statistics) {
+    if (column_group.column_ids != column_ids) continue;
+    distinct_count = std::min(distinct_count.value_or(column_group.distinct_count), column_group.distinct_count);
+  }
+  return distinct_count;
+}
+
+// The number of distinct value combinations cannot exceed the number of rows
+void cap_column_group_distinct_counts(std::vector<ColumnGroupStatistics>& column_group_statistics,
+                                      const Cardinality row_count) {
+  for (auto& column_group : column_group_statistics) {
+    column_group.distinct_count = std::min(column_group.distinct_count, row_count);
+  }
+}
+
+// Column groups of both inputs of a join. The ColumnIDs of the right input are offset by the left input's column count.
+std::vector<ColumnGroupStatistics> join_column_group_statistics(const TableStatistics& left_input_table_statistics,
+                                                                const TableStatistics& right_input_table_statistics,
+                                                                const Cardinality row_count) {
+  auto column_group_statistics = left_input_table_statistics.column_group_statistics;
+
+  const auto left_column_count = left_input_table_statistics.column_statistics.size();
+  for (const auto& column_group : right_input_table_statistics.column_group_statistics) {
+    auto column_ids = column_group.column_ids;
+    for (auto& column_id : column_ids) {
+      column_id = ColumnID{static_cast<ColumnID::base_type>(left_column_count + column_id)};
+    }
+    column_group_statistics.emplace_back(std::move(column_ids), column_group.distinct_count);
+  }
+
+  cap_column_group_distinct_counts(column_group_statistics, row_count);
+  return column_group_statistics;
+}
+
+/**
+ * Derives column groups (see ColumnGroupStatistics) from the unique constraints and functional dependencies of
+ * @param node. The value combinations of the columns of a unique constraint are as distinct as the rows. For an FD, the
+ * value combinations of the determinants and a dependent are as distinct as those of the determinants alone.
+ */
+std::shared_ptr<TableStatistics> add_column_groups_from_constraints(
+    const AbstractLQPNode& node, const std::shared_ptr<TableStatistics>& table_statistics) {
+  auto column_groups = std::vector<ColumnGroupStatistics>{};
+
+  const auto find_column_ids = [&](const ExpressionUnorderedSet& expressions) {
+    auto column_ids = std::vector<ColumnID>{};
+    for (const auto& expression : expressions) {
+      const auto column_id = node.find_column_id(*expression);
+      if (!column_id) return std::vector<ColumnID>{};
+      column_ids.emplace_back(*column_id);
+    }
+    std::sort(column_ids.begin(), column_ids.end());
+    return column_ids;
+  };
+
+  // Single-column unique constraints are already reflected by the distinct count of the column's histogram
+  for (const auto& unique_constraint : *node.unique_constraints()) {
+    auto column_ids = find_column_ids(unique_constraint.expressions);
+    if (column_ids.size() < 2) continue;
+    column_groups.emplace_back(std::move(column_ids), table_statistics->row_count);
+  }
+
+  for (const auto& functional_dependency : node.functional_dependencies()) {
+    const auto determinant_column_ids = find_column_ids(functional_dependency.determinants);
+    if (determinant_column_ids.empty()) continue;
+    const auto distinct_count = estimate_independent_distinct_count(*table_statistics, determinant_column_ids);
+
+    for (const auto& dependent : functional_dependency.dependents) {
+      const auto dependent_column_id = node.find_column_id(*dependent);
+      if (!dependent_column_id) continue;
+
+      auto column_ids = determinant_column_ids;
+      column_ids.insert(std::upper_bound(column_ids.begin(), column_ids.end(), *dependent_column_id),
+                        *dependent_column_id);
+      column_groups.emplace_back(std::move(column_ids), distinct_count);
+    }
+  }
+
+  if (column_groups.empty()) {
+    return table_statistics;
+  }
+
+  const auto output_table_statistics = std::make_shared<TableStatistics>(*table_statistics);
+  output_table_statistics->column_group_statistics.insert(output_table_statistics->column_group_statistics.end(),
+                                                          column_groups.begin(), column_groups.end());
+  return output_table_statistics;
+}
+
+// Maps the input ColumnIDs of @param node to its output ColumnIDs
+std::vector<std::optional<ColumnID>> output_column_ids_by_input_column_id(const AbstractLQPNode& node,
+                                                                          const size_t input_column_count) {
+  auto output_column_ids = std::vector<std::optional<ColumnID>>(input_column_count);
+  const auto& output_expressions = node.output_expressions();
+  for (auto output_column_id = ColumnID{0}; output_column_id < output_expressions.size(); ++output_column_id) {
+    const auto input_column_id = node.left_input()->find_column_id(*output_expressions[output_column_id]);
+    if (input_column_id) {
+      output_column_ids[*input_column_id] = output_column_id;
+    }
+  }
+  return output_column_ids;
+}
+
 }  // namespace
 
 namespace opossum {
@@ -146,6 +281,7 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_statistics(
       const auto mock_node = std::dynamic_pointer_cast<MockNode>(lqp);
       Assert(mock_node->table_statistics(), "Cannot return statistics of MockNode that was not assigned statistics");
       output_table_statistics = prune_column_statistics(mock_node->table_statistics(), mock_node->pruned_column_ids());
+      output_table_statistics = add_column_groups_from_constraints(*mock_node, output_table_statistics);
     } break;
 
     case LQPNodeType::Predicate: {
@@ -185,6 +321,7 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_statistics(
         output_table_statistics =
             prune_column_statistics(stored_table->table_statistics(), stored_table_node->pruned_column_ids());
       }
+      output_table_statistics = add_column_groups_from_constraints(*stored_table_node, output_table_statistics);
     } break;
 
     case LQPNodeType::Validate: {
@@ -254,7 +391,12 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_alias_node(
     column_statistics[expression_idx] = input_table_statistics->column_statistics[input_column_id];
   }
 
-  return std::make_shared<TableStatistics>(std::move(column_statistics), input_table_statistics->row_count);
+  const auto output_table_statistics =
+      std::make_shared<TableStatistics>(std::move(column_statistics), input_table_statistics->row_count);
+  output_table_statistics->column_group_statistics = remap_column_group_statistics(
+      input_table_statistics->column_group_statistics,
+      output_column_ids_by_input_column_id(alias_node, input_table_statistics->column_statistics.size()));
+  return output_table_statistics;
 }
 
 std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_projection_node(
@@ -280,7 +422,12 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_projection_node(
     }
   }
 
-  return std::make_shared<TableStatistics>(std::move(column_statistics), input_table_statistics->row_count);
+  const auto output_table_statistics =
+      std::make_shared<TableStatistics>(std::move(column_statistics), input_table_statistics->row_count);
+  output_table_statistics->column_group_statistics = remap_column_group_statistics(
+      input_table_statistics->column_group_statistics,
+      output_column_ids_by_input_column_id(projection_node, input_table_statistics->column_statistics.size()));
+  return output_table_statistics;
 }
 
 std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_aggregate_node(
@@ -304,7 +451,12 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_aggregate_node(
     }
   }
 
-  return std::make_shared<TableStatistics>(std::move(column_statistics), input_table_statistics->row_count);
+  const auto output_table_statistics =
+      std::make_shared<TableStatistics>(std::move(column_statistics), input_table_statistics->row_count);
+  output_table_statistics->column_group_statistics = remap_column_group_statistics(
+      input_table_statistics->column_group_statistics,
+      output_column_ids_by_input_column_id(aggregate_node, input_table_statistics->column_statistics.size()));
+  return output_table_statistics;
 }
 
 std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_validate_node(
@@ -428,7 +580,8 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_join_node(
   if (join_node.join_mode == JoinMode::Cross) {
     return estimate_cross_join(*left_input_table_statistics, *right_input_table_statistics);
   } else {
-    // TODO(anybody) Join cardinality estimation is consciously only performed for the primary join predicate. #1560
+    // TODO(anybody) Join cardinality estimation only considers secondary join predicates for inner equi joins with
+    //               column groups. #1560
     const auto primary_operator_join_predicate = OperatorJoinPredicate::from_expression(
         *join_node.join_predicates()[0], *join_node.left_input(), *join_node.right_input());
 
@@ -441,10 +594,22 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_join_node(
         case JoinMode::FullOuter:
         case JoinMode::Inner:
           switch (primary_operator_join_predicate->predicate_condition) {
-            case PredicateCondition::Equals:
-              return estimate_inner_equi_join(primary_operator_join_predicate->column_ids.first,
-                                              primary_operator_join_predicate->column_ids.second,
-                                              *left_input_table_statistics, *right_input_table_statistics);
+            case PredicateCondition::Equals: {
+              // Secondary equi predicates are considered if column groups provide correlation information
+              auto column_ids = std::vector<std::pair<ColumnID, ColumnID>>{primary_operator_join_predicate->column_ids};
+              const auto& join_predicates = join_node.join_predicates();
+              for (auto predicate_idx = size_t{1}; predicate_idx < join_predicates.size(); ++predicate_idx) {
+                const auto operator_join_predicate = OperatorJoinPredicate::from_expression(
+                    *join_predicates[predicate_idx], *join_node.left_input(), *join_node.right_input());
+                if (operator_join_predicate &&
+                    operator_join_predicate->predicate_condition == PredicateCondition::Equals) {
+                  column_ids.emplace_back(operator_join_predicate->column_ids);
+                }
+              }
+
+              return estimate_multi_predicate_inner_equi_join(column_ids, *left_input_table_statistics,
+                                                              *right_input_table_statistics);
+            }
 
             // TODO(anybody) Implement estimation for non-equi joins. #1830
             case PredicateCondition::NotEquals:
@@ -558,6 +723,9 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_operator_scan_pr
   auto output_column_statistics =
       std::vector<std::shared_ptr<BaseAttributeStatistics>>{input_table_statistics->column_statistics.size()};
 
+  // Distinct count of the scanned column if the predicate binds it to a single value, used for column groups below
+  auto bound_column_distinct_count = std::optional<HistogramCountType>{};
+
   resolve_data_type(left_data_type, [&](const auto data_type_t) {
     using ColumnDataType = typename decltype(data_type_t)::type;
 
@@ -662,6 +830,7 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_operator_scan_pr
             const auto total_distinct_count =
                 std::max(scan_statistics_object->total_distinct_count(), HistogramCountType{1.0f});
             selectivity = total_distinct_count > 0 ? 1.0f / total_distinct_count : 0.0f;
+            bound_column_distinct_count = total_distinct_count;
           } break;
 
           case PredicateCondition::NotEquals: {
@@ -751,12 +920,66 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_operator_scan_pr
         column_statistics->set_statistics_object(sliced_statistics_object);
 
         output_column_statistics[left_column_id] = column_statistics;
+
+        if (predicate.predicate_condition == PredicateCondition::Equals) {
+          bound_column_distinct_count =
+              std::max(scan_statistics_object->total_distinct_count(), HistogramCountType{1.0f});
+        }
       }
     }
   });
 
+  /**
+   * Column groups (see ColumnGroupStatistics) capture the correlation between the scanned column and other columns. An
+   * equality predicate binds the scanned column to a single value. Assuming the value combinations of a group to be
+   * evenly distributed over the values of the bound column, the combinations that remain for the other columns of the
+   * group are the group's distinct count divided by the distinct count of the bound column. Once all other columns of a
+   * group are bound, the remaining distinct count is the number of values the last column takes in the selected rows.
+   * An equality predicate on that column then selects one of them, which replaces the estimation above that assumes
+   * independence. For all other predicates, the groups of the scanned columns are dropped.
+   */
+  auto output_column_group_statistics = std::vector<ColumnGroupStatistics>{};
+  auto column_groups_changed = false;
+  auto correlated_distinct_count = std::optional<Cardinality>{};
+
+  for (const auto& column_group : input_table_statistics->column_group_statistics) {
+    const auto& column_ids = column_group.column_ids;
+    const auto contains_column = [&](const ColumnID column_id) {
+      return std::binary_search(column_ids.cbegin(), column_ids.cend(), column_id);
+    };
+
+    if (!contains_column(left_column_id) && !(right_column_id && contains_column(*right_column_id))) {
+      output_column_group_statistics.emplace_back(column_group);
+      continue;
+    }
+
+    column_groups_changed = true;
+    if (!bound_column_distinct_count) continue;
+
+    if (column_ids.size() == 1) {
+      correlated_distinct_count =
+          std::min(correlated_distinct_count.value_or(column_group.distinct_count), column_group.distinct_count);
+      continue;
+    }
+
+    auto remaining_column_ids = column_ids;
+    remaining_column_ids.erase(std::find(remaining_column_ids.begin(), remaining_column_ids.end(), left_column_id));
+    const auto remaining_distinct_count =
+        std::max(column_group.distinct_count / *bound_column_distinct_count, Cardinality{1});
+    output_column_group_statistics.emplace_back(std::move(remaining_column_ids), remaining_distinct_count);
+  }
+
+  if (correlated_distinct_count && selectivity > 0.0f) {
+    const auto correlated_selectivity = Selectivity{1.0f / std::max(*correlated_distinct_count, Cardinality{1})};
+    if (output_column_statistics[left_column_id]) {
+      output_column_statistics[left_column_id] =
+          output_column_statistics[left_column_id]->scaled(correlated_selectivity / selectivity);
+    }
+    selectivity = correlated_selectivity;
+  }
+
   // Entire chunk matches; simply return the input
-  if (selectivity == 1) {
+  if (selectivity == 1 && !column_groups_changed) {
     return input_table_statistics;
   }
 
@@ -768,7 +991,11 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_operator_scan_pr
   }
 
   const auto row_count = Cardinality{input_table_statistics->row_count * selectivity};
-  return std::make_shared<TableStatistics>(std::move(output_column_statistics), row_count);
+  const auto output_table_statistics =
+      std::make_shared<TableStatistics>(std::move(output_column_statistics), row_count);
+  cap_column_group_distinct_counts(output_column_group_statistics, row_count);
+  output_table_statistics->column_group_statistics = std::move(output_column_group_statistics);
+  return output_table_statistics;
 }
 
 template <typename T>
@@ -897,11 +1124,73 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_inner_equi_join(
     }
 
     output_table_statistics = std::make_shared<TableStatistics>(std::move(column_statistics), cardinality);
+    output_table_statistics->column_group_statistics =
+        join_column_group_statistics(left_input_table_statistics, right_input_table_statistics, cardinality);
   });
 
   return output_table_statistics;
 }
 
+std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_multi_predicate_inner_equi_join(
+    const std::vector<std::pair<ColumnID, ColumnID>>& column_ids, const TableStatistics& left_input_table_statistics,
+    const TableStatistics& right_input_table_statistics) {
+  Assert(!column_ids.empty(), "Expected at least one join predicate");
+
+  const auto primary_output_table_statistics = estimate_inner_equi_join(
+      column_ids[0].first, column_ids[0].second, left_input_table_statistics, right_input_table_statistics);
+  if (column_ids.size() == 1) {
+    return primary_output_table_statistics;
+  }
+
+  auto left_column_ids = std::vector<ColumnID>{};
+  auto right_column_ids = std::vector<ColumnID>{};
+  for (const auto& [left_column_id, right_column_id] : column_ids) {
+    left_column_ids.emplace_back(left_column_id);
+    right_column_ids.emplace_back(right_column_id);
+  }
+  for (auto* join_column_ids : {&left_column_ids, &right_column_ids}) {
+    std::sort(join_column_ids->begin(), join_column_ids->end());
+    join_column_ids->erase(std::unique(join_column_ids->begin(), join_column_ids->end()), join_column_ids->end());
+  }
+
+  // Without a column group for the join columns of at least one input, the secondary predicates are not considered.
+  // Assuming them to be independent would underestimate joins on correlated columns, e.g., on composite keys.
+  const auto left_group_distinct_count = find_column_group_distinct_count(left_input_table_statistics, left_column_ids);
+  const auto right_group_distinct_count =
+      find_column_group_distinct_count(right_input_table_statistics, right_column_ids);
+  if (!left_group_distinct_count && !right_group_distinct_count) {
+    return primary_output_table_statistics;
+  }
+
+  const auto left_distinct_count = left_group_distinct_count.value_or(
+      estimate_independent_distinct_count(left_input_table_statistics, left_column_ids));
+  const auto right_distinct_count = right_group_distinct_count.value_or(
+      estimate_independent_distinct_count(right_input_table_statistics, right_column_ids));
+
+  // Principle of inclusion: Every join key of the input with fewer distinct keys finds its matches in the other input
+  const auto distinct_count = std::max({left_distinct_count, right_distinct_count, Cardinality{1}});
+  const auto cardinality = Cardinality{left_input_table_statistics.row_count *
+                                       right_input_table_statistics.row_count / distinct_count};
+
+  // The secondary predicates can only reduce the cardinality estimated for the primary predicate
+  if (cardinality >= primary_output_table_statistics->row_count) {
+    return primary_output_table_statistics;
+  }
+
+  const auto selectivity = Selectivity{cardinality / primary_output_table_statistics->row_count};
+
+  auto column_statistics = std::vector<std::shared_ptr<BaseAttributeStatistics>>{
+      primary_output_table_statistics->column_statistics.size()};
+  for (auto column_id = ColumnID{0}; column_id < column_statistics.size(); ++column_id) {
+    column_statistics[column_id] = primary_output_table_statistics->column_statistics[column_id]->scaled(selectivity);
+  }
+
+  const auto output_table_statistics = std::make_shared<TableStatistics>(std::move(column_statistics), cardinality);
+  output_table_statistics->column_group_statistics = primary_output_table_statistics->column_group_statistics;
+  cap_column_group_distinct_counts(output_table_statistics->column_group_statistics, cardinality);
+  return output_table_statistics;
+}
+
 std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_semi_join(
     const ColumnID left_column_id, const ColumnID right_column_id, const TableStatistics& left_input_table_statistics,
     const TableStatistics& right_input_table_statistics) {
@@ -981,6 +1270,8 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_semi_join(
     }
 
     output_table_statistics = std::make_shared<TableStatistics>(std::move(column_statistics), cardinality);
+    output_table_statistics->column_group_statistics = left_input_table_statistics.column_group_statistics;
+    cap_column_group_distinct_counts(output_table_statistics->column_group_statistics, cardinality);
   });
 
   Assert(output_table_statistics->row_count <= left_input_table_statistics.row_count * 1.01f,
@@ -1014,7 +1305,10 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::estimate_cross_join(
 
   const auto row_count = Cardinality{left_selectivity * right_selectivity};
 
-  return std::make_shared<TableStatistics>(std::move(column_statistics), row_count);
+  const auto output_table_statistics = std::make_shared<TableStatistics>(std::move(column_statistics), row_count);
+  output_table_statistics->column_group_statistics =
+      join_column_group_statistics(left_input_table_statistics, right_input_table_statistics, row_count);
+  return output_table_statistics;
 }
 
 template <typename T>
@@ -1118,6 +1412,8 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::prune_column_statistics(
   auto output_column_statistics = std::vector<std::shared_ptr<BaseAttributeStatistics>>(
       table_statistics->column_statistics.size() - pruned_column_ids.size());
 
+  auto output_column_ids = std::vector<std::optional<ColumnID>>(table_statistics->column_statistics.size());
+
   auto pruned_column_ids_iter = pruned_column_ids.begin();
 
   for (auto input_column_id = ColumnID{0}, output_column_id = ColumnID{0};
@@ -1129,10 +1425,15 @@ std::shared_ptr<TableStatistics> CardinalityEstimator::prune_column_statistics(
     }
 
     output_column_statistics[output_column_id] = table_statistics->column_statistics[input_column_id];
+    output_column_ids[input_column_id] = output_column_id;
     ++output_column_id;
   }
 
-  return std::make_shared<TableStatistics>(std::move(output_column_statistics), table_statistics->row_count);
+  const auto output_table_statistics =
+      std::make_shared<TableStatistics>(std::move(output_column_statistics), table_statistics->row_count);
+  output_table_statistics->column_group_statistics =
+      remap_column_group_statistics(table_statistics->column_group_statistics, output_column_ids);
+  return output_table_statistics;
 }
 
 }  // namespace opossum
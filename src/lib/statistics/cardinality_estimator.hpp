@@ -1,6 +1,8 @@
 #pragma once
 
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "boost/dynamic_bitset.hpp"
 
@@ -96,6 +98,15 @@ class CardinalityEstimator : public AbstractCardinalityEstimator {
                                                                    const TableStatistics& left_input_table_statistics,
                                                                    const TableStatistics& right_input_table_statistics);
 
+  /**
+   * Estimates an inner equi join on multiple pairs of @param column_ids (left ColumnID, right ColumnID). Assuming the
+   * predicates to be independent underestimates joins on correlated columns. Hence, the secondary predicates are only
+   * considered if a column group (see ColumnGroupStatistics) covers the join columns of at least one input.
+   */
+  static std::shared_ptr<TableStatistics> estimate_multi_predicate_inner_equi_join(
+      const std::vector<std::pair<ColumnID, ColumnID>>& column_ids, const TableStatistics& left_input_table_statistics,
+      const TableStatistics& right_input_table_statistics);
+
   static std::shared_ptr<TableStatistics> estimate_semi_join(const ColumnID left_column_id,
                                                              const ColumnID right_column_id,
                                                              const TableStatistics& left_input_table_statistics,
@@ -0,0 +1,50 @@
+#include "column_group_statistics.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ColumnGroupStatistics::ColumnGroupStatistics(std::vector<ColumnID> init_column_ids,
+                                             const Cardinality init_distinct_count)
+    : column_ids(std::move(init_column_ids)), distinct_count(init_distinct_count) {
+  DebugAssert(std::is_sorted(column_ids.cbegin(), column_ids.cend()) &&
+                  std::adjacent_find(column_ids.cbegin(), column_ids.cend()) == column_ids.cend(),
+              "ColumnIDs of a column group must be sorted and unique");
+}
+
+std::vector<ColumnGroupStatistics> remap_column_group_statistics(
+    const std::vector<ColumnGroupStatistics>& column_group_statistics,
+    const std::vector<std::optional<ColumnID>>& output_column_ids) {
+  auto output_column_group_statistics = std::vector<ColumnGroupStatistics>{};
+
+  for (const auto& column_group : column_group_statistics) {
+    auto column_ids = std::vector<ColumnID>{};
+    column_ids.reserve(column_group.column_ids.size());
+    for (const auto column_id : column_group.column_ids) {
+      DebugAssert(column_id < output_column_ids.size(), "ColumnID out of bounds");
+      if (!output_column_ids[column_id]) break;
+      column_ids.emplace_back(*output_column_ids[column_id]);
+    }
+
+    if (column_ids.size() != column_group.column_ids.size()) continue;
+
+    std::sort(column_ids.begin(), column_ids.end());
+    output_column_group_statistics.emplace_back(std::move(column_ids), column_group.distinct_count);
+  }
+
+  return output_column_group_statistics;
+}
+
+std::ostream& operator<<(std::ostream& stream, const ColumnGroupStatistics& column_group_statistics) {
+  stream << "ColumnGroup {";
+  for (const auto column_id : column_group_statistics.column_ids) {
+    stream << " " << column_id;
+  }
+  stream << " } DistinctCount: " << column_group_statistics.distinct_count;
+  return stream;
+}
+
+}  // namespace opossum
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <iostream>
+#include <optional>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Number of distinct value combinations of a group of columns. Per-column statistics assume the columns to be
+ * independent, which underestimates conjunctions of predicates on correlated columns, e.g., `city = 'X' AND zip = 'Y'`.
+ * Column groups capture the correlation: if a zip code determines the city, the group {city, zip} has as many distinct
+ * combinations as there are zip codes.
+ *
+ * Column groups are optional. The CardinalityEstimator derives them from the key constraints and functional
+ * dependencies of StoredTableNodes and MockNodes and forwards them through the LQP.
+ */
+struct ColumnGroupStatistics {
+  // @param init_column_ids must be sorted and contain no duplicates
+  ColumnGroupStatistics(std::vector<ColumnID> init_column_ids, const Cardinality init_distinct_count);
+
+  std::vector<ColumnID> column_ids;
+  Cardinality distinct_count;
+};
+
+/**
+ * Maps the ColumnIDs of @param column_group_statistics to the ColumnIDs of another table, e.g., the output of an LQP
+ * node. @param output_column_ids is indexed by the input ColumnIDs. Groups with a column that has no output ColumnID
+ * are dropped.
+ */
+std::vector<ColumnGroupStatistics> remap_column_group_statistics(
+    const std::vector<ColumnGroupStatistics>& column_group_statistics,
+    const std::vector<std::optional<ColumnID>>& output_column_ids);
+
+std::ostream& operator<<(std::ostream& stream, const ColumnGroupStatistics& column_group_statistics);
+
+}  // namespace opossum
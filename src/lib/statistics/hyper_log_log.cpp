@@ -0,0 +1,54 @@
+#include "hyper_log_log.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace opossum {
+
+HyperLogLog::HyperLogLog() : _registers(REGISTER_COUNT) {}
+
+void HyperLogLog::add_hash(const uint64_t hash) {
+  // Finalizer of MurmurHash3, which spreads the entropy of the input over all bits
+  auto mixed_hash = hash;
+  mixed_hash ^= mixed_hash >> 33;
+  mixed_hash *= 0xff51afd7ed558ccdULL;
+  mixed_hash ^= mixed_hash >> 33;
+  mixed_hash *= 0xc4ceb9fe1a85ec53ULL;
+  mixed_hash ^= mixed_hash >> 33;
+
+  // The first PRECISION bits select the register. The sentinel bit limits the number of leading zeros of the rest.
+  const auto register_id = mixed_hash >> (64 - PRECISION);
+  const auto remaining_bits = (mixed_hash << PRECISION) | (uint64_t{1} << (PRECISION - 1));
+  const auto rank = static_cast<uint8_t>(__builtin_clzll(remaining_bits) + 1);
+
+  _registers[register_id] = std::max(_registers[register_id], rank);
+}
+
+void HyperLogLog::merge(const HyperLogLog& other) {
+  for (auto register_id = size_t{0}; register_id < REGISTER_COUNT; ++register_id) {
+    _registers[register_id] = std::max(_registers[register_id], other._registers[register_id]);
+  }
+}
+
+double HyperLogLog::estimate() const {
+  auto inverse_sum = 0.0;
+  auto empty_register_count = size_t{0};
+  for (const auto register_value : _registers) {
+    inverse_sum += std::ldexp(1.0, -register_value);
+    empty_register_count += register_value == 0;
+  }
+
+  const auto register_count = static_cast<double>(REGISTER_COUNT);
+  const auto alpha = 0.7213 / (1.0 + 1.079 / register_count);
+  const auto raw_estimate = alpha * register_count * register_count / inverse_sum;
+
+  // For small cardinalities, the raw estimate is biased. Linear counting on the empty registers is more accurate.
+  if (raw_estimate <= 2.5 * register_count && empty_register_count > 0) {
+    return register_count * std::log(register_count / static_cast<double>(empty_register_count));
+  }
+
+  // With 64-bit hashes, no correction for hash collisions is necessary for realistic cardinalities
+  return raw_estimate;
+}
+
+}  // namespace opossum
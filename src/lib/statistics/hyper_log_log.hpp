@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace opossum {
+
+/**
+ * HyperLogLog sketch (Flajolet et al., 2007) that estimates the number of distinct values added to it in constant
+ * memory. Values are hashed into 2^PRECISION registers, each of which stores the maximum number of leading zeros (plus
+ * one) seen in the remaining hash bits. As adding a value twice does not change the sketch, sketches of different
+ * chunks can be merged and segments that know their distinct values (e.g., dictionary segments) only need to add each
+ * of them once. The standard error of the estimate is 1.04 / sqrt(2^PRECISION), i.e., about 0.8%.
+ */
+class HyperLogLog {
+ public:
+  static constexpr auto PRECISION = uint8_t{14};
+  static constexpr auto REGISTER_COUNT = size_t{1} << PRECISION;
+
+  HyperLogLog();
+
+  template <typename T>
+  void add(const T& value) {
+    add_hash(std::hash<T>{}(value));
+  }
+
+  // As std::hash is the identity for integers on most platforms, the hash is mixed before it is used
+  void add_hash(const uint64_t hash);
+
+  void merge(const HyperLogLog& other);
+
+  double estimate() const;
+
+ private:
+  std::vector<uint8_t> _registers;
+};
+
+}  // namespace opossum
@@ -1,12 +1,14 @@
 #include "join_graph_statistics_cache.hpp"
 
+#include <mutex>
+
 #include "logical_query_plan/lqp_utils.hpp"
 #include "optimizer/join_ordering/join_graph.hpp"
 #include "statistics/table_statistics.hpp"
 
 namespace opossum {
 
-JoinGraphStatisticsCache JoinGraphStatisticsCache::from_join_graph(const JoinGraph& join_graph) {
+std::shared_ptr<JoinGraphStatisticsCache> JoinGraphStatisticsCache::from_join_graph(const JoinGraph& join_graph) {
   VertexIndexMap vertex_indices;
   for (auto vertex_idx = size_t{0}; vertex_idx < join_graph.vertices.size(); ++vertex_idx) {
     vertex_indices.emplace(join_graph.vertices[vertex_idx], vertex_idx);
@@ -21,7 +23,7 @@ JoinGraphStatisticsCache JoinGraphStatisticsCache::from_join_graph(const JoinGra
     }
   }
 
-  return {std::move(vertex_indices), std::move(predicate_indices)};
+  return std::make_shared<JoinGraphStatisticsCache>(std::move(vertex_indices), std::move(predicate_indices));
 }
 
 JoinGraphStatisticsCache::JoinGraphStatisticsCache(VertexIndexMap&& vertex_indices,
@@ -87,6 +89,7 @@ std::optional<JoinGraphStatisticsCache::Bitmask> JoinGraphStatisticsCache::bitma
 
 std::shared_ptr<TableStatistics> JoinGraphStatisticsCache::get(
     const Bitmask& bitmask, const std::vector<std::shared_ptr<AbstractExpression>>& requested_column_order) const {
+  auto lock = std::shared_lock{_cache_mutex};
   const auto cache_iter = _cache.find(bitmask);
   if (cache_iter == _cache.end()) {
     return nullptr;
@@ -125,6 +128,13 @@ std::shared_ptr<TableStatistics> JoinGraphStatisticsCache::get(
   auto result_table_statistics =
       std::make_shared<TableStatistics>(std::move(output_column_statistics), cached_table_statistics->row_count);
 
+  auto result_column_ids = std::vector<std::optional<ColumnID>>(cached_table_statistics->column_statistics.size());
+  for (auto column_id = ColumnID{0}; column_id < requested_column_order.size(); ++column_id) {
+    result_column_ids[cached_column_ids[column_id]] = column_id;
+  }
+  result_table_statistics->column_group_statistics =
+      remap_column_group_statistics(cached_table_statistics->column_group_statistics, result_column_ids);
+
   return result_table_statistics;
 }
 
@@ -138,6 +148,8 @@ void JoinGraphStatisticsCache::set(const Bitmask& bitmask,
     cache_entry.column_expression_order.emplace(column_order[column_id], column_id);
   }
 
+  // If another thread has set the entry in the meantime, it is kept
+  auto lock = std::unique_lock{_cache_mutex};
   _cache.emplace(bitmask, std::move(cache_entry));
 }
 }  // namespace opossum
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <map>
+#include <memory>
+#include <shared_mutex>
 #include <unordered_map>
 
 #include "boost/dynamic_bitset.hpp"
@@ -21,6 +23,9 @@ class JoinGraph;
  * This cache exists primarily to aid the performance of the JoinOrderingRule.
  * The JoinOrderingRule frequently requests statistics for different plans consisting of the same set of Join and Scan
  * predicates.
+ *
+ * get() and set() can be called concurrently, so that a single cache can be shared by the CardinalityEstimators of
+ * parallel join enumeration (see AbstractJoinOrderingAlgorithm).
  */
 class JoinGraphStatisticsCache {
  public:
@@ -38,7 +43,7 @@ class JoinGraphStatisticsCache {
 
   // Creates a JoinGraphStatisticsCache with VertexIndexMap and PredicateIndexMap pointing to the vertices / predicates
   // in the JoinGraph
-  static JoinGraphStatisticsCache from_join_graph(const JoinGraph& join_graph);
+  static std::shared_ptr<JoinGraphStatisticsCache> from_join_graph(const JoinGraph& join_graph);
 
   JoinGraphStatisticsCache(VertexIndexMap&& vertex_indices, PredicateIndexMap&& predicate_indices);
 
@@ -79,6 +84,7 @@ class JoinGraphStatisticsCache {
   // There is no std::hash<Bitmask> and Bitmask/boost::dynamic_bitset<> doesn't expose the data necessary to implement
   // this efficiently... :(
   std::map<Bitmask, CacheEntry> _cache;
+  mutable std::shared_mutex _cache_mutex;
 };
 
 }  // namespace opossum
@@ -92,46 +92,80 @@ std::shared_ptr<EqualDistinctCountHistogram<T>> EqualDistinctCountHistogram<T>::
     const Table& table, const ColumnID column_id, const BinID max_bin_count, const HistogramDomain<T>& domain) {
   Assert(max_bin_count > 0, "max_bin_count must be greater than zero ");
 
-  const auto value_distribution = value_distribution_from_column(table, column_id, domain);
+  auto value_distribution = value_distribution_from_column(table, column_id, domain);
 
-  if (value_distribution.empty()) {
+  const auto total_count =
+      std::accumulate(value_distribution.cbegin(), value_distribution.cend(), HistogramCountType{0},
+                      [](HistogramCountType a, const std::pair<T, HistogramCountType>& b) { return a + b.second; });
+  const auto total_distinct_count = static_cast<HistogramCountType>(value_distribution.size());
+
+  // A full scan is a sample of the entire column, so that no scaling takes place
+  return from_sample(std::move(value_distribution), total_count, total_distinct_count, max_bin_count);
+}
+
+template <typename T>
+std::shared_ptr<EqualDistinctCountHistogram<T>> EqualDistinctCountHistogram<T>::from_sample(
+    std::vector<std::pair<T, HistogramCountType>>&& sampled_value_distribution, const HistogramCountType total_count,
+    const HistogramCountType total_distinct_count, const BinID max_bin_count) {
+  Assert(max_bin_count > 0, "max_bin_count must be greater than zero ");
+
+  if (sampled_value_distribution.empty()) {
     return nullptr;
   }
 
+  const auto sampled_distinct_count = sampled_value_distribution.size();
+  const auto sampled_count =
+      std::accumulate(sampled_value_distribution.cbegin(), sampled_value_distribution.cend(), HistogramCountType{0},
+                      [](HistogramCountType a, const std::pair<T, HistogramCountType>& b) { return a + b.second; });
+
   // If there are fewer distinct values than the number of desired bins use that instead.
   const auto bin_count =
-      value_distribution.size() < max_bin_count ? static_cast<BinID>(value_distribution.size()) : max_bin_count;
+      sampled_distinct_count < max_bin_count ? static_cast<BinID>(sampled_distinct_count) : max_bin_count;
+
+  // Split the sampled values evenly among bins.
+  const auto sampled_distinct_count_per_bin = static_cast<size_t>(sampled_distinct_count / bin_count);
+  const BinID sampled_bin_count_with_extra_value = sampled_distinct_count % bin_count;
 
-  // Split values evenly among bins.
-  const auto distinct_count_per_bin = static_cast<size_t>(value_distribution.size() / bin_count);
-  const BinID bin_count_with_extra_value = value_distribution.size() % bin_count;
+  // The distinct count of the column cannot be lower than that of the sample or higher than its value count. Assuming
+  // that the sample is representative, the column's distinct values are spread evenly among the bins as well.
+  const auto distinct_count =
+      static_cast<size_t>(std::max(static_cast<HistogramCountType>(sampled_distinct_count),
+                                   std::min(std::round(total_distinct_count), total_count)));
+  const auto distinct_count_per_bin = static_cast<size_t>(distinct_count / bin_count);
+  const BinID bin_count_with_extra_value = distinct_count % bin_count;
+
+  const auto scale = total_count / sampled_count;
 
   std::vector<T> bin_minima(bin_count);
   std::vector<T> bin_maxima(bin_count);
   std::vector<HistogramCountType> bin_heights(bin_count);
 
-  // `min_value_idx` and `max_value_idx` are indices into the sorted vector `value_distribution`
+  // `min_value_idx` and `max_value_idx` are indices into the sorted vector `sampled_value_distribution`
   // describing which range of distinct values goes into a bin
   auto min_value_idx = BinID{0};
   for (BinID bin_idx = 0; bin_idx < bin_count; bin_idx++) {
-    auto max_value_idx = min_value_idx + distinct_count_per_bin - 1;
-    if (bin_idx < bin_count_with_extra_value) {
+    auto max_value_idx = min_value_idx + sampled_distinct_count_per_bin - 1;
+    if (bin_idx < sampled_bin_count_with_extra_value) {
       max_value_idx++;
     }
 
     // We'd like to move strings, but have to copy if we need the same string for the bin_maximum
-    if (std::is_same_v<T, std::string> && min_value_idx != max_value_idx) {
-      bin_minima[bin_idx] = std::move(value_distribution[min_value_idx].first);
+    if (min_value_idx != max_value_idx) {
+      bin_minima[bin_idx] = std::move(sampled_value_distribution[min_value_idx].first);
     } else {
-      bin_minima[bin_idx] = value_distribution[min_value_idx].first;
+      bin_minima[bin_idx] = sampled_value_distribution[min_value_idx].first;
     }
 
-    bin_maxima[bin_idx] = std::move(value_distribution[max_value_idx].first);
+    bin_maxima[bin_idx] = std::move(sampled_value_distribution[max_value_idx].first);
+
+    const auto sampled_bin_height = std::accumulate(
+        sampled_value_distribution.cbegin() + min_value_idx, sampled_value_distribution.cbegin() + max_value_idx + 1,
+        HistogramCountType{0},
+        [](HistogramCountType a, const std::pair<T, HistogramCountType>& b) { return a + b.second; });
 
-    bin_heights[bin_idx] =
-        std::accumulate(value_distribution.cbegin() + min_value_idx, value_distribution.cbegin() + max_value_idx + 1,
-                        HistogramCountType{0},
-                        [](HistogramCountType a, const std::pair<T, HistogramCountType>& b) { return a + b.second; });
+    // Each distinct value of a bin occurs at least once
+    const auto bin_distinct_count = distinct_count_per_bin + (bin_idx < bin_count_with_extra_value ? 1 : 0);
+    bin_heights[bin_idx] = std::max(sampled_bin_height * scale, static_cast<HistogramCountType>(bin_distinct_count));
 
     min_value_idx = max_value_idx + 1;
   }
@@ -36,6 +36,17 @@ class EqualDistinctCountHistogram : public AbstractHistogram<T> {
                                                                      const BinID max_bin_count,
                                                                      const HistogramDomain<T>& domain = {});
 
+  /**
+   * Create an EqualDistinctCountHistogram from the value distribution of a sample of a column. The bin edges are taken
+   * from the sample. The bin heights are scaled up to @param total_count and the distinct counts are derived from
+   * @param total_distinct_count, e.g., a HyperLogLog estimate for the entire column.
+   * @param sampled_value_distribution  Distinct values of the sample with their number of occurrences, sorted by value
+   * @param max_bin_count               Desired number of bins. Less might be created, but never more. Must not be zero.
+   */
+  static std::shared_ptr<EqualDistinctCountHistogram<T>> from_sample(
+      std::vector<std::pair<T, HistogramCountType>>&& sampled_value_distribution, const HistogramCountType total_count,
+      const HistogramCountType total_distinct_count, const BinID max_bin_count);
+
   std::string name() const override;
   std::shared_ptr<AbstractHistogram<T>> clone() const override;
   HistogramCountType total_distinct_count() const override;
@@ -0,0 +1,280 @@
+#include "table_sketch.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include <utility>
+
+#include "hyper_log_log.hpp"
+#include "hyrise.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/statistics_objects/equal_distinct_count_histogram.hpp"
+#include "statistics/statistics_objects/null_value_ratio_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/fixed_string_dictionary_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Strings with characters outside of the histogram's domain are capped, see add_segment_to_value_distribution() in
+// equal_distinct_count_histogram.cpp. Calls @param functor with the (capped) value.
+template <typename T, typename Functor>
+void with_value_in_domain(const T& value, const HistogramDomain<T>& domain, const Functor& functor) {
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    if (!domain.contains(value)) {
+      functor(domain.string_to_domain(value));
+      return;
+    }
+  }
+  functor(value);
+}
+
+// Adds all distinct values of @param segment to @param sketch. Dictionary segments know their distinct values, so that
+// the attribute vector does not have to be scanned. All other segments are scanned entirely, which is deliberate: the
+// number of distinct values cannot be extrapolated from a sample without a large (and data-dependent) error, while the
+// distinct count is what the histograms' estimates are most sensitive to. For these segments, sketching a chunk thus
+// costs a full scan of its values rather than only the access to the sampled windows.
+template <typename T>
+void add_segment_to_sketch(const AbstractSegment& segment, HyperLogLog& sketch, const HistogramDomain<T>& domain) {
+  const auto add_value = [&](const auto& value) { sketch.add(value); };
+
+  if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+    for (const auto& value : *dictionary_segment->dictionary()) {
+      with_value_in_domain(value, domain, add_value);
+    }
+    return;
+  }
+
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    if (const auto dictionary_segment = dynamic_cast<const FixedStringDictionarySegment<T>*>(&segment)) {
+      for (const auto& string_value : *dictionary_segment->fixed_string_dictionary()) {
+        with_value_in_domain(pmr_string{string_value}, domain, add_value);
+      }
+      return;
+    }
+  }
+
+  segment_iterate<T>(segment, [&](const auto& position) {
+    if (position.is_null()) return;
+    with_value_in_domain(position.value(), domain, add_value);
+  });
+}
+
+}  // namespace
+
+namespace opossum {
+
+class BaseColumnSketch {
+ public:
+  virtual ~BaseColumnSketch() = default;
+
+  // Adds all distinct values of @param segment and a sample of @param sample_row_count of its rows
+  virtual void add_segment(const AbstractSegment& segment, const size_t sample_row_count) = 0;
+
+  virtual void merge(const BaseColumnSketch& other) = 0;
+
+  virtual std::shared_ptr<BaseAttributeStatistics> attribute_statistics(const Cardinality row_count,
+                                                                        const BinID histogram_bin_count) const = 0;
+};
+
+}  // namespace opossum
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+template <typename T>
+class ColumnSketch : public BaseColumnSketch {
+ public:
+  void add_segment(const AbstractSegment& segment, const size_t sample_row_count) final {
+    const auto chunk_size = static_cast<size_t>(segment.size());
+    const auto domain = HistogramDomain<T>{};
+
+    const auto add_sampled_position = [&](const auto& position) {
+      ++_sampled_row_count;
+      if (position.is_null()) {
+        ++_sampled_null_count;
+        return;
+      }
+      with_value_in_domain(position.value(), domain, [&](const auto& value) { ++_sampled_value_distribution[value]; });
+    };
+
+    if (sample_row_count >= chunk_size) {
+      segment_iterate<T>(segment, [&](const auto& position) {
+        add_sampled_position(position);
+        if (position.is_null()) return;
+        with_value_in_domain(position.value(), domain, [&](const auto& value) { _distinct_values.add(value); });
+      });
+      return;
+    }
+
+    // Windows of consecutive rows are cheaper to access than single rows and retain some of the data's locality
+    constexpr auto max_window_size = TableSketch::SAMPLE_WINDOW_SIZE;
+    const auto window_count = (sample_row_count + max_window_size - 1) / max_window_size;
+    const auto window_distance = chunk_size / window_count;
+
+    // For samples of more than 1 / SAMPLE_WINDOW_SIZE of the rows, the windows would overlap and rows would be sampled
+    // twice. Instead, the windows are shrunk to be adjacent.
+    const auto window_size = std::min(max_window_size, window_distance);
+
+    auto position_filter = std::make_shared<RowIDPosList>();
+    position_filter->reserve(window_count * window_size);
+    for (auto window_id = size_t{0}; window_id < window_count; ++window_id) {
+      const auto window_end = std::min(window_id * window_distance + window_size, chunk_size);
+      for (auto chunk_offset = window_id * window_distance; chunk_offset < window_end; ++chunk_offset) {
+        position_filter->emplace_back(RowID{ChunkID{0}, static_cast<ChunkOffset>(chunk_offset)});
+      }
+    }
+    position_filter->guarantee_single_chunk();
+
+    segment_iterate_filtered<T>(segment, position_filter, add_sampled_position);
+    add_segment_to_sketch(segment, _distinct_values, domain);
+  }
+
+  void merge(const BaseColumnSketch& other) final {
+    const auto& other_sketch = static_cast<const ColumnSketch<T>&>(other);
+    _distinct_values.merge(other_sketch._distinct_values);
+    for (const auto& [value, count] : other_sketch._sampled_value_distribution) {
+      _sampled_value_distribution[value] += count;
+    }
+    _sampled_row_count += other_sketch._sampled_row_count;
+    _sampled_null_count += other_sketch._sampled_null_count;
+  }
+
+  std::shared_ptr<BaseAttributeStatistics> attribute_statistics(const Cardinality row_count,
+                                                                const BinID histogram_bin_count) const final {
+    const auto attribute_statistics = std::make_shared<AttributeStatistics<T>>();
+
+    if (_sampled_row_count == _sampled_null_count) {
+      // All sampled values are NULL (or there are no values at all), so no histogram can be built
+      attribute_statistics->set_statistics_object(std::make_shared<NullValueRatioStatistics>(1.0f));
+      return attribute_statistics;
+    }
+
+    const auto null_value_ratio = static_cast<float>(_sampled_null_count) / static_cast<float>(_sampled_row_count);
+    const auto total_count = std::round(row_count * (1.0f - null_value_ratio));
+
+    auto sampled_value_distribution = std::vector<std::pair<T, HistogramCountType>>{
+        _sampled_value_distribution.begin(), _sampled_value_distribution.end()};
+    std::sort(sampled_value_distribution.begin(), sampled_value_distribution.end(),
+              [&](const auto& l, const auto& r) { return l.first < r.first; });
+
+    const auto histogram = EqualDistinctCountHistogram<T>::from_sample(
+        std::move(sampled_value_distribution), total_count,
+        static_cast<HistogramCountType>(_distinct_values.estimate()), histogram_bin_count);
+    attribute_statistics->set_statistics_object(histogram);
+    attribute_statistics->set_statistics_object(std::make_shared<NullValueRatioStatistics>(null_value_ratio));
+    return attribute_statistics;
+  }
+
+ private:
+  HyperLogLog _distinct_values;
+  std::unordered_map<T, HistogramCountType> _sampled_value_distribution;
+  size_t _sampled_row_count{0};
+  size_t _sampled_null_count{0};
+};
+
+}  // namespace
+
+namespace opossum {
+
+TableSketch::TableSketch(const std::vector<DataType>& column_data_types, const double sample_ratio)
+    : _column_data_types{column_data_types}, _sample_ratio{sample_ratio}, _column_sketches{_create_column_sketches()} {
+  Assert(_sample_ratio > 0.0 && _sample_ratio <= 1.0, "Sample ratio must be in (0, 1]");
+}
+
+std::shared_ptr<TableSketch> TableSketch::from_table(const Table& table) {
+  const auto row_count = static_cast<double>(table.row_count());
+  const auto sample_ratio = std::min(1.0, static_cast<double>(SAMPLE_ROW_COUNT) / std::max(row_count, 1.0));
+  const auto table_sketch = std::make_shared<TableSketch>(table.column_data_types(), sample_ratio);
+
+  const auto chunk_count = table.chunk_count();
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk || chunk->is_mutable()) continue;
+
+    jobs.emplace_back(
+        std::make_shared<JobTask>([&table_sketch, chunk_id, chunk]() { table_sketch->add_chunk(chunk_id, *chunk); }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  table_sketch->_initial_row_count = table_sketch->_row_count;
+  return table_sketch;
+}
+
+bool TableSketch::add_chunk(const ChunkID chunk_id, const Chunk& chunk) {
+  if (contains_chunk(chunk_id)) return false;
+
+  // The chunk is sketched without holding the lock. Only the merge is serialized.
+  const auto chunk_column_sketches = _create_column_sketches();
+  const auto sample_row_count = static_cast<size_t>(std::ceil(_sample_ratio * chunk.size()));
+  for (auto column_id = ColumnID{0}; column_id < _column_data_types.size(); ++column_id) {
+    chunk_column_sketches[column_id]->add_segment(*chunk.get_segment(column_id), sample_row_count);
+  }
+
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  if (!_chunk_ids.emplace(chunk_id).second) return false;
+
+  for (auto column_id = ColumnID{0}; column_id < _column_data_types.size(); ++column_id) {
+    _column_sketches[column_id]->merge(*chunk_column_sketches[column_id]);
+  }
+  _row_count += static_cast<Cardinality>(chunk.size());
+  return true;
+}
+
+bool TableSketch::contains_chunk(const ChunkID chunk_id) const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _chunk_ids.count(chunk_id) > 0;
+}
+
+Cardinality TableSketch::row_count() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _row_count;
+}
+
+bool TableSketch::claim_rebuild() {
+  {
+    const auto lock = std::lock_guard<std::mutex>{_mutex};
+    if (_row_count - _initial_row_count <= STALENESS_THRESHOLD * _initial_row_count) return false;
+  }
+
+  return !_rebuild_claimed.exchange(true);
+}
+
+std::shared_ptr<TableStatistics> TableSketch::table_statistics(const std::optional<Cardinality> row_count) const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+
+  const auto statistics_row_count = row_count.value_or(_row_count);
+  const auto histogram_bin_count = TableStatistics::histogram_bin_count(statistics_row_count);
+
+  auto column_statistics = std::vector<std::shared_ptr<BaseAttributeStatistics>>{};
+  column_statistics.reserve(_column_sketches.size());
+  for (const auto& column_sketch : _column_sketches) {
+    column_statistics.emplace_back(column_sketch->attribute_statistics(statistics_row_count, histogram_bin_count));
+  }
+
+  return std::make_shared<TableStatistics>(std::move(column_statistics), statistics_row_count);
+}
+
+std::vector<std::shared_ptr<BaseColumnSketch>> TableSketch::_create_column_sketches() const {
+  auto column_sketches = std::vector<std::shared_ptr<BaseColumnSketch>>{};
+  column_sketches.reserve(_column_data_types.size());
+  for (const auto data_type : _column_data_types) {
+    resolve_data_type(data_type, [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      column_sketches.emplace_back(std::make_shared<ColumnSketch<ColumnDataType>>());
+    });
+  }
+  return column_sketches;
+}
+
+}  // namespace opossum
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_set>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseColumnSketch;
+class Chunk;
+class Table;
+class TableStatistics;
+
+/**
+ * Mergeable summary of the immutable chunks of a table from which TableStatistics are built. For each column, it holds
+ * a HyperLogLog sketch of the distinct values and a block sample of the rows (see TableStatistics::from_table). The
+ * distinct values are taken from the dictionaries of dictionary-encoded segments and from all values of other
+ * segments, so that only the value distribution is sampled.
+ *
+ * Chunks are sketched independently and folded into the TableSketch, so that new chunks can be incorporated without
+ * revisiting the existing ones (see update_table_statistics()). The sample ratio is fixed when the sketch is created.
+ * Hence, the sample grows with the table and the sketch should be rebuilt once the table has grown considerably.
+ */
+class TableSketch {
+ public:
+  TableSketch(const std::vector<DataType>& column_data_types, const double sample_ratio);
+
+  /**
+   * Sketches all immutable chunks of @param table in parallel. The sample ratio is chosen so that about
+   * SAMPLE_ROW_COUNT rows of the table are sampled.
+   */
+  static std::shared_ptr<TableSketch> from_table(const Table& table);
+
+  /**
+   * Sketches @param chunk and folds it into this sketch. Returns false if a chunk with @param chunk_id has already
+   * been added. Can be called concurrently.
+   */
+  bool add_chunk(const ChunkID chunk_id, const Chunk& chunk);
+
+  bool contains_chunk(const ChunkID chunk_id) const;
+
+  // Number of rows of all added chunks
+  Cardinality row_count() const;
+
+  /**
+   * Returns true (only once) if the rows added since the creation of the sketch exceed STALENESS_THRESHOLD of the
+   * rows it was created with. The caller is expected to rebuild the sketch.
+   */
+  bool claim_rebuild();
+
+  /**
+   * Builds TableStatistics for the rows of all added chunks. If @param row_count is given, the statistics are scaled
+   * to that number of rows instead. This is used to account for the rows of mutable chunks, which are not sketched and
+   * are assumed to be distributed like the sketched rows.
+   */
+  std::shared_ptr<TableStatistics> table_statistics(const std::optional<Cardinality> row_count = std::nullopt) const;
+
+  // Number of rows sampled from the entire table and the number of consecutive rows sampled at once
+  static constexpr auto SAMPLE_ROW_COUNT = size_t{100'000};
+  static constexpr auto SAMPLE_WINDOW_SIZE = size_t{64};
+
+  // Relative growth of the table after which the sketch should be rebuilt
+  static constexpr auto STALENESS_THRESHOLD = 0.5;
+
+ private:
+  std::vector<std::shared_ptr<BaseColumnSketch>> _create_column_sketches() const;
+
+  const std::vector<DataType> _column_data_types;
+  const double _sample_ratio;
+
+  std::vector<std::shared_ptr<BaseColumnSketch>> _column_sketches;
+  std::unordered_set<ChunkID> _chunk_ids;
+  Cardinality _row_count{0};
+  Cardinality _initial_row_count{0};
+  std::atomic<bool> _rebuild_claimed{false};
+  mutable std::mutex _mutex;
+};
+
+}  // namespace opossum
@@ -1,79 +1,101 @@
 #include "table_statistics.hpp"
 
+#include <algorithm>
 #include <numeric>
-#include <thread>
 
 #include "attribute_statistics.hpp"
+#include "hyrise.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
 #include "statistics/statistics_objects/abstract_histogram.hpp"
+#include "statistics/statistics_objects/equal_distinct_count_histogram.hpp"
+#include "statistics/statistics_objects/null_value_ratio_statistics.hpp"
+#include "statistics/table_sketch.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
 
-namespace opossum {
+namespace {
 
-std::shared_ptr<TableStatistics> TableStatistics::from_table(const Table& table) {
-  std::vector<std::shared_ptr<BaseAttributeStatistics>> column_statistics(table.column_count());
+using namespace opossum;  // NOLINT
 
-  /**
-   * Determine bin count, within mostly arbitrarily chosen bounds: 5 (for tables with <=2k rows) up to 100 bins
-   * (for tables with >= 200m rows) are created.
-   */
-  const auto histogram_bin_count = std::min<size_t>(100, std::max<size_t>(5, table.row_count() / 2'000));
+template <typename T>
+std::shared_ptr<AttributeStatistics<T>> full_attribute_statistics(const Table& table, const ColumnID column_id,
+                                                                  const BinID histogram_bin_count) {
+  const auto output_column_statistics = std::make_shared<AttributeStatistics<T>>();
 
-  auto next_column_id = std::atomic<size_t>{0u};
-  auto threads = std::vector<std::thread>{};
+  const auto histogram = EqualDistinctCountHistogram<T>::from_column(table, column_id, histogram_bin_count);
+
+  if (histogram) {
+    output_column_statistics->set_statistics_object(histogram);
+
+    // Use the insight that the histogram will only contain non-null values to generate the NullValueRatio property
+    const auto null_value_ratio =
+        table.row_count() == 0
+            ? 0.0f
+            : 1.0f - (static_cast<float>(histogram->total_count()) / static_cast<float>(table.row_count()));
+    output_column_statistics->set_statistics_object(std::make_shared<NullValueRatioStatistics>(null_value_ratio));
+  } else {
+    // Failure to generate a histogram currently only stems from all-null segments.
+    // TODO(anybody) this is a slippery assumption. But the alternative would be a full segment scan...
+    output_column_statistics->set_statistics_object(std::make_shared<NullValueRatioStatistics>(1.0f));
+  }
+
+  return output_column_statistics;
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::shared_ptr<TableStatistics> TableStatistics::from_table(const Table& table,
+                                                             const std::optional<StatisticsGenerationMode> mode) {
+  const auto sampled = mode ? *mode == StatisticsGenerationMode::Sampled
+                            : table.row_count() >= SAMPLED_STATISTICS_MIN_ROW_COUNT;
+
+  if (sampled) {
+    /**
+     * Sampled statistics are built from a TableSketch, which is parallelized per chunk and thus uses all cores even for
+     * tables with few columns. The sketch is kept so that new chunks can be folded in later. As the sketch does not
+     * cover mutable chunks, the statistics are scaled to the row count of the entire table. If the table has no
+     * immutable chunks yet, there is nothing to scale and the full statistics are built instead.
+     */
+    const auto table_sketch = TableSketch::from_table(table);
+    if (table_sketch->row_count() > 0 || table.row_count() == 0) {
+      const auto table_statistics = table_sketch->table_statistics(static_cast<Cardinality>(table.row_count()));
+      table_statistics->table_sketch = table_sketch;
+      return table_statistics;
+    }
+  }
+
+  std::vector<std::shared_ptr<BaseAttributeStatistics>> column_statistics(table.column_count());
+  const auto histogram_bin_count = TableStatistics::histogram_bin_count(table.row_count());
 
   /**
    * Parallely create statistics objects for the Table's columns
    */
-  for (auto thread_id = 0u;
-       thread_id < std::min(static_cast<uint>(table.column_count()), std::thread::hardware_concurrency() + 1);
-       ++thread_id) {
-    threads.emplace_back([&] {
-      while (true) {
-        auto my_column_id = ColumnID{static_cast<ColumnID::base_type>(next_column_id++)};
-        if (static_cast<ColumnCount>(my_column_id) >= table.column_count()) return;
-
-        const auto column_data_type = table.column_data_type(my_column_id);
-
-        resolve_data_type(column_data_type, [&](auto type) {
-          using ColumnDataType = typename decltype(type)::type;
-
-          const auto output_column_statistics = std::make_shared<AttributeStatistics<ColumnDataType>>();
-
-          const auto histogram =
-              EqualDistinctCountHistogram<ColumnDataType>::from_column(table, my_column_id, histogram_bin_count);
-
-          if (histogram) {
-            output_column_statistics->set_statistics_object(histogram);
-
-            // Use the insight that the histogram will only contain non-null values to generate the NullValueRatio
-            // property
-            const auto null_value_ratio =
-                table.row_count() == 0
-                    ? 0.0f
-                    : 1.0f - (static_cast<float>(histogram->total_count()) / static_cast<float>(table.row_count()));
-            output_column_statistics->set_statistics_object(
-                std::make_shared<NullValueRatioStatistics>(null_value_ratio));
-          } else {
-            // Failure to generate a histogram currently only stems from all-null segments.
-            // TODO(anybody) this is a slippery assumption. But the alternative would be a full segment scan...
-            output_column_statistics->set_statistics_object(std::make_shared<NullValueRatioStatistics>(1.0f));
-          }
-
-          column_statistics[my_column_id] = output_column_statistics;
-        });
-      }
-    });
-  }
-
-  for (auto& thread : threads) {
-    thread.join();
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(table.column_count());
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, column_id]() {
+      resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        column_statistics[column_id] = full_attribute_statistics<ColumnDataType>(table, column_id, histogram_bin_count);
+      });
+    }));
   }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
 
   return std::make_shared<TableStatistics>(std::move(column_statistics), table.row_count());
 }
 
+size_t TableStatistics::histogram_bin_count(const Cardinality row_count) {
+  /**
+   * Determine bin count, within mostly arbitrarily chosen bounds: 5 (for tables with <=2k rows) up to 100 bins
+   * (for tables with >= 200m rows) are created.
+   */
+  return std::min<size_t>(100, std::max<size_t>(5, static_cast<size_t>(row_count) / 2'000));
+}
+
 TableStatistics::TableStatistics(std::vector<std::shared_ptr<BaseAttributeStatistics>>&& init_column_statistics,
                                  const Cardinality init_row_count)
     : column_statistics(std::move(init_column_statistics)), row_count(init_row_count) {}
@@ -94,6 +116,10 @@ std::ostream& operator<<(std::ostream& stream, const TableStatistics& table_stat
     });
   }
 
+  for (const auto& column_group : table_statistics.column_group_statistics) {
+    stream << column_group << std::endl;
+  }
+
   stream << "}" << std::endl;
 
   return stream;
@@ -8,11 +8,23 @@
 #include <vector>
 
 #include "all_type_variant.hpp"
+#include "statistics/column_group_statistics.hpp"
 
 namespace opossum {
 
 class BaseAttributeStatistics;
 class Table;
+class TableSketch;
+
+/**
+ * Full:    Histograms are built from the value distribution of all values. This requires a hash map with an entry for
+ *          each distinct value of a column and becomes slow for large tables.
+ * Sampled: Histograms are built from a TableSketch, i.e., from a block sample of each chunk that is scaled up. The
+ *          distinct counts are estimated using HyperLogLog sketches. The memory usage is bounded and dictionary
+ *          segments do not have to be scanned. Only immutable chunks are sampled, the statistics are scaled to the row
+ *          count of the entire table.
+ */
+enum class StatisticsGenerationMode { Full, Sampled };
 
 /**
  * Container for all cardinality estimation statistics gathered about a Table. Also used to represent the estimation of
@@ -22,9 +34,16 @@ class TableStatistics {
  public:
   /**
    * Creates statistics objects for cardinality estimation for all Columns in @param table. See implementation for
-   * which statistics objects are created.
+   * which statistics objects are created. If no @param mode is given, statistics for tables with at least
+   * SAMPLED_STATISTICS_MIN_ROW_COUNT rows are sampled.
    */
-  static std::shared_ptr<TableStatistics> from_table(const Table& table);
+  static std::shared_ptr<TableStatistics> from_table(const Table& table,
+                                                     const std::optional<StatisticsGenerationMode> mode = std::nullopt);
+
+  static constexpr auto SAMPLED_STATISTICS_MIN_ROW_COUNT = size_t{1'000'000};
+
+  // Number of histogram bins for a table with @param row_count rows
+  static size_t histogram_bin_count(const Cardinality row_count);
 
   TableStatistics(std::vector<std::shared_ptr<BaseAttributeStatistics>>&& init_column_statistics,
                   const Cardinality init_row_count);
@@ -36,6 +55,12 @@ class TableStatistics {
 
   const std::vector<std::shared_ptr<BaseAttributeStatistics>> column_statistics;
   Cardinality row_count;
+
+  // Optional statistics about the correlation between columns, see ColumnGroupStatistics
+  std::vector<ColumnGroupStatistics> column_group_statistics;
+
+  // The sketch the statistics were built from, if any. Used to fold in new chunks, see update_table_statistics().
+  std::shared_ptr<TableSketch> table_sketch;
 };
 
 std::ostream& operator<<(std::ostream& stream, const TableStatistics& table_statistics);
@@ -0,0 +1,82 @@
+#include "update_table_statistics.hpp"
+
+#include <memory>
+#include <mutex>
+
+#include "hyrise.hpp"
+#include "scheduler/job_task.hpp"
+#include "statistics/generate_pruning_statistics.hpp"
+#include "statistics/table_sketch.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/table.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Statistics built from a sketch must not replace statistics that were built from a newer sketch in the meantime
+std::mutex replace_table_statistics_mutex;
+
+// Replaces the table's statistics if they are still @param expected_table_statistics or have been built from the same
+// @param table_sketch, i.e., if no rebuild has replaced the sketch in the meantime
+void replace_table_statistics(Table& table, const std::shared_ptr<TableStatistics>& expected_table_statistics,
+                              const std::shared_ptr<TableSketch>& table_sketch) {
+  // Statistics must not be replaced by a sketch that does not cover any rows, e.g., if the table only has a mutable
+  // chunk. Otherwise, the sketch is scaled to the rows of the mutable chunk as well (see TableStatistics::from_table).
+  if (table_sketch->row_count() == 0 && table.row_count() > 0) return;
+
+  const auto table_statistics = table_sketch->table_statistics(static_cast<Cardinality>(table.row_count()));
+  table_statistics->table_sketch = table_sketch;
+
+  const auto lock = std::lock_guard<std::mutex>{replace_table_statistics_mutex};
+  const auto current_table_statistics = table.table_statistics();
+  if (current_table_statistics != expected_table_statistics &&
+      current_table_statistics->table_sketch != table_sketch) {
+    return;
+  }
+  table.set_table_statistics(table_statistics);
+}
+
+}  // namespace
+
+namespace opossum {
+
+void update_table_statistics(const std::shared_ptr<Table>& table) {
+  const auto table_statistics = table->table_statistics();
+  if (!table_statistics) return;
+
+  auto table_sketch = table_statistics->table_sketch;
+  auto sketch_changed = false;
+  if (!table_sketch) {
+    table_sketch = TableSketch::from_table(*table);
+    sketch_changed = true;
+  }
+
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    if (!chunk || chunk->is_mutable()) continue;
+
+    // Returns immediately if the chunk already has pruning statistics
+    generate_chunk_pruning_statistics(chunk);
+
+    if (!table_sketch->contains_chunk(chunk_id)) {
+      sketch_changed |= table_sketch->add_chunk(chunk_id, *chunk);
+    }
+  }
+
+  if (sketch_changed) {
+    replace_table_statistics(*table, table_statistics, table_sketch);
+  }
+
+  if (table_sketch->claim_rebuild()) {
+    // Chunks that are finalized while the sketch is rebuilt are folded in by the next update
+    const auto rebuild_task = std::make_shared<JobTask>([table]() {
+      const auto rebuilt_table_sketch = TableSketch::from_table(*table);
+      replace_table_statistics(*table, table->table_statistics(), rebuilt_table_sketch);
+    });
+    rebuild_task->schedule();
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <memory>
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Incorporates the immutable chunks of @param table that were finalized since its statistics were built:
+ *  - Pruning statistics are generated for chunks that have none yet (e.g., because they have not been encoded).
+ *  - The chunks are folded into the TableSketch of the table's statistics and the statistics are replaced with ones
+ *    built from the updated sketch and scaled to the row count of the table, including its mutable chunk. Statistics
+ *    that were generated from all values (StatisticsGenerationMode::Full) have no sketch, which is then created from
+ *    the table on the first update.
+ *  - Once the table has grown by more than TableSketch::STALENESS_THRESHOLD since its sketch was created, a JobTask
+ *    that rebuilds the sketch (and thus resizes the sample) is scheduled.
+ *
+ * Tables without statistics (e.g., those not stored in the StorageManager) are ignored.
+ */
+void update_table_statistics(const std::shared_ptr<Table>& table);
+
+}  // namespace opossum
@@ -0,0 +1,117 @@
+#include "alp_segment.hpp"
+
+#include <climits>
+
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_warning.hpp"
+
+namespace opossum {
+
+template <typename T, typename U>
+ALPSegment<T, U>::ALPSegment(pmr_vector<ALPBlock> blocks, std::unique_ptr<const BaseCompressedVector> offset_values,
+                             pmr_vector<ChunkOffset> exception_chunk_offsets, pmr_vector<T> exception_values,
+                             std::optional<pmr_vector<bool>> null_values)
+    : AbstractEncodedSegment{data_type_from_type<T>()},
+      _blocks{std::move(blocks)},
+      _offset_values{std::move(offset_values)},
+      _exception_chunk_offsets{std::move(exception_chunk_offsets)},
+      _exception_values{std::move(exception_values)},
+      _null_values{std::move(null_values)},
+      _decompressor{_offset_values->create_base_decompressor()} {
+  DebugAssert(_exception_chunk_offsets.size() == _exception_values.size(),
+              "Number of exception chunk offsets does not match the number of exception values");
+  DebugAssert(!_null_values || _null_values->size() == _offset_values->size(),
+              "Number of NULL values does not match the number of offset values");
+}
+
+template <typename T, typename U>
+const pmr_vector<ALPBlock>& ALPSegment<T, U>::blocks() const {
+  return _blocks;
+}
+
+template <typename T, typename U>
+const BaseCompressedVector& ALPSegment<T, U>::offset_values() const {
+  return *_offset_values;
+}
+
+template <typename T, typename U>
+const pmr_vector<ChunkOffset>& ALPSegment<T, U>::exception_chunk_offsets() const {
+  return _exception_chunk_offsets;
+}
+
+template <typename T, typename U>
+const pmr_vector<T>& ALPSegment<T, U>::exception_values() const {
+  return _exception_values;
+}
+
+template <typename T, typename U>
+const std::optional<pmr_vector<bool>>& ALPSegment<T, U>::null_values() const {
+  return _null_values;
+}
+
+template <typename T, typename U>
+AllTypeVariant ALPSegment<T, U>::operator[](const ChunkOffset chunk_offset) const {
+  PerformanceWarning("operator[] used");
+  DebugAssert(chunk_offset < size(), "Passed chunk offset must be valid.");
+
+  const auto typed_value = get_typed_value(chunk_offset);
+  if (!typed_value) {
+    return NULL_VALUE;
+  }
+  return *typed_value;
+}
+
+template <typename T, typename U>
+ChunkOffset ALPSegment<T, U>::size() const {
+  return static_cast<ChunkOffset>(_offset_values->size());
+}
+
+template <typename T, typename U>
+std::shared_ptr<AbstractSegment> ALPSegment<T, U>::copy_using_allocator(
+    const PolymorphicAllocator<size_t>& alloc) const {
+  auto new_blocks = pmr_vector<ALPBlock>(_blocks, alloc);
+  auto new_offset_values = _offset_values->copy_using_allocator(alloc);
+  auto new_exception_chunk_offsets = pmr_vector<ChunkOffset>(_exception_chunk_offsets, alloc);
+  auto new_exception_values = pmr_vector<T>(_exception_values, alloc);
+
+  std::optional<pmr_vector<bool>> new_null_values;
+  if (_null_values) {
+    new_null_values = pmr_vector<bool>(*_null_values, alloc);
+  }
+
+  auto copy = std::make_shared<ALPSegment>(std::move(new_blocks), std::move(new_offset_values),
+                                           std::move(new_exception_chunk_offsets), std::move(new_exception_values),
+                                           std::move(new_null_values));
+  copy->access_counter = access_counter;
+  return copy;
+}
+
+template <typename T, typename U>
+size_t ALPSegment<T, U>::memory_usage(const MemoryUsageCalculationMode) const {
+  // MemoryUsageCalculationMode ignored since full calculation is efficient.
+  auto segment_size = sizeof(*this) + sizeof(ALPBlock) * _blocks.capacity() + _offset_values->data_size() +
+                      sizeof(ChunkOffset) * _exception_chunk_offsets.capacity() +
+                      sizeof(T) * _exception_values.capacity();
+
+  if (_null_values) {
+    segment_size += _null_values->capacity() / CHAR_BIT;
+  }
+
+  return segment_size;
+}
+
+template <typename T, typename U>
+EncodingType ALPSegment<T, U>::encoding_type() const {
+  return EncodingType::ALP;
+}
+
+template <typename T, typename U>
+std::optional<CompressedVectorType> ALPSegment<T, U>::compressed_vector_type() const {
+  return _offset_values->type();
+}
+
+template class ALPSegment<float>;
+template class ALPSegment<double>;
+
+}  // namespace opossum
@@ -0,0 +1,165 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <optional>
+#include <type_traits>
+
+#include <boost/hana/contains.hpp>
+#include <boost/hana/tuple.hpp>
+#include <boost/hana/type.hpp>
+
+#include "abstract_encoded_segment.hpp"
+#include "alp_segment/alp_utils.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "storage/vector_compression/base_vector_decompressor.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseCompressedVector;
+
+// Parameters of a single block of an ALPSegment
+struct ALPBlock {
+  // Frame of reference for the encoded values of the block
+  int64_t minimum{0};
+
+  // Index of the block's first entry in exception_chunk_offsets and exception_values. The block's exceptions end where
+  // the exceptions of the next block begin.
+  uint32_t first_exception{0};
+
+  // A value is encoded as round(value * 10^exponent / 10^factor), see alp_utils.hpp
+  uint8_t exponent{0};
+  uint8_t factor{0};
+};
+
+/**
+ * @brief Segment implementing adaptive lossless floating-point (ALP) encoding
+ *
+ * Floating-point values that originate from decimals (e.g., sensor readings or prices) are losslessly converted into
+ * integers (see alp_utils.hpp). The segment is divided into fixed-size blocks. Each block chooses the exponent and
+ * factor for this conversion that encode its values most compactly. The integers are then stored as offsets from the
+ * block's minimum (as in FrameOfReferenceSegment), which are compressed using vector compression. Decoding a value
+ * requires an integer addition and two multiplications. For sequential access, decode_block() decodes all values of
+ * a block in a loop without branches, which the compiler can vectorize, and patches in the exceptions afterwards.
+ *
+ * Values that cannot be converted (e.g., NaN or values with too many significant digits) are stored as exceptions:
+ * their chunk offsets and original values are stored in separate vectors, sorted by chunk offset. Their offset_values
+ * entry is zero. Columns whose values are mostly not decimals (e.g., results of arbitrary computations) thus end up
+ * larger than unencoded segments and should use a different encoding.
+ *
+ * Null values are stored in a separate vector. If the segment does not contain NULL values, null_values is
+ * std::nullopt.
+ *
+ * std::enable_if_t is used for the same reasons as in FrameOfReferenceSegment.
+ */
+template <typename T, typename = std::enable_if_t<encoding_supports_data_type(enum_c<EncodingType, EncodingType::ALP>,
+                                                                              hana::type_c<T>)>>
+class ALPSegment : public AbstractEncodedSegment {
+ public:
+  // Same as the vector size of the original ALP implementation. Smaller blocks adapt better to changes in the data, but
+  // add more overhead for the block parameters.
+  static constexpr auto block_size = 1024u;
+
+  explicit ALPSegment(pmr_vector<ALPBlock> blocks, std::unique_ptr<const BaseCompressedVector> offset_values,
+                      pmr_vector<ChunkOffset> exception_chunk_offsets, pmr_vector<T> exception_values,
+                      std::optional<pmr_vector<bool>> null_values);
+
+  const pmr_vector<ALPBlock>& blocks() const;
+  const BaseCompressedVector& offset_values() const;
+  const pmr_vector<ChunkOffset>& exception_chunk_offsets() const;
+  const pmr_vector<T>& exception_values() const;
+  const std::optional<pmr_vector<bool>>& null_values() const;
+
+  // Returns the (non-NULL) value at chunk_offset, given its entry in offset_values. Used by the iterables.
+  T decode_value(const ChunkOffset chunk_offset, const uint32_t offset_value) const {
+    // performance critical - not in cpp to help with inlining
+    const auto block_id = chunk_offset / block_size;
+    const auto& block = _blocks[block_id];
+
+    const auto exceptions_end = block_id + 1 < _blocks.size() ? _blocks[block_id + 1].first_exception
+                                                              : static_cast<uint32_t>(_exception_chunk_offsets.size());
+    if (block.first_exception != exceptions_end) {
+      const auto exceptions_begin_it = _exception_chunk_offsets.cbegin() + block.first_exception;
+      const auto exceptions_end_it = _exception_chunk_offsets.cbegin() + exceptions_end;
+      const auto exception_it = std::lower_bound(exceptions_begin_it, exceptions_end_it, chunk_offset);
+      if (exception_it != exceptions_end_it && *exception_it == chunk_offset) {
+        return _exception_values[std::distance(_exception_chunk_offsets.cbegin(), exception_it)];
+      }
+    }
+
+    return alp_decode<T>(block.minimum + static_cast<int64_t>(offset_value), block.exponent, block.factor);
+  }
+
+  // Writes the values of block @param block_id to @param values, which must hold block_size values. The entries of NULL
+  // values are unspecified. Used by the iterables for sequential access.
+  template <typename OffsetValueDecompressor>
+  void decode_block(const size_t block_id, OffsetValueDecompressor& offset_value_decompressor, T* values) const {
+    // performance critical - not in cpp to help with inlining
+    const auto& block = _blocks[block_id];
+    const auto block_begin = block_id * block_size;
+    const auto block_value_count = std::min(static_cast<size_t>(block_size), size() - block_begin);
+
+    // The offset values are decompressed first, so that the decoding loop below does not depend on the decompressor
+    auto offset_values = std::array<uint32_t, block_size>{};
+    for (auto index = size_t{0}; index < block_value_count; ++index) {
+      offset_values[index] = offset_value_decompressor.get(block_begin + index);
+    }
+
+    for (auto index = size_t{0}; index < block_value_count; ++index) {
+      values[index] = alp_decode<T>(block.minimum + static_cast<int64_t>(offset_values[index]), block.exponent,
+                                    block.factor);
+    }
+
+    // Exceptions are stored with an offset value of zero and overwrite the values decoded from it
+    const auto exceptions_end = block_id + 1 < _blocks.size() ? _blocks[block_id + 1].first_exception
+                                                              : static_cast<uint32_t>(_exception_chunk_offsets.size());
+    for (auto exception_id = block.first_exception; exception_id < exceptions_end; ++exception_id) {
+      values[_exception_chunk_offsets[exception_id] - block_begin] = _exception_values[exception_id];
+    }
+  }
+
+  /**
+   * @defgroup AbstractSegment interface
+   * @{
+   */
+
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const {
+    // performance critical - not in cpp to help with inlining
+    if (_null_values && (*_null_values)[chunk_offset]) {
+      return std::nullopt;
+    }
+    return decode_value(chunk_offset, _decompressor->get(chunk_offset));
+  }
+
+  ChunkOffset size() const final;
+
+  std::shared_ptr<AbstractSegment> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const final;
+
+  size_t memory_usage(const MemoryUsageCalculationMode) const final;
+
+  /**@}*/
+
+  /**
+   * @defgroup AbstractEncodedSegment interface
+   * @{
+   */
+
+  EncodingType encoding_type() const final;
+  std::optional<CompressedVectorType> compressed_vector_type() const final;
+
+  /**@}*/
+
+ private:
+  const pmr_vector<ALPBlock> _blocks;
+  const std::unique_ptr<const BaseCompressedVector> _offset_values;
+  const pmr_vector<ChunkOffset> _exception_chunk_offsets;
+  const pmr_vector<T> _exception_values;
+  const std::optional<pmr_vector<bool>> _null_values;
+  std::unique_ptr<BaseVectorDecompressor> _decompressor;
+};
+
+}  // namespace opossum
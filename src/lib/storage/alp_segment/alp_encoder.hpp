@@ -0,0 +1,216 @@
+#pragma once
+
+#include <algorithm>
+#include <climits>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "storage/alp_segment.hpp"
+#include "storage/alp_segment/alp_utils.hpp"
+#include "storage/base_segment_encoder.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/value_segment/value_segment_iterable.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "types.hpp"
+#include "utils/enum_constant.hpp"
+
+namespace opossum {
+
+/**
+ * Encodes a floating-point segment into an ALPSegment. As in the original ALP implementation, exponent and factor are
+ * chosen in two levels: First, the combinations that work best for a sample of the entire segment are determined.
+ * Then, each block picks the best of these candidates for a sample of its own values. This way, only a few
+ * combinations have to be tried per block.
+ */
+class ALPEncoder : public SegmentEncoder<ALPEncoder> {
+ public:
+  static constexpr auto _encoding_type = enum_c<EncodingType, EncodingType::ALP>;
+  static constexpr auto _uses_vector_compression = true;  // see base_segment_encoder.hpp for details
+
+  // Number of values sampled from the segment and from each block, respectively
+  static constexpr auto _segment_sample_size = size_t{256};
+  static constexpr auto _block_sample_size = size_t{32};
+
+  // Number of exponent/factor combinations that are considered for each block
+  static constexpr auto _candidate_count = size_t{5};
+
+  template <typename T>
+  std::shared_ptr<AbstractEncodedSegment> _on_encode(const AnySegmentIterable<T> segment_iterable,
+                                                     const PolymorphicAllocator<T>& allocator) {
+    static constexpr auto block_size = ALPSegment<T>::block_size;
+
+    auto values = std::vector<T>{};
+    auto null_values = pmr_vector<bool>{allocator};
+    auto segment_contains_null_values = false;
+
+    segment_iterable.with_iterators([&](auto segment_it, auto segment_end) {
+      const auto size = std::distance(segment_it, segment_end);
+      values.reserve(size);
+      null_values.reserve(size);
+
+      for (; segment_it != segment_end; ++segment_it) {
+        const auto segment_value = *segment_it;
+        const auto value_is_null = segment_value.is_null();
+        values.push_back(value_is_null ? T{} : segment_value.value());
+        null_values.push_back(value_is_null);
+        segment_contains_null_values |= value_is_null;
+      }
+    });
+
+    const auto candidates = _find_candidates(_sample(values, null_values, 0, values.size(), _segment_sample_size));
+
+    auto blocks = pmr_vector<ALPBlock>{allocator};
+    auto offset_values = pmr_vector<uint32_t>{allocator};
+    auto exception_chunk_offsets = pmr_vector<ChunkOffset>{allocator};
+    auto exception_values = pmr_vector<T>{allocator};
+
+    blocks.reserve((values.size() + block_size - 1) / block_size);
+    offset_values.reserve(values.size());
+
+    // used as optional input for the compression of the offset values
+    auto max_offset = uint32_t{0};
+
+    auto encoded_values = std::vector<std::optional<int64_t>>(block_size);
+
+    for (auto block_begin = size_t{0}; block_begin < values.size(); block_begin += block_size) {
+      const auto block_end = std::min(block_begin + block_size, values.size());
+
+      auto block = ALPBlock{};
+      block.first_exception = static_cast<uint32_t>(exception_chunk_offsets.size());
+
+      const auto block_sample = _sample(values, null_values, block_begin, block_end, _block_sample_size);
+      std::tie(block.exponent, block.factor) = _best_candidate(block_sample, candidates);
+
+      auto minimum = std::numeric_limits<int64_t>::max();
+      for (auto chunk_offset = block_begin; chunk_offset < block_end; ++chunk_offset) {
+        auto& encoded_value = encoded_values[chunk_offset - block_begin];
+        encoded_value = null_values[chunk_offset] ? std::nullopt
+                                                  : alp_encode(values[chunk_offset], block.exponent, block.factor);
+        if (encoded_value) {
+          minimum = std::min(minimum, *encoded_value);
+        }
+      }
+      block.minimum = minimum == std::numeric_limits<int64_t>::max() ? int64_t{0} : minimum;
+
+      for (auto chunk_offset = block_begin; chunk_offset < block_end; ++chunk_offset) {
+        auto offset = uint32_t{0};
+        if (!null_values[chunk_offset]) {
+          // Values that could not be encoded or that are too far from the block's minimum to be stored as an offset
+          // are stored as exceptions
+          const auto& encoded_value = encoded_values[chunk_offset - block_begin];
+          if (encoded_value && *encoded_value - block.minimum <= int64_t{std::numeric_limits<uint32_t>::max()}) {
+            offset = static_cast<uint32_t>(*encoded_value - block.minimum);
+          } else {
+            exception_chunk_offsets.push_back(static_cast<ChunkOffset>(chunk_offset));
+            exception_values.push_back(values[chunk_offset]);
+          }
+        }
+        offset_values.push_back(offset);
+        max_offset = std::max(max_offset, offset);
+      }
+
+      blocks.push_back(block);
+    }
+
+    auto compressed_offset_values = compress_vector(offset_values, vector_compression_type(), allocator, {max_offset});
+
+    auto optional_null_values =
+        segment_contains_null_values ? std::optional<pmr_vector<bool>>{std::move(null_values)} : std::nullopt;
+
+    return std::make_shared<ALPSegment<T>>(std::move(blocks), std::move(compressed_offset_values),
+                                           std::move(exception_chunk_offsets), std::move(exception_values),
+                                           std::move(optional_null_values));
+  }
+
+ private:
+  using ExponentAndFactor = std::pair<uint8_t, uint8_t>;
+
+  // Returns up to sample_size non-NULL values, evenly spread across [begin, end)
+  template <typename T>
+  static std::vector<T> _sample(const std::vector<T>& values, const pmr_vector<bool>& null_values, const size_t begin,
+                                const size_t end, const size_t sample_size) {
+    const auto stride = std::max(size_t{1}, (end - begin) / sample_size);
+
+    auto sample = std::vector<T>{};
+    sample.reserve(sample_size);
+    for (auto index = begin; index < end && sample.size() < sample_size; index += stride) {
+      if (!null_values[index]) {
+        sample.push_back(values[index]);
+      }
+    }
+    return sample;
+  }
+
+  // Estimates the number of bits needed to store the sample with the given exponent and factor. Each exception costs
+  // the size of the original value plus its chunk offset.
+  template <typename T>
+  static uint64_t _estimate_size(const std::vector<T>& sample, const ExponentAndFactor& exponent_and_factor) {
+    auto exception_count = uint64_t{0};
+    auto minimum = std::numeric_limits<int64_t>::max();
+    auto maximum = std::numeric_limits<int64_t>::lowest();
+
+    for (const auto& value : sample) {
+      const auto encoded_value = alp_encode(value, exponent_and_factor.first, exponent_and_factor.second);
+      if (!encoded_value) {
+        ++exception_count;
+        continue;
+      }
+      minimum = std::min(minimum, *encoded_value);
+      maximum = std::max(maximum, *encoded_value);
+    }
+
+    auto bit_width = uint64_t{0};
+    if (exception_count < sample.size()) {
+      const auto range = static_cast<uint64_t>(maximum - minimum);
+      while (bit_width < 64 && (range >> bit_width) != 0) {
+        ++bit_width;
+      }
+    }
+
+    const auto exception_size = uint64_t{sizeof(T) + sizeof(ChunkOffset)} * CHAR_BIT;
+    return (sample.size() - exception_count) * bit_width + exception_count * exception_size;
+  }
+
+  // Returns the _candidate_count combinations of exponent and factor that encode the sample most compactly
+  template <typename T>
+  static std::vector<ExponentAndFactor> _find_candidates(const std::vector<T>& sample) {
+    auto estimated_sizes = std::vector<std::pair<uint64_t, ExponentAndFactor>>{};
+    for (auto exponent = uint8_t{0}; exponent <= alp_max_exponent<T>(); ++exponent) {
+      for (auto factor = uint8_t{0}; factor <= exponent; ++factor) {
+        const auto exponent_and_factor = ExponentAndFactor{exponent, factor};
+        estimated_sizes.emplace_back(_estimate_size(sample, exponent_and_factor), exponent_and_factor);
+      }
+    }
+
+    // Sorting by the pair prefers smaller exponents and factors for equal sizes
+    const auto candidate_count = std::min(_candidate_count, estimated_sizes.size());
+    std::partial_sort(estimated_sizes.begin(), estimated_sizes.begin() + candidate_count, estimated_sizes.end());
+
+    auto candidates = std::vector<ExponentAndFactor>{};
+    for (auto candidate_id = size_t{0}; candidate_id < candidate_count; ++candidate_id) {
+      candidates.push_back(estimated_sizes[candidate_id].second);
+    }
+    return candidates;
+  }
+
+  template <typename T>
+  static ExponentAndFactor _best_candidate(const std::vector<T>& sample,
+                                           const std::vector<ExponentAndFactor>& candidates) {
+    auto best_candidate = candidates.front();
+    auto best_size = std::numeric_limits<uint64_t>::max();
+    for (const auto& candidate : candidates) {
+      const auto size = _estimate_size(sample, candidate);
+      if (size < best_size) {
+        best_size = size;
+        best_candidate = candidate;
+      }
+    }
+    return best_candidate;
+  }
+};
+
+}  // namespace opossum
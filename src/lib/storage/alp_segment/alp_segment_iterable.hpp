@@ -0,0 +1,159 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <optional>
+#include <type_traits>
+
+#include "storage/abstract_segment.hpp"
+#include "storage/alp_segment.hpp"
+#include "storage/segment_iterables.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+
+namespace opossum {
+
+template <typename T>
+class ALPSegmentIterable : public PointAccessibleSegmentIterable<ALPSegmentIterable<T>> {
+ public:
+  using ValueType = T;
+
+  explicit ALPSegmentIterable(const ALPSegment<T>& segment) : _segment{segment} {}
+
+  template <typename Functor>
+  void _on_with_iterators(const Functor& functor) const {
+    _segment.access_counter[SegmentAccessCounter::AccessType::Sequential] += _segment.size();
+    resolve_compressed_vector_type(_segment.offset_values(), [&](const auto& offset_values) {
+      using OffsetValueDecompressor = std::decay_t<decltype(offset_values.create_decompressor())>;
+
+      // The iterators share the decoded block, which is only decoded again when an iterator moves to a different block
+      const auto decoded_block = std::make_shared<DecodedBlock>();
+
+      auto begin = Iterator<OffsetValueDecompressor>{&_segment, offset_values.create_decompressor(), decoded_block,
+                                                     ChunkOffset{0}};
+      auto end = Iterator<OffsetValueDecompressor>{&_segment, offset_values.create_decompressor(), decoded_block,
+                                                   static_cast<ChunkOffset>(_segment.size())};
+
+      functor(begin, end);
+    });
+  }
+
+  template <typename Functor, typename PosListType>
+  void _on_with_iterators(const std::shared_ptr<PosListType>& position_filter, const Functor& functor) const {
+    _segment.access_counter[SegmentAccessCounter::access_type(*position_filter)] += position_filter->size();
+    resolve_compressed_vector_type(_segment.offset_values(), [&](const auto& offset_values) {
+      using OffsetValueDecompressor = std::decay_t<decltype(offset_values.create_decompressor())>;
+      using PosListIteratorType = std::decay_t<decltype(position_filter->cbegin())>;
+
+      auto begin = PointAccessIterator<OffsetValueDecompressor, PosListIteratorType>{
+          &_segment, offset_values.create_decompressor(), position_filter->cbegin(), position_filter->cbegin()};
+      auto end = PointAccessIterator<OffsetValueDecompressor, PosListIteratorType>{
+          &_segment, offset_values.create_decompressor(), position_filter->cbegin(), position_filter->cend()};
+
+      functor(begin, end);
+    });
+  }
+
+  size_t _on_size() const { return _segment.size(); }
+
+ private:
+  const ALPSegment<T>& _segment;
+
+ private:
+  struct DecodedBlock {
+    std::optional<size_t> block_id;
+    std::array<T, ALPSegment<T>::block_size> values;
+  };
+
+  template <typename OffsetValueDecompressor>
+  class Iterator : public AbstractSegmentIterator<Iterator<OffsetValueDecompressor>, SegmentPosition<T>> {
+   public:
+    using ValueType = T;
+    using IterableType = ALPSegmentIterable<T>;
+
+   public:
+    explicit Iterator(const ALPSegment<T>* segment, OffsetValueDecompressor offset_value_decompressor,
+                      std::shared_ptr<DecodedBlock> decoded_block, ChunkOffset chunk_offset)
+        : _segment{segment},
+          _offset_value_decompressor{std::move(offset_value_decompressor)},
+          _decoded_block{std::move(decoded_block)},
+          _chunk_offset{chunk_offset} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    void increment() { ++_chunk_offset; }
+
+    void decrement() { --_chunk_offset; }
+
+    void advance(std::ptrdiff_t n) { _chunk_offset += n; }
+
+    bool equal(const Iterator& other) const { return _chunk_offset == other._chunk_offset; }
+
+    std::ptrdiff_t distance_to(const Iterator& other) const {
+      return static_cast<std::ptrdiff_t>(other._chunk_offset) - _chunk_offset;
+    }
+
+    SegmentPosition<T> dereference() const {
+      const auto& null_values = _segment->null_values();
+      const auto is_null = null_values ? (*null_values)[_chunk_offset] : false;
+      if (is_null) {
+        return SegmentPosition<T>{T{}, true, _chunk_offset};
+      }
+
+      const auto block_id = _chunk_offset / ALPSegment<T>::block_size;
+      if (_decoded_block->block_id != block_id) {
+        _segment->decode_block(block_id, _offset_value_decompressor, _decoded_block->values.data());
+        _decoded_block->block_id = block_id;
+      }
+
+      const auto value = _decoded_block->values[_chunk_offset % ALPSegment<T>::block_size];
+      return SegmentPosition<T>{value, false, _chunk_offset};
+    }
+
+   private:
+    const ALPSegment<T>* _segment;
+    mutable OffsetValueDecompressor _offset_value_decompressor;
+    std::shared_ptr<DecodedBlock> _decoded_block;
+    ChunkOffset _chunk_offset;
+  };
+
+  template <typename OffsetValueDecompressor, typename PosListIteratorType>
+  class PointAccessIterator
+      : public AbstractPointAccessSegmentIterator<PointAccessIterator<OffsetValueDecompressor, PosListIteratorType>,
+                                                  SegmentPosition<T>, PosListIteratorType> {
+   public:
+    using ValueType = T;
+    using IterableType = ALPSegmentIterable<T>;
+
+    PointAccessIterator(const ALPSegment<T>* segment, OffsetValueDecompressor offset_value_decompressor,
+                        PosListIteratorType position_filter_begin, PosListIteratorType position_filter_it)
+        : AbstractPointAccessSegmentIterator<PointAccessIterator<OffsetValueDecompressor, PosListIteratorType>,
+                                             SegmentPosition<T>, PosListIteratorType>{std::move(position_filter_begin),
+                                                                                      std::move(position_filter_it)},
+          _segment{segment},
+          _offset_value_decompressor{std::move(offset_value_decompressor)} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    SegmentPosition<T> dereference() const {
+      const auto& chunk_offsets = this->chunk_offsets();
+      const auto current_offset = chunk_offsets.offset_in_referenced_chunk;
+
+      const auto& null_values = _segment->null_values();
+      const auto is_null = null_values ? (*null_values)[current_offset] : false;
+      if (is_null) {
+        return SegmentPosition<T>{T{}, true, chunk_offsets.offset_in_poslist};
+      }
+
+      const auto value = _segment->decode_value(current_offset, _offset_value_decompressor.get(current_offset));
+      return SegmentPosition<T>{value, false, chunk_offsets.offset_in_poslist};
+    }
+
+   private:
+    const ALPSegment<T>* _segment;
+    mutable OffsetValueDecompressor _offset_value_decompressor;
+  };
+};
+
+}  // namespace opossum
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <type_traits>
+
+namespace opossum {
+
+/**
+ * Helpers for the adaptive lossless floating-point encoding used by ALPSegment, see Afroozeh et al.: "ALP: Adaptive
+ * Lossless floating-Point Compression", SIGMOD 2024.
+ *
+ * Many floating-point values originate from decimals (e.g., 12.34). Multiplying them by 10^exponent and dividing them
+ * by 10^factor yields an integer, which can be encoded much more compactly than the value itself. An encoded value is
+ * only used if decoding it yields the exact same bits as the original value.
+ */
+
+// Larger exponents do not yield integers that can be stored exactly in the respective type
+template <typename T>
+constexpr uint8_t alp_max_exponent() {
+  static_assert(std::is_floating_point_v<T>, "ALP is only defined for floating-point types");
+  return std::is_same_v<T, float> ? uint8_t{10} : uint8_t{18};
+}
+
+inline constexpr auto ALP_POWERS_OF_TEN = std::array<double, 19>{
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18};
+
+inline constexpr auto ALP_INVERSE_POWERS_OF_TEN =
+    std::array<double, 19>{1e0,   1e-1,  1e-2,  1e-3,  1e-4,  1e-5,  1e-6,  1e-7,  1e-8, 1e-9,
+                           1e-10, 1e-11, 1e-12, 1e-13, 1e-14, 1e-15, 1e-16, 1e-17, 1e-18};
+
+// Implemented in hpp for performance reasons (to allow inlining and vectorization of the decoding loops). Floats are
+// decoded using double arithmetic as well, because 10^-exponent is too imprecise as a float and would turn most values
+// into exceptions.
+template <typename T>
+T alp_decode(const int64_t encoded_value, const uint8_t exponent, const uint8_t factor) {
+  return static_cast<T>(static_cast<double>(encoded_value) * ALP_POWERS_OF_TEN[factor] *
+                        ALP_INVERSE_POWERS_OF_TEN[exponent]);
+}
+
+// Returns the encoded value if value can be restored from it without any loss, std::nullopt otherwise. Besides values
+// with too many decimal digits, this is the case for NaN, infinity, and -0.0.
+template <typename T>
+std::optional<int64_t> alp_encode(const T value, const uint8_t exponent, const uint8_t factor) {
+  const auto scaled_value =
+      static_cast<double>(value) * ALP_POWERS_OF_TEN[exponent] * ALP_INVERSE_POWERS_OF_TEN[factor];
+
+  // Only integers below 2^53 can be represented exactly by a double
+  if (!(std::abs(scaled_value) < 9'007'199'254'740'992.0)) {
+    return std::nullopt;
+  }
+
+  const auto encoded_value = static_cast<int64_t>(std::llround(scaled_value));
+  const auto decoded_value = alp_decode<T>(encoded_value, exponent, factor);
+  if (std::memcmp(&decoded_value, &value, sizeof(T)) != 0) {
+    return std::nullopt;
+  }
+
+  return encoded_value;
+}
+
+}  // namespace opossum
@@ -21,7 +21,8 @@ class AbstractSegment;
 /**
  * @brief Interface for encoding chunks
  *
- * NOT thread-safe. In a multi-threaded context, the ChunkCompressionTask should invoke the ChunkEncoder.
+ * NOT thread-safe. In a multi-threaded context, the ChunkCompressionTask should invoke the ChunkEncoder. Full chunks of
+ * tables that are inserted into are compressed in the background by the ChunkCompressionPlugin.
  *
  * The methods provided are not thread-safe and might lead to race conditions
  * if there are other operations manipulating the chunks at the same time.
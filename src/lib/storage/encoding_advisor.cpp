@@ -0,0 +1,307 @@
+#include "encoding_advisor.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/base_segment_encoder.hpp"
+#include "storage/chunk.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_access_counter.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+#include "utils/size_estimation_utils.hpp"
+
+namespace opossum {
+
+namespace {
+
+struct AccessCosts {
+  double sequential;
+  double random;
+};
+
+// Rough cost of accessing a single value of an encoding, relative to accessing a value of an unencoded segment
+const auto relative_access_costs = std::map<EncodingType, AccessCosts>{
+    {EncodingType::Unencoded, {1.0, 1.0}},
+    {EncodingType::Dictionary, {1.2, 1.5}},
+    {EncodingType::RunLength, {1.2, 8.0}},
+    {EncodingType::FixedStringDictionary, {2.0, 2.0}},
+    {EncodingType::FrameOfReference, {1.2, 1.5}},
+    {EncodingType::LZ4, {20.0, 100.0}},
+    {EncodingType::FSST, {4.0, 4.0}},
+    {EncodingType::ALP, {1.5, 2.0}}};
+
+// Additional cost of SimdBp128 compressed vectors, which decode blocks of 128 values at once and are thus expensive to
+// access randomly
+const auto simd_bp128_access_costs = AccessCosts{0.3, 4.0};
+
+// Returns the number of accesses of @param access_type since @param previous_access_counter was taken
+double accesses_since(const AbstractSegment& segment, const SegmentAccessCounter& previous_access_counter,
+                      const SegmentAccessCounter::AccessType access_type) {
+  const auto accesses = segment.access_counter[access_type].load();
+  const auto previous_accesses = previous_access_counter[access_type].load();
+  return accesses > previous_accesses ? static_cast<double>(accesses - previous_accesses) : 0.0;
+}
+
+// Returns the weighted access cost per row of the given encoding, based on the accesses recorded for the segment since
+// @param previous_access_counter was taken
+double access_cost(const AbstractSegment& segment, const SegmentAccessCounter& previous_access_counter,
+                   const SegmentEncodingSpec& encoding_spec) {
+  using AccessType = SegmentAccessCounter::AccessType;
+  const auto row_count = static_cast<double>(segment.size());
+  const auto sequential_accesses = accesses_since(segment, previous_access_counter, AccessType::Sequential) +
+                                   accesses_since(segment, previous_access_counter, AccessType::Monotonic);
+  const auto random_accesses = accesses_since(segment, previous_access_counter, AccessType::Random) +
+                               accesses_since(segment, previous_access_counter, AccessType::Point);
+
+  auto costs = relative_access_costs.at(encoding_spec.encoding_type);
+  if (encoding_spec.vector_compression_type == VectorCompressionType::SimdBp128) {
+    costs.sequential += simd_bp128_access_costs.sequential;
+    costs.random += simd_bp128_access_costs.random;
+  }
+
+  return EncodingAdvisor::ACCESS_COST_WEIGHT *
+         (sequential_accesses * costs.sequential + random_accesses * costs.random) / row_count;
+}
+
+std::vector<SegmentEncodingSpec> candidate_encoding_specs(const DataType data_type) {
+  auto candidates = std::vector<SegmentEncodingSpec>{};
+  for (const auto encoding_type : all_encoding_types) {
+    if (encoding_type == EncodingType::LZ4 || !encoding_supports_data_type(encoding_type, data_type)) continue;
+
+    if (encoding_type == EncodingType::Unencoded || !create_encoder(encoding_type)->uses_vector_compression()) {
+      candidates.emplace_back(encoding_type);
+      continue;
+    }
+
+    candidates.emplace_back(encoding_type, VectorCompressionType::FixedSizeByteAligned);
+    candidates.emplace_back(encoding_type, VectorCompressionType::SimdBp128);
+  }
+  return candidates;
+}
+
+// Copies the values of the sample windows into a new ValueSegment. Iterating the segment increments its access
+// counters, so these accesses are subtracted afterwards. Otherwise, the advisor would mistake its own sampling for
+// accesses.
+template <typename T>
+std::shared_ptr<ValueSegment<T>> sample_segment(const AbstractSegment& segment) {
+  const auto row_count = static_cast<size_t>(segment.size());
+  const auto sample_size = EncodingAdvisor::SAMPLE_WINDOW_COUNT * EncodingAdvisor::SAMPLE_WINDOW_SIZE;
+
+  auto values = pmr_vector<T>{};
+  auto null_values = pmr_vector<bool>{};
+  values.reserve(std::min(row_count, sample_size));
+  null_values.reserve(std::min(row_count, sample_size));
+
+  const auto append_value = [&](const auto& position) {
+    null_values.push_back(position.is_null());
+    values.push_back(position.is_null() ? T{} : position.value());
+  };
+
+  // Only the accesses of the sampling are subtracted. Restoring the previous counters instead would lose the accesses
+  // of concurrently running operators.
+  if (row_count <= sample_size) {
+    segment_iterate<T>(segment, append_value);
+    segment.access_counter[SegmentAccessCounter::AccessType::Sequential] -= row_count;
+  } else {
+    auto position_filter = std::make_shared<RowIDPosList>();
+    position_filter->reserve(sample_size);
+    const auto window_distance = row_count / EncodingAdvisor::SAMPLE_WINDOW_COUNT;
+    for (auto window_id = size_t{0}; window_id < EncodingAdvisor::SAMPLE_WINDOW_COUNT; ++window_id) {
+      for (auto window_offset = size_t{0}; window_offset < EncodingAdvisor::SAMPLE_WINDOW_SIZE; ++window_offset) {
+        const auto chunk_offset = static_cast<ChunkOffset>(window_id * window_distance + window_offset);
+        position_filter->emplace_back(RowID{ChunkID{0}, chunk_offset});
+      }
+    }
+    position_filter->guarantee_single_chunk();
+    segment_iterate_filtered<T>(segment, position_filter, append_value);
+    segment.access_counter[SegmentAccessCounter::access_type(*position_filter)] -= position_filter->size();
+  }
+
+  if (std::find(null_values.cbegin(), null_values.cend(), true) == null_values.cend()) {
+    return std::make_shared<ValueSegment<T>>(std::move(values));
+  }
+  return std::make_shared<ValueSegment<T>>(std::move(values), std::move(null_values));
+}
+
+// FrameOfReferenceSegments store offsets of up to 32 bits, plus the upper 32 bits of the offsets of all values once a
+// block spans a wider range (see FrameOfReferenceSegment). For such ranges, FrameOfReference does not compress and the
+// sample cannot tell how many blocks are affected, so it is not considered.
+template <typename T>
+bool exceeds_frame_of_reference_range(const ValueSegment<T>& sample) {
+  if constexpr (std::is_integral_v<T> && sizeof(T) > sizeof(uint32_t)) {
+    auto min_value = std::numeric_limits<T>::max();
+    auto max_value = std::numeric_limits<T>::lowest();
+    for (auto sample_offset = ChunkOffset{0}; sample_offset < sample.size(); ++sample_offset) {
+      if (sample.is_nullable() && sample.null_values()[sample_offset]) continue;
+      min_value = std::min(min_value, sample.values()[sample_offset]);
+      max_value = std::max(max_value, sample.values()[sample_offset]);
+    }
+
+    using UnsignedT = std::make_unsigned_t<T>;
+    return min_value < max_value && static_cast<UnsignedT>(static_cast<UnsignedT>(max_value) -
+                                                           static_cast<UnsignedT>(min_value)) >
+                                        std::numeric_limits<uint32_t>::max();
+  }
+  return false;
+}
+
+// Estimates the size of the dictionary and the attribute vector of (FixedString)DictionarySegments
+template <typename T>
+size_t estimate_dictionary_memory_usage(const ValueSegment<T>& sample, const size_t row_count,
+                                        const SegmentEncodingSpec& encoding_spec) {
+  auto value_counts = std::unordered_map<T, size_t>{};
+  auto sample_value_count = size_t{0};
+  for (auto sample_offset = ChunkOffset{0}; sample_offset < sample.size(); ++sample_offset) {
+    if (sample.is_nullable() && sample.null_values()[sample_offset]) continue;
+    ++value_counts[sample.values()[sample_offset]];
+    ++sample_value_count;
+  }
+
+  // Guaranteed-error estimator (Charikar et al.: "Towards Estimation Error Guarantees for Distinct Values", PODS 2000)
+  const auto sample_distinct_count = value_counts.size();
+  const auto singleton_count = static_cast<size_t>(
+      std::count_if(value_counts.cbegin(), value_counts.cend(), [](const auto& entry) { return entry.second == 1; }));
+  auto distinct_count = double{0};
+  if (sample_value_count > 0) {
+    const auto non_null_row_count =
+        static_cast<double>(row_count) * static_cast<double>(sample_value_count) / static_cast<double>(sample.size());
+    distinct_count = std::sqrt(non_null_row_count / static_cast<double>(sample_value_count)) *
+                         static_cast<double>(singleton_count) +
+                     static_cast<double>(sample_distinct_count - singleton_count);
+    distinct_count = std::clamp(distinct_count, static_cast<double>(sample_distinct_count), non_null_row_count);
+  }
+
+  auto dictionary_value_size = double{sizeof(T)};
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    if (!value_counts.empty()) {
+      auto value_sizes = size_t{0};
+      auto max_value_size = size_t{0};
+      for (const auto& [value, count] : value_counts) {
+        value_sizes += sizeof(pmr_string) + string_heap_size(value);
+        max_value_size = std::max(max_value_size, value.size());
+      }
+      // FixedStringDictionarySegments store every value with the length of the longest value
+      dictionary_value_size = encoding_spec.encoding_type == EncodingType::FixedStringDictionary
+                                  ? static_cast<double>(max_value_size)
+                                  : static_cast<double>(value_sizes) / static_cast<double>(value_counts.size());
+    }
+  }
+
+  // The attribute vector also has to store the NULL value id, which is the dictionary size
+  const auto value_id_count = static_cast<uint64_t>(distinct_count) + 1;
+  auto value_id_bits = uint64_t{1};
+  while (value_id_bits < 32 && (value_id_count >> value_id_bits) != 0) {
+    ++value_id_bits;
+  }
+  if (encoding_spec.vector_compression_type == VectorCompressionType::FixedSizeByteAligned) {
+    value_id_bits = value_id_bits <= 8 ? 8 : value_id_bits <= 16 ? 16 : 32;
+  }
+
+  return static_cast<size_t>(distinct_count * dictionary_value_size) + row_count * value_id_bits / CHAR_BIT;
+}
+
+}  // namespace
+
+std::vector<EncodingAdvisor::EncodingEstimate> EncodingAdvisor::estimate_encodings(
+    const std::shared_ptr<const AbstractSegment>& segment, const DataType data_type,
+    const SegmentAccessCounter& previous_access_counter) {
+  Assert(!std::dynamic_pointer_cast<const ReferenceSegment>(segment),
+         "Encodings can only be estimated for data segments.");
+
+  const auto row_count = static_cast<size_t>(segment->size());
+  if (row_count == 0) return {};
+
+  auto estimates = std::vector<EncodingEstimate>{};
+  resolve_data_type(data_type, [&](const auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    const auto sample = sample_segment<ColumnDataType>(*segment);
+    const auto extrapolation_factor = static_cast<double>(row_count) / static_cast<double>(sample->size());
+    const auto skip_frame_of_reference = exceeds_frame_of_reference_range(*sample);
+
+    for (const auto& encoding_spec : candidate_encoding_specs(data_type)) {
+      if (encoding_spec.encoding_type == EncodingType::FrameOfReference && skip_frame_of_reference) continue;
+
+      auto memory_usage = size_t{0};
+      if (encoding_spec.encoding_type == EncodingType::Dictionary ||
+          encoding_spec.encoding_type == EncodingType::FixedStringDictionary) {
+        memory_usage = estimate_dictionary_memory_usage(*sample, row_count, encoding_spec);
+      } else {
+        const auto encoded_sample = ChunkEncoder::encode_segment(sample, data_type, encoding_spec);
+        memory_usage = static_cast<size_t>(
+            static_cast<double>(encoded_sample->memory_usage(MemoryUsageCalculationMode::Full)) * extrapolation_factor);
+      }
+
+      const auto cost = static_cast<double>(memory_usage) / static_cast<double>(row_count) +
+                        access_cost(*segment, previous_access_counter, encoding_spec);
+      estimates.push_back({encoding_spec, memory_usage, cost});
+    }
+  });
+
+  std::stable_sort(estimates.begin(), estimates.end(),
+                   [](const auto& lhs, const auto& rhs) { return lhs.cost < rhs.cost; });
+  return estimates;
+}
+
+SegmentEncodingSpec EncodingAdvisor::recommend_segment_encoding(const std::shared_ptr<const AbstractSegment>& segment,
+                                                                const DataType data_type,
+                                                                const SegmentAccessCounter& previous_access_counter) {
+  const auto current_encoding_spec = get_segment_encoding_spec(segment);
+
+  const auto estimates = estimate_encodings(segment, data_type, previous_access_counter);
+  if (estimates.empty()) return current_encoding_spec;
+
+  // Compare with the estimate of the current encoding (instead of its actual size) so that extrapolation errors do not
+  // trigger a re-encoding. Encodings that are not estimated (i.e., LZ4) use the actual size.
+  const auto current_estimate_it =
+      std::find_if(estimates.cbegin(), estimates.cend(),
+                   [&](const auto& estimate) { return estimate.encoding_spec == current_encoding_spec; });
+  const auto current_cost =
+      current_estimate_it != estimates.cend()
+          ? current_estimate_it->cost
+          : static_cast<double>(segment->memory_usage(MemoryUsageCalculationMode::Sampled)) / segment->size() +
+                access_cost(*segment, previous_access_counter, current_encoding_spec);
+
+  const auto& best_estimate = estimates.front();
+  if (best_estimate.cost < current_cost * (1.0 - REENCODING_THRESHOLD)) {
+    return best_estimate.encoding_spec;
+  }
+  return current_encoding_spec;
+}
+
+ChunkEncodingSpec EncodingAdvisor::recommend_chunk_encoding(
+    const std::shared_ptr<const Chunk>& chunk, const std::vector<DataType>& column_data_types,
+    const std::vector<SegmentAccessCounter>& previous_access_counters) {
+  const auto column_count = chunk->column_count();
+  Assert(column_data_types.size() == static_cast<size_t>(column_count),
+         "Number of column types must match the chunk’s column count.");
+  Assert(previous_access_counters.empty() || previous_access_counters.size() == static_cast<size_t>(column_count),
+         "Number of access counters must match the chunk’s column count.");
+
+  const auto no_previous_accesses = SegmentAccessCounter{};
+  auto chunk_encoding_spec = ChunkEncodingSpec{};
+  chunk_encoding_spec.reserve(column_count);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto segment = chunk->get_segment(column_id);
+    const auto& previous_access_counter =
+        previous_access_counters.empty() ? no_previous_accesses : previous_access_counters[column_id];
+    chunk_encoding_spec.push_back(
+        recommend_segment_encoding(segment, column_data_types[column_id], previous_access_counter));
+  }
+  return chunk_encoding_spec;
+}
+
+}  // namespace opossum
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storage/encoding_type.hpp"
+#include "storage/segment_access_counter.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractSegment;
+class Chunk;
+
+/**
+ * Recommends encodings for the segments of immutable chunks based on their data and on how they have been accessed
+ * recently (see SegmentAccessCounter). For each candidate encoding, the advisor estimates
+ *  - the memory usage: Encodings whose size grows linearly with the number of rows (e.g., FrameOfReference or
+ *    RunLength) are applied to a sample of the segment and the result is extrapolated. For dictionary encodings, the
+ *    size of the dictionary is derived from the estimated number of distinct values.
+ *  - the access cost: The sequential and random accesses per row are weighted with the relative cost of accessing a
+ *    single value of the encoding. Only the accesses since the previous_access_counter was taken are considered,
+ *    e.g., since the previous pass of the EncodingAdvisorPlugin. Thus, a segment that is no longer accessed is moved
+ *    to a denser encoding, even if it has been accessed frequently in the past. Without a previous_access_counter,
+ *    all accesses since the creation of the segment are considered.
+ *
+ * The candidate with the lowest combined cost is recommended. Thus, cold segments end up with the smallest encoding,
+ * while frequently accessed segments get a faster one. To prevent segments from being re-encoded back and forth, the
+ * current encoding is kept unless the best candidate is cheaper by more than REENCODING_THRESHOLD.
+ *
+ * LZ4 is not considered, as its compression ratio cannot be derived from a small sample and its decoding is too slow
+ * for segments that are accessed at all.
+ */
+class EncodingAdvisor {
+ public:
+  struct EncodingEstimate {
+    SegmentEncodingSpec encoding_spec;
+
+    // Estimated memory usage of the entire segment in bytes
+    size_t memory_usage;
+
+    // memory_usage per row plus the weighted access cost per row, used to compare the candidates
+    double cost;
+  };
+
+  // Returns the estimates for all candidate encodings that support the data type, ordered by ascending cost
+  static std::vector<EncodingEstimate> estimate_encodings(
+      const std::shared_ptr<const AbstractSegment>& segment, const DataType data_type,
+      const SegmentAccessCounter& previous_access_counter = SegmentAccessCounter{});
+
+  static SegmentEncodingSpec recommend_segment_encoding(
+      const std::shared_ptr<const AbstractSegment>& segment, const DataType data_type,
+      const SegmentAccessCounter& previous_access_counter = SegmentAccessCounter{});
+
+  // @param previous_access_counters holds one counter per column or is empty
+  static ChunkEncodingSpec recommend_chunk_encoding(
+      const std::shared_ptr<const Chunk>& chunk, const std::vector<DataType>& column_data_types,
+      const std::vector<SegmentAccessCounter>& previous_access_counters = {});
+
+  // The sample consists of evenly distributed windows of consecutive values so that runs of values are retained
+  static constexpr auto SAMPLE_WINDOW_COUNT = size_t{16};
+  static constexpr auto SAMPLE_WINDOW_SIZE = size_t{256};
+
+  // Cost of one access per row at a relative access cost of one, in bytes per row
+  static constexpr auto ACCESS_COST_WEIGHT = 0.05;
+
+  // Minimum relative cost reduction for which a segment is re-encoded
+  static constexpr auto REENCODING_THRESHOLD = 0.1;
+};
+
+}  // namespace opossum
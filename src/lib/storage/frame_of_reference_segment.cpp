@@ -10,12 +10,20 @@ namespace opossum {
 template <typename T, typename U>
 FrameOfReferenceSegment<T, U>::FrameOfReferenceSegment(pmr_vector<T> block_minima,
                                                        std::optional<pmr_vector<bool>> null_values,
-                                                       std::unique_ptr<const BaseCompressedVector> offset_values)
+                                                       std::unique_ptr<const BaseCompressedVector> offset_values,
+                                                       std::unique_ptr<const BaseCompressedVector> high_offset_values)
     : AbstractEncodedSegment{data_type_from_type<T>()},
       _block_minima{std::move(block_minima)},
       _null_values{std::move(null_values)},
       _offset_values{std::move(offset_values)},
-      _decompressor{_offset_values->create_base_decompressor()} {}
+      _high_offset_values{std::move(high_offset_values)},
+      _decompressor{_offset_values->create_base_decompressor()} {
+  if (_high_offset_values) {
+    Assert(sizeof(T) > sizeof(uint32_t), "Offsets of 32 bit values always fit into 32 bits.");
+    Assert(_high_offset_values->size() == _offset_values->size(), "Expected a high offset for each offset.");
+    _high_offset_decompressor = _high_offset_values->create_base_decompressor();
+  }
+}
 
 template <typename T, typename U>
 const pmr_vector<T>& FrameOfReferenceSegment<T, U>::block_minima() const {
@@ -32,6 +40,11 @@ const BaseCompressedVector& FrameOfReferenceSegment<T, U>::offset_values() const
   return *_offset_values;
 }
 
+template <typename T, typename U>
+const BaseCompressedVector* FrameOfReferenceSegment<T, U>::high_offset_values() const {
+  return _high_offset_values.get();
+}
+
 template <typename T, typename U>
 AllTypeVariant FrameOfReferenceSegment<T, U>::operator[](const ChunkOffset chunk_offset) const {
   PerformanceWarning("operator[] used");
@@ -54,6 +67,8 @@ std::shared_ptr<AbstractSegment> FrameOfReferenceSegment<T, U>::copy_using_alloc
     const PolymorphicAllocator<size_t>& alloc) const {
   auto new_block_minima = pmr_vector<T>(_block_minima, alloc);
   auto new_offset_values = _offset_values->copy_using_allocator(alloc);
+  auto new_high_offset_values =
+      _high_offset_values ? _high_offset_values->copy_using_allocator(alloc) : nullptr;
 
   std::optional<pmr_vector<bool>> null_values;
   if (_null_values) {
@@ -61,7 +76,8 @@ std::shared_ptr<AbstractSegment> FrameOfReferenceSegment<T, U>::copy_using_alloc
   }
 
   auto copy = std::make_shared<FrameOfReferenceSegment>(std::move(new_block_minima), std::move(null_values),
-                                                        std::move(new_offset_values));
+                                                        std::move(new_offset_values),
+                                                        std::move(new_high_offset_values));
   copy->access_counter = access_counter;
   return copy;
 }
@@ -76,6 +92,10 @@ size_t FrameOfReferenceSegment<T, U>::memory_usage(const MemoryUsageCalculationM
     segment_size += _null_values->capacity() / CHAR_BIT;
   }
 
+  if (_high_offset_values) {
+    segment_size += _high_offset_values->data_size();
+  }
+
   return segment_size;
 }
 
@@ -90,7 +110,6 @@ std::optional<CompressedVectorType> FrameOfReferenceSegment<T, U>::compressed_ve
 }
 
 template class FrameOfReferenceSegment<int32_t>;
-// int64_t disabled for now, as vector compression cannot handle 64 bit values - also in reference_segment_iterable.hpp
-// template class FrameOfReferenceSegment<int64_t>;
+template class FrameOfReferenceSegment<int64_t>;
 
 }  // namespace opossum
@@ -31,9 +31,21 @@ class BaseCompressedVector;
  * offset handling, the minimum of each frame is stored in the
  * offset_values vector at each position that is NULL.
  *
+ * As vector compression handles 32 bit values only, the offsets
+ * of an int64_t segment are split if the values of a block span
+ * more than 2^32: The lower 32 bits are stored in offset_values
+ * and the upper 32 bits in the additional high_offset_values.
+ * The latter are only stored if the segment contains such a wide
+ * block. For narrow blocks, their high offsets are zero, so that
+ * they compress well. Typically, the values of int64_t segments
+ * are close to each other (e.g., timestamps or sequential IDs)
+ * and no high offsets are needed. With SimdBp128 as vector
+ * compression, the bit width of the offsets is chosen for each
+ * block of 128 offsets individually.
+ *
  * std::enable_if_t must be used here and cannot be replaced by a
  * static_assert in order to prevent instantiation of
- * FrameOfReferenceSegment<T> with T other than int32_t. Otherwise,
+ * FrameOfReferenceSegment<T> with T other than int32_t and int64_t. Otherwise,
  * the compiler might instantiate FrameOfReferenceSegment with other
  * types even if they are never actually needed.
  * "If the function selected by overload resolution can be determined
@@ -55,12 +67,16 @@ class FrameOfReferenceSegment : public AbstractEncodedSegment {
   static constexpr auto block_size = 2048u;
 
   explicit FrameOfReferenceSegment(pmr_vector<T> block_minima, std::optional<pmr_vector<bool>> null_values,
-                                   std::unique_ptr<const BaseCompressedVector> offset_values);
+                                   std::unique_ptr<const BaseCompressedVector> offset_values,
+                                   std::unique_ptr<const BaseCompressedVector> high_offset_values = nullptr);
 
   const pmr_vector<T>& block_minima() const;
   const std::optional<pmr_vector<bool>>& null_values() const;
   const BaseCompressedVector& offset_values() const;
 
+  // Upper 32 bits of the offsets, nullptr if all offsets fit into 32 bits
+  const BaseCompressedVector* high_offset_values() const;
+
   /**
    * @defgroup AbstractSegment interface
    * @{
@@ -73,9 +89,17 @@ class FrameOfReferenceSegment : public AbstractEncodedSegment {
     if (_null_values && (*_null_values)[chunk_offset]) {
       return std::nullopt;
     }
+    using UnsignedT = std::make_unsigned_t<T>;
+
     const auto minimum = _block_minima[chunk_offset / block_size];
-    const auto value = static_cast<T>(_decompressor->get(chunk_offset)) + minimum;
-    return value;
+    auto offset = static_cast<UnsignedT>(_decompressor->get(chunk_offset));
+    if constexpr (sizeof(T) > sizeof(uint32_t)) {
+      if (_high_offset_decompressor) {
+        offset |= static_cast<UnsignedT>(_high_offset_decompressor->get(chunk_offset)) << 32u;
+      }
+    }
+    // Offsets of wide blocks might exceed the range of T, so they are added on unsigned values
+    return static_cast<T>(offset + static_cast<UnsignedT>(minimum));
   }
 
   ChunkOffset size() const final;
@@ -100,7 +124,9 @@ class FrameOfReferenceSegment : public AbstractEncodedSegment {
   const pmr_vector<T> _block_minima;
   const std::optional<pmr_vector<bool>> _null_values;
   const std::unique_ptr<const BaseCompressedVector> _offset_values;
+  const std::unique_ptr<const BaseCompressedVector> _high_offset_values;
   std::unique_ptr<BaseVectorDecompressor> _decompressor;
+  std::unique_ptr<BaseVectorDecompressor> _high_offset_decompressor;
 };
 
 }  // namespace opossum
@@ -26,6 +26,9 @@ class FrameOfReferenceEncoder : public SegmentEncoder<FrameOfReferenceEncoder> {
                                                      const PolymorphicAllocator<T>& allocator) {
     static constexpr auto block_size = FrameOfReferenceSegment<T>::block_size;
 
+    // Differences between values are calculated on unsigned values, as they might overflow T
+    using UnsignedT = std::make_unsigned_t<T>;
+
     // Ceiling of integer division
     const auto div_ceil = [](auto x, auto y) { return (x + y - 1u) / y; };
 
@@ -35,13 +38,18 @@ class FrameOfReferenceEncoder : public SegmentEncoder<FrameOfReferenceEncoder> {
     // holds the uncompressed offset values
     auto offset_values = pmr_vector<uint32_t>{allocator};
 
+    // holds the upper 32 bits of the offset values, only filled once a block's values span more than 2^32
+    auto high_offset_values = pmr_vector<uint32_t>{allocator};
+
     // holds whether a segment value is null
     auto null_values = pmr_vector<bool>{allocator};
 
     // used as optional input for the compression of the offset values
     auto max_offset = uint32_t{0u};
+    auto max_high_offset = uint32_t{0u};
 
     auto segment_contains_null_values = false;
+    auto segment_contains_wide_blocks = false;
 
     segment_iterable.with_iterators([&](auto segment_it, auto segment_end) {
       const auto size = std::distance(segment_it, segment_end);
@@ -83,14 +91,20 @@ class FrameOfReferenceEncoder : public SegmentEncoder<FrameOfReferenceEncoder> {
         // The last value block might not be filled completely
         const auto this_value_block_end = value_block_it;
 
-        if (block_contains_values) {
-          // Make sure that the largest offset fits into uint32_t (required for vector compression).
-          Assert(static_cast<std::make_unsigned_t<T>>(max_value - min_value) <= std::numeric_limits<uint32_t>::max(),
-                 "Value range in block must fit into uint32_t.");
-        }
-
         block_minima.push_back(min_value);
 
+        // Vector compression handles 32 bit values only. If the offsets of this block do not fit into 32 bits, their
+        // upper bits are stored separately. From then on, a high offset is stored for every value of the segment.
+        if constexpr (sizeof(T) > sizeof(uint32_t)) {
+          const auto block_range = static_cast<UnsignedT>(max_value) - static_cast<UnsignedT>(min_value);
+          if (block_contains_values && block_range > std::numeric_limits<uint32_t>::max() &&
+              !segment_contains_wide_blocks) {
+            segment_contains_wide_blocks = true;
+            high_offset_values.reserve(offset_values.capacity());
+            high_offset_values.resize(offset_values.size(), uint32_t{0u});
+          }
+        }
+
         value_block_it = current_value_block.begin();
         for (; value_block_it != this_value_block_end; ++value_block_it, ++current_block_null_values_it) {
           auto value = *value_block_it;
@@ -100,21 +114,37 @@ class FrameOfReferenceEncoder : public SegmentEncoder<FrameOfReferenceEncoder> {
             // values are stored as zeros, we might run in an overflow of the uint32_t when minimum > 0.
             value = min_value;
           }
-          const auto offset = static_cast<uint32_t>(value - min_value);
-          offset_values.push_back(offset);
-          max_offset = std::max(max_offset, offset);
+          const auto offset = static_cast<UnsignedT>(static_cast<UnsignedT>(value) - static_cast<UnsignedT>(min_value));
+          offset_values.push_back(static_cast<uint32_t>(offset));
+          max_offset = std::max(max_offset, static_cast<uint32_t>(offset));
+
+          if constexpr (sizeof(T) > sizeof(uint32_t)) {
+            if (segment_contains_wide_blocks) {
+              const auto high_offset = static_cast<uint32_t>(offset >> 32u);
+              high_offset_values.push_back(high_offset);
+              max_high_offset = std::max(max_high_offset, high_offset);
+            }
+          }
         }
       }
     });
 
     auto compressed_offset_values = compress_vector(offset_values, vector_compression_type(), allocator, {max_offset});
 
+    auto compressed_high_offset_values = std::unique_ptr<const BaseCompressedVector>{};
+    if (segment_contains_wide_blocks) {
+      compressed_high_offset_values =
+          compress_vector(high_offset_values, vector_compression_type(), allocator, {max_high_offset});
+    }
+
     if (segment_contains_null_values) {
       return std::make_shared<FrameOfReferenceSegment<T>>(std::move(block_minima), std::move(null_values),
-                                                          std::move(compressed_offset_values));
+                                                          std::move(compressed_offset_values),
+                                                          std::move(compressed_high_offset_values));
     }
     return std::make_shared<FrameOfReferenceSegment<T>>(std::move(block_minima), std::nullopt,
-                                                        std::move(compressed_offset_values));
+                                                        std::move(compressed_offset_values),
+                                                        std::move(compressed_high_offset_values));
   }
 };
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <type_traits>
 
 #include "storage/abstract_segment.hpp"
@@ -22,11 +23,13 @@ class FrameOfReferenceSegmentIterable : public PointAccessibleSegmentIterable<Fr
     resolve_compressed_vector_type(_segment.offset_values(), [&](const auto& offset_values) {
       using OffsetValueDecompressor = std::decay_t<decltype(offset_values.create_decompressor())>;
 
-      auto begin = Iterator<OffsetValueDecompressor>{&_segment.block_minima(), &_segment.null_values(),
-                                                     offset_values.create_decompressor(), ChunkOffset{0}};
+      auto begin =
+          Iterator<OffsetValueDecompressor>{&_segment.block_minima(), &_segment.null_values(),
+                                            offset_values.create_decompressor(), _create_high_offset_decompressor(),
+                                            ChunkOffset{0}};
 
       auto end = Iterator<OffsetValueDecompressor>{&_segment.block_minima(), &_segment.null_values(),
-                                                   offset_values.create_decompressor(),
+                                                   offset_values.create_decompressor(), nullptr,
                                                    static_cast<ChunkOffset>(_segment.size())};
 
       functor(begin, end);
@@ -42,10 +45,10 @@ class FrameOfReferenceSegmentIterable : public PointAccessibleSegmentIterable<Fr
 
       auto begin = PointAccessIterator<OffsetValueDecompressor, PosListIteratorType>{
           &_segment.block_minima(), &_segment.null_values(), offset_values.create_decompressor(),
-          position_filter->cbegin(), position_filter->cbegin()};
+          _create_high_offset_decompressor(), position_filter->cbegin(), position_filter->cbegin()};
 
       auto end = PointAccessIterator<OffsetValueDecompressor, PosListIteratorType>{
-          &_segment.block_minima(), &_segment.null_values(), offset_values.create_decompressor(),
+          &_segment.block_minima(), &_segment.null_values(), offset_values.create_decompressor(), nullptr,
           position_filter->cbegin(), position_filter->cend()};
 
       functor(begin, end);
@@ -57,6 +60,28 @@ class FrameOfReferenceSegmentIterable : public PointAccessibleSegmentIterable<Fr
  private:
   const FrameOfReferenceSegment<T>& _segment;
 
+  // Most segments do not store high offsets. To avoid instantiating the iterators for each combination of compressed
+  // vector types, the high offsets are decompressed via the virtual interface of the decompressor.
+  std::shared_ptr<BaseVectorDecompressor> _create_high_offset_decompressor() const {
+    const auto* high_offset_values = _segment.high_offset_values();
+    if (!high_offset_values) return nullptr;
+    return high_offset_values->create_base_decompressor();
+  }
+
+  static T _decode(const T block_minimum, const uint32_t offset_value,
+                   const std::shared_ptr<BaseVectorDecompressor>& high_offset_decompressor,
+                   const ChunkOffset chunk_offset) {
+    using UnsignedT = std::make_unsigned_t<T>;
+
+    auto offset = static_cast<UnsignedT>(offset_value);
+    if constexpr (sizeof(T) > sizeof(uint32_t)) {
+      if (high_offset_decompressor) {
+        offset |= static_cast<UnsignedT>(high_offset_decompressor->get(chunk_offset)) << 32u;
+      }
+    }
+    return static_cast<T>(offset + static_cast<UnsignedT>(block_minimum));
+  }
+
  private:
   template <typename OffsetValueDecompressor>
   class Iterator : public AbstractSegmentIterator<Iterator<OffsetValueDecompressor>, SegmentPosition<T>> {
@@ -66,10 +91,12 @@ class FrameOfReferenceSegmentIterable : public PointAccessibleSegmentIterable<Fr
 
    public:
     explicit Iterator(const pmr_vector<T>* block_minima, const std::optional<pmr_vector<bool>>* null_values,
-                      OffsetValueDecompressor offset_value_decompressor, ChunkOffset chunk_offset)
+                      OffsetValueDecompressor offset_value_decompressor,
+                      std::shared_ptr<BaseVectorDecompressor> high_offset_decompressor, ChunkOffset chunk_offset)
         : _block_minima{block_minima},
           _null_values{null_values},
           _offset_value_decompressor{std::move(offset_value_decompressor)},
+          _high_offset_decompressor{std::move(high_offset_decompressor)},
           _chunk_offset{chunk_offset} {}
 
    private:
@@ -93,7 +120,7 @@ class FrameOfReferenceSegmentIterable : public PointAccessibleSegmentIterable<Fr
       const auto is_null = *_null_values ? (**_null_values)[_chunk_offset] : false;
       const auto block_minimum = (*_block_minima)[_chunk_offset / block_size];
       const auto offset_value = _offset_value_decompressor.get(_chunk_offset);
-      const auto value = static_cast<T>(offset_value) + block_minimum;
+      const auto value = _decode(block_minimum, offset_value, _high_offset_decompressor, _chunk_offset);
 
       return SegmentPosition<T>{value, is_null, _chunk_offset};
     }
@@ -102,6 +129,7 @@ class FrameOfReferenceSegmentIterable : public PointAccessibleSegmentIterable<Fr
     const pmr_vector<T>* _block_minima;
     const std::optional<pmr_vector<bool>>* _null_values;
     mutable OffsetValueDecompressor _offset_value_decompressor;
+    std::shared_ptr<BaseVectorDecompressor> _high_offset_decompressor;
     ChunkOffset _chunk_offset;
   };
 
@@ -114,14 +142,16 @@ class FrameOfReferenceSegmentIterable : public PointAccessibleSegmentIterable<Fr
     using IterableType = FrameOfReferenceSegmentIterable<T>;
 
     PointAccessIterator(const pmr_vector<T>* block_minima, const std::optional<pmr_vector<bool>>* null_values,
-                        OffsetValueDecompressor offset_value_decompressor, PosListIteratorType position_filter_begin,
-                        PosListIteratorType position_filter_it)
+                        OffsetValueDecompressor offset_value_decompressor,
+                        std::shared_ptr<BaseVectorDecompressor> high_offset_decompressor,
+                        PosListIteratorType position_filter_begin, PosListIteratorType position_filter_it)
         : AbstractPointAccessSegmentIterator<PointAccessIterator<OffsetValueDecompressor, PosListIteratorType>,
                                              SegmentPosition<T>, PosListIteratorType>{std::move(position_filter_begin),
                                                                                       std::move(position_filter_it)},
           _block_minima{block_minima},
           _null_values{null_values},
-          _offset_value_decompressor{std::move(offset_value_decompressor)} {}
+          _offset_value_decompressor{std::move(offset_value_decompressor)},
+          _high_offset_decompressor{std::move(high_offset_decompressor)} {}
 
    private:
     friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
@@ -135,7 +165,7 @@ class FrameOfReferenceSegmentIterable : public PointAccessibleSegmentIterable<Fr
       const auto is_null = *_null_values ? (**_null_values)[current_offset] : false;
       const auto block_minimum = (*_block_minima)[current_offset / block_size];
       const auto offset_value = _offset_value_decompressor.get(current_offset);
-      const auto value = static_cast<T>(offset_value) + block_minimum;
+      const auto value = _decode(block_minimum, offset_value, _high_offset_decompressor, current_offset);
 
       return SegmentPosition<T>{value, is_null, chunk_offsets.offset_in_poslist};
     }
@@ -144,6 +174,7 @@ class FrameOfReferenceSegmentIterable : public PointAccessibleSegmentIterable<Fr
     const pmr_vector<T>* _block_minima;
     const std::optional<pmr_vector<bool>>* _null_values;
     mutable OffsetValueDecompressor _offset_value_decompressor;
+    std::shared_ptr<BaseVectorDecompressor> _high_offset_decompressor;
   };
 };
 
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string_view>
+
+#include "abstract_encoded_segment.hpp"
+#include "fsst_segment/fsst_symbol_table.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "storage/vector_compression/base_vector_decompressor.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseCompressedVector;
+
+/**
+ * @brief Segment implementing FSST-style string compression
+ *
+ * All strings of the segment are compressed with a single static symbol table (see FSSTSymbolTable), which replaces
+ * frequent substrings of up to eight bytes by one-byte codes. As opposed to LZ4, each string is compressed
+ * independently. Thus, a single value can be accessed by decompressing only its own codes. Unlike dictionary
+ * encoding, this also compresses columns with many distinct values (e.g., URLs).
+ *
+ * The codes of all values are stored consecutively in compressed_values. The codes of the value at ChunkOffset i start
+ * at offsets[i] and end at offsets[i + 1] (or at the end of compressed_values for the last value). The offsets are
+ * compressed using vector compression. NULL values are stored as empty code sequences and marked in null_values. If
+ * the segment does not contain NULL values, null_values is std::nullopt.
+ */
+template <typename T>
+class FSSTSegment : public AbstractEncodedSegment {
+ public:
+  explicit FSSTSegment(const FSSTSymbolTable& symbol_table, pmr_vector<char> compressed_values,
+                       std::unique_ptr<const BaseCompressedVector> offsets,
+                       std::optional<pmr_vector<bool>> null_values);
+
+  const FSSTSymbolTable& symbol_table() const;
+  const pmr_vector<char>& compressed_values() const;
+  const BaseCompressedVector& offsets() const;
+  const std::optional<pmr_vector<bool>>& null_values() const;
+
+  /**
+   * @defgroup AbstractSegment interface
+   * @{
+   */
+
+  AllTypeVariant operator[](const ChunkOffset chunk_offset) const final;
+
+  std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const {
+    // performance critical - not in cpp to help with inlining
+    if (_null_values && (*_null_values)[chunk_offset]) {
+      return std::nullopt;
+    }
+
+    const auto begin = _decompressor->get(chunk_offset);
+    const auto end = chunk_offset + 1u < size() ? _decompressor->get(chunk_offset + 1u) : _compressed_values.size();
+    auto value = T{};
+    _symbol_table.decompress(std::string_view{_compressed_values.data() + begin, end - begin}, value);
+    return value;
+  }
+
+  ChunkOffset size() const final;
+
+  std::shared_ptr<AbstractSegment> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const final;
+
+  size_t memory_usage(const MemoryUsageCalculationMode) const final;
+
+  /**@}*/
+
+  /**
+   * @defgroup AbstractEncodedSegment interface
+   * @{
+   */
+
+  EncodingType encoding_type() const final;
+  std::optional<CompressedVectorType> compressed_vector_type() const final;
+
+  /**@}*/
+
+ private:
+  const FSSTSymbolTable _symbol_table;
+  const pmr_vector<char> _compressed_values;
+  const std::unique_ptr<const BaseCompressedVector> _offsets;
+  const std::optional<pmr_vector<bool>> _null_values;
+  std::unique_ptr<BaseVectorDecompressor> _decompressor;
+};
+
+}  // namespace opossum
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include "storage/base_segment_encoder.hpp"
+#include "storage/fsst_segment.hpp"
+#include "storage/fsst_segment/fsst_symbol_table.hpp"
+#include "storage/value_segment.hpp"
+#include "storage/value_segment/value_segment_iterable.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/enum_constant.hpp"
+
+namespace opossum {
+
+/**
+ * Encodes a string segment into an FSSTSegment. The symbol table is built from a sample of the segment's values and
+ * then used to compress every value of the segment independently.
+ */
+class FSSTEncoder : public SegmentEncoder<FSSTEncoder> {
+ public:
+  static constexpr auto _encoding_type = enum_c<EncodingType, EncodingType::FSST>;
+  static constexpr auto _uses_vector_compression = true;  // see base_segment_encoder.hpp for details
+
+  /**
+   * Building the symbol table requires multiple passes over the sample. As in the original FSST paper, a sample of
+   * 16 KB suffices to find the frequent substrings of a segment.
+   */
+  static constexpr auto _sample_size = size_t{16384u};
+
+  template <typename T>
+  std::shared_ptr<AbstractEncodedSegment> _on_encode(const AnySegmentIterable<T> segment_iterable,
+                                                     const PolymorphicAllocator<T>& allocator) {
+    auto values = std::vector<T>{};
+    auto null_values = pmr_vector<bool>{allocator};
+    auto segment_contains_null = false;
+    auto total_value_size = size_t{0};
+
+    segment_iterable.with_iterators([&](auto it, auto end) {
+      const auto segment_size = static_cast<size_t>(std::distance(it, end));
+      values.reserve(segment_size);
+      null_values.reserve(segment_size);
+
+      for (; it != end; ++it) {
+        const auto segment_value = *it;
+        const auto is_null = segment_value.is_null();
+        values.emplace_back(is_null ? T{} : segment_value.value());
+        null_values.push_back(is_null);
+        segment_contains_null |= is_null;
+        total_value_size += values.back().size();
+      }
+    });
+
+    // Sample every n-th value so that the sample covers the entire segment, but does not exceed the sample size by
+    // much
+    const auto sample_stride = std::max(size_t{1}, total_value_size / _sample_size);
+    auto sample = std::vector<std::string_view>{};
+    for (auto value_index = size_t{0}; value_index < values.size(); value_index += sample_stride) {
+      sample.emplace_back(values[value_index]);
+    }
+
+    const auto symbol_table = FSSTSymbolTable::build(sample);
+
+    auto compressed_values = pmr_vector<char>{allocator};
+    auto offsets = pmr_vector<uint32_t>{allocator};
+    offsets.reserve(values.size());
+
+    for (const auto& value : values) {
+      Assert(compressed_values.size() <= std::numeric_limits<uint32_t>::max(),
+             "Compressed values of FSSTSegment exceed the maximum offset");
+      offsets.push_back(static_cast<uint32_t>(compressed_values.size()));
+      symbol_table.compress(value, compressed_values);
+    }
+    compressed_values.shrink_to_fit();
+
+    const auto max_offset = offsets.empty() ? uint32_t{0} : offsets.back();
+    auto compressed_offsets = compress_vector(offsets, vector_compression_type(), allocator, {max_offset});
+
+    auto optional_null_values = segment_contains_null ? std::optional<pmr_vector<bool>>{std::move(null_values)}
+                                                      : std::nullopt;
+
+    return std::make_shared<FSSTSegment<T>>(symbol_table, std::move(compressed_values), std::move(compressed_offsets),
+                                            std::move(optional_null_values));
+  }
+};
+
+}  // namespace opossum
@@ -0,0 +1,168 @@
+#pragma once
+
+#include <string_view>
+#include <type_traits>
+
+#include "storage/fsst_segment.hpp"
+#include "storage/segment_iterables.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+
+namespace opossum {
+
+/**
+ * Iterates over the values of an FSSTSegment. If DecompressValues is false, the iterable does not decompress the
+ * values, but returns the codes of each value as a std::string_view (or an empty view for NULL values). This is used
+ * to evaluate predicates on the compressed representation (see FSSTSymbolTable).
+ */
+template <typename T, bool DecompressValues = true>
+class FSSTSegmentIterable : public PointAccessibleSegmentIterable<FSSTSegmentIterable<T, DecompressValues>> {
+ public:
+  using IteratedValueType = std::conditional_t<DecompressValues, T, std::string_view>;
+  using ValueType = IteratedValueType;
+
+  explicit FSSTSegmentIterable(const FSSTSegment<T>& segment) : _segment{segment} {}
+
+  template <typename Functor>
+  void _on_with_iterators(const Functor& functor) const {
+    _segment.access_counter[SegmentAccessCounter::AccessType::Sequential] += _segment.size();
+    resolve_compressed_vector_type(_segment.offsets(), [&](const auto& offsets) {
+      using OffsetDecompressor = std::decay_t<decltype(offsets.create_decompressor())>;
+
+      auto begin = Iterator<OffsetDecompressor>{&_segment.symbol_table(), &_segment.compressed_values(),
+                                                &_segment.null_values(), offsets.create_decompressor(),
+                                                ChunkOffset{0}};
+      auto end = Iterator<OffsetDecompressor>{&_segment.symbol_table(), &_segment.compressed_values(),
+                                              &_segment.null_values(), offsets.create_decompressor(),
+                                              static_cast<ChunkOffset>(_segment.size())};
+
+      functor(begin, end);
+    });
+  }
+
+  template <typename Functor, typename PosListType>
+  void _on_with_iterators(const std::shared_ptr<PosListType>& position_filter, const Functor& functor) const {
+    _segment.access_counter[SegmentAccessCounter::access_type(*position_filter)] += position_filter->size();
+    resolve_compressed_vector_type(_segment.offsets(), [&](const auto& offsets) {
+      using OffsetDecompressor = std::decay_t<decltype(offsets.create_decompressor())>;
+      using PosListIteratorType = std::decay_t<decltype(position_filter->cbegin())>;
+
+      auto begin = PointAccessIterator<OffsetDecompressor, PosListIteratorType>{
+          &_segment.symbol_table(),      &_segment.compressed_values(), &_segment.null_values(),
+          offsets.create_decompressor(), position_filter->cbegin(),     position_filter->cbegin()};
+      auto end = PointAccessIterator<OffsetDecompressor, PosListIteratorType>{
+          &_segment.symbol_table(),      &_segment.compressed_values(), &_segment.null_values(),
+          offsets.create_decompressor(), position_filter->cbegin(),     position_filter->cend()};
+
+      functor(begin, end);
+    });
+  }
+
+  size_t _on_size() const { return _segment.size(); }
+
+ private:
+  const FSSTSegment<T>& _segment;
+
+  // Returns the (decompressed) value at chunk_offset. Shared by both iterator types.
+  template <typename OffsetDecompressor>
+  static IteratedValueType _value(const FSSTSymbolTable& symbol_table, const pmr_vector<char>& compressed_values,
+                                  OffsetDecompressor& offset_decompressor, const ChunkOffset chunk_offset) {
+    const auto begin = offset_decompressor.get(chunk_offset);
+    const auto end = chunk_offset + size_t{1} < offset_decompressor.size() ? offset_decompressor.get(chunk_offset + 1)
+                                                                            : compressed_values.size();
+    const auto codes = std::string_view{compressed_values.data() + begin, end - begin};
+
+    if constexpr (DecompressValues) {
+      auto value = T{};
+      symbol_table.decompress(codes, value);
+      return value;
+    } else {
+      return codes;
+    }
+  }
+
+ private:
+  template <typename OffsetDecompressor>
+  class Iterator : public AbstractSegmentIterator<Iterator<OffsetDecompressor>, SegmentPosition<IteratedValueType>> {
+   public:
+    using ValueType = IteratedValueType;
+    using IterableType = FSSTSegmentIterable<T, DecompressValues>;
+
+   public:
+    explicit Iterator(const FSSTSymbolTable* symbol_table, const pmr_vector<char>* compressed_values,
+                      const std::optional<pmr_vector<bool>>* null_values, OffsetDecompressor offset_decompressor,
+                      ChunkOffset chunk_offset)
+        : _symbol_table{symbol_table},
+          _compressed_values{compressed_values},
+          _null_values{null_values},
+          _offset_decompressor{std::move(offset_decompressor)},
+          _chunk_offset{chunk_offset} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    void increment() { ++_chunk_offset; }
+
+    void decrement() { --_chunk_offset; }
+
+    void advance(std::ptrdiff_t n) { _chunk_offset += n; }
+
+    bool equal(const Iterator& other) const { return _chunk_offset == other._chunk_offset; }
+
+    std::ptrdiff_t distance_to(const Iterator& other) const {
+      return static_cast<std::ptrdiff_t>(other._chunk_offset) - _chunk_offset;
+    }
+
+    SegmentPosition<IteratedValueType> dereference() const {
+      const auto is_null = *_null_values ? (**_null_values)[_chunk_offset] : false;
+      const auto value = _value(*_symbol_table, *_compressed_values, _offset_decompressor, _chunk_offset);
+      return SegmentPosition<IteratedValueType>{value, is_null, _chunk_offset};
+    }
+
+   private:
+    const FSSTSymbolTable* _symbol_table;
+    const pmr_vector<char>* _compressed_values;
+    const std::optional<pmr_vector<bool>>* _null_values;
+    mutable OffsetDecompressor _offset_decompressor;
+    ChunkOffset _chunk_offset;
+  };
+
+  template <typename OffsetDecompressor, typename PosListIteratorType>
+  class PointAccessIterator
+      : public AbstractPointAccessSegmentIterator<PointAccessIterator<OffsetDecompressor, PosListIteratorType>,
+                                                  SegmentPosition<IteratedValueType>, PosListIteratorType> {
+   public:
+    using ValueType = IteratedValueType;
+    using IterableType = FSSTSegmentIterable<T, DecompressValues>;
+
+    PointAccessIterator(const FSSTSymbolTable* symbol_table, const pmr_vector<char>* compressed_values,
+                        const std::optional<pmr_vector<bool>>* null_values, OffsetDecompressor offset_decompressor,
+                        PosListIteratorType position_filter_begin, PosListIteratorType position_filter_it)
+        : AbstractPointAccessSegmentIterator<PointAccessIterator<OffsetDecompressor, PosListIteratorType>,
+                                             SegmentPosition<IteratedValueType>, PosListIteratorType>{
+              std::move(position_filter_begin), std::move(position_filter_it)},
+          _symbol_table{symbol_table},
+          _compressed_values{compressed_values},
+          _null_values{null_values},
+          _offset_decompressor{std::move(offset_decompressor)} {}
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    SegmentPosition<IteratedValueType> dereference() const {
+      const auto& chunk_offsets = this->chunk_offsets();
+      const auto current_offset = chunk_offsets.offset_in_referenced_chunk;
+
+      const auto is_null = *_null_values ? (**_null_values)[current_offset] : false;
+      const auto value = _value(*_symbol_table, *_compressed_values, _offset_decompressor, current_offset);
+      return SegmentPosition<IteratedValueType>{value, is_null, chunk_offsets.offset_in_poslist};
+    }
+
+   private:
+    const FSSTSymbolTable* _symbol_table;
+    const pmr_vector<char>* _compressed_values;
+    const std::optional<pmr_vector<bool>>* _null_values;
+    mutable OffsetDecompressor _offset_decompressor;
+  };
+};
+
+}  // namespace opossum
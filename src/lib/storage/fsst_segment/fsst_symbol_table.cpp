@@ -0,0 +1,169 @@
+#include "fsst_symbol_table.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// The number of generations was chosen as in the original FSST paper. Later generations hardly improve the table.
+constexpr auto GENERATION_COUNT = 5;
+
+// While building the table, the counters use codes 0 to 255 for escaped bytes and 256 + c for the symbol with code c.
+constexpr auto BYTE_COUNT = size_t{256};
+constexpr auto COUNTER_CODE_COUNT = BYTE_COUNT + FSSTSymbolTable::MAX_SYMBOL_COUNT;
+
+}  // namespace
+
+FSSTSymbolTable::FSSTSymbolTable(const std::vector<std::string_view>& symbols) : _symbol_count(symbols.size()) {
+  Assert(_symbol_count <= MAX_SYMBOL_COUNT, "Too many symbols for FSSTSymbolTable");
+
+  for (auto code = size_t{0}; code < _symbol_count; ++code) {
+    const auto& symbol = symbols[code];
+    Assert(!symbol.empty() && symbol.size() <= MAX_SYMBOL_LENGTH, "Invalid length of FSST symbol");
+    std::copy(symbol.cbegin(), symbol.cend(), _symbols[code].begin());
+    _symbol_lengths[code] = static_cast<uint8_t>(symbol.size());
+  }
+
+  auto code = size_t{0};
+  for (auto byte = size_t{0}; byte < BYTE_COUNT; ++byte) {
+    _first_byte_begin[byte] = static_cast<uint16_t>(code);
+    for (; code < _symbol_count && static_cast<uint8_t>(_symbols[code][0]) == byte; ++code) {
+      Assert(code == _first_byte_begin[byte] || _symbol_lengths[code] <= _symbol_lengths[code - 1],
+             "FSST symbols with the same first byte have to be sorted by descending length");
+    }
+  }
+  _first_byte_begin[BYTE_COUNT] = static_cast<uint16_t>(code);
+  Assert(code == _symbol_count, "FSST symbols have to be sorted by their first byte");
+}
+
+FSSTSymbolTable FSSTSymbolTable::build(const std::vector<std::string_view>& sample) {
+  auto symbol_table = FSSTSymbolTable{};
+
+  auto single_counts = std::vector<uint32_t>(COUNTER_CODE_COUNT);
+  auto pair_counts = std::vector<uint32_t>(COUNTER_CODE_COUNT * COUNTER_CODE_COUNT);
+
+  for (auto generation = 0; generation < GENERATION_COUNT; ++generation) {
+    std::fill(single_counts.begin(), single_counts.end(), uint32_t{0});
+    std::fill(pair_counts.begin(), pair_counts.end(), uint32_t{0});
+
+    // Compress the sample with the current table and count how often each symbol and each pair of adjacent symbols
+    // occurs
+    for (const auto& value : sample) {
+      auto previous_counter_code = std::optional<size_t>{};
+      for (auto position = size_t{0}; position < value.size();) {
+        const auto first_byte = static_cast<uint8_t>(value[position]);
+        const auto code = symbol_table._find_longest_symbol(value.substr(position));
+
+        auto counter_code = size_t{first_byte};
+        auto length = size_t{1};
+        if (code != ESCAPE_CODE) {
+          counter_code = BYTE_COUNT + code;
+          length = symbol_table._symbol_lengths[code];
+
+          // Also count the first byte on its own, so that frequent bytes can become single-byte symbols
+          if (length > 1) ++single_counts[first_byte];
+        }
+
+        ++single_counts[counter_code];
+        if (previous_counter_code) ++pair_counts[*previous_counter_code * COUNTER_CODE_COUNT + counter_code];
+
+        previous_counter_code = counter_code;
+        position += length;
+      }
+    }
+
+    const auto counter_code_symbol = [&](const size_t counter_code) {
+      if (counter_code < BYTE_COUNT) return std::string(1, static_cast<char>(counter_code));
+      return std::string{symbol_table.symbol(static_cast<uint8_t>(counter_code - BYTE_COUNT))};
+    };
+
+    // The gain of a candidate is the number of sample bytes it would have covered. Escaped bytes and single-byte
+    // symbols share the same candidate.
+    auto gains = std::unordered_map<std::string, uint64_t>{};
+    for (auto first_counter_code = size_t{0}; first_counter_code < COUNTER_CODE_COUNT; ++first_counter_code) {
+      if (single_counts[first_counter_code] == 0) continue;
+
+      const auto first_symbol = counter_code_symbol(first_counter_code);
+      gains[first_symbol] += uint64_t{single_counts[first_counter_code]} * first_symbol.size();
+
+      if (first_symbol.size() == MAX_SYMBOL_LENGTH) continue;
+
+      for (auto second_counter_code = size_t{0}; second_counter_code < COUNTER_CODE_COUNT; ++second_counter_code) {
+        const auto pair_count = pair_counts[first_counter_code * COUNTER_CODE_COUNT + second_counter_code];
+        if (pair_count == 0) continue;
+
+        const auto second_symbol = counter_code_symbol(second_counter_code);
+        const auto concatenation = (first_symbol + second_symbol).substr(0, MAX_SYMBOL_LENGTH);
+        gains[concatenation] += uint64_t{pair_count} * concatenation.size();
+      }
+    }
+
+    // Pick the candidates with the highest gains. Ties are broken by the symbol to make the table deterministic.
+    auto candidates = std::vector<std::pair<std::string, uint64_t>>{gains.begin(), gains.end()};
+    std::sort(candidates.begin(), candidates.end(), [](const auto& lhs, const auto& rhs) {
+      return std::tie(rhs.second, lhs.first) < std::tie(lhs.second, rhs.first);
+    });
+    candidates.resize(std::min(candidates.size(), MAX_SYMBOL_COUNT));
+
+    std::sort(candidates.begin(), candidates.end(), [](const auto& lhs, const auto& rhs) {
+      const auto lhs_first_byte = static_cast<uint8_t>(lhs.first[0]);
+      const auto rhs_first_byte = static_cast<uint8_t>(rhs.first[0]);
+      const auto lhs_length = lhs.first.size();
+      const auto rhs_length = rhs.first.size();
+      return std::tie(lhs_first_byte, rhs_length, lhs.first) < std::tie(rhs_first_byte, lhs_length, rhs.first);
+    });
+
+    auto symbols = std::vector<std::string_view>{};
+    symbols.reserve(candidates.size());
+    for (const auto& candidate : candidates) {
+      symbols.emplace_back(candidate.first);
+    }
+    symbol_table = FSSTSymbolTable{symbols};
+  }
+
+  return symbol_table;
+}
+
+size_t FSSTSymbolTable::symbol_count() const { return _symbol_count; }
+
+std::string_view FSSTSymbolTable::symbol(const uint8_t code) const {
+  DebugAssert(code < _symbol_count, "Invalid FSST code");
+  return std::string_view{_symbols[code].data(), _symbol_lengths[code]};
+}
+
+void FSSTSymbolTable::compress(const std::string_view value, pmr_vector<char>& codes) const {
+  for (auto position = size_t{0}; position < value.size();) {
+    const auto code = _find_longest_symbol(value.substr(position));
+    codes.push_back(static_cast<char>(code));
+
+    if (code == ESCAPE_CODE) {
+      codes.push_back(value[position]);
+      ++position;
+    } else {
+      position += _symbol_lengths[code];
+    }
+  }
+}
+
+uint8_t FSSTSymbolTable::_find_longest_symbol(const std::string_view value) const {
+  const auto first_byte = static_cast<uint8_t>(value[0]);
+  for (auto code = _first_byte_begin[first_byte]; code < _first_byte_begin[first_byte + 1]; ++code) {
+    const auto length = _symbol_lengths[code];
+    if (length <= value.size() && std::memcmp(value.data(), _symbols[code].data(), length) == 0) {
+      return static_cast<uint8_t>(code);
+    }
+  }
+
+  return ESCAPE_CODE;
+}
+
+}  // namespace opossum
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Static symbol table as used by FSST (Fast Static Symbol Table) string compression, see Boncz et al.: "FSST: Fast
+ * Random Access String Compression", VLDB 2020.
+ *
+ * A symbol table maps up to 255 one-byte codes to symbols of one to eight bytes. A string is compressed by greedily
+ * replacing the longest symbol that matches at the current position with its code. Bytes that are not covered by any
+ * symbol are emitted as the ESCAPE_CODE, followed by the byte itself. Each string is compressed independently from
+ * all other strings, which allows for random access into compressed data.
+ *
+ * As the compression is deterministic, two strings are equal if and only if their compressed representations are
+ * equal. Thus, equality predicates can be evaluated without decompressing the scanned values.
+ */
+class FSSTSymbolTable {
+ public:
+  static constexpr auto MAX_SYMBOL_LENGTH = size_t{8};
+  static constexpr auto MAX_SYMBOL_COUNT = size_t{255};
+  static constexpr auto ESCAPE_CODE = uint8_t{255};
+
+  // Creates an empty symbol table, which escapes every byte
+  FSSTSymbolTable() = default;
+
+  // Creates a symbol table from the given symbols, e.g., when importing a segment. The code of symbols[i] is i. Symbols
+  // have to be sorted by their first byte and, for equal first bytes, by descending length. This way, the first symbol
+  // that matches at a position of a string is the longest match.
+  explicit FSSTSymbolTable(const std::vector<std::string_view>& symbols);
+
+  // Builds a symbol table that compresses the given sample strings well. The table is built in multiple generations.
+  // In each generation, the sample is compressed with the table of the previous generation. Then, the symbols and the
+  // concatenations of adjacent symbols that yield the highest gain (i.e., the number of bytes covered by them) form
+  // the next generation's table.
+  static FSSTSymbolTable build(const std::vector<std::string_view>& sample);
+
+  size_t symbol_count() const;
+  std::string_view symbol(const uint8_t code) const;
+
+  // Appends the compressed representation of value to codes
+  void compress(const std::string_view value, pmr_vector<char>& codes) const;
+
+  // Implemented in hpp for performance reasons (to allow inlining)
+  template <typename String>
+  void decompress(const std::string_view codes, String& value) const {
+    value.clear();
+    for (auto code_index = size_t{0}; code_index < codes.size(); ++code_index) {
+      const auto code = static_cast<uint8_t>(codes[code_index]);
+      if (code == ESCAPE_CODE) {
+        ++code_index;
+        value.push_back(codes[code_index]);
+      } else {
+        value.append(_symbols[code].data(), _symbol_lengths[code]);
+      }
+    }
+  }
+
+  // Returns whether the decompressed value of codes starts with prefix. Only the codes that are needed to produce the
+  // first prefix.size() bytes are decompressed.
+  bool decompressed_value_starts_with(const std::string_view codes, const std::string_view prefix) const {
+    auto prefix_position = size_t{0};
+    for (auto code_index = size_t{0}; code_index < codes.size() && prefix_position < prefix.size(); ++code_index) {
+      const auto code = static_cast<uint8_t>(codes[code_index]);
+      if (code == ESCAPE_CODE) {
+        ++code_index;
+        if (codes[code_index] != prefix[prefix_position]) return false;
+        ++prefix_position;
+      } else {
+        const auto compared_length = std::min(size_t{_symbol_lengths[code]}, prefix.size() - prefix_position);
+        if (prefix.compare(prefix_position, compared_length, _symbols[code].data(), compared_length) != 0) {
+          return false;
+        }
+        prefix_position += compared_length;
+      }
+    }
+
+    return prefix_position == prefix.size();
+  }
+
+ private:
+  // Returns the code of the longest symbol that is a prefix of value, or ESCAPE_CODE if there is none
+  uint8_t _find_longest_symbol(const std::string_view value) const;
+
+  std::array<std::array<char, MAX_SYMBOL_LENGTH>, MAX_SYMBOL_COUNT> _symbols{};
+  std::array<uint8_t, MAX_SYMBOL_COUNT> _symbol_lengths{};
+  size_t _symbol_count{0};
+
+  // The symbols starting with byte b are stored at the codes [_first_byte_begin[b], _first_byte_begin[b + 1])
+  std::array<uint16_t, 257> _first_byte_begin{};
+};
+
+}  // namespace opossum
@@ -68,6 +68,16 @@ bool MvccData::compare_exchange_tid(const ChunkOffset offset, TransactionID expe
   return _tids[offset].compare_exchange_strong(expected_transaction_id, new_transaction_id);
 }
 
+void MvccData::register_insert() { _pending_inserts.fetch_add(1, std::memory_order_seq_cst); }
+
+void MvccData::deregister_insert() {
+  // Releases the begin_cids written by the Insert to threads that observe the decremented count
+  const auto previous_pending_inserts = _pending_inserts.fetch_sub(1, std::memory_order_release);
+  DebugAssert(previous_pending_inserts > 0, "Insert was not registered");
+}
+
+uint32_t MvccData::pending_inserts() const { return _pending_inserts.load(std::memory_order_acquire); }
+
 size_t MvccData::memory_usage() const {
   auto bytes = size_t{0};
   bytes += sizeof(_tids) + sizeof(_begin_cids) + sizeof(_end_cids);  // NOLINT
@@ -45,6 +45,15 @@ struct MvccData {
   bool compare_exchange_tid(const ChunkOffset offset, TransactionID expected_transaction_id,
                             TransactionID new_transaction_id);
 
+  /**
+   * Inserts register for every chunk they reserve rows in (while holding the table's append mutex) and deregister
+   * once they have committed or rolled back, i.e., once they have written the begin_cids of their rows. A full chunk
+   * without pending inserts is not modified by Inserts anymore (see ChunkCompressionTask::chunk_is_completed).
+   */
+  void register_insert();
+  void deregister_insert();
+  uint32_t pending_inserts() const;
+
   size_t memory_usage() const;
 
  private:
@@ -52,6 +61,8 @@ struct MvccData {
   pmr_vector<CommitID> _begin_cids;                  // < commit id when record was added
   pmr_vector<CommitID> _end_cids;                    // < commit id when record was deleted
   pmr_vector<copyable_atomic<TransactionID>> _tids;  // < 0 unless locked by a transaction
+
+  std::atomic_uint32_t _pending_inserts{0};
 };
 
 std::ostream& operator<<(std::ostream& stream, const MvccData& mvcc_data);
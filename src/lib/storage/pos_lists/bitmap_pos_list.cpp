@@ -0,0 +1,45 @@
+#include "bitmap_pos_list.hpp"
+
+namespace opossum {
+
+BitmapPosList::BitmapPosList(const ChunkID common_chunk_id, Bitmap bitmap)
+    : _common_chunk_id(common_chunk_id), _bitmap(std::move(bitmap)), _ranks(_bitmap.size()) {
+  DebugAssert(_common_chunk_id != INVALID_CHUNK_ID, "Cannot create BitmapPosList for INVALID_CHUNK_ID");
+
+  for (auto word_index = size_t{0}; word_index < _bitmap.size(); ++word_index) {
+    _ranks[word_index] = static_cast<uint32_t>(_size);
+    _size += static_cast<size_t>(__builtin_popcountll(_bitmap[word_index]));
+  }
+}
+
+bool BitmapPosList::is_preferable(const size_t match_count, const size_t chunk_size) {
+  // A bitmap with its rank directory takes 12 bytes per 64 rows of the chunk. We require it to be at least four times
+  // smaller than the corresponding RowIDPosList, i.e., at least ~10% of the rows have to match.
+  constexpr auto MIN_MEMORY_SAVING_FACTOR = size_t{4};
+  const auto bitmap_size = word_count(chunk_size) * (sizeof(uint64_t) + sizeof(uint32_t));
+  return match_count * sizeof(RowID) >= bitmap_size * MIN_MEMORY_SAVING_FACTOR;
+}
+
+bool BitmapPosList::references_single_chunk() const { return true; }
+
+ChunkID BitmapPosList::common_chunk_id() const { return _common_chunk_id; }
+
+const BitmapPosList::Bitmap& BitmapPosList::bitmap() const { return _bitmap; }
+
+bool BitmapPosList::empty() const { return _size == 0; }
+
+size_t BitmapPosList::size() const { return _size; }
+
+size_t BitmapPosList::memory_usage(const MemoryUsageCalculationMode) const {
+  return sizeof(*this) + _bitmap.capacity() * sizeof(uint64_t) + _ranks.capacity() * sizeof(uint32_t);
+}
+
+BitmapPosList::Iterator BitmapPosList::begin() const { return Iterator(this, 0); }
+
+BitmapPosList::Iterator BitmapPosList::end() const { return Iterator(this, size()); }
+
+BitmapPosList::Iterator BitmapPosList::cbegin() const { return begin(); }
+
+BitmapPosList::Iterator BitmapPosList::cend() const { return end(); }
+
+}  // namespace opossum
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <algorithm>
+#include <tuple>
+#include <utility>
+
+#include "abstract_pos_list.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// The BitmapPosList references rows of a single chunk using one bit per row of that chunk: bit i of the bitmap is set
+// if the row at ChunkOffset i is contained. Positions are ordered by their ChunkOffset. For dense matches (as produced
+// by table scans with a low selectivity), this takes much less memory than a RowIDPosList, which stores eight bytes
+// per match.
+//
+// To provide random access to the n-th position, the list keeps a rank directory with the number of set bits in front
+// of each 64-bit word of the bitmap. Accessing a position thus requires a binary search over the directory. Iterators
+// only search the directory when they are created or moved by more than one position. Otherwise, they walk the words
+// of the bitmap.
+class BitmapPosList final : public AbstractPosList {
+ public:
+  using Bitmap = pmr_vector<uint64_t>;
+
+  static constexpr auto BITS_PER_WORD = size_t{64};
+
+  class Iterator : public boost::iterator_facade<Iterator, RowID, boost::random_access_traversal_tag, RowID> {
+   public:
+    Iterator(const BitmapPosList* pos_list, const size_t index) : _pos_list(pos_list) { _seek(index); }
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    void increment() {
+      ++_index;
+
+      // Clear the bit of the current position and move on to the next word with set bits if none are left
+      _word &= _word - 1;
+      while (_word == 0 && ++_word_index < _pos_list->_bitmap.size()) {
+        _word = _pos_list->_bitmap[_word_index];
+      }
+    }
+
+    void decrement() { _seek(_index - 1); }
+
+    void advance(std::ptrdiff_t n) {
+      if (n == 1) {
+        increment();
+        return;
+      }
+      _seek(_index + n);
+    }
+
+    bool equal(const Iterator& other) const {
+      DebugAssert(_pos_list == other._pos_list, "Iterator compared to iterator on different BitmapPosList instance");
+      return _index == other._index;
+    }
+
+    std::ptrdiff_t distance_to(const Iterator& other) const {
+      return static_cast<std::ptrdiff_t>(other._index) - static_cast<std::ptrdiff_t>(_index);
+    }
+
+    RowID dereference() const {
+      DebugAssert(_index < _pos_list->size(), "past-the-end BitmapPosList::Iterator dereferenced");
+      const auto chunk_offset = _word_index * BITS_PER_WORD + static_cast<size_t>(__builtin_ctzll(_word));
+      return RowID{_pos_list->_common_chunk_id, static_cast<ChunkOffset>(chunk_offset)};
+    }
+
+    void _seek(const size_t index) {
+      _index = index;
+      if (index >= _pos_list->size()) {
+        _word_index = _pos_list->_bitmap.size();
+        _word = 0;
+        return;
+      }
+      std::tie(_word_index, _word) = _pos_list->_locate(index);
+    }
+
+    const BitmapPosList* _pos_list;
+    size_t _index{0};
+
+    // The word that contains the current position, with the bits of the preceding positions cleared
+    size_t _word_index{0};
+    uint64_t _word{0};
+  };
+
+  // Bit i of `bitmap[i / BITS_PER_WORD]` is set if the row at ChunkOffset i is contained. The bitmap must not contain
+  // bits for rows that did not exist in the chunk when the pos list was created (cf. EntireChunkPosList).
+  BitmapPosList(const ChunkID common_chunk_id, Bitmap bitmap);
+
+  // Number of words needed for a bitmap that covers chunk_size rows
+  static size_t word_count(const size_t chunk_size) { return (chunk_size + BITS_PER_WORD - 1) / BITS_PER_WORD; }
+
+  // Returns whether a BitmapPosList for match_count matches within a chunk of chunk_size rows should be preferred over
+  // a RowIDPosList. As random access into a BitmapPosList is more expensive than into a RowIDPosList, we only use it
+  // if it saves a substantial amount of memory.
+  static bool is_preferable(const size_t match_count, const size_t chunk_size);
+
+  bool references_single_chunk() const final;
+  ChunkID common_chunk_id() const final;
+
+  // Implemented in hpp for performance reasons (to allow inlining)
+  RowID operator[](const size_t index) const final {
+    DebugAssert(index < _size, "BitmapPosList index out of range");
+
+    const auto [word_index, word] = _locate(index);
+    const auto chunk_offset = word_index * BITS_PER_WORD + static_cast<size_t>(__builtin_ctzll(word));
+    return RowID{_common_chunk_id, static_cast<ChunkOffset>(chunk_offset)};
+  }
+
+  // Returns whether the row at the given ChunkOffset is contained
+  bool contains(const ChunkOffset chunk_offset) const {
+    const auto word_index = chunk_offset / BITS_PER_WORD;
+    if (word_index >= _bitmap.size()) return false;
+    return (_bitmap[word_index] >> (chunk_offset % BITS_PER_WORD)) & uint64_t{1};
+  }
+
+  // Returns the number of contained rows in front of the given ChunkOffset, which is the position of that row in the
+  // pos list if it is contained.
+  size_t rank(const ChunkOffset chunk_offset) const {
+    const auto word_index = chunk_offset / BITS_PER_WORD;
+    if (word_index >= _bitmap.size()) return _size;
+
+    const auto bit_index = chunk_offset % BITS_PER_WORD;
+    const auto preceding_bits = _bitmap[word_index] & ((uint64_t{1} << bit_index) - 1);
+    return _ranks[word_index] + static_cast<size_t>(__builtin_popcountll(preceding_bits));
+  }
+
+  const Bitmap& bitmap() const;
+
+  bool empty() const final;
+  size_t size() const final;
+  size_t memory_usage(const MemoryUsageCalculationMode) const final;
+
+  Iterator begin() const;
+  Iterator end() const;
+  Iterator cbegin() const;
+  Iterator cend() const;
+
+ private:
+  // Returns the index of the word that contains the index-th set bit and that word with the preceding bits cleared
+  std::pair<size_t, uint64_t> _locate(const size_t index) const {
+    // The word is the last one with less than index + 1 bits in front
+    const auto word_index =
+        static_cast<size_t>(std::upper_bound(_ranks.cbegin(), _ranks.cend(), index) - _ranks.cbegin()) - 1;
+    auto word = _bitmap[word_index];
+    for (auto remaining_bits = index - _ranks[word_index]; remaining_bits > 0; --remaining_bits) {
+      word &= word - 1;
+    }
+    return {word_index, word};
+  }
+
+  const ChunkID _common_chunk_id;
+  const Bitmap _bitmap;
+
+  // Number of set bits in front of each word of the bitmap
+  pmr_vector<uint32_t> _ranks;
+  size_t _size{0};
+};
+
+}  // namespace opossum
@@ -6,10 +6,12 @@
 #include <vector>
 
 #include "resolve_type.hpp"
+#include "storage/alp_segment.hpp"
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/fixed_string_dictionary_segment.hpp"
 #include "storage/frame_of_reference_segment.hpp"
+#include "storage/fsst_segment.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/run_length_segment.hpp"
 #include "storage/segment_accessor.hpp"
@@ -67,11 +69,22 @@ class ReferenceSegmentIterable : public SegmentIterable<ReferenceSegmentIterable
 #endif
 
 #ifdef HYRISE_ERASE_FRAMEOFREFERENCE
-          if constexpr (std::is_same_v<T, int32_t>) {
+          if constexpr (encoding_supports_data_type(enum_c<EncodingType, EncodingType::FrameOfReference>,
+                                                    hana::type_c<T>)) {
             if constexpr (std::is_same_v<SegmentType, FrameOfReferenceSegment<T>>) return;
           }
 #endif
 
+#ifdef HYRISE_ERASE_FSST
+          if constexpr (std::is_same_v<SegmentType, FSSTSegment<T>>) return;
+#endif
+
+#ifdef HYRISE_ERASE_ALP
+          if constexpr (encoding_supports_data_type(enum_c<EncodingType, EncodingType::ALP>, hana::type_c<T>)) {
+            if constexpr (std::is_same_v<SegmentType, ALPSegment<T>>) return;
+          }
+#endif
+
           // Always erase LZ4Segment accessors
           if constexpr (std::is_same_v<SegmentType, LZ4Segment<T>>) return;
 
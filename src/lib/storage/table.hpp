@@ -171,7 +171,8 @@ class Table : private Noncopyable {
 
   /**
    * Tables, typically those stored in the StorageManager, can be associated with statistics to perform Cardinality
-   * estimation during optimization.
+   * estimation during optimization. As the statistics can be replaced in the background (see
+   * update_table_statistics()), they are accessed atomically.
    * @{
    */
   std::shared_ptr<TableStatistics> table_statistics() const;
@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "hyrise.hpp"
+#include "statistics/update_table_statistics.hpp"
 #include "storage/chunk.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/table.hpp"
@@ -13,11 +14,13 @@
 
 namespace opossum {
 
-ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const ChunkID chunk_id)
-    : ChunkCompressionTask{table_name, std::vector<ChunkID>{chunk_id}} {}
+ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const ChunkID chunk_id,
+                                           const std::optional<ChunkEncodingSpec>& chunk_encoding_spec)
+    : ChunkCompressionTask{table_name, std::vector<ChunkID>{chunk_id}, chunk_encoding_spec} {}
 
-ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids)
-    : _table_name{table_name}, _chunk_ids{chunk_ids} {}
+ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids,
+                                           const std::optional<ChunkEncodingSpec>& chunk_encoding_spec)
+    : _table_name{table_name}, _chunk_ids{chunk_ids}, _chunk_encoding_spec{chunk_encoding_spec} {}
 
 void ChunkCompressionTask::_on_execute() {
   auto table = Hyrise::get().storage_manager.get_table(_table_name);
@@ -32,26 +35,34 @@ void ChunkCompressionTask::_on_execute() {
     // TODO(anyone): It is unclear if this restriction is really necessary. If it becomes a problem and we decide to
     // get rid of it, we should make sure that a new mutable chunk is created first so that inserts do not end up in
     // the chunk being compressed.
-    DebugAssert(_chunk_is_completed(chunk, table->target_chunk_size()),
+    DebugAssert(chunk_is_completed(chunk, table->target_chunk_size()),
                 "Chunk is not completed and thus can’t be compressed.");
 
-    ChunkEncoder::encode_chunk(chunk, table->column_data_types());
+    if (chunk->is_mutable()) {
+      // Insert checks whether the last chunk is mutable while holding the append mutex
+      const auto append_lock = table->acquire_append_mutex();
+      chunk->finalize();
+    }
+
+    if (_chunk_encoding_spec) {
+      ChunkEncoder::encode_chunk(chunk, table->column_data_types(), *_chunk_encoding_spec);
+    } else {
+      ChunkEncoder::encode_chunk(chunk, table->column_data_types());
+    }
   }
+
+  // Fold the now immutable chunks into the table's statistics
+  update_table_statistics(table);
 }
 
-bool ChunkCompressionTask::_chunk_is_completed(const std::shared_ptr<Chunk>& chunk, const uint32_t target_chunk_size) {
+bool ChunkCompressionTask::chunk_is_completed(const std::shared_ptr<const Chunk>& chunk,
+                                              const uint32_t target_chunk_size) {
   if (chunk->size() != target_chunk_size) return false;
 
+  // The Inserts into the chunk register before growing it (see Insert::_on_execute). Thus, once the chunk is observed
+  // to be full, all Inserts that will ever write to it have registered, and only their deregistration is pending.
   const auto& mvcc_data = chunk->mvcc_data();
-
-  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < target_chunk_size; ++chunk_offset) {
-    // TODO(anybody) Reading the non-atomic begin_cid (which is written to in Insert without a write lock) is likely UB
-    //               When activating the ChunkCompressionTask, please look for a different means of determining whether
-    //               all Inserts to a Chunk finished.
-    if (mvcc_data->get_begin_cid(chunk_offset) == MvccData::MAX_COMMIT_ID) return false;
-  }
-
-  return true;
+  return !mvcc_data || mvcc_data->pending_inserts() == 0;
 }
 
 }  // namespace opossum
@@ -0,0 +1,43 @@
+#include "memory_budget_setting.hpp"
+
+#include <boost/lexical_cast.hpp>
+
+#include "hyrise.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+MemoryBudgetSetting::MemoryBudgetSetting() : AbstractSetting(NAME), _value("0"), _budget(0) {}
+
+const std::string& MemoryBudgetSetting::description() const {
+  static const auto description =
+      std::string{"Bytes that each operator may use before it spills intermediate results to disk (0: unlimited). "
+                  "The budget is per operator, not per query."};
+  return description;
+}
+
+const std::string& MemoryBudgetSetting::get() { return _value; }
+
+void MemoryBudgetSetting::set(const std::string& value) {
+  auto budget = size_t{0};
+  try {
+    budget = boost::lexical_cast<size_t>(value);
+  } catch (const boost::bad_lexical_cast&) {
+    Fail("Memory budget must be a number of bytes, got '" + value + "'");
+  }
+
+  _value = value;
+  _budget = budget;
+}
+
+std::optional<size_t> MemoryBudgetSetting::operator_memory_budget() {
+  const auto& settings_manager = Hyrise::get().settings_manager;
+  if (!settings_manager.has_setting(NAME)) return std::nullopt;
+
+  const auto setting = std::static_pointer_cast<MemoryBudgetSetting>(settings_manager.get_setting(NAME));
+  const auto budget = setting->_budget.load();
+  if (budget == 0) return std::nullopt;
+  return budget;
+}
+
+}  // namespace opossum
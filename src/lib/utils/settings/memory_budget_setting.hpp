@@ -0,0 +1,45 @@
+#pragma once
+
+#include <atomic>
+#include <optional>
+#include <string>
+
+#include "utils/settings/abstract_setting.hpp"
+
+namespace opossum {
+
+/**
+ * Limits the memory (in bytes) that a single memory-intensive operator may use for its intermediate data structures. If
+ * JoinHash, AggregateHash, or Sort estimate that they would exceed the budget, they write their radix partitions,
+ * partial aggregates, or sorted runs to temporary files (see SpillFile) and process them one after another. This makes
+ * queries slower, but keeps large intermediates from exhausting the memory of the process. JoinHash decides before
+ * materializing its inputs, using the input row counts as an upper bound, and then spills each chunk right after it has
+ * been partitioned. Without radix partitions, it cannot spill and issues a PerformanceWarning.
+ *
+ * The budget applies to each operator on its own, not to the query as a whole: if a query (or multiple concurrent
+ * queries) runs N of these operators at the same time, they may use up to N times the budget together. Tracking a
+ * shared per-query budget would require the operators to know their query and to coordinate their reservations.
+ *
+ * The setting is registered by Hyrise. A value of 0 (the default) disables the budget.
+ */
+class MemoryBudgetSetting : public AbstractSetting {
+ public:
+  static constexpr auto NAME = "Operators.memory_budget";
+
+  MemoryBudgetSetting();
+
+  const std::string& description() const final;
+
+  const std::string& get() final;
+
+  void set(const std::string& value) final;
+
+  // Returns the budget of the current Hyrise instance or std::nullopt if there is none.
+  static std::optional<size_t> operator_memory_budget();
+
+ private:
+  std::string _value;
+  std::atomic<size_t> _budget;
+};
+
+}  // namespace opossum
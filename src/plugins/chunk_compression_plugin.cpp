@@ -0,0 +1,71 @@
+#include "chunk_compression_plugin.hpp"
+
+#include <vector>
+
+#include "storage/chunk.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/table.hpp"
+#include "tasks/chunk_compression_task.hpp"
+
+namespace opossum {
+
+std::string ChunkCompressionPlugin::description() const { return "Background chunk compression plugin"; }
+
+void ChunkCompressionPlugin::start() {
+  _loop_thread_compression =
+      std::make_unique<PausableLoopThread>(IDLE_DELAY_COMPRESSION, [&](size_t) { _compression_loop(); });
+}
+
+void ChunkCompressionPlugin::stop() {
+  // Call destructor of PausableLoopThread to terminate its thread
+  _loop_thread_compression.reset();
+}
+
+void ChunkCompressionPlugin::_compression_loop() {
+  const auto tables = Hyrise::get().storage_manager.tables();
+
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (const auto& [table_name, table] : tables) {
+    if (table->type() != TableType::Data || table->uses_mvcc() != UseMvcc::Yes) continue;
+
+    const auto target_chunk_size = table->target_chunk_size();
+    const auto chunk_count = table->chunk_count();
+
+    auto chunk_ids = std::vector<ChunkID>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (!chunk || !chunk->is_mutable()) continue;
+
+      if (ChunkCompressionTask::chunk_is_completed(chunk, target_chunk_size)) {
+        chunk_ids.emplace_back(chunk_id);
+      }
+    }
+
+    if (!chunk_ids.empty()) {
+      tasks.emplace_back(std::make_shared<ChunkCompressionTask>(table_name, chunk_ids, _table_encoding_spec(table)));
+    }
+  }
+
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(tasks);
+}
+
+std::optional<ChunkEncodingSpec> ChunkCompressionPlugin::_table_encoding_spec(
+    const std::shared_ptr<const Table>& table) {
+  for (auto chunk_id = table->chunk_count(); chunk_id > 0; --chunk_id) {
+    const auto chunk = table->get_chunk(ChunkID{chunk_id - 1});
+    if (!chunk || chunk->is_mutable() || !chunk->pruning_statistics()) continue;
+
+    auto chunk_encoding_spec = ChunkEncodingSpec{};
+    const auto column_count = chunk->column_count();
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      chunk_encoding_spec.emplace_back(get_segment_encoding_spec(chunk->get_segment(column_id)));
+    }
+    return chunk_encoding_spec;
+  }
+
+  return std::nullopt;
+}
+
+EXPORT_PLUGIN(ChunkCompressionPlugin)
+
+}  // namespace opossum
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "hyrise.hpp"
+#include "storage/encoding_type.hpp"
+#include "utils/abstract_plugin.hpp"
+#include "utils/pausable_loop_thread.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+class Table;
+
+/*
+ * Inserts append rows to the last chunk of a table until it reaches the target chunk size. Afterwards, the chunk
+ * remains mutable and unencoded, so insert-heavy tables accumulate large amounts of uncompressed data. This plugin
+ * periodically looks for such chunks and, once all inserts into them have been committed or rolled back, schedules
+ * ChunkCompressionTasks that finalize and encode them and generate their pruning statistics.
+ *
+ * Tables do not store an encoding configuration. Instead, a chunk is encoded like the most recent chunk of its table
+ * that has been encoded explicitly (i.e., that has pruning statistics). For tables without such a chunk, the default
+ * encoding is used.
+ */
+class ChunkCompressionPlugin : public AbstractPlugin {
+  friend class ChunkCompressionPluginTest;
+
+ public:
+  std::string description() const final;
+
+  void start() final;
+
+  void stop() final;
+
+  constexpr static std::chrono::milliseconds IDLE_DELAY_COMPRESSION = std::chrono::milliseconds(1'000);
+
+ private:
+  void _compression_loop();
+
+  static std::optional<ChunkEncodingSpec> _table_encoding_spec(const std::shared_ptr<const Table>& table);
+
+  std::unique_ptr<PausableLoopThread> _loop_thread_compression;
+};
+
+}  // namespace opossum
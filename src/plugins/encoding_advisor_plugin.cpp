@@ -0,0 +1,103 @@
+#include "encoding_advisor_plugin.hpp"
+
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include "statistics/generate_pruning_statistics.hpp"
+#include "storage/chunk.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/encoding_advisor.hpp"
+#include "storage/segment_access_counter.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+std::string EncodingAdvisorPlugin::description() const { return "Automatic segment encoding plugin"; }
+
+void EncodingAdvisorPlugin::start() {
+  _loop_thread_reencoding =
+      std::make_unique<PausableLoopThread>(IDLE_DELAY_REENCODING, [&](size_t) { _reencoding_loop(); });
+}
+
+void EncodingAdvisorPlugin::stop() {
+  // Call destructor of PausableLoopThread to terminate its thread
+  _loop_thread_reencoding.reset();
+}
+
+void EncodingAdvisorPlugin::_reencoding_loop() {
+  const auto tables = Hyrise::get().storage_manager.tables();
+
+  // Snapshots of segments that are not visited in this pass (e.g., because they have been replaced) are dropped
+  auto next_snapshots = AccessCounterSnapshots{};
+
+  for (const auto& [table_name, table] : tables) {
+    const auto column_data_types = table->column_data_types();
+    const auto chunk_count = table->chunk_count();
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+
+      // Mutable chunks are still being inserted into, logically deleted chunks will be removed soon anyway
+      if (!chunk || chunk->is_mutable() || chunk->get_cleanup_commit_id()) continue;
+
+      // An exception would terminate the loop thread. Skip the chunk instead, it keeps its current encoding.
+      try {
+        _reencode_chunk(chunk, column_data_types, next_snapshots);
+      } catch (const std::exception& exception) {
+        auto message = std::ostringstream{};
+        message << "Skipped chunk " << chunk_id << " of " << table_name << ": " << exception.what();
+        Hyrise::get().log_manager.add_message("EncodingAdvisorPlugin", message.str(), LogLevel::Warning);
+      }
+    }
+  }
+
+  _access_counter_snapshots = std::move(next_snapshots);
+}
+
+void EncodingAdvisorPlugin::_reencode_chunk(const std::shared_ptr<Chunk>& chunk,
+                                            const std::vector<DataType>& column_data_types,
+                                            AccessCounterSnapshots& next_snapshots) const {
+  const auto column_count = chunk->column_count();
+
+  // Segments without a snapshot have not been seen by a previous pass, so all of their accesses are considered. The
+  // previous snapshots are kept in case the chunk is skipped because of an exception.
+  auto segments = std::vector<std::shared_ptr<AbstractSegment>>{};
+  auto previous_access_counters = std::vector<SegmentAccessCounter>(column_count);
+  segments.reserve(column_count);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    segments.emplace_back(chunk->get_segment(column_id));
+    const auto snapshot_it = _access_counter_snapshots.find(segments.back());
+    if (snapshot_it == _access_counter_snapshots.cend()) continue;
+
+    previous_access_counters[column_id] = snapshot_it->second;
+    next_snapshots.insert_or_assign(segments.back(), snapshot_it->second);
+  }
+
+  const auto chunk_encoding_spec =
+      EncodingAdvisor::recommend_chunk_encoding(chunk, column_data_types, previous_access_counters);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto& segment = segments[column_id];
+    if (get_segment_encoding_spec(segment) == chunk_encoding_spec[column_id]) {
+      next_snapshots.insert_or_assign(segment, segment->access_counter);
+      continue;
+    }
+
+    // The counters of the previous segment are not carried over. They would include accesses from before the previous
+    // pass, which are not relevant for the next decision.
+    const auto encoded_segment =
+        ChunkEncoder::encode_segment(segment, column_data_types[column_id], chunk_encoding_spec[column_id]);
+    chunk->replace_segment(column_id, encoded_segment);
+    next_snapshots.insert_or_assign(encoded_segment, SegmentAccessCounter{});
+  }
+
+  // Pruning statistics do not depend on the encoding. Chunks that have never been encoded might lack them, though.
+  if (!chunk->pruning_statistics()) {
+    generate_chunk_pruning_statistics(chunk);
+  }
+}
+
+EXPORT_PLUGIN(EncodingAdvisorPlugin)
+
+}  // namespace opossum
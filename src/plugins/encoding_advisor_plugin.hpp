@@ -0,0 +1,62 @@
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "storage/segment_access_counter.hpp"
+#include "utils/abstract_plugin.hpp"
+#include "utils/pausable_loop_thread.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+/*
+ * Periodically asks the EncodingAdvisor for the best encoding of every segment in the immutable chunks of all tables
+ * and re-encodes the chunks whose recommendation differs from their current encoding. Thus, encodings do not have to
+ * be tuned manually per column: cold segments are compressed as much as possible, while segments that are accessed
+ * frequently are moved to encodings that are cheaper to access.
+ *
+ * The decisions are based on the accesses since the previous pass: After each pass, the plugin keeps a snapshot of
+ * the access counters of every segment and passes it to the EncodingAdvisor in the next pass. Thus, a segment that
+ * was frequently accessed in the past can be moved to a denser encoding once the workload changes. Re-encoded segments
+ * start with empty counters, i.e., their accesses are counted from the replacement on.
+ *
+ * Segments are replaced atomically (see Chunk::replace_segment), so concurrently running operators keep working on
+ * the previous segment. If a chunk cannot be re-encoded, it is skipped and a warning is logged.
+ */
+class EncodingAdvisorPlugin : public AbstractPlugin {
+  friend class EncodingAdvisorPluginTest;
+
+ public:
+  std::string description() const final;
+
+  void start() final;
+
+  void stop() final;
+
+  // Sleep after each pass over all tables
+  constexpr static std::chrono::milliseconds IDLE_DELAY_REENCODING = std::chrono::milliseconds(10'000);
+
+ private:
+  // The access counters of the segments at the end of a pass. Segments are referenced weakly, so that the snapshots do
+  // not keep replaced segments alive and a snapshot never matches a new segment that reuses the address.
+  using AccessCounterSnapshots = std::map<std::weak_ptr<const AbstractSegment>, SegmentAccessCounter,
+                                          std::owner_less<std::weak_ptr<const AbstractSegment>>>;
+
+  void _reencoding_loop();
+
+  // Re-encodes the segments of @param chunk and stores the snapshots of its (new) segments in @param next_snapshots
+  void _reencode_chunk(const std::shared_ptr<Chunk>& chunk, const std::vector<DataType>& column_data_types,
+                       AccessCounterSnapshots& next_snapshots) const;
+
+  std::unique_ptr<PausableLoopThread> _loop_thread_reencoding;
+
+  // Only accessed by the loop thread
+  AccessCounterSnapshots _access_counter_snapshots;
+};
+
+}  // namespace opossum
@@ -100,6 +100,10 @@ const SegmentEncodingSpec all_segment_encoding_specs[]{
     {EncodingType::FixedStringDictionary, VectorCompressionType::FixedSizeByteAligned},
     {EncodingType::FixedStringDictionary, VectorCompressionType::SimdBp128},
     {EncodingType::FrameOfReference},
+    {EncodingType::FSST, VectorCompressionType::FixedSizeByteAligned},
+    {EncodingType::FSST, VectorCompressionType::SimdBp128},
+    {EncodingType::ALP, VectorCompressionType::FixedSizeByteAligned},
+    {EncodingType::ALP, VectorCompressionType::SimdBp128},
     {EncodingType::LZ4},
     {EncodingType::RunLength}};
 }  // namespace opossum
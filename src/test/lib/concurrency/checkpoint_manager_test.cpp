@@ -0,0 +1,176 @@
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+
+#include "concurrency/checkpoint_manager.hpp"
+#include "concurrency/write_ahead_log.hpp"
+#include "hyrise.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class CheckpointManagerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    std::filesystem::remove_all(directory);
+    std::remove(log_filename.c_str());
+    Hyrise::get().storage_manager.add_table("table_a", load_table("resources/test_data/tbl/int_float.tbl", 2));
+  }
+
+  void TearDown() override {
+    Hyrise::get().write_ahead_log = nullptr;
+    std::filesystem::remove_all(directory);
+    std::remove(log_filename.c_str());
+  }
+
+  static std::shared_ptr<const Table> execute(const std::string& sql) {
+    auto pipeline = SQLPipelineBuilder{sql}.create_pipeline();
+    const auto [pipeline_status, table] = pipeline.get_result_table();
+    EXPECT_EQ(pipeline_status, SQLPipelineStatus::Success);
+    return table;
+  }
+
+  // Simulates a crash: The in-memory state is lost, only the files on disk remain.
+  static void restart() {
+    Hyrise::get().write_ahead_log = nullptr;
+    Hyrise::reset();
+  }
+
+  static size_t chunk_file_count(const std::filesystem::path& checkpoint_directory) {
+    auto count = size_t{0};
+    for (const auto& entry : std::filesystem::directory_iterator(checkpoint_directory)) {
+      if (entry.path().filename().string().find("_chunk_") != std::string::npos) ++count;
+    }
+    return count;
+  }
+
+  const std::string directory = test_data_path + "checkpoint_manager_test";
+  const std::string log_filename = test_data_path + "checkpoint_manager_test.wal";
+};
+
+TEST_F(CheckpointManagerTest, LoadCheckpoint) {
+  execute("INSERT INTO table_a VALUES (1, 1.5), (2, NULL)");
+  execute("DELETE FROM table_a WHERE a = 123");
+  const auto expected_table = execute("SELECT * FROM table_a");
+  const auto expected_chunk_count = Hyrise::get().storage_manager.get_table("table_a")->chunk_count();
+
+  auto checkpoint_manager = CheckpointManager{directory};
+  EXPECT_EQ(checkpoint_manager.create_checkpoint(), 0);
+
+  // Changes after the snapshot are not part of the checkpoint.
+  execute("INSERT INTO table_a VALUES (3, 3.5)");
+
+  restart();
+
+  EXPECT_EQ(CheckpointManager{directory}.load_latest_checkpoint(), 0);
+  EXPECT_TABLE_EQ_UNORDERED(execute("SELECT * FROM table_a"), expected_table);
+
+  // Rows keep their positions.
+  EXPECT_EQ(Hyrise::get().storage_manager.get_table("table_a")->chunk_count(), expected_chunk_count);
+}
+
+TEST_F(CheckpointManagerTest, EmptyChunkInTheMiddle) {
+  // Tables with an empty chunk in the middle cannot be built using the Table interface. Thus, the segments of the
+  // first chunk are replaced with empty ones.
+  const auto table = Hyrise::get().storage_manager.get_table("table_a");
+  const auto chunk = table->get_chunk(ChunkID{0});
+  chunk->replace_segment(ColumnID{0}, std::make_shared<ValueSegment<int32_t>>(pmr_vector<int32_t>{}));
+  chunk->replace_segment(ColumnID{1}, std::make_shared<ValueSegment<float>>(pmr_vector<float>{}));
+  execute("INSERT INTO table_a VALUES (1, 1.5)");
+  const auto expected_table = execute("SELECT * FROM table_a");
+  const auto expected_chunk_count = table->chunk_count();
+
+  auto checkpoint_manager = CheckpointManager{directory};
+  checkpoint_manager.create_checkpoint();
+
+  restart();
+
+  EXPECT_EQ(CheckpointManager{directory}.load_latest_checkpoint(), 0);
+  EXPECT_TABLE_EQ_UNORDERED(execute("SELECT * FROM table_a"), expected_table);
+
+  // The empty chunk is restored as a removed chunk, so that the following chunks keep their ChunkIDs.
+  const auto loaded_table = Hyrise::get().storage_manager.get_table("table_a");
+  EXPECT_EQ(loaded_table->chunk_count(), expected_chunk_count);
+  EXPECT_FALSE(loaded_table->get_chunk(ChunkID{0}));
+
+  // The restored table accepts new rows.
+  execute("INSERT INTO table_a VALUES (2, 2.5)");
+  EXPECT_EQ(execute("SELECT * FROM table_a")->row_count(), expected_table->row_count() + 1);
+}
+
+TEST_F(CheckpointManagerTest, NoCheckpoint) {
+  EXPECT_EQ(CheckpointManager{directory}.load_latest_checkpoint(), std::nullopt);
+}
+
+TEST_F(CheckpointManagerTest, ReuseUnchangedChunks) {
+  auto checkpoint_manager = CheckpointManager{directory};
+  checkpoint_manager.create_checkpoint();
+  EXPECT_EQ(chunk_file_count(directory + "/checkpoint_0"), 2);
+
+  // Nothing changed, so the second checkpoint refers to the files of the first one.
+  checkpoint_manager.create_checkpoint();
+  EXPECT_EQ(chunk_file_count(directory + "/checkpoint_1"), 0);
+
+  // Only the chunk of the deleted row and the new (mutable) chunk are written.
+  execute("DELETE FROM table_a WHERE a = 123");
+  execute("INSERT INTO table_a VALUES (1, 1.5)");
+  checkpoint_manager.create_checkpoint();
+  EXPECT_EQ(chunk_file_count(directory + "/checkpoint_2"), 2);
+
+  const auto expected_table = execute("SELECT * FROM table_a");
+  restart();
+
+  EXPECT_EQ(CheckpointManager{directory}.load_latest_checkpoint(), 2);
+  EXPECT_TABLE_EQ_UNORDERED(execute("SELECT * FROM table_a"), expected_table);
+}
+
+TEST_F(CheckpointManagerTest, RecoverFromCheckpointAndLog) {
+  Hyrise::get().write_ahead_log = std::make_shared<WriteAheadLog>(log_filename);
+  execute("INSERT INTO table_a VALUES (1, 1.5), (2, 2.5)");
+
+  auto checkpoint_manager = CheckpointManager{directory};
+  const auto checkpoint_id = checkpoint_manager.create_checkpoint();
+
+  // Only these transactions have to be replayed.
+  execute("DELETE FROM table_a WHERE a = 1");
+  execute("INSERT INTO table_a VALUES (3, 3.5)");
+  const auto expected_table = execute("SELECT * FROM table_a");
+
+  restart();
+
+  EXPECT_EQ(CheckpointManager{directory}.load_latest_checkpoint(), checkpoint_id);
+  EXPECT_EQ(WriteAheadLog::recover(log_filename, checkpoint_id), 2);
+  EXPECT_TABLE_EQ_UNORDERED(execute("SELECT * FROM table_a"), expected_table);
+}
+
+TEST_F(CheckpointManagerTest, RecoverAfterCrashBeforeManifestRename) {
+  Hyrise::get().write_ahead_log = std::make_shared<WriteAheadLog>(log_filename);
+  execute("INSERT INTO table_a VALUES (1, 1.5)");
+
+  auto checkpoint_manager = CheckpointManager{directory};
+  const auto first_checkpoint_id = checkpoint_manager.create_checkpoint();
+
+  execute("INSERT INTO table_a VALUES (2, 2.5)");
+  const auto second_checkpoint_id = checkpoint_manager.create_checkpoint();
+  execute("DELETE FROM table_a WHERE a = 1");
+  const auto expected_table = execute("SELECT * FROM table_a");
+
+  // Simulate a crash after the marker of the second checkpoint was logged but before its manifest was renamed
+  const auto second_checkpoint_directory =
+      std::filesystem::path{directory} / ("checkpoint_" + std::to_string(second_checkpoint_id));
+  std::filesystem::rename(second_checkpoint_directory / CheckpointManager::MANIFEST_FILE_NAME,
+                          second_checkpoint_directory / (std::string{CheckpointManager::MANIFEST_FILE_NAME} + ".tmp"));
+
+  restart();
+
+  // The incomplete checkpoint is ignored, the transactions after the first one are replayed
+  EXPECT_EQ(CheckpointManager{directory}.load_latest_checkpoint(), first_checkpoint_id);
+  EXPECT_EQ(WriteAheadLog::recover(log_filename, first_checkpoint_id), 2);
+  EXPECT_TABLE_EQ_UNORDERED(execute("SELECT * FROM table_a"), expected_table);
+}
+
+}  // namespace opossum
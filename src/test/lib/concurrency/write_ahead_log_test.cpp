@@ -0,0 +1,100 @@
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+
+#include "concurrency/write_ahead_log.hpp"
+#include "hyrise.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+
+namespace opossum {
+
+class WriteAheadLogTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    std::remove(filename.c_str());
+    load_base_table();
+  }
+
+  void TearDown() override {
+    Hyrise::get().write_ahead_log = nullptr;
+    std::remove(filename.c_str());
+  }
+
+  // The log refers to the positions of the rows in the tables as they are loaded at startup.
+  static void load_base_table() {
+    Hyrise::get().storage_manager.add_table("table_a", load_table("resources/test_data/tbl/int_float.tbl", 2));
+  }
+
+  static std::shared_ptr<const Table> execute(const std::string& sql) {
+    auto pipeline = SQLPipelineBuilder{sql}.create_pipeline();
+    const auto [pipeline_status, table] = pipeline.get_result_table();
+    EXPECT_EQ(pipeline_status, SQLPipelineStatus::Success);
+    return table;
+  }
+
+  // Simulates a crash: The in-memory state is lost, only the base table and the log remain.
+  void restart() {
+    Hyrise::get().write_ahead_log = nullptr;
+    Hyrise::reset();
+    load_base_table();
+  }
+
+  const std::string filename = test_data_path + "write_ahead_log_test.wal";
+};
+
+TEST_F(WriteAheadLogTest, RecoverCommittedTransactions) {
+  Hyrise::get().write_ahead_log = std::make_shared<WriteAheadLog>(filename);
+
+  execute("INSERT INTO table_a VALUES (1, 1.5), (2, NULL)");
+  execute("DELETE FROM table_a WHERE a = 12345");
+  execute("UPDATE table_a SET b = 7.5 WHERE a = 2");
+  execute("BEGIN; INSERT INTO table_a VALUES (3, 3.5); ROLLBACK;");
+  const auto expected_table = execute("SELECT * FROM table_a");
+
+  restart();
+
+  EXPECT_EQ(WriteAheadLog::recover(filename), 3);
+  EXPECT_TABLE_EQ_UNORDERED(execute("SELECT * FROM table_a"), expected_table);
+}
+
+TEST_F(WriteAheadLogTest, RecoverMultipleSessions) {
+  Hyrise::get().write_ahead_log = std::make_shared<WriteAheadLog>(filename);
+  execute("INSERT INTO table_a VALUES (1, 1.5), (2, 2.5)");
+
+  restart();
+  EXPECT_EQ(WriteAheadLog::recover(filename), 1);
+
+  // The second session deletes a row that was added by the first one and has been replayed.
+  Hyrise::get().write_ahead_log = std::make_shared<WriteAheadLog>(filename);
+  execute("DELETE FROM table_a WHERE a = 1");
+  execute("INSERT INTO table_a VALUES (4, 4.5)");
+  const auto expected_table = execute("SELECT * FROM table_a");
+
+  restart();
+
+  EXPECT_EQ(WriteAheadLog::recover(filename), 3);
+  EXPECT_TABLE_EQ_UNORDERED(execute("SELECT * FROM table_a"), expected_table);
+}
+
+TEST_F(WriteAheadLogTest, IgnoreTornEntry) {
+  Hyrise::get().write_ahead_log = std::make_shared<WriteAheadLog>(filename);
+  execute("INSERT INTO table_a VALUES (1, 1.5)");
+  const auto expected_table = execute("SELECT * FROM table_a");
+  execute("INSERT INTO table_a VALUES (2, 2.5)");
+  Hyrise::get().write_ahead_log = nullptr;
+
+  // Cut off the last entry as if the process had crashed while writing it.
+  std::filesystem::resize_file(filename, std::filesystem::file_size(filename) - 3);
+
+  restart();
+
+  EXPECT_EQ(WriteAheadLog::recover(filename), 1);
+  EXPECT_TABLE_EQ_UNORDERED(execute("SELECT * FROM table_a"), expected_table);
+}
+
+TEST_F(WriteAheadLogTest, NoLogFile) { EXPECT_EQ(WriteAheadLog::recover(filename), 0); }
+
+}  // namespace opossum
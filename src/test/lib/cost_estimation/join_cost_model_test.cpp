@@ -0,0 +1,177 @@
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "cost_estimation/join_cost_model.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/join_index.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class JoinCostModelTest : public BaseTest {
+ public:
+  void SetUp() override {
+    properties.left_row_count = 100.0f;
+    properties.right_row_count = 1'000.0f;
+    properties.output_row_count = 50.0f;
+    properties.index_chunk_count = 10;
+  }
+
+  static std::shared_ptr<Table> create_int_table(const int32_t row_count, const ChunkOffset chunk_size) {
+    const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data,
+                                               chunk_size);
+    for (auto value = int32_t{0}; value < row_count; ++value) {
+      table->append({value});
+    }
+    table->last_chunk()->finalize();
+    return table;
+  }
+
+  static std::shared_ptr<AbstractOperator> execute(const std::shared_ptr<AbstractOperator>& op) {
+    op->execute();
+    return op;
+  }
+
+  JoinCostModel::JoinProperties properties;
+};
+
+TEST_F(JoinCostModelTest, Features) {
+  using Features = JoinCostModel::Features;
+
+  EXPECT_EQ(JoinCostModel::features(OperatorType::JoinHash, properties), Features({1.0, 100.0, 1'000.0, 50.0}));
+  EXPECT_EQ(JoinCostModel::features(OperatorType::JoinNestedLoop, properties),
+            Features({1.0, 100'000.0, 1'100.0, 50.0}));
+
+  // Only the inputs that are not sorted yet need to be sorted
+  const auto sort_merge_features = JoinCostModel::features(OperatorType::JoinSortMerge, properties);
+  EXPECT_DOUBLE_EQ(sort_merge_features[1], 100.0 * std::log2(100.0) + 1'000.0 * std::log2(1'000.0));
+  EXPECT_DOUBLE_EQ(sort_merge_features[2], 1'100.0);
+
+  properties.left_input_sorted = true;
+  EXPECT_DOUBLE_EQ(JoinCostModel::features(OperatorType::JoinSortMerge, properties)[1], 1'000.0 * std::log2(1'000.0));
+
+  // Every probe row is looked up in the index of every chunk of the index side
+  EXPECT_EQ(JoinCostModel::features(OperatorType::JoinIndex, properties), Features({1.0, 1'000.0, 100.0, 50.0}));
+  properties.index_side = IndexSide::Left;
+  EXPECT_EQ(JoinCostModel::features(OperatorType::JoinIndex, properties), Features({1.0, 10'000.0, 1'000.0, 50.0}));
+}
+
+TEST_F(JoinCostModelTest, EstimateCost) {
+  auto join_cost_model = JoinCostModel{};
+  join_cost_model.set_coefficients(OperatorType::JoinHash, {1.0, 2.0, 3.0, 4.0});
+
+  EXPECT_FLOAT_EQ(join_cost_model.estimate_cost(OperatorType::JoinHash, properties), 1.0f + 200.0f + 3'000.0f + 200.0f);
+  EXPECT_THROW(join_cost_model.estimate_cost(OperatorType::TableScan, properties), std::logic_error);
+}
+
+TEST_F(JoinCostModelTest, DefaultCoefficientsPreferIndexForSmallProbeSide) {
+  const auto join_cost_model = JoinCostModel{};
+
+  properties.left_row_count = 10.0f;
+  properties.right_row_count = 1'000'000.0f;
+  properties.output_row_count = 10.0f;
+  properties.index_chunk_count = 16;
+
+  EXPECT_LT(join_cost_model.estimate_cost(OperatorType::JoinIndex, properties) * 10.0f,
+            join_cost_model.estimate_cost(OperatorType::JoinHash, properties));
+}
+
+TEST_F(JoinCostModelTest, Calibrate) {
+  const auto hash_coefficients = JoinCostModel::Coefficients{30'000.0, 20.0, 10.0, 5.0};
+
+  auto samples = std::vector<JoinCostModel::Sample>{};
+  for (const auto left_row_count : {1'000.0f, 10'000.0f, 100'000.0f, 1'000'000.0f}) {
+    for (const auto right_row_count : {1'000.0f, 30'000.0f, 500'000.0f}) {
+      auto sample_properties = JoinCostModel::JoinProperties{};
+      sample_properties.left_row_count = left_row_count;
+      sample_properties.right_row_count = right_row_count;
+      sample_properties.output_row_count = left_row_count * right_row_count / 1'000'000.0f;
+
+      const auto features = JoinCostModel::features(OperatorType::JoinHash, sample_properties);
+      auto runtime = 0.0;
+      for (auto feature_idx = size_t{0}; feature_idx < JoinCostModel::FEATURE_COUNT; ++feature_idx) {
+        runtime += hash_coefficients[feature_idx] * features[feature_idx];
+      }
+
+      samples.emplace_back(JoinCostModel::Sample{OperatorType::JoinHash, sample_properties,
+                                                 std::chrono::nanoseconds{static_cast<int64_t>(runtime)}});
+
+      // A join type whose runtime does not depend on the features
+      samples.emplace_back(
+          JoinCostModel::Sample{OperatorType::JoinSortMerge, sample_properties, std::chrono::nanoseconds{10'000}});
+    }
+  }
+
+  // Too few samples to calibrate JoinIndex
+  samples.resize(samples.size() + 2, JoinCostModel::Sample{OperatorType::JoinIndex, properties,
+                                                           std::chrono::nanoseconds{1'000}});
+
+  auto join_cost_model = JoinCostModel{};
+  const auto index_coefficients = join_cost_model.coefficients(OperatorType::JoinIndex);
+  join_cost_model.calibrate(samples);
+
+  const auto& calibrated_hash_coefficients = join_cost_model.coefficients(OperatorType::JoinHash);
+  for (auto feature_idx = size_t{0}; feature_idx < JoinCostModel::FEATURE_COUNT; ++feature_idx) {
+    EXPECT_NEAR(calibrated_hash_coefficients[feature_idx], hash_coefficients[feature_idx],
+                hash_coefficients[feature_idx] * 0.01);
+  }
+
+  const auto& calibrated_sort_merge_coefficients = join_cost_model.coefficients(OperatorType::JoinSortMerge);
+  EXPECT_NEAR(calibrated_sort_merge_coefficients[0], 10'000.0, 1.0);
+  for (auto feature_idx = size_t{1}; feature_idx < JoinCostModel::FEATURE_COUNT; ++feature_idx) {
+    EXPECT_GE(calibrated_sort_merge_coefficients[feature_idx], 0.0);
+    EXPECT_NEAR(calibrated_sort_merge_coefficients[feature_idx], 0.0, 1e-3);
+  }
+
+  EXPECT_EQ(join_cost_model.coefficients(OperatorType::JoinIndex), index_coefficients);
+}
+
+TEST_F(JoinCostModelTest, SampleFromOperators) {
+  const auto left_table = create_int_table(100, ChunkOffset{50});
+  const auto right_table = create_int_table(10, ChunkOffset{5});
+  ChunkEncoder::encode_all_chunks(right_table);
+  right_table->create_index<GroupKeyIndex>({ColumnID{0}});
+
+  const auto left = execute(std::make_shared<TableWrapper>(left_table));
+  const auto right = execute(std::make_shared<TableWrapper>(right_table));
+  const auto sorted_right =
+      execute(std::make_shared<Sort>(right, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}}}));
+
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+
+  const auto join_hash = std::make_shared<JoinHash>(left, sorted_right, JoinMode::Inner, primary_predicate);
+  join_hash->execute();
+
+  const auto hash_sample = JoinCostModel::sample(*join_hash);
+  EXPECT_EQ(hash_sample.join_type, OperatorType::JoinHash);
+  EXPECT_FLOAT_EQ(hash_sample.properties.left_row_count, 100.0f);
+  EXPECT_FLOAT_EQ(hash_sample.properties.right_row_count, 10.0f);
+  EXPECT_FLOAT_EQ(hash_sample.properties.output_row_count, 10.0f);
+  EXPECT_FALSE(hash_sample.properties.left_input_sorted);
+  EXPECT_TRUE(hash_sample.properties.right_input_sorted);
+  EXPECT_EQ(hash_sample.runtime, join_hash->performance_data->walltime);
+
+  const auto join_index = std::make_shared<JoinIndex>(left, right, JoinMode::Inner, primary_predicate,
+                                                      std::vector<OperatorJoinPredicate>{}, IndexSide::Right);
+  join_index->execute();
+
+  const auto index_sample = JoinCostModel::sample(*join_index);
+  EXPECT_EQ(index_sample.join_type, OperatorType::JoinIndex);
+  EXPECT_EQ(index_sample.properties.index_side, IndexSide::Right);
+  EXPECT_EQ(index_sample.properties.index_chunk_count, 2u);
+  EXPECT_FALSE(index_sample.properties.right_input_sorted);
+
+  // Operators that have not been executed cannot be sampled
+  const auto not_executed_join = std::make_shared<JoinHash>(left, right, JoinMode::Inner, primary_predicate);
+  EXPECT_THROW(JoinCostModel::sample(*not_executed_join), std::logic_error);
+}
+
+}  // namespace opossum
@@ -46,12 +46,57 @@ TEST_F(LikeMatcherTest, Matching) {
   EXPECT_TRUE(match("Hello World!! (Nice day)", "H%(%day)"));
   EXPECT_TRUE(match("Smiley: ^-^", "%^_^%"));
   EXPECT_TRUE(match("Questionmark: ?", "%_?%"));
+  EXPECT_TRUE(match("", ""));
+  EXPECT_TRUE(match("", "%"));
+  EXPECT_TRUE(match("Hello", "%%"));
+  EXPECT_TRUE(match("Hello", "_____"));
+  EXPECT_TRUE(match("Hello", "H%%o"));
+  EXPECT_TRUE(match("xxabcXdefyy", "%abc_def%"));
+  EXPECT_TRUE(match("abcabcXdef", "%abc_def%"));
+  EXPECT_TRUE(match("abcdef abcXdef", "abc%abc_def"));
+  EXPECT_TRUE(match("a.b*c", "a.b*c"));
 }
 
 TEST_F(LikeMatcherTest, NotMatching) {
   EXPECT_FALSE(match("hello", "Hello"));
   EXPECT_FALSE(match("Hello", "Hello_"));
   EXPECT_FALSE(match("Hello", "He_o"));
+  EXPECT_FALSE(match("Hello", ""));
+  EXPECT_FALSE(match("abc", "abc%abc"));
+  EXPECT_FALSE(match("xxabcdefyy", "%abc_def%"));
+  EXPECT_FALSE(match("abcdef", "abc%abc_def"));
+  EXPECT_FALSE(match("Hello", "H%_%_%_%_%_%"));
+  EXPECT_FALSE(match("Hello World", "%World%Hello"));
+}
+
+TEST_F(LikeMatcherTest, LongStrings) {
+  // Exercise the SIMD code paths, which process 32 positions at once, including matches in the remainder and long
+  // segments that do not fit into the bit-parallel automaton
+  const auto long_segment = std::string(100, 'a') + "_";
+  const auto prefix = std::string(70, 'x');
+  for (const auto offset : {size_t{0}, size_t{1}, size_t{31}, size_t{32}, size_t{63}}) {
+    SCOPED_TRACE(offset);
+    const auto value = std::string(offset, 'x') + "needle" + prefix;
+    EXPECT_TRUE(match(value, "%needle%"));
+    EXPECT_TRUE(match(value, "%need%le%"));
+    EXPECT_TRUE(match(value, "%ne_dle%"));
+    EXPECT_FALSE(match(value, "%needles%"));
+    EXPECT_FALSE(match(value, "%ne_dlex_x%y%"));
+
+    const auto long_value = prefix + std::string(offset, 'a') + std::string(100, 'a') + "b" + prefix;
+    EXPECT_TRUE(match(long_value, "%" + long_segment + "%"));
+    EXPECT_FALSE(match(long_value, "%" + long_segment + "y%"));
+  }
+}
+
+TEST_F(LikeMatcherTest, Find) {
+  const auto string = std::string(40, 'x') + "abc" + std::string(40, 'x') + "abc";
+  EXPECT_EQ(LikeMatcher::find(string, "abc"), 40);
+  EXPECT_EQ(LikeMatcher::find(string, "abc", 41), 83);
+  EXPECT_EQ(LikeMatcher::find(string, "abc", 84), std::string_view::npos);
+  EXPECT_EQ(LikeMatcher::find(string, "abd"), std::string_view::npos);
+  EXPECT_EQ(LikeMatcher::find(string, ""), 0);
+  EXPECT_EQ(LikeMatcher::find("", "a"), std::string_view::npos);
 }
 
 }  // namespace opossum
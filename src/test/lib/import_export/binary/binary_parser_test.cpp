@@ -1,3 +1,6 @@
+#include <cmath>
+#include <cstdio>
+#include <limits>
 #include <memory>
 #include <string>
 #include <vector>
@@ -6,6 +9,8 @@
 
 #include "hyrise.hpp"
 #include "import_export/binary/binary_parser.hpp"
+#include "import_export/binary/binary_writer.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/encoding_type.hpp"
 
@@ -359,6 +364,75 @@ TEST_F(BinaryParserTest, AllNullFrameOfReferenceSegment) {
   EXPECT_TABLE_EQ_ORDERED(table, expected_table);
 }
 
+TEST_F(BinaryParserTest, LongFrameOfReferenceSegmentRoundTrip) {
+  const auto filename = test_data_path + "binary_parser_test_long_for.bin";
+
+  auto expected_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Long, true}}, TableType::Data, 3);
+  expected_table->append({int64_t{1'600'000'000'000'000}});
+  expected_table->append({opossum::NULL_VALUE});
+  expected_table->append({int64_t{1'600'000'000'001'000}});
+  expected_table->append({int64_t{-5'000'000'000}});
+  expected_table->append({int64_t{-5'000'000'007}});
+  // The values of the second chunk span more than 2^32, so that its high offsets are stored
+  expected_table->append({std::numeric_limits<int64_t>::max()});
+  expected_table->last_chunk()->finalize();
+  ChunkEncoder::encode_all_chunks(expected_table, SegmentEncodingSpec{EncodingType::FrameOfReference});
+
+  BinaryWriter::write(*expected_table, filename);
+  EXPECT_TABLE_EQ_ORDERED(BinaryParser::parse(filename), expected_table);
+
+  std::remove(filename.c_str());
+}
+
+TEST_F(BinaryParserTest, FSSTSegmentRoundTrip) {
+  const auto filename = test_data_path + "binary_parser_test_fsst.bin";
+
+  auto expected_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::String, true}}, TableType::Data, 3);
+  expected_table->append({"https://hyrise.org/"});
+  expected_table->append({opossum::NULL_VALUE});
+  expected_table->append({""});
+  expected_table->append({"https://hyrise.org/docs"});
+  expected_table->append({"mailto:hyrise@hpi.de"});
+  expected_table->last_chunk()->finalize();
+  ChunkEncoder::encode_all_chunks(expected_table,
+                                  SegmentEncodingSpec{EncodingType::FSST, VectorCompressionType::FixedSizeByteAligned});
+
+  BinaryWriter::write(*expected_table, filename);
+  const auto table = BinaryParser::parse(filename);
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+
+  const auto segment = table->get_chunk(ChunkID{1})->get_segment(ColumnID{0});
+  EXPECT_TRUE(std::dynamic_pointer_cast<FSSTSegment<pmr_string>>(segment));
+
+  std::remove(filename.c_str());
+}
+
+TEST_F(BinaryParserTest, ALPSegmentRoundTrip) {
+  const auto filename = test_data_path + "binary_parser_test_alp.bin";
+
+  auto expected_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Double, true}}, TableType::Data, 3);
+  expected_table->append({12.34});
+  expected_table->append({opossum::NULL_VALUE});
+  expected_table->append({-0.5});
+  expected_table->append({M_PI});
+  expected_table->append({100.0});
+  expected_table->last_chunk()->finalize();
+  ChunkEncoder::encode_all_chunks(expected_table,
+                                  SegmentEncodingSpec{EncodingType::ALP, VectorCompressionType::FixedSizeByteAligned});
+
+  BinaryWriter::write(*expected_table, filename);
+  const auto table = BinaryParser::parse(filename);
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+
+  const auto segment = table->get_chunk(ChunkID{1})->get_segment(ColumnID{0});
+  EXPECT_TRUE(std::dynamic_pointer_cast<ALPSegment<double>>(segment));
+
+  std::remove(filename.c_str());
+}
+
 TEST_F(BinaryParserTest, InvalidEncodingType) {
   auto filename = _reference_filepath + ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".bin";
   EXPECT_THROW(BinaryParser::parse(filename), std::exception);
@@ -422,4 +496,68 @@ TEST_F(BinaryParserTest, SortColumnDefinitions) {
   EXPECT_TRUE(table->get_chunk(ChunkID{2})->individually_sorted_by().empty());
 }
 
+TEST_F(BinaryParserTest, MemoryMappedPageAlignedFile) {
+  const auto filename = test_data_path + "binary_parser_test_page_aligned.bin";
+
+  // Large enough for the dictionaries and attribute vectors to be page-aligned.
+  auto expected_table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::String, false}}, TableType::Data, 6000);
+  for (auto row = int32_t{0}; row < 10'000; ++row) {
+    expected_table->append({row, pmr_string{"value" + std::to_string(row % 3000)}});
+  }
+  expected_table->last_chunk()->finalize();
+  const auto vector_compression_type = VectorCompressionType::FixedSizeByteAligned;
+  ChunkEncoder::encode_all_chunks(expected_table,
+                                  ChunkEncodingSpec{{EncodingType::Dictionary, vector_compression_type},
+                                                    {EncodingType::FixedStringDictionary, vector_compression_type}});
+
+  BinaryWriter::write(*expected_table, filename, BinaryFileLayout::Indexed);
+
+  const auto mapped_table = BinaryParser::parse(filename, UseMmap::Yes);
+  EXPECT_TABLE_EQ_ORDERED(mapped_table, expected_table);
+
+  // The segments use the memory of the mapping.
+  const auto segment = mapped_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  const auto dictionary_segment = std::dynamic_pointer_cast<DictionarySegment<int32_t>>(segment);
+  ASSERT_TRUE(dictionary_segment);
+  EXPECT_NE(dictionary_segment->dictionary()->get_allocator().resource(),
+            boost::container::pmr::get_default_resource());
+
+  // Indexed files can also be read without mapping them and sequential files can be mapped.
+  EXPECT_TABLE_EQ_ORDERED(BinaryParser::parse(filename), expected_table);
+  BinaryWriter::write(*expected_table, filename);
+  EXPECT_TABLE_EQ_ORDERED(BinaryParser::parse(filename, UseMmap::Yes), expected_table);
+
+  // The mapped table stays valid after the file was removed.
+  std::remove(filename.c_str());
+  EXPECT_TABLE_EQ_ORDERED(mapped_table, expected_table);
+}
+
+TEST_F(BinaryParserTest, MemoryMappedIndexedFileWithNodeQueueScheduler) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  const auto filename = test_data_path + "binary_parser_test_node_queue_scheduler.bin";
+
+  // Many chunks whose dictionaries and attribute vectors are large enough to be page-aligned, so that the chunks are
+  // parsed by concurrent tasks that all map parts of the file at the same time.
+  auto expected_table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Long, false}}, TableType::Data, 4096);
+  for (auto row = int32_t{0}; row < 64 * 4096; ++row) {
+    expected_table->append({row % 2000, int64_t{row}});
+  }
+  expected_table->last_chunk()->finalize();
+  ChunkEncoder::encode_all_chunks(expected_table, SegmentEncodingSpec{EncodingType::Dictionary,
+                                                                      VectorCompressionType::FixedSizeByteAligned});
+
+  BinaryWriter::write(*expected_table, filename, BinaryFileLayout::Indexed);
+
+  const auto mapped_table = BinaryParser::parse(filename, UseMmap::Yes);
+  EXPECT_EQ(mapped_table->chunk_count(), expected_table->chunk_count());
+  EXPECT_TABLE_EQ_ORDERED(mapped_table, expected_table);
+
+  std::remove(filename.c_str());
+  EXPECT_TABLE_EQ_ORDERED(mapped_table, expected_table);
+}
+
 }  // namespace opossum
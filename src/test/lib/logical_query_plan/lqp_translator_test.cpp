@@ -1,4 +1,5 @@
 #include <memory>
+#include <numeric>
 #include <optional>
 #include <string>
 #include <utility>
@@ -39,6 +40,7 @@
 #include "operators/import.hpp"
 #include "operators/index_scan.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/join_index.hpp"
 #include "operators/join_nested_loop.hpp"
 #include "operators/join_sort_merge.hpp"
 #include "operators/limit.hpp"
@@ -50,8 +52,10 @@
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
 #include "operators/union_all.hpp"
 #include "operators/union_positions.hpp"
+#include "scheduler/operator_task.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
 #include "storage/prepared_plan.hpp"
@@ -663,6 +667,138 @@ TEST_F(LQPTranslatorTest, JoinNodeToJoinNestedLoop) {
   EXPECT_EQ(join_op->mode(), JoinMode::Inner);
 }
 
+TEST_F(LQPTranslatorTest, JoinNodeToJoinIndex) {
+  const auto add_int_table = [](const std::string& name, const bool indexed) {
+    const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data,
+                                               ChunkOffset{1'000}, UseMvcc::Yes);
+    for (auto value = int32_t{0}; value < 10'000; ++value) {
+      table->append({value});
+    }
+    table->last_chunk()->finalize();
+    ChunkEncoder::encode_all_chunks(table);
+    if (indexed) table->create_index<GroupKeyIndex>({ColumnID{0}});
+    Hyrise::get().storage_manager.add_table(name, table);
+    return StoredTableNode::make(name);
+  };
+
+  const auto indexed_node = add_int_table("indexed_table", true);
+  const auto indexed_a = indexed_node->get_column("a");
+  const auto not_indexed_node = add_int_table("not_indexed_table", false);
+
+  /**
+   * Check PQP - Probing the indexes of the ten chunks of indexed_table with the three rows of table_int_float is
+   * cheaper than building and probing a hash table. The index can be on either side.
+   */
+  const auto join_op_right =
+      std::dynamic_pointer_cast<JoinIndex>(LQPTranslator{}.translate_node(JoinNode::make(
+          JoinMode::Inner, equals_(int_float_a, indexed_a), int_float_node, indexed_node)));
+  ASSERT_TRUE(join_op_right);
+  EXPECT_EQ(join_op_right->index_side(), IndexSide::Right);
+  EXPECT_EQ(join_op_right->primary_predicate().column_ids, ColumnIDPair(ColumnID{0}, ColumnID{0}));
+
+  const auto join_op_left =
+      std::dynamic_pointer_cast<JoinIndex>(LQPTranslator{}.translate_node(JoinNode::make(
+          JoinMode::Inner, equals_(indexed_a, int_float_a), indexed_node, int_float_node)));
+  ASSERT_TRUE(join_op_left);
+  EXPECT_EQ(join_op_left->index_side(), IndexSide::Left);
+
+  // Without an index, JoinHash is used
+  const auto join_op_without_index = LQPTranslator{}.translate_node(JoinNode::make(
+      JoinMode::Inner, equals_(int_float_a, not_indexed_node->get_column("a")), int_float_node, not_indexed_node));
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinHash>(join_op_without_index));
+}
+
+TEST_F(LQPTranslatorTest, JoinNodeToJoinIndexOnValidatedLeftInput) {
+  // The join column is the second column of the indexed table. As both columns are indexed, probing the index of the
+  // wrong column would produce wrong results.
+  const auto table = std::make_shared<Table>(
+      TableColumnDefinitions{{"b", DataType::Int, false}, {"a", DataType::Int, false}}, TableType::Data,
+      ChunkOffset{1'000}, UseMvcc::Yes);
+  for (auto chunk_begin = int32_t{0}; chunk_begin < 10'000; chunk_begin += 1'000) {
+    auto b_values = pmr_vector<int32_t>(1'000);
+    auto a_values = pmr_vector<int32_t>(1'000);
+    std::iota(a_values.begin(), a_values.end(), chunk_begin);
+    std::iota(b_values.begin(), b_values.end(), chunk_begin + 1);
+    table->append_chunk(Segments{std::make_shared<ValueSegment<int32_t>>(std::move(b_values)),
+                                 std::make_shared<ValueSegment<int32_t>>(std::move(a_values))},
+                        std::make_shared<MvccData>(1'000, CommitID{0}));
+    table->last_chunk()->finalize();
+  }
+  ChunkEncoder::encode_all_chunks(table);
+  table->create_index<GroupKeyIndex>({ColumnID{0}});
+  table->create_index<GroupKeyIndex>({ColumnID{1}});
+  Hyrise::get().storage_manager.add_table("indexed_table", table);
+
+  const auto indexed_node = StoredTableNode::make("indexed_table");
+  const auto indexed_a = indexed_node->get_column("a");
+
+  /**
+   * Check PQP - The index is on the left side, which is a reference table because of the validation
+   */
+  const auto pqp = LQPTranslator{}.translate_node(JoinNode::make(
+      JoinMode::Inner, equals_(indexed_a, int_float_a), ValidateNode::make(indexed_node), int_float_node));
+  const auto join_op = std::dynamic_pointer_cast<JoinIndex>(pqp);
+  ASSERT_TRUE(join_op);
+  EXPECT_EQ(join_op->index_side(), IndexSide::Left);
+  EXPECT_EQ(join_op->primary_predicate().column_ids, ColumnIDPair(ColumnID{1}, ColumnID{0}));
+
+  /**
+   * Check result - Only the rows with a = 123 and a = 1234 match, and they are found using the index
+   */
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  pqp->set_transaction_context_recursively(transaction_context);
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(OperatorTask::make_tasks_from_operator(pqp));
+
+  const auto expected_table = std::make_shared<Table>(TableColumnDefinitions{{"b", DataType::Int, false},
+                                                                             {"a", DataType::Int, false},
+                                                                             {"a", DataType::Int, false},
+                                                                             {"b", DataType::Float, false}},
+                                                      TableType::Data);
+  expected_table->append({124, 123, 123, 456.7f});
+  expected_table->append({1235, 1234, 1234, 457.7f});
+  EXPECT_TABLE_EQ_UNORDERED(join_op->get_output(), expected_table);
+
+  const auto& performance_data = static_cast<const JoinIndex::PerformanceData&>(*join_op->performance_data);
+  EXPECT_EQ(performance_data.chunks_scanned_without_index, 0);
+  EXPECT_EQ(performance_data.chunks_scanned_with_index, 10);
+}
+
+TEST_F(LQPTranslatorTest, JoinNodeToJoinSortMergeOnSortedInputs) {
+  const auto add_int_table = [](const std::string& name) {
+    const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data,
+                                               ChunkOffset{10'000}, UseMvcc::Yes);
+    for (auto value = int32_t{0}; value < 20'000; ++value) {
+      table->append({value});
+    }
+    Hyrise::get().storage_manager.add_table(name, table);
+    return StoredTableNode::make(name);
+  };
+
+  const auto left_node = add_int_table("left_table");
+  const auto right_node = add_int_table("right_table");
+  const auto left_a = left_node->get_column("a");
+  const auto right_a = right_node->get_column("a");
+
+  /**
+   * Check PQP - For unsorted inputs, JoinHash is cheaper. If both inputs are sorted by the join column, JoinSortMerge
+   * does not have to sort them and is used instead.
+   */
+  const auto unsorted_join_op = LQPTranslator{}.translate_node(
+      JoinNode::make(JoinMode::Inner, equals_(left_a, right_a), left_node, right_node));
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinHash>(unsorted_join_op));
+
+  // clang-format off
+  const auto sorted_join_node =
+  JoinNode::make(JoinMode::Inner, equals_(left_a, right_a),
+    SortNode::make(expression_vector(left_a), std::vector<SortMode>{SortMode::Ascending},
+      left_node),
+    SortNode::make(expression_vector(right_a), std::vector<SortMode>{SortMode::Ascending},
+      right_node));
+  // clang-format on
+  const auto sorted_join_op = LQPTranslator{}.translate_node(sorted_join_node);
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinSortMerge>(sorted_join_op));
+}
+
 TEST_F(LQPTranslatorTest, AggregateNodeSimple) {
   /**
    * Build LQP and translate to PQP
@@ -748,6 +884,47 @@ TEST_F(LQPTranslatorTest, LimitNode) {
   EXPECT_EQ(*limit_op->row_count_expression(), *value_(2));
 }
 
+TEST_F(LQPTranslatorTest, LimitOnSortBecomesTopK) {
+  // clang-format off
+  const auto lqp =
+  LimitNode::make(value_(5),
+    SortNode::make(expression_vector(int_float_b, int_float_a), std::vector<SortMode>{SortMode::Descending, SortMode::Ascending},  // NOLINT
+      int_float_node));
+  // clang-format on
+
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+
+  const auto top_k = std::dynamic_pointer_cast<const TopK>(pqp);
+  ASSERT_TRUE(top_k);
+  EXPECT_EQ(*top_k->row_count_expression(), *value_(5));
+  ASSERT_EQ(top_k->sort_definitions().size(), 2u);
+  EXPECT_EQ(top_k->sort_definitions().at(0), SortColumnDefinition(ColumnID{1}, SortMode::Descending));
+  EXPECT_EQ(top_k->sort_definitions().at(1), SortColumnDefinition(ColumnID{0}, SortMode::Ascending));
+
+  const auto get_table = std::dynamic_pointer_cast<const GetTable>(top_k->left_input());
+  ASSERT_TRUE(get_table);
+}
+
+TEST_F(LQPTranslatorTest, LimitOnSharedSortIsNotFused) {
+  // If the sorted result is used elsewhere as well, the Sort has to be executed anyway.
+  const auto sort_node = SortNode::make(expression_vector(int_float_a), std::vector<SortMode>{SortMode::Ascending},
+                                        int_float_node);
+
+  // clang-format off
+  const auto lqp =
+  UnionNode::make(SetOperationMode::All,
+    LimitNode::make(value_(5), sort_node),
+    sort_node);
+  // clang-format on
+
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+
+  const auto limit = std::dynamic_pointer_cast<const Limit>(pqp->left_input());
+  ASSERT_TRUE(limit);
+  EXPECT_EQ(limit->left_input(), pqp->right_input());
+  EXPECT_TRUE(std::dynamic_pointer_cast<const Sort>(limit->left_input()));
+}
+
 TEST_F(LQPTranslatorTest, DiamondShapeSimple) {
   /**
    * Test that
@@ -10,6 +10,7 @@
 #include "base_test.hpp"
 
 #include "expression/aggregate_expression.hpp"
+#include "hyrise.hpp"
 #include "operators/abstract_read_only_operator.hpp"
 #include "operators/aggregate_hash.hpp"
 #include "operators/aggregate_sort.hpp"
@@ -18,10 +19,12 @@
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
+#include "utils/settings/memory_budget_setting.hpp"
 
 namespace opossum {
 
@@ -891,4 +894,54 @@ TYPED_TEST(OperatorsAggregateTest, StringVariations) {
   EXPECT_EQ(values_sorted, result_values_sorted);
 }
 
+TYPED_TEST(OperatorsAggregateTest, MultiThreaded) {
+  // With a multi-threaded scheduler, AggregateHash pre-aggregates the chunks in parallel and merges the results.
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  test_output<TypeParam>(
+      this->_table_wrapper_2_2, {{ColumnID{2}, AggregateFunction::Min}, {ColumnID{3}, AggregateFunction::Max}},
+      {ColumnID{0}, ColumnID{1}}, "resources/test_data/tbl/aggregateoperator/groupby_int_2gb_2agg/min_max.tbl");
+  test_output<TypeParam>(
+      this->_table_wrapper_2_2, {{ColumnID{2}, AggregateFunction::Sum}, {ColumnID{3}, AggregateFunction::Count}},
+      {ColumnID{0}, ColumnID{1}}, "resources/test_data/tbl/aggregateoperator/groupby_int_2gb_2agg/sum_count.tbl");
+  test_output<TypeParam>(this->_table_wrapper_1_1_large, {{ColumnID{1}, AggregateFunction::StandardDeviationSample}},
+                         {ColumnID{0}},
+                         "resources/test_data/tbl/aggregateoperator/groupby_int_1gb_1agg/stddev_samp_large.tbl");
+  test_output<TypeParam>(this->_table_wrapper_1_1, {{ColumnID{1}, AggregateFunction::CountDistinct}}, {ColumnID{0}},
+                         "resources/test_data/tbl/aggregateoperator/groupby_int_1gb_1agg/count_distinct.tbl");
+  test_output<TypeParam>(this->_table_wrapper_1_1_null, {{ColumnID{1}, AggregateFunction::Avg}}, {ColumnID{0}},
+                         "resources/test_data/tbl/aggregateoperator/groupby_int_1gb_1agg/avg_null.tbl", false);
+  test_output<TypeParam>(this->_table_wrapper_1_1_string, {{ColumnID{1}, AggregateFunction::Max}}, {ColumnID{0}},
+                         "resources/test_data/tbl/aggregateoperator/groupby_string_1gb_1agg/max.tbl");
+  test_output<TypeParam>(this->_table_wrapper_1_1, {{INVALID_COLUMN_ID, AggregateFunction::Count}}, {ColumnID{0}},
+                         "resources/test_data/tbl/aggregateoperator/groupby_int_1gb_1agg/count_star.tbl", false);
+  test_output<TypeParam>(this->_table_wrapper_1_0_null, {}, {ColumnID{0}},
+                         "resources/test_data/tbl/aggregateoperator/groupby_int_1gb_0agg/result_null.tbl", false);
+  test_output<TypeParam>(this->_table_wrapper_1_1, {{ColumnID{1}, AggregateFunction::Avg}}, {},
+                         "resources/test_data/tbl/aggregateoperator/0gb_1agg/avg.tbl");
+}
+
+TYPED_TEST(OperatorsAggregateTest, SpillingAggregation) {
+  // With a budget of one byte, AggregateHash writes the partial results of every chunk to disk before merging them.
+  Hyrise::get().settings_manager.get_setting(MemoryBudgetSetting::NAME)->set("1");
+
+  test_output<TypeParam>(
+      this->_table_wrapper_2_2, {{ColumnID{2}, AggregateFunction::Min}, {ColumnID{3}, AggregateFunction::Max}},
+      {ColumnID{0}, ColumnID{1}}, "resources/test_data/tbl/aggregateoperator/groupby_int_2gb_2agg/min_max.tbl");
+  test_output<TypeParam>(this->_table_wrapper_1_1_large, {{ColumnID{1}, AggregateFunction::StandardDeviationSample}},
+                         {ColumnID{0}},
+                         "resources/test_data/tbl/aggregateoperator/groupby_int_1gb_1agg/stddev_samp_large.tbl");
+  test_output<TypeParam>(this->_table_wrapper_1_1, {{ColumnID{1}, AggregateFunction::CountDistinct}}, {ColumnID{0}},
+                         "resources/test_data/tbl/aggregateoperator/groupby_int_1gb_1agg/count_distinct.tbl");
+  test_output<TypeParam>(this->_table_wrapper_1_1_null, {{ColumnID{1}, AggregateFunction::Avg}}, {ColumnID{0}},
+                         "resources/test_data/tbl/aggregateoperator/groupby_int_1gb_1agg/avg_null.tbl", false);
+  test_output<TypeParam>(this->_table_wrapper_1_1_string, {{ColumnID{1}, AggregateFunction::Max}}, {ColumnID{0}},
+                         "resources/test_data/tbl/aggregateoperator/groupby_string_1gb_1agg/max.tbl");
+  test_output<TypeParam>(this->_table_wrapper_1_0_null, {}, {ColumnID{0}},
+                         "resources/test_data/tbl/aggregateoperator/groupby_int_1gb_0agg/result_null.tbl", false);
+  test_output<TypeParam>(this->_table_wrapper_1_1, {{ColumnID{1}, AggregateFunction::Avg}}, {},
+                         "resources/test_data/tbl/aggregateoperator/0gb_1agg/avg.tbl");
+}
+
 }  // namespace opossum
@@ -40,7 +40,7 @@ class OperatorsExportTest : public BaseTest {
   const std::string test_filename = test_data_path + "export_test";
   const std::string test_meta_filename = test_filename + CsvMeta::META_FILE_EXTENSION;
   const std::string reference_filepath = "resources/test_data/";
-  const std::map<FileType, std::string> reference_filenames{{FileType::Binary, "bin/float.bin"},
+  const std::map<FileType, std::string> reference_filenames{{FileType::Binary, "bin/float_indexed.bin"},
                                                             {FileType::Csv, "csv/float.csv"}};
   const std::map<FileType, std::string> file_extensions{{FileType::Binary, ".bin"}, {FileType::Csv, ".csv"}};
 };
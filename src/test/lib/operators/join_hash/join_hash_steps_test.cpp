@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <numeric>
 
 #include "base_test.hpp"
 
@@ -157,14 +158,9 @@ TEST_F(JoinHashStepsTest, MaterializeAndBuildWithKeepNulls) {
     });
   }
 
-  // Build a BloomFilter that cannot be used to skip any entries by creating a BloomFilter with every value being false
-  // and using bitwise negation (~x).
-  auto bloom_filter = ~BloomFilter(BLOOM_FILTER_SIZE);
-
-  // Build phase: NULLs should be discarded
-  auto hash_map_with_nulls = build<int, int>(materialized_with_nulls, JoinHashBuildMode::AllPositions, 0, bloom_filter);
-  auto hash_map_without_nulls =
-      build<int, int>(materialized_without_nulls, JoinHashBuildMode::AllPositions, 0, bloom_filter);
+  // Build phase: NULLs should be discarded. The default (disabled) BloomFilter does not skip any entries.
+  auto hash_map_with_nulls = build<int, int>(materialized_with_nulls, JoinHashBuildMode::AllPositions, 0);
+  auto hash_map_without_nulls = build<int, int>(materialized_without_nulls, JoinHashBuildMode::AllPositions, 0);
 
   // With 0 radix bits, only a single hash map should be built
   EXPECT_EQ(hash_map_with_nulls.size(), 1);
@@ -189,16 +185,18 @@ TEST_F(JoinHashStepsTest, MaterializeOutputBloomFilter) {
     materialize_input<int, int, false>(_table_with_nulls_and_zeros->get_output(), ColumnID{0}, histograms, 1,
                                        bloom_filter);
 
-    // For all input values, their position in the bloom filter should be correctly set to true
+    // All input values should be contained in the bloom filter
+    EXPECT_TRUE(bloom_filter.is_enabled());
     for (auto value : std::vector<int>{0, 6, 7, 9, 13, 18}) {
-      EXPECT_TRUE(bloom_filter[value]);
-
-      // Set to false for easier checking of the values that should be false
-      bloom_filter[value] = false;
+      EXPECT_TRUE(bloom_filter.may_contain(std::hash<int>{}(value)));
     }
 
-    // All other slots should be false
-    EXPECT_EQ(bloom_filter, BloomFilter{BLOOM_FILTER_SIZE});
+    // Other values should (almost) never be reported as contained
+    auto false_positive_count = 0;
+    for (auto value = 100; value < 1'100; ++value) {
+      false_positive_count += bloom_filter.may_contain(std::hash<int>{}(value));
+    }
+    EXPECT_LT(false_positive_count, 10);
   }
 }
 
@@ -208,9 +206,9 @@ TEST_F(JoinHashStepsTest, MaterializeInputBloomFilter) {
     BloomFilter output_bloom_filter;
 
     // Fill input_bloom_filter
-    BloomFilter input_bloom_filter(BLOOM_FILTER_SIZE);
+    auto input_bloom_filter = BloomFilter{3};
     for (auto value : std::vector<int>{6, 7, 9}) {
-      input_bloom_filter[value] = true;
+      input_bloom_filter.insert(std::hash<int>{}(value));
     }
 
     auto container = materialize_input<int, int, false>(_table_with_nulls_and_zeros->get_output(), ColumnID{0},
@@ -308,9 +306,9 @@ TEST_F(JoinHashStepsTest, BuildRespectsBloomFilter) {
   BloomFilter output_bloom_filter;              // Ignored in this test
 
   // Fill input_bloom_filter
-  BloomFilter input_bloom_filter(BLOOM_FILTER_SIZE);
+  auto input_bloom_filter = BloomFilter{3};
   for (auto value : std::vector<int>{6, 7, 9}) {
-    input_bloom_filter[value] = true;
+    input_bloom_filter.insert(std::hash<int>{}(value));
   }
 
   auto container = materialize_input<int, int, false>(_table_with_nulls_and_zeros->get_output(), ColumnID{0},
@@ -329,6 +327,71 @@ TEST_F(JoinHashStepsTest, BuildRespectsBloomFilter) {
   EXPECT_FALSE(hash_table->contains(18));
 }
 
+TEST_F(JoinHashStepsTest, ReduceByBloomFilter) {
+  std::vector<std::vector<size_t>> histograms;
+  BloomFilter output_bloom_filter;  // Ignored in this test
+
+  auto bloom_filter = BloomFilter{3};
+  for (auto value : std::vector<int>{6, 7, 9}) {
+    bloom_filter.insert(std::hash<int>{}(value));
+  }
+
+  auto container = materialize_input<int, int, true>(_table_with_nulls_and_zeros->get_output(), ColumnID{0},
+                                                     histograms, 1, output_bloom_filter);
+  reduce_by_bloom_filter<int, int, true>(container, histograms, 1, bloom_filter);
+
+  // Values that are not contained in the bloom filter are removed, NULLs are kept
+  auto remaining_element_count = size_t{0};
+  auto histogram_sum = size_t{0};
+  for (auto partition_idx = size_t{0}; partition_idx < container.size(); ++partition_idx) {
+    const auto& partition = container[partition_idx];
+    ASSERT_EQ(partition.elements.size(), partition.null_values.size());
+    for (auto element_idx = size_t{0}; element_idx < partition.elements.size(); ++element_idx) {
+      const auto value = partition.elements[element_idx].value;
+      EXPECT_TRUE(partition.null_values[element_idx] || value == 6 || value == 7 || value == 9);
+    }
+    remaining_element_count += partition.elements.size();
+    histogram_sum += std::accumulate(histograms[partition_idx].begin(), histograms[partition_idx].end(), size_t{0});
+  }
+  // 7, 7, 9, 6, 9, 7, and two NULLs
+  EXPECT_EQ(remaining_element_count, 8);
+  EXPECT_EQ(histogram_sum, remaining_element_count);
+}
+
+TEST_F(JoinHashStepsTest, MaterializeAndSpillInput) {
+  const auto radix_bit_count = size_t{2};
+
+  // Spilled partitions are loaded with the same elements in the same order as the partitions created in memory
+  const auto tables = std::vector<std::shared_ptr<const Table>>{_table_zero_one, _table_int_with_nulls->get_output()};
+  for (const auto& table : tables) {
+    std::vector<std::vector<size_t>> histograms;
+    auto bloom_filter = BloomFilter{};
+    const auto materialized = materialize_input<int, int, true>(table, ColumnID{0}, histograms, radix_bit_count,
+                                                                bloom_filter);
+    const auto expected_partitions = partition_by_radix<int, int, true>(materialized, histograms, radix_bit_count);
+
+    auto spill_file = SpillFile{};
+    auto spill_bloom_filter = BloomFilter{};
+    const auto spilled_partitions = materialize_and_spill_input<int, int, true>(table, ColumnID{0}, radix_bit_count,
+                                                                               spill_file, spill_bloom_filter);
+    ASSERT_EQ(spilled_partitions.blocks.size(), expected_partitions.size());
+    ASSERT_EQ(spilled_partitions.element_counts.size(), expected_partitions.size());
+    EXPECT_EQ(spilled_partitions.has_null_values, table != _table_zero_one);
+
+    for (auto partition_idx = size_t{0}; partition_idx < expected_partitions.size(); ++partition_idx) {
+      const auto& expected_partition = expected_partitions[partition_idx];
+      const auto partition = load_spilled_partition<int>(spill_file, spilled_partitions.blocks[partition_idx]);
+      EXPECT_EQ(spilled_partitions.element_counts[partition_idx], expected_partition.elements.size());
+      ASSERT_EQ(partition.elements.size(), expected_partition.elements.size());
+      for (auto element_idx = size_t{0}; element_idx < partition.elements.size(); ++element_idx) {
+        EXPECT_EQ(partition.elements[element_idx].row_id, expected_partition.elements[element_idx].row_id);
+        EXPECT_EQ(partition.elements[element_idx].value, expected_partition.elements[element_idx].value);
+      }
+      EXPECT_EQ(partition.null_values, expected_partition.null_values);
+    }
+  }
+}
+
 TEST_F(JoinHashStepsTest, ThrowWhenNoNullValuesArePassed) {
   if (!HYRISE_DEBUG) GTEST_SKIP();
 
@@ -3,6 +3,7 @@
 #include "operators/join_hash.hpp"
 #include "operators/table_wrapper.hpp"
 #include "types.hpp"
+#include "utils/settings/memory_budget_setting.hpp"
 
 namespace opossum {
 
@@ -117,4 +118,53 @@ TEST_F(OperatorsJoinHashTest, RadixBitCalculation) {
                                                   std::numeric_limits<size_t>::max()) > 0ul);
 }
 
+TEST_F(OperatorsJoinHashTest, SpillingJoin) {
+  // With a small memory budget, the inputs are radix partitioned and written to disk while they are materialized.
+  // Afterwards, they are joined in batches of partitions. If the number of radix bits is not given, at least one is
+  // used.
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  auto& memory_budget_setting = *Hyrise::get().settings_manager.get_setting(MemoryBudgetSetting::NAME);
+
+  for (const auto radix_bits : {std::optional<size_t>{}, std::optional<size_t>{4}}) {
+    for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Semi, JoinMode::AntiNullAsFalse}) {
+      memory_budget_setting.set("0");
+      const auto expected_join = std::make_shared<JoinHash>(
+          _table_tpch_lineitems, _table_tpch_orders, mode, primary_predicate, std::vector<OperatorJoinPredicate>{},
+          radix_bits);
+      expected_join->execute();
+
+      memory_budget_setting.set("1000");
+      const auto join = std::make_shared<JoinHash>(_table_tpch_lineitems, _table_tpch_orders, mode,
+                                                   primary_predicate, std::vector<OperatorJoinPredicate>{}, radix_bits);
+      join->execute();
+
+      EXPECT_TABLE_EQ_UNORDERED(join->get_output(), expected_join->get_output());
+      EXPECT_EQ(join->description(DescriptionMode::SingleLine).find("Radix bits: 0"), std::string::npos);
+    }
+  }
+  memory_budget_setting.set("0");
+}
+
+TEST_F(OperatorsJoinHashTest, SpillingAntiJoinWithNullValues) {
+  // NULL values on the build side are detected while the inputs are spilled
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  auto& memory_budget_setting = *Hyrise::get().settings_manager.get_setting(MemoryBudgetSetting::NAME);
+
+  for (const auto& [left, right] : {std::pair{_table_wrapper_small, _table_with_nulls},
+                                    std::pair{_table_with_nulls, _table_wrapper_small}}) {
+    memory_budget_setting.set("0");
+    const auto expected_join = std::make_shared<JoinHash>(left, right, JoinMode::AntiNullAsTrue, primary_predicate,
+                                                          std::vector<OperatorJoinPredicate>{}, 2);
+    expected_join->execute();
+
+    memory_budget_setting.set("1");
+    const auto join = std::make_shared<JoinHash>(left, right, JoinMode::AntiNullAsTrue, primary_predicate,
+                                                 std::vector<OperatorJoinPredicate>{}, 2);
+    join->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(join->get_output(), expected_join->get_output());
+  }
+  memory_budget_setting.set("0");
+}
+
 }  // namespace opossum
@@ -11,6 +11,7 @@
 #include "operators/join_verification.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
 #include "storage/table.hpp"
@@ -259,4 +260,28 @@ TEST_F(OperatorsJoinIndexTest, RightJoinPruneInputIsRefIndexInputIsDataIndexSide
                    1, true);
 }
 
+TEST_F(OperatorsJoinIndexTest, ParallelExecution) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  // Both inputs consist of multiple chunks, so that the matches of multiple index chunks are merged
+  const auto small_chunk_table_wrapper_e = load_table_with_index("resources/test_data/tbl/int_int2.tbl", 1);
+  small_chunk_table_wrapper_e->execute();
+  const auto small_chunk_table_wrapper_f = load_table_with_index("resources/test_data/tbl/int_int3.tbl", 1);
+  small_chunk_table_wrapper_f->execute();
+
+  for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Right, JoinMode::FullOuter, JoinMode::Semi,
+                          JoinMode::AntiNullAsFalse}) {
+    for (const auto index_side : {IndexSide::Left, IndexSide::Right}) {
+      SCOPED_TRACE(mode);
+      test_join_output(small_chunk_table_wrapper_e, small_chunk_table_wrapper_f,
+                       {{ColumnID{0}, ColumnID{0}}, PredicateCondition::LessThanEquals}, mode, 1, true, index_side);
+    }
+  }
+
+  // Fall back to the nested loop join
+  test_join_output(_table_wrapper_h_no_index, _table_wrapper_i_no_index,
+                   {{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals}, JoinMode::FullOuter, 1, false);
+}
+
 }  // namespace opossum
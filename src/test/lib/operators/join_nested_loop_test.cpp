@@ -1,8 +1,10 @@
 #include "base_test.hpp"
 
 #include "operators/join_nested_loop.hpp"
+#include "operators/join_verification.hpp"
 #include "operators/projection.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 
 namespace opossum {
 
@@ -57,4 +59,47 @@ TEST_F(OperatorsJoinNestedLoopTest, DeepCopy) {
   EXPECT_NE(join_operator_copy->right_input(), nullptr);
 }
 
+TEST_F(OperatorsJoinNestedLoopTest, ParallelExecution) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  // Many small chunks on both sides so that multiple jobs find matches for the same right chunk
+  const auto create_input = [](const int32_t modulo, const ChunkOffset chunk_size) {
+    const auto column_definitions =
+        TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::Int, false}};
+    const auto table = std::make_shared<Table>(column_definitions, TableType::Data, chunk_size);
+    for (auto row_id = int32_t{0}; row_id < 200; ++row_id) {
+      const auto a = row_id % 31 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{row_id % modulo};
+      table->append({a, row_id % 3});
+    }
+    const auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  };
+  const auto right = create_input(13, ChunkOffset{10});
+
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::LessThan};
+  const auto secondary_predicates =
+      std::vector<OperatorJoinPredicate>{{{ColumnID{1}, ColumnID{1}}, PredicateCondition::NotEquals}};
+
+  // With a single left chunk, the right chunks are split among multiple jobs
+  for (const auto left_chunk_size : {ChunkOffset{10}, ChunkOffset{200}}) {
+    SCOPED_TRACE(left_chunk_size);
+    const auto left = create_input(17, left_chunk_size);
+
+    for (const auto mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Right, JoinMode::FullOuter, JoinMode::Semi,
+                            JoinMode::AntiNullAsTrue}) {
+      SCOPED_TRACE(mode);
+      const auto join = std::make_shared<JoinNestedLoop>(left, right, mode, primary_predicate, secondary_predicates);
+      join->execute();
+
+      const auto join_verification =
+          std::make_shared<JoinVerification>(left, right, mode, primary_predicate, secondary_predicates);
+      join_verification->execute();
+
+      EXPECT_TABLE_EQ_UNORDERED(join->get_output(), join_verification->get_output());
+    }
+  }
+}
+
 }  // namespace opossum
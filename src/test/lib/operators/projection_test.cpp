@@ -14,6 +14,7 @@
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -223,4 +224,53 @@ TEST_F(OperatorsProjectionTest, ForwardSortedByFlag) {
   }
 }
 
+TEST_F(OperatorsProjectionTest, ParallelExecutionKeepsChunkOrder) {
+  // Chunks are projected in jobs of at least Chunk::DEFAULT_SIZE rows. Small chunks are bundled, so that the chunks
+  // of size Chunk::DEFAULT_SIZE / 4 at the end of the table form one job.
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data);
+  const auto chunk_sizes = std::vector<size_t>{Chunk::DEFAULT_SIZE, Chunk::DEFAULT_SIZE, Chunk::DEFAULT_SIZE / 4,
+                                               Chunk::DEFAULT_SIZE / 4, Chunk::DEFAULT_SIZE / 4};
+  auto row_count = size_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_sizes.size(); ++chunk_id) {
+    const auto chunk_size = chunk_sizes[chunk_id];
+    auto values = pmr_vector<int32_t>(chunk_size);
+    auto null_values = pmr_vector<bool>(chunk_size);
+    for (auto chunk_offset = size_t{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      values[chunk_offset] = static_cast<int32_t>(row_count + chunk_offset);
+      // Only the last chunk contains NULLs, which makes the output column nullable.
+      null_values[chunk_offset] = chunk_id == chunk_sizes.size() - 1 && chunk_offset % 2 == 0;
+    }
+    table->append_chunk(Segments{std::make_shared<ValueSegment<int32_t>>(std::move(values), std::move(null_values))});
+    row_count += chunk_size;
+  }
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto a = PQPColumnExpression::from_table(*table, "a");
+  const auto projection = std::make_shared<Projection>(table_wrapper, expression_vector(add_(a, 1)));
+  projection->execute();
+
+  const auto& output_table = projection->get_output();
+  ASSERT_EQ(output_table->chunk_count(), chunk_sizes.size());
+  EXPECT_TRUE(output_table->column_is_nullable(ColumnID{0}));
+
+  auto row_id = size_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < output_table->chunk_count(); ++chunk_id) {
+    const auto& segment = *output_table->get_chunk(chunk_id)->get_segment(ColumnID{0});
+    ASSERT_EQ(segment.size(), chunk_sizes[chunk_id]);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment.size(); ++chunk_offset) {
+      const auto value = segment[chunk_offset];
+      if (chunk_id == output_table->chunk_count() - 1 && chunk_offset % 2 == 0) {
+        EXPECT_TRUE(variant_is_null(value));
+      } else {
+        EXPECT_EQ(boost::get<int32_t>(value), static_cast<int32_t>(row_id + 1));
+      }
+      ++row_id;
+    }
+  }
+}
+
 }  // namespace opossum
@@ -3,6 +3,8 @@
 #include "operators/join_hash.hpp"
 #include "operators/sort.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "utils/settings/memory_budget_setting.hpp"
 
 namespace opossum {
 
@@ -191,4 +193,67 @@ TEST_F(SortTest, InputReferencesDifferentColumns) {
   EXPECT_EQ(sort.get_output()->type(), TableType::Data);
 }
 
+TEST_F(SortTest, SpillingSort) {
+  // With a memory budget of 200 bytes, every sorted run holds only a few rows and the runs are merged from disk.
+  Hyrise::get().settings_manager.get_setting(MemoryBudgetSetting::NAME)->set("200");
+
+  auto sort = Sort{input_table_wrapper,
+                   {SortColumnDefinition{ColumnID{0}, SortMode::Ascending},
+                    SortColumnDefinition{ColumnID{1}, SortMode::Descending}}};
+  sort.execute();
+
+  EXPECT_TABLE_EQ_ORDERED(sort.get_output(), load_table("resources/test_data/tbl/sort/a_asc_b_desc.tbl"));
+
+  auto string_sort = Sort{input_table_wrapper, {SortColumnDefinition{ColumnID{2}, SortMode::Descending}}};
+  string_sort.execute();
+
+  auto expected_sort = Sort{input_table_wrapper, {SortColumnDefinition{ColumnID{2}, SortMode::Descending}}};
+  Hyrise::get().settings_manager.get_setting(MemoryBudgetSetting::NAME)->set("0");
+  expected_sort.execute();
+
+  EXPECT_TABLE_EQ_ORDERED(string_sort.get_output(), expected_sort.get_output());
+}
+
+TEST_F(SortTest, ParallelSortIsStable) {
+  // Large inputs are sorted in runs that are merged in parallel. We use five runs of Chunk::DEFAULT_SIZE rows so that
+  // the merge includes a round with an odd number of runs. Column a has many duplicates, column b holds the input
+  // position and is used to check that the relative order of rows with the same value is kept.
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  const auto row_count = size_t{5} * Chunk::DEFAULT_SIZE;
+  auto a_values = pmr_vector<int32_t>(row_count);
+  auto b_values = pmr_vector<int32_t>(row_count);
+  for (auto row_id = size_t{0}; row_id < row_count; ++row_id) {
+    a_values[row_id] = static_cast<int32_t>((row_id * 7919) % 1'000);
+    b_values[row_id] = static_cast<int32_t>(row_id);
+  }
+
+  auto expected_rows = std::vector<std::pair<int32_t, int32_t>>{};
+  expected_rows.reserve(row_count);
+  for (auto row_id = size_t{0}; row_id < row_count; ++row_id) {
+    expected_rows.emplace_back(a_values[row_id], b_values[row_id]);
+  }
+  std::stable_sort(expected_rows.begin(), expected_rows.end(),
+                   [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+
+  const auto table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, false}}, TableType::Data);
+  table->append_chunk(Segments{std::make_shared<ValueSegment<int32_t>>(std::move(a_values)),
+                               std::make_shared<ValueSegment<int32_t>>(std::move(b_values))});
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto sort = Sort{table_wrapper, {SortColumnDefinition{ColumnID{0}, SortMode::Descending}}, Chunk::DEFAULT_SIZE,
+                   Sort::ForceMaterialization::Yes};
+  sort.execute();
+
+  const auto rows = sort.get_output()->get_rows();
+  ASSERT_EQ(rows.size(), row_count);
+  for (auto row_id = size_t{0}; row_id < row_count; ++row_id) {
+    ASSERT_EQ(boost::get<int32_t>(rows[row_id][0]), expected_rows[row_id].first);
+    ASSERT_EQ(boost::get<int32_t>(rows[row_id][1]), expected_rows[row_id].second);
+  }
+}
+
 }  // namespace opossum
@@ -62,7 +62,8 @@ auto table_scan_scring_test_formatter = [](const ::testing::TestParamInfo<Encodi
 
 INSTANTIATE_TEST_SUITE_P(EncodingTypes, OperatorsTableScanStringTest,
                          ::testing::Values(EncodingType::Unencoded, EncodingType::Dictionary,
-                                           EncodingType::FixedStringDictionary, EncodingType::RunLength),
+                                           EncodingType::FixedStringDictionary, EncodingType::RunLength,
+                                           EncodingType::FSST),
                          table_scan_scring_test_formatter);
 
 TEST_P(OperatorsTableScanStringTest, ScanEquals) {
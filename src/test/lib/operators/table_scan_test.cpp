@@ -1,7 +1,9 @@
 #include <algorithm>
 #include <iostream>
+#include <limits>
 #include <map>
 #include <memory>
+#include <numeric>
 #include <optional>
 #include <string>
 #include <utility>
@@ -24,8 +26,10 @@
 #include "operators/table_wrapper.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/encoding_type.hpp"
+#include "storage/pos_lists/bitmap_pos_list.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
+#include "type_comparison.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -264,6 +268,47 @@ TEST_P(OperatorsTableScanTest, DoubleScan) {
   EXPECT_TABLE_EQ_UNORDERED(scan_2->get_output(), expected_result);
 }
 
+TEST_P(OperatorsTableScanTest, BitmapPosListsForLowSelectivity) {
+  // Scans that select a large part of a chunk output a BitmapPosList. A subsequent scan intersects that bitmap with its
+  // own matches, so that its output uses a BitmapPosList as well.
+  auto values = pmr_vector<int32_t>(1'000);
+  std::iota(values.begin(), values.end(), 0);
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data);
+  table->append_chunk(Segments{std::make_shared<ValueSegment<int32_t>>(std::move(values))});
+  table->last_chunk()->finalize();
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{_encoding_type});
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto scan_a = std::make_shared<TableScan>(table_wrapper, less_than_(column_a, 800));
+  scan_a->execute();
+  const auto scan_b = std::make_shared<TableScan>(scan_a, greater_than_equals_(column_a, 300));
+  scan_b->execute();
+
+  for (const auto& scan : {scan_a, scan_b}) {
+    const auto& output_table = scan->get_output();
+    ASSERT_EQ(output_table->chunk_count(), 1);
+    const auto segment = output_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+    const auto& pos_list = std::static_pointer_cast<const ReferenceSegment>(segment)->pos_list();
+    EXPECT_TRUE(std::dynamic_pointer_cast<const BitmapPosList>(pos_list));
+  }
+
+  const auto rows = scan_b->get_output()->get_rows();
+  ASSERT_EQ(rows.size(), 500);
+  for (auto row_id = size_t{0}; row_id < rows.size(); ++row_id) {
+    EXPECT_EQ(rows[row_id][0], AllTypeVariant{static_cast<int32_t>(row_id + 300)});
+  }
+
+  // Selective scans still output a RowIDPosList
+  const auto scan_c = std::make_shared<TableScan>(table_wrapper, less_than_(column_a, 10));
+  scan_c->execute();
+  const auto segment = scan_c->get_output()->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  EXPECT_TRUE(std::dynamic_pointer_cast<const RowIDPosList>(
+      std::static_pointer_cast<const ReferenceSegment>(segment)->pos_list()));
+}
+
 TEST_P(OperatorsTableScanTest, EmptyResultScan) {
   auto scan_1 = create_table_scan(get_int_float_op(), ColumnID{0}, PredicateCondition::GreaterThan, 90000);
   scan_1->execute();
@@ -377,6 +422,85 @@ TEST_P(OperatorsTableScanTest, ScanOnCompressedSegments) {
   }
 }
 
+TEST_P(OperatorsTableScanTest, ScanOnLongSegmentWithMultipleBlocks) {
+  // Timestamp-like values spanning multiple blocks of a FrameOfReferenceSegment. The gap between the blocks is larger
+  // than 2^32, so that some search values cannot be represented as an offset in some of the blocks.
+  constexpr auto row_count = 5'000;
+  constexpr auto first_timestamp = int64_t{1'600'000'000'000'000};
+  auto values = pmr_vector<int64_t>(row_count);
+  auto null_values = pmr_vector<bool>(row_count);
+  for (auto row_id = 0; row_id < row_count; ++row_id) {
+    values[row_id] = first_timestamp + (row_id / 2'048) * int64_t{10'000'000'000} + (row_id % 2'048) * 1'000;
+    null_values[row_id] = row_id % 7 == 0;
+  }
+
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Long, true}}, TableType::Data);
+  const auto segment =
+      std::make_shared<ValueSegment<int64_t>>(pmr_vector<int64_t>{values}, pmr_vector<bool>{null_values});
+  table->append_chunk(Segments{segment});
+  table->last_chunk()->finalize();
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{_encoding_type});
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto search_values = std::vector<int64_t>{first_timestamp - 1,
+                                                  first_timestamp,
+                                                  first_timestamp + 1'000'000,
+                                                  first_timestamp + 1'000'001,
+                                                  first_timestamp + 10'000'000'000,
+                                                  first_timestamp + 15'000'000'000,
+                                                  first_timestamp + 20'000'000'000 + 903'000,
+                                                  first_timestamp + 30'000'000'000};
+  const auto predicate_conditions =
+      std::vector<PredicateCondition>{PredicateCondition::Equals,      PredicateCondition::NotEquals,
+                                      PredicateCondition::LessThan,    PredicateCondition::LessThanEquals,
+                                      PredicateCondition::GreaterThan, PredicateCondition::GreaterThanEquals};
+
+  for (const auto search_value : search_values) {
+    for (const auto predicate_condition : predicate_conditions) {
+      auto expected_row_count = size_t{0};
+      with_comparator(predicate_condition, [&](auto comparator) {
+        for (auto row_id = 0; row_id < row_count; ++row_id) {
+          expected_row_count += !null_values[row_id] && comparator(values[row_id], search_value);
+        }
+      });
+
+      const auto scan = create_table_scan(table_wrapper, ColumnID{0}, predicate_condition, search_value);
+      scan->execute();
+      EXPECT_EQ(scan->get_output()->row_count(), expected_row_count)
+          << predicate_condition << " " << search_value;
+    }
+  }
+}
+
+TEST_P(OperatorsTableScanTest, ScanOnLongSegmentWithWideBlock) {
+  // The values span more than 2^32, so that the offsets of a FrameOfReferenceSegment do not fit into 32 bits
+  const auto values = pmr_vector<int64_t>{std::numeric_limits<int64_t>::max(), -5'000'000'000, 0, 17,
+                                          std::numeric_limits<int64_t>::min(), 5'000'000'000};
+
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Long, false}}, TableType::Data);
+  table->append_chunk(Segments{std::make_shared<ValueSegment<int64_t>>(pmr_vector<int64_t>{values})});
+  table->last_chunk()->finalize();
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{_encoding_type});
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto expected_row_counts =
+      std::vector<std::pair<PredicateCondition, size_t>>{{PredicateCondition::Equals, 1},
+                                                         {PredicateCondition::NotEquals, 5},
+                                                         {PredicateCondition::LessThan, 2},
+                                                         {PredicateCondition::GreaterThan, 3},
+                                                         {PredicateCondition::GreaterThanEquals, 4}};
+
+  for (const auto& [predicate_condition, expected_row_count] : expected_row_counts) {
+    const auto scan = create_table_scan(table_wrapper, ColumnID{0}, predicate_condition, int64_t{0});
+    scan->execute();
+    EXPECT_EQ(scan->get_output()->row_count(), expected_row_count) << predicate_condition;
+  }
+}
+
 TEST_P(OperatorsTableScanTest, ScanOnReferencedCompressedSegments) {
   // we do not need to check for a non existing value, because that happens automatically when we scan the second chunk
 
@@ -0,0 +1,84 @@
+#include "base_test.hpp"
+
+#include "operators/table_scan/value_id_range_scan.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+
+namespace opossum {
+
+// Vector compression type and the largest value ID, which determines the width of the compressed values
+using ValueIDRangeScanParams = std::tuple<VectorCompressionType, uint32_t>;
+
+class OperatorsTableScanValueIDRangeScanTest : public BaseTest,
+                                               public ::testing::WithParamInterface<ValueIDRangeScanParams> {
+ protected:
+  void SetUp() override {
+    const auto [vector_compression_type, max_value_id] = GetParam();
+    _max_value_id = max_value_id;
+
+    // The size is not a multiple of the SIMD width or the SimdBp128 block size, so that the remainder is scanned, too.
+    // The first 2'000 value IDs are small, which leads to SimdBp128 blocks that can be skipped for larger ranges.
+    _value_ids = pmr_vector<uint32_t>(5'003);
+    for (auto index = size_t{0}; index < _value_ids.size(); ++index) {
+      const auto hash = static_cast<uint32_t>(index * 2'654'435'761u >> 7u);
+      _value_ids[index] = index < 2'000 ? hash % 4 : hash % (max_value_id + 1);
+    }
+    _value_ids.back() = max_value_id;
+
+    _attribute_vector = compress_vector(_value_ids, vector_compression_type, {}, {max_value_id});
+  }
+
+  void _test_range(const ValueID lower_value_id, const ValueID upper_value_id, const ValueID excluded_value_id) {
+    auto expected = RowIDPosList{};
+    for (auto index = ChunkOffset{0}; index < _value_ids.size(); ++index) {
+      const auto value_id = _value_ids[index];
+      if (value_id >= lower_value_id && value_id < upper_value_id && value_id != excluded_value_id) {
+        expected.emplace_back(RowID{ChunkID{1}, index});
+      }
+    }
+
+    auto matches = RowIDPosList{};
+    scan_value_id_range(*_attribute_vector, lower_value_id, upper_value_id, excluded_value_id, ChunkID{1}, matches);
+
+    ASSERT_EQ(matches.size(), expected.size());
+    for (auto index = size_t{0}; index < matches.size(); ++index) {
+      EXPECT_EQ(matches[index], expected[index]);
+    }
+  }
+
+  uint32_t _max_value_id{};
+  pmr_vector<uint32_t> _value_ids;
+  std::unique_ptr<const BaseCompressedVector> _attribute_vector;
+};
+
+TEST_P(OperatorsTableScanValueIDRangeScanTest, Ranges) {
+  // The largest value ID plays the role of the null value ID
+  const auto null_value_id = ValueID{_max_value_id};
+  const auto middle_value_id = ValueID{_max_value_id / 2};
+
+  // Equals
+  _test_range(ValueID{2}, ValueID{3}, null_value_id);
+  _test_range(middle_value_id, ValueID{middle_value_id + 1}, null_value_id);
+
+  // NotEquals
+  _test_range(ValueID{0}, null_value_id, ValueID{1});
+
+  // LessThan and GreaterThanEquals
+  _test_range(ValueID{0}, middle_value_id, null_value_id);
+  _test_range(middle_value_id, null_value_id, null_value_id);
+
+  // Between
+  _test_range(ValueID{1}, middle_value_id, null_value_id);
+
+  // Empty ranges
+  _test_range(ValueID{3}, ValueID{3}, null_value_id);
+  _test_range(ValueID{5}, ValueID{4}, null_value_id);
+}
+
+INSTANTIATE_TEST_SUITE_P(OperatorsTableScanValueIDRangeScanTestInstances, OperatorsTableScanValueIDRangeScanTest,
+                         ::testing::Values(ValueIDRangeScanParams{VectorCompressionType::FixedSizeByteAligned, 200},
+                                           ValueIDRangeScanParams{VectorCompressionType::FixedSizeByteAligned, 60'000},
+                                           ValueIDRangeScanParams{VectorCompressionType::FixedSizeByteAligned, 100'000},
+                                           ValueIDRangeScanParams{VectorCompressionType::SimdBp128, 200},
+                                           ValueIDRangeScanParams{VectorCompressionType::SimdBp128, 100'000}));
+
+}  // namespace opossum
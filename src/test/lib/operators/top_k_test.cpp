@@ -0,0 +1,108 @@
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "operators/limit.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class OperatorsTopKTest : public BaseTest {
+ public:
+  static void SetUpTestCase() { input_table = load_table("resources/test_data/tbl/sort/input.tbl", 20); }
+
+  void SetUp() override {
+    input_table_wrapper = std::make_shared<TableWrapper>(input_table);
+    input_table_wrapper->execute();
+  }
+
+  // TopK has to return exactly the same rows (in the same order) as a Sort followed by a Limit.
+  void test_against_sort_and_limit(const std::shared_ptr<AbstractOperator>& input) {
+    const auto a_asc = SortColumnDefinition{ColumnID{0}, SortMode::Ascending};
+    const auto a_desc = SortColumnDefinition{ColumnID{0}, SortMode::Descending};
+    const auto b_asc = SortColumnDefinition{ColumnID{1}, SortMode::Ascending};
+    const auto b_desc = SortColumnDefinition{ColumnID{1}, SortMode::Descending};
+    const auto c_desc = SortColumnDefinition{ColumnID{2}, SortMode::Descending};
+
+    const auto sort_definitions_variations = std::vector<std::vector<SortColumnDefinition>>{
+        {a_asc}, {a_desc}, {b_asc}, {b_desc}, {c_desc}, {a_asc, b_desc}, {a_desc, b_asc}};
+
+    for (const auto& sort_definitions : sort_definitions_variations) {
+      for (const auto row_count : {int64_t{1}, int64_t{7}, int64_t{20}, int64_t{33}, int64_t{50}, int64_t{100}}) {
+        SCOPED_TRACE(std::to_string(row_count) + " rows, sorted by column " +
+                     std::to_string(sort_definitions.front().column));
+
+        const auto top_k = std::make_shared<TopK>(input, sort_definitions, value_(row_count));
+        top_k->execute();
+
+        const auto sort = std::make_shared<Sort>(input, sort_definitions);
+        sort->execute();
+        const auto limit = std::make_shared<Limit>(sort, value_(row_count));
+        limit->execute();
+
+        EXPECT_TABLE_EQ_ORDERED(top_k->get_output(), limit->get_output());
+      }
+    }
+  }
+
+  static inline std::shared_ptr<Table> input_table;
+  std::shared_ptr<AbstractOperator> input_table_wrapper;
+};
+
+TEST_F(OperatorsTopKTest, DataInput) { test_against_sort_and_limit(input_table_wrapper); }
+
+TEST_F(OperatorsTopKTest, ReferenceInput) {
+  const auto a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto table_scan = std::make_shared<TableScan>(input_table_wrapper, greater_than_(a, 5));
+  table_scan->execute();
+
+  test_against_sort_and_limit(table_scan);
+}
+
+TEST_F(OperatorsTopKTest, WithScheduler) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  test_against_sort_and_limit(input_table_wrapper);
+}
+
+TEST_F(OperatorsTopKTest, ZeroRows) {
+  const auto top_k =
+      std::make_shared<TopK>(input_table_wrapper, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}}},
+                             value_(int64_t{0}));
+  top_k->execute();
+
+  EXPECT_EQ(top_k->get_output()->row_count(), 0);
+}
+
+TEST_F(OperatorsTopKTest, EmptyInput) {
+  const auto table_scan = std::make_shared<TableScan>(input_table_wrapper, equals_(1, 2));
+  table_scan->execute();
+
+  const auto top_k = std::make_shared<TopK>(
+      table_scan, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}}}, value_(int64_t{10}));
+  top_k->execute();
+
+  EXPECT_EQ(top_k->get_output()->row_count(), 0);
+}
+
+TEST_F(OperatorsTopKTest, OutputIsSorted) {
+  const auto sort_definition = SortColumnDefinition{ColumnID{1}, SortMode::Descending};
+  const auto top_k = std::make_shared<TopK>(input_table_wrapper, std::vector<SortColumnDefinition>{sort_definition},
+                                            value_(int64_t{5}));
+  top_k->execute();
+
+  const auto& output = top_k->get_output();
+  EXPECT_EQ(output->type(), TableType::References);
+  ASSERT_EQ(output->chunk_count(), 1);
+  EXPECT_EQ(output->get_chunk(ChunkID{0})->individually_sorted_by(),
+            std::vector<SortColumnDefinition>{sort_definition});
+}
+
+}  // namespace opossum
@@ -1,4 +1,5 @@
 #include <memory>
+#include <numeric>
 #include <utility>
 
 #include "base_test.hpp"
@@ -11,6 +12,7 @@
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/union_positions.hpp"
+#include "storage/pos_lists/bitmap_pos_list.hpp"
 #include "storage/reference_segment.hpp"
 
 namespace opossum {
@@ -141,6 +143,42 @@ TEST_F(UnionPositionsTest, SelfUnionOverlappingRangesMultipleSegments) {
                             load_table("resources/test_data/tbl/int_float4_overlapping_ranges.tbl"));
 }
 
+TEST_F(UnionPositionsTest, BitmapPosLists) {
+  /**
+   * Scans that select a large part of a chunk output BitmapPosLists, which UnionPositions combines with a bitwise OR.
+   * The table has two chunks with the values 0 to 999.
+   */
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data);
+  for (auto chunk_index = 0; chunk_index < 2; ++chunk_index) {
+    auto values = pmr_vector<int32_t>(500);
+    std::iota(values.begin(), values.end(), chunk_index * 500);
+    table->append_chunk(Segments{std::make_shared<ValueSegment<int32_t>>(std::move(values))});
+    table->last_chunk()->finalize();
+  }
+
+  auto table_wrapper_op = std::make_shared<TableWrapper>(table);
+  auto table_scan_a_op = std::make_shared<TableScan>(table_wrapper_op, less_than_(_int_column_0_non_nullable, 300));
+  auto table_scan_b_op =
+      std::make_shared<TableScan>(table_wrapper_op, greater_than_equals_(_int_column_0_non_nullable, 200));
+  auto union_unique_op = std::make_shared<UnionPositions>(table_scan_a_op, table_scan_b_op);
+
+  execute_all({table_wrapper_op, table_scan_a_op, table_scan_b_op, union_unique_op});
+
+  const auto& output = union_unique_op->get_output();
+  ASSERT_EQ(output->chunk_count(), 2);
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    const auto segment = output->get_chunk(chunk_id)->get_segment(ColumnID{0});
+    const auto& pos_list = std::static_pointer_cast<const ReferenceSegment>(segment)->pos_list();
+    EXPECT_TRUE(std::dynamic_pointer_cast<const BitmapPosList>(pos_list));
+  }
+
+  const auto rows = output->get_rows();
+  ASSERT_EQ(rows.size(), 1'000);
+  for (auto row_id = size_t{0}; row_id < rows.size(); ++row_id) {
+    EXPECT_EQ(rows[row_id][0], AllTypeVariant{static_cast<int32_t>(row_id)});
+  }
+}
+
 TEST_F(UnionPositionsTest, MultipleReferencedTables) {
   /**
    * Join int_float4 and int_int on their respective "a" column. Scan the result once for int_int.b >= 2 and for
@@ -0,0 +1,128 @@
+#include "base_test.hpp"
+
+#include "cost_estimation/cost_estimator_logical.hpp"
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "optimizer/join_ordering/dp_ccp.hpp"
+#include "optimizer/join_ordering/join_graph.hpp"
+#include "optimizer/join_ordering/linearized_dp.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "statistics/cardinality_estimator.hpp"
+
+/**
+ * LinearizedDp shares the placement of local and uncorrelated predicates with DpCcp (see dp_ccp_test.cpp). The tests
+ * here focus on the join order.
+ */
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class LinearizedDpTest : public BaseTest {
+ public:
+  void SetUp() override {
+    cardinality_estimator = std::make_shared<CardinalityEstimator>();
+    cost_estimator = std::make_shared<CostEstimatorLogical>(cardinality_estimator);
+
+    node_a = create_mock_node_with_statistics(MockNode::ColumnDefinitions{{DataType::Int, "a"}}, 20,
+                                              {GenericHistogram<int32_t>::with_single_bin(1, 50, 20, 10)});
+    node_b = create_mock_node_with_statistics(MockNode::ColumnDefinitions{{DataType::Int, "a"}}, 20,
+                                              {GenericHistogram<int32_t>::with_single_bin(40, 100, 20, 10)});
+    node_c = create_mock_node_with_statistics(MockNode::ColumnDefinitions{{DataType::Int, "a"}}, 20,
+                                              {GenericHistogram<int32_t>::with_single_bin(1, 100, 20, 10)});
+    node_d = create_mock_node_with_statistics(MockNode::ColumnDefinitions{{DataType::Int, "a"}}, 200,
+                                              {GenericHistogram<int32_t>::with_single_bin(1, 100, 200, 10)});
+
+    a_a = node_a->get_column("a");
+    b_a = node_b->get_column("a");
+    c_a = node_c->get_column("a");
+    d_a = node_d->get_column("a");
+  }
+
+  std::shared_ptr<MockNode> node_a, node_b, node_c, node_d;
+  std::shared_ptr<AbstractCardinalityEstimator> cardinality_estimator;
+  std::shared_ptr<AbstractCostEstimator> cost_estimator;
+  std::shared_ptr<LQPColumnExpression> a_a, b_a, c_a, d_a;
+};
+
+TEST_F(LinearizedDpTest, JoinOrdering) {
+  /**
+   * Joining A and B first yields the smallest intermediate result. Thus, the linear order is A, B, C and the best plan
+   * (the same as found by DpCcp) joins the interval [A, B] with C.
+   */
+
+  const auto join_edge_a_b = JoinGraphEdge{JoinGraphVertexSet{3, 0b011}, expression_vector(equals_(a_a, b_a))};
+  const auto join_edge_a_c = JoinGraphEdge{JoinGraphVertexSet{3, 0b101}, expression_vector(equals_(a_a, c_a))};
+  const auto join_edge_b_c = JoinGraphEdge{JoinGraphVertexSet{3, 0b110}, expression_vector(equals_(b_a, c_a))};
+
+  const auto join_graph = JoinGraph(std::vector<std::shared_ptr<AbstractLQPNode>>({node_a, node_b, node_c}),
+                                    std::vector<JoinGraphEdge>({join_edge_a_b, join_edge_a_c, join_edge_b_c}));
+
+  const auto actual_lqp = LinearizedDp{}(join_graph, cost_estimator);  // NOLINT
+
+  // clang-format off
+  const auto expected_lqp =
+  PredicateNode::make(equals_(b_a, c_a),
+    JoinNode::make(JoinMode::Inner, expression_vector(equals_(a_a, c_a)),
+      node_c,
+      JoinNode::make(JoinMode::Inner, equals_(a_a, b_a),
+        node_a,
+        node_b)));
+  // clang-format on
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(LinearizedDpTest, CrossJoin) {
+  /**
+   * The linear order is A, B, C. The interval [B, C] is not connected and can only be built with a cross join. Still,
+   * it is cheaper to join A and B first.
+   */
+
+  const auto join_edge_a_b = JoinGraphEdge{JoinGraphVertexSet{3, 0b011}, expression_vector(equals_(a_a, b_a))};
+  const auto cross_join_edge_a_c = JoinGraphEdge{JoinGraphVertexSet{3, 0b101}, {}};
+
+  const auto join_graph = JoinGraph(std::vector<std::shared_ptr<AbstractLQPNode>>({node_a, node_b, node_c}),
+                                    std::vector<JoinGraphEdge>({join_edge_a_b, cross_join_edge_a_c}));
+
+  const auto actual_lqp = LinearizedDp{}(join_graph, cost_estimator);  // NOLINT
+
+  // clang-format off
+  const auto expected_lqp =
+  JoinNode::make(JoinMode::Cross,
+    node_c,
+    JoinNode::make(JoinMode::Inner, equals_(a_a, b_a),
+      node_a,
+      node_b));
+  // clang-format on
+
+  EXPECT_LQP_EQ(expected_lqp, actual_lqp);
+}
+
+TEST_F(LinearizedDpTest, ChainWithScheduler) {
+  /**
+   * For the chain A - B - C - D, the linear order follows the chain and every connected subgraph is an interval of
+   * it. Thus, LinearizedDp considers the same plans as DpCcp. The intervals are processed in parallel.
+   */
+
+  const auto join_edge_a_b = JoinGraphEdge{JoinGraphVertexSet{4, 0b0011}, expression_vector(equals_(a_a, b_a))};
+  const auto join_edge_b_c = JoinGraphEdge{JoinGraphVertexSet{4, 0b0110}, expression_vector(equals_(b_a, c_a))};
+  const auto join_edge_c_d = JoinGraphEdge{JoinGraphVertexSet{4, 0b1100}, expression_vector(equals_(c_a, d_a))};
+
+  const auto join_graph = JoinGraph(std::vector<std::shared_ptr<AbstractLQPNode>>({node_a, node_b, node_c, node_d}),
+                                    std::vector<JoinGraphEdge>({join_edge_a_b, join_edge_b_c, join_edge_c_d}));
+
+  const auto dp_ccp_lqp = DpCcp{}(join_graph, cost_estimator);  // NOLINT
+
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  const auto actual_lqp = LinearizedDp{}(join_graph, cost_estimator);  // NOLINT
+
+  EXPECT_LQP_EQ(actual_lqp, dp_ccp_lqp);
+}
+
+}  // namespace opossum
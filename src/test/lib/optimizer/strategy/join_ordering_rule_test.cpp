@@ -6,8 +6,13 @@
 #include "logical_query_plan/join_node.hpp"
 #include "logical_query_plan/mock_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
+#include "optimizer/join_ordering/dp_ccp.hpp"
+#include "optimizer/join_ordering/greedy_operator_ordering.hpp"
+#include "optimizer/join_ordering/join_graph.hpp"
+#include "optimizer/join_ordering/linearized_dp.hpp"
 #include "optimizer/strategy/join_ordering_rule.hpp"
 #include "statistics/attribute_statistics.hpp"
+#include "statistics/cardinality_estimator.hpp"
 #include "statistics/table_statistics.hpp"
 
 /**
@@ -78,4 +83,54 @@ TEST_F(JoinOrderingRuleTest, MultipleJoinGraphs) {
   EXPECT_LQP_EQ(actual_lqp, expected_lqp);
 }
 
+TEST_F(JoinOrderingRuleTest, AlgorithmDependsOnVertexCount) {
+  // The JoinGraph is tree-shaped: Vertex i is joined with vertex (i - 1) / 2. The vertices differ in size so that the
+  // algorithms have something to choose from.
+  const auto create_lqp = [&](const size_t vertex_count) {
+    auto columns = std::vector<std::shared_ptr<LQPColumnExpression>>{};
+    auto join_lqp = std::shared_ptr<AbstractLQPNode>{};
+    for (auto vertex_idx = size_t{0}; vertex_idx < vertex_count; ++vertex_idx) {
+      const auto row_count = 10 + (vertex_idx * 37) % 100;
+      const auto histogram = GenericHistogram<int32_t>::with_single_bin(1, 100, static_cast<float>(row_count),
+                                                                        static_cast<float>(row_count / 2));
+      const auto column_name = "c" + std::to_string(vertex_idx);
+      const auto node = create_mock_node_with_statistics({{DataType::Int, column_name}}, row_count, {histogram});
+      columns.emplace_back(node->get_column(column_name));
+
+      if (!join_lqp) {
+        join_lqp = node;
+      } else {
+        join_lqp = JoinNode::make(JoinMode::Inner, equals_(columns[(vertex_idx - 1) / 2], columns[vertex_idx]),
+                                  join_lqp, node);
+      }
+    }
+    return std::make_pair(join_lqp, columns.front());
+  };
+
+  const auto expect_algorithm = [&](const size_t vertex_count, AbstractJoinOrderingAlgorithm&& algorithm) {
+    SCOPED_TRACE(vertex_count);
+    const auto [join_lqp, column] = create_lqp(vertex_count);
+
+    // The JoinGraph is built before the rule modifies the LQP
+    const auto join_graph = JoinGraph::build_from_lqp(join_lqp);
+    ASSERT_TRUE(join_graph);
+    ASSERT_EQ(join_graph->vertices.size(), vertex_count);
+    const auto cost_estimator = std::make_shared<CostEstimatorLogical>(std::make_shared<CardinalityEstimator>());
+    const auto expected_lqp =
+        AggregateNode::make(expression_vector(column), expression_vector(), algorithm(*join_graph, cost_estimator));
+
+    const auto input_lqp = AggregateNode::make(expression_vector(column), expression_vector(), join_lqp);
+    const auto actual_lqp = apply_rule(rule, input_lqp);
+
+    EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+  };
+
+  // Graphs with up to MAX_DP_CCP_VERTEX_COUNT (i.e., 9) vertices are ordered with DpCcp, graphs with up to
+  // MAX_LINEARIZED_DP_VERTEX_COUNT (i.e., 50) vertices with LinearizedDp, and larger graphs with GOO
+  expect_algorithm(JoinOrderingRule::MAX_DP_CCP_VERTEX_COUNT, DpCcp{});
+  expect_algorithm(JoinOrderingRule::MAX_DP_CCP_VERTEX_COUNT + 1, LinearizedDp{});
+  expect_algorithm(JoinOrderingRule::MAX_LINEARIZED_DP_VERTEX_COUNT, LinearizedDp{});
+  expect_algorithm(JoinOrderingRule::MAX_LINEARIZED_DP_VERTEX_COUNT + 1, GreedyOperatorOrdering{});
+}
+
 }  // namespace opossum
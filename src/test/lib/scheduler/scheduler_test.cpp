@@ -257,4 +257,82 @@ TEST_F(SchedulerTest, SingleWorkerGuaranteeProgress) {
   Hyrise::get().scheduler()->finish();
 }
 
+TEST_F(SchedulerTest, WorkStealingBasicTest) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>(NodeQueueScheduler::Mode::WorkStealing));
+
+  std::atomic_uint counter{0};
+
+  increment_counter_in_subtasks(counter);
+
+  Hyrise::get().scheduler()->finish();
+
+  ASSERT_EQ(counter, 30u);
+}
+
+TEST_F(SchedulerTest, WorkStealingDependencies) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>(NodeQueueScheduler::Mode::WorkStealing));
+
+  std::atomic_uint linear_counter{0u};
+  std::atomic_uint multiple_counter{0u};
+  std::atomic_uint diamond_counter{0u};
+
+  stress_linear_dependencies(linear_counter);
+  stress_multiple_dependencies(multiple_counter);
+  stress_diamond_dependencies(diamond_counter);
+
+  Hyrise::get().scheduler()->finish();
+
+  EXPECT_EQ(linear_counter, 3u);
+  EXPECT_EQ(multiple_counter, 4u);
+  EXPECT_EQ(diamond_counter, 7u);
+}
+
+TEST_F(SchedulerTest, WorkStealingSingleWorkerGuaranteeProgress) {
+  Hyrise::get().topology.use_default_topology(1);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>(NodeQueueScheduler::Mode::WorkStealing));
+
+  auto task_done = false;
+  auto task = std::make_shared<JobTask>([&task_done]() {
+    auto subtask = std::make_shared<JobTask>([&task_done]() { task_done = true; });
+
+    subtask->schedule();
+    Hyrise::get().scheduler()->wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{subtask});
+  });
+
+  task->schedule();
+  Hyrise::get().scheduler()->wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{task});
+  EXPECT_TRUE(task_done);
+
+  Hyrise::get().scheduler()->finish();
+}
+
+TEST_F(SchedulerTest, WorkStealingNestedJobs) {
+  // Many short jobs that spawn jobs themselves. Workers that run out of work have to steal from the deques of the
+  // others and must not miss any wakeup, otherwise this test deadlocks.
+  Hyrise::get().topology.use_fake_numa_topology(8, 2);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>(NodeQueueScheduler::Mode::WorkStealing));
+
+  std::atomic_uint counter{0};
+
+  for (auto iteration = 0; iteration < 100; ++iteration) {
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto job_id = 0; job_id < 20; ++job_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&]() {
+        auto subjobs = std::vector<std::shared_ptr<AbstractTask>>{};
+        for (auto subjob_id = 0; subjob_id < 5; ++subjob_id) {
+          subjobs.emplace_back(std::make_shared<JobTask>([&]() { ++counter; }));
+        }
+        Hyrise::get().scheduler()->schedule_and_wait_for_tasks(subjobs);
+      }));
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+  }
+
+  Hyrise::get().scheduler()->finish();
+
+  EXPECT_EQ(counter, 100u * 20u * 5u);
+}
+
 }  // namespace opossum
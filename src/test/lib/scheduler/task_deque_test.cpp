@@ -0,0 +1,85 @@
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "scheduler/job_task.hpp"
+#include "scheduler/task_deque.hpp"
+
+namespace opossum {
+
+class TaskDequeTest : public BaseTest {};
+
+TEST_F(TaskDequeTest, PopIsLifoAndStealIsFifo) {
+  auto deque = TaskDeque{};
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto index = 0; index < 3; ++index) {
+    tasks.emplace_back(std::make_shared<JobTask>([]() {}));
+    deque.push(tasks.back());
+  }
+  EXPECT_EQ(deque.size(), 3);
+
+  EXPECT_EQ(deque.pop(), tasks[2]);
+  EXPECT_EQ(deque.steal(), tasks[0]);
+  EXPECT_EQ(deque.pop(), tasks[1]);
+
+  EXPECT_TRUE(deque.empty());
+  EXPECT_EQ(deque.pop(), nullptr);
+  EXPECT_EQ(deque.steal(), nullptr);
+}
+
+TEST_F(TaskDequeTest, Grow) {
+  auto deque = TaskDeque{2};
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto index = 0; index < 100; ++index) {
+    tasks.emplace_back(std::make_shared<JobTask>([]() {}));
+    deque.push(tasks.back());
+  }
+
+  for (auto index = 0; index < 100; ++index) {
+    EXPECT_EQ(deque.steal(), tasks[index]);
+  }
+  EXPECT_TRUE(deque.empty());
+}
+
+TEST_F(TaskDequeTest, ConcurrentStealing) {
+  // Every task has to be taken exactly once, either by the owner or by one of the thieves.
+  constexpr auto TASK_COUNT = 10'000;
+  constexpr auto THIEF_COUNT = 3;
+
+  auto deque = TaskDeque{4};
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto index = 0; index < TASK_COUNT; ++index) {
+    tasks.emplace_back(std::make_shared<JobTask>([]() {}));
+  }
+
+  auto taken_count = std::atomic_uint{0};
+  auto owner_done = std::atomic_bool{false};
+  const auto take = [&](const std::shared_ptr<AbstractTask>& task) {
+    if (!task) return;
+    EXPECT_TRUE(task->try_mark_as_enqueued());
+    ++taken_count;
+  };
+
+  auto thieves = std::vector<std::thread>{};
+  for (auto thief_id = 0; thief_id < THIEF_COUNT; ++thief_id) {
+    thieves.emplace_back([&]() {
+      while (!owner_done || !deque.empty()) take(deque.steal());
+    });
+  }
+
+  for (auto index = 0; index < TASK_COUNT; ++index) {
+    deque.push(tasks[index]);
+    if (index % 3 == 0) take(deque.pop());
+  }
+  while (!deque.empty()) take(deque.pop());
+  owner_done = true;
+
+  for (auto& thief : thieves) thief.join();
+
+  EXPECT_EQ(taken_count, TASK_COUNT);
+}
+
+}  // namespace opossum
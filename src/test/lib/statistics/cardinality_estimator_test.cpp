@@ -90,6 +90,7 @@ class CardinalityEstimatorTest : public BaseTest {
                                               {histogram_c_x, histogram_c_y});
 
     c_x = node_c->get_column("x");
+    c_y = node_c->get_column("y");
 
     /**
      * node_d
@@ -142,7 +143,7 @@ class CardinalityEstimatorTest : public BaseTest {
   }
 
   CardinalityEstimator estimator;
-  std::shared_ptr<LQPColumnExpression> a_a, a_b, b_a, b_b, c_x, d_a, d_b, d_c, e_a, e_b, f_a, f_b, g_a;
+  std::shared_ptr<LQPColumnExpression> a_a, a_b, b_a, b_b, c_x, c_y, d_a, d_b, d_c, e_a, e_b, f_a, f_b, g_a;
   std::shared_ptr<MockNode> node_a, node_b, node_c, node_d, node_e, node_f, node_g;
 };
 
@@ -214,7 +215,7 @@ TEST_F(CardinalityEstimatorTest, JoinNumericEquiInner) {
 }
 
 TEST_F(CardinalityEstimatorTest, JoinNumericEquiInnerMultiPredicates) {
-  // For now, secondary join predicates are ignored for CardinalityEstimation
+  // Without column groups, secondary join predicates are ignored for CardinalityEstimation
 
   // clang-format off
   const auto input_lqp =
@@ -229,6 +230,30 @@ TEST_F(CardinalityEstimatorTest, JoinNumericEquiInnerMultiPredicates) {
   ASSERT_EQ(result_statistics->row_count, 128u);
 }
 
+TEST_F(CardinalityEstimatorTest, JoinNumericEquiInnerMultiPredicatesWithColumnGroup) {
+  // {x, y} is unique in node_c, i.e., there are 64 distinct join keys on the right side. On the left side, there are
+  // at most 32 (the row count). Each of the 32 rows on the left side finds one match.
+  node_c->set_key_constraints({TableKeyConstraint{{ColumnID{0}, ColumnID{1}}, KeyConstraintType::UNIQUE}});
+
+  // clang-format off
+  const auto input_lqp =
+  JoinNode::make(JoinMode::Inner, expression_vector(equals_(b_a, c_x), equals_(b_b, c_y)),
+    node_b,
+    node_c);
+  // clang-format on
+
+  const auto result_statistics = estimator.estimate_statistics(input_lqp);
+
+  ASSERT_EQ(result_statistics->column_statistics.size(), 4u);
+  EXPECT_FLOAT_EQ(result_statistics->row_count, 32.0f);
+
+  // The column group of node_c is forwarded with the ColumnIDs of the join output
+  ASSERT_EQ(result_statistics->column_group_statistics.size(), 1u);
+  EXPECT_EQ(result_statistics->column_group_statistics[0].column_ids,
+            std::vector<ColumnID>({ColumnID{2}, ColumnID{3}}));
+  EXPECT_FLOAT_EQ(result_statistics->column_group_statistics[0].distinct_count, 32.0f);
+}
+
 TEST_F(CardinalityEstimatorTest, JoinNumericNonEquiInner) {
   // Test that joins on with non-equi predicate conditions are estimated as cross joins (for now)
 
@@ -629,6 +654,52 @@ TEST_F(CardinalityEstimatorTest, PredicateTwoOnDifferentColumns) {
   EXPECT_FLOAT_EQ(estimator.estimate_cardinality(input_lqp->left_input()->left_input()), 100.0f);
 }
 
+TEST_F(CardinalityEstimatorTest, PredicateWithColumnGroup) {
+  // d_a determines d_b, i.e., there are as many distinct combinations of d_a and d_b as there are values of d_a
+  node_d->table_statistics()->column_group_statistics.emplace_back(std::vector<ColumnID>{ColumnID{0}, ColumnID{1}},
+                                                                  20.0f);
+
+  // clang-format off
+  const auto input_lqp_a =
+  PredicateNode::make(equals_(d_b, 55),
+    PredicateNode::make(equals_(d_a, 50),  // s=0.05
+      node_d));
+
+  // Selects 20 rows with 20 / 5 = 4 distinct values of d_a
+  const auto input_lqp_b =
+  PredicateNode::make(equals_(d_a, 50),
+    PredicateNode::make(equals_(d_b, 55),  // s=0.2
+      node_d));
+
+  const auto input_lqp_c =
+  PredicateNode::make(and_(equals_(d_a, 50), equals_(d_b, 55)),
+    node_d);
+  // clang-format on
+
+  EXPECT_FLOAT_EQ(estimator.estimate_cardinality(input_lqp_a), 5.0f);
+  EXPECT_FLOAT_EQ(estimator.estimate_cardinality(input_lqp_a->left_input()), 5.0f);
+  EXPECT_FLOAT_EQ(estimator.estimate_cardinality(input_lqp_b), 5.0f);
+  EXPECT_FLOAT_EQ(estimator.estimate_cardinality(input_lqp_b->left_input()), 20.0f);
+  EXPECT_FLOAT_EQ(estimator.estimate_cardinality(input_lqp_c), 5.0f);
+
+  // Column groups are dropped for other predicates on their columns
+  const auto input_lqp_d = PredicateNode::make(greater_than_(d_a, 50), node_d);
+  EXPECT_TRUE(estimator.estimate_statistics(input_lqp_d)->column_group_statistics.empty());
+}
+
+TEST_F(CardinalityEstimatorTest, PredicateWithFunctionalDependency) {
+  node_d->set_functional_dependencies({FunctionalDependency{{d_a}, {d_b}}});
+
+  // clang-format off
+  const auto input_lqp =
+  PredicateNode::make(equals_(d_b, 55),
+    PredicateNode::make(equals_(d_a, 50),  // s=0.05
+      node_d));
+  // clang-format on
+
+  EXPECT_FLOAT_EQ(estimator.estimate_cardinality(input_lqp), 5.0f);
+}
+
 TEST_F(CardinalityEstimatorTest, PredicateMultiple) {
   // clang-format off
   const auto input_lqp =
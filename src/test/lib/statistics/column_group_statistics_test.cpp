@@ -0,0 +1,23 @@
+#include "base_test.hpp"
+
+#include "statistics/column_group_statistics.hpp"
+
+namespace opossum {
+
+class ColumnGroupStatisticsTest : public BaseTest {};
+
+TEST_F(ColumnGroupStatisticsTest, Remap) {
+  const auto column_group_statistics =
+      std::vector<ColumnGroupStatistics>{ColumnGroupStatistics{{ColumnID{0}, ColumnID{2}}, 10.0f},
+                                         ColumnGroupStatistics{{ColumnID{1}, ColumnID{2}}, 20.0f}};
+
+  // Column 0 is pruned, columns 1 and 2 are swapped
+  const auto remapped_column_group_statistics =
+      remap_column_group_statistics(column_group_statistics, {std::nullopt, ColumnID{1}, ColumnID{0}});
+
+  ASSERT_EQ(remapped_column_group_statistics.size(), 1u);
+  EXPECT_EQ(remapped_column_group_statistics[0].column_ids, std::vector<ColumnID>({ColumnID{0}, ColumnID{1}}));
+  EXPECT_FLOAT_EQ(remapped_column_group_statistics[0].distinct_count, 20.0f);
+}
+
+}  // namespace opossum
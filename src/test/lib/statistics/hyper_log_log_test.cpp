@@ -0,0 +1,51 @@
+#include "base_test.hpp"
+
+#include "statistics/hyper_log_log.hpp"
+
+namespace opossum {
+
+class HyperLogLogTest : public BaseTest {};
+
+TEST_F(HyperLogLogTest, EmptySketch) {
+  const auto sketch = HyperLogLog{};
+  EXPECT_EQ(sketch.estimate(), 0.0);
+}
+
+TEST_F(HyperLogLogTest, Estimate) {
+  for (const auto distinct_count : {10, 1'000, 100'000}) {
+    auto sketch = HyperLogLog{};
+    for (auto value = 0; value < distinct_count; ++value) {
+      sketch.add(value);
+    }
+
+    // Adding values a second time does not change the sketch
+    for (auto value = 0; value < distinct_count; ++value) {
+      sketch.add(value);
+    }
+
+    EXPECT_NEAR(sketch.estimate(), distinct_count, distinct_count * 0.03);
+  }
+}
+
+TEST_F(HyperLogLogTest, Strings) {
+  auto sketch = HyperLogLog{};
+  for (auto value = 0; value < 5'000; ++value) {
+    sketch.add(pmr_string{"value" + std::to_string(value % 2'000)});
+  }
+
+  EXPECT_NEAR(sketch.estimate(), 2'000, 2'000 * 0.03);
+}
+
+TEST_F(HyperLogLogTest, Merge) {
+  auto sketch_a = HyperLogLog{};
+  auto sketch_b = HyperLogLog{};
+  for (auto value = 0; value < 20'000; ++value) {
+    sketch_a.add(value);
+    sketch_b.add(value + 10'000);
+  }
+
+  sketch_a.merge(sketch_b);
+  EXPECT_NEAR(sketch_a.estimate(), 30'000, 30'000 * 0.03);
+}
+
+}  // namespace opossum
@@ -60,4 +60,26 @@ TEST_F(EqualDistinctCountHistogramTest, FromColumnFloat) {
   EXPECT_EQ(hist->bin(BinID{2}), HistogramBin<float>(3.6f, 6.1f, 4, 3));
 }
 
+TEST_F(EqualDistinctCountHistogramTest, FromSample) {
+  using ValueDistribution = std::vector<std::pair<int32_t, HistogramCountType>>;
+  const auto sampled_value_distribution = ValueDistribution{{1, 2}, {2, 1}, {3, 1}, {5, 2}, {8, 2}};
+
+  // The sample contains 8 of 80 values, the bin heights are scaled up accordingly
+  const auto hist =
+      EqualDistinctCountHistogram<int32_t>::from_sample(ValueDistribution{sampled_value_distribution}, 80, 50, 2u);
+
+  ASSERT_EQ(hist->bin_count(), 2u);
+  EXPECT_EQ(hist->bin(BinID{0}), HistogramBin<int32_t>(1, 3, 40, 25));
+  EXPECT_EQ(hist->bin(BinID{1}), HistogramBin<int32_t>(5, 8, 40, 25));
+  EXPECT_EQ(hist->total_count(), 80);
+  EXPECT_EQ(hist->total_distinct_count(), 50);
+
+  // The distinct count cannot be lower than that of the sample
+  const auto underestimated_hist =
+      EqualDistinctCountHistogram<int32_t>::from_sample(ValueDistribution{sampled_value_distribution}, 80, 3, 2u);
+  EXPECT_EQ(underestimated_hist->total_distinct_count(), 5);
+
+  EXPECT_FALSE(EqualDistinctCountHistogram<int32_t>::from_sample(ValueDistribution{}, 0, 0, 2u));
+}
+
 }  // namespace opossum
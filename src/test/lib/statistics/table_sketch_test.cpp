@@ -0,0 +1,96 @@
+#include "base_test.hpp"
+
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/statistics_objects/abstract_histogram.hpp"
+#include "statistics/table_sketch.hpp"
+#include "statistics/table_statistics.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class TableSketchTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // 200 rows in ten chunks, the last one is still mutable
+    _table = load_table("resources/test_data/tbl/int_with_nulls_large.tbl", 20, FinalizeLastChunk::No);
+  }
+
+  std::shared_ptr<AbstractHistogram<int32_t>> histogram_a(const TableStatistics& table_statistics) {
+    const auto column_statistics =
+        std::dynamic_pointer_cast<AttributeStatistics<int32_t>>(table_statistics.column_statistics.at(0));
+    return std::dynamic_pointer_cast<AbstractHistogram<int32_t>>(column_statistics->histogram);
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(TableSketchTest, FromTable) {
+  const auto table_sketch = TableSketch::from_table(*_table);
+
+  // The mutable chunk is not part of the sketch
+  EXPECT_FLOAT_EQ(table_sketch->row_count(), 180);
+  EXPECT_TRUE(table_sketch->contains_chunk(ChunkID{8}));
+  EXPECT_FALSE(table_sketch->contains_chunk(ChunkID{9}));
+
+  const auto table_statistics = table_sketch->table_statistics();
+  EXPECT_FLOAT_EQ(table_statistics->row_count, 180);
+  ASSERT_EQ(table_statistics->column_statistics.size(), 2u);
+
+  // The table is smaller than the sample, so that the statistics are exact
+  const auto histogram = histogram_a(*table_statistics);
+  ASSERT_TRUE(histogram);
+  EXPECT_FLOAT_EQ(histogram->total_count(), 155);
+  EXPECT_FLOAT_EQ(histogram->total_distinct_count(), 10);
+
+  // Statistics can be scaled to include the rows of the mutable chunk
+  const auto scaled_table_statistics = table_sketch->table_statistics(200);
+  EXPECT_FLOAT_EQ(scaled_table_statistics->row_count, 200);
+  EXPECT_NEAR(histogram_a(*scaled_table_statistics)->total_count(), 155.0f * 200 / 180, 1.0f);
+}
+
+TEST_F(TableSketchTest, AddChunk) {
+  auto table_sketch = TableSketch{_table->column_data_types(), 1.0};
+  EXPECT_FLOAT_EQ(table_sketch.row_count(), 0);
+
+  EXPECT_TRUE(table_sketch.add_chunk(ChunkID{0}, *_table->get_chunk(ChunkID{0})));
+  EXPECT_TRUE(table_sketch.add_chunk(ChunkID{1}, *_table->get_chunk(ChunkID{1})));
+  EXPECT_FLOAT_EQ(table_sketch.row_count(), 40);
+
+  // Chunks are only added once
+  EXPECT_FALSE(table_sketch.add_chunk(ChunkID{1}, *_table->get_chunk(ChunkID{1})));
+  EXPECT_FLOAT_EQ(table_sketch.row_count(), 40);
+
+  const auto table_statistics = table_sketch.table_statistics();
+  EXPECT_FLOAT_EQ(table_statistics->row_count, 40);
+
+  // The first 40 rows of column a contain five NULL values and eight distinct values
+  const auto histogram = histogram_a(*table_statistics);
+  ASSERT_TRUE(histogram);
+  EXPECT_FLOAT_EQ(histogram->total_count(), 35);
+  EXPECT_FLOAT_EQ(histogram->total_distinct_count(), 8);
+}
+
+TEST_F(TableSketchTest, ClaimRebuild) {
+  auto table_sketch = TableSketch{_table->column_data_types(), 1.0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < 4; ++chunk_id) {
+    table_sketch.add_chunk(chunk_id, *_table->get_chunk(chunk_id));
+  }
+
+  // Sketches that were not created from a table become stale with the first chunk
+  EXPECT_TRUE(table_sketch.claim_rebuild());
+  EXPECT_FALSE(table_sketch.claim_rebuild());
+
+  // A sketch of 200 rows becomes stale once more than 100 rows have been added
+  _table->last_chunk()->finalize();
+  const auto new_chunks = load_table("resources/test_data/tbl/int_with_nulls_large.tbl", 20);
+  const auto stale_table_sketch = TableSketch::from_table(*_table);
+  for (auto chunk_id = ChunkID{0}; chunk_id < 5; ++chunk_id) {
+    stale_table_sketch->add_chunk(ChunkID{10 + chunk_id}, *new_chunks->get_chunk(chunk_id));
+  }
+  EXPECT_FALSE(stale_table_sketch->claim_rebuild());
+
+  stale_table_sketch->add_chunk(ChunkID{15}, *new_chunks->get_chunk(ChunkID{5}));
+  EXPECT_TRUE(stale_table_sketch->claim_rebuild());
+}
+
+}  // namespace opossum
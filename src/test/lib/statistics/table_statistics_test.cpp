@@ -3,12 +3,41 @@
 #include "statistics/attribute_statistics.hpp"
 #include "statistics/generate_pruning_statistics.hpp"
 #include "statistics/statistics_objects/abstract_histogram.hpp"
+#include "statistics/table_sketch.hpp"
 #include "statistics/table_statistics.hpp"
+#include "statistics/update_table_statistics.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "utils/load_table.hpp"
 
 namespace opossum {
 
-class TableStatisticsTest : public BaseTest {};
+class TableStatisticsTest : public BaseTest {
+ protected:
+  // Column a contains the values 0 to 999 and every seventh row is NULL, column b contains 50 distinct strings
+  std::shared_ptr<Table> create_large_table() {
+    const auto row_count = 200'000;
+    const auto chunk_size = ChunkOffset{10'000};
+
+    auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::String, false}};
+    auto table = std::make_shared<Table>(column_definitions, TableType::Data, chunk_size);
+
+    for (auto chunk_begin = 0; chunk_begin < row_count; chunk_begin += chunk_size) {
+      auto values_a = pmr_vector<int32_t>{};
+      auto null_values_a = pmr_vector<bool>{};
+      auto values_b = pmr_vector<pmr_string>{};
+      for (auto row_id = chunk_begin; row_id < chunk_begin + static_cast<int32_t>(chunk_size); ++row_id) {
+        values_a.push_back(row_id % 1'000);
+        null_values_a.push_back(row_id % 7 == 0);
+        values_b.push_back(pmr_string{"value" + std::to_string(row_id % 50)});
+      }
+      table->append_chunk({std::make_shared<ValueSegment<int32_t>>(std::move(values_a), std::move(null_values_a)),
+                           std::make_shared<ValueSegment<pmr_string>>(std::move(values_b))});
+      table->last_chunk()->finalize();
+    }
+
+    return table;
+  }
+};
 
 TEST_F(TableStatisticsTest, FromTable) {
   const auto table = load_table("resources/test_data/tbl/int_with_nulls_large.tbl", 20);
@@ -41,4 +70,117 @@ TEST_F(TableStatisticsTest, FromTable) {
   EXPECT_FLOAT_EQ(histogram_b->total_distinct_count(), 190);
 }
 
+TEST_F(TableStatisticsTest, FromTableSampled) {
+  const auto table = create_large_table();
+
+  const auto check_statistics = [&](const auto& table_statistics) {
+    ASSERT_EQ(table_statistics->row_count, 200'000u);
+
+    const auto column_statistics_a =
+        std::dynamic_pointer_cast<AttributeStatistics<int32_t>>(table_statistics->column_statistics.at(0));
+    const auto histogram_a = std::dynamic_pointer_cast<AbstractHistogram<int32_t>>(column_statistics_a->histogram);
+    ASSERT_TRUE(histogram_a);
+    EXPECT_NEAR(histogram_a->total_count(), 171'428, 171'428 * 0.02);
+    EXPECT_NEAR(histogram_a->total_distinct_count(), 1'000, 1'000 * 0.03);
+    EXPECT_NEAR(column_statistics_a->null_value_ratio->ratio, 1.0 / 7, 0.01);
+
+    const auto column_statistics_b =
+        std::dynamic_pointer_cast<AttributeStatistics<pmr_string>>(table_statistics->column_statistics.at(1));
+    const auto histogram_b = std::dynamic_pointer_cast<AbstractHistogram<pmr_string>>(column_statistics_b->histogram);
+    ASSERT_TRUE(histogram_b);
+    EXPECT_FLOAT_EQ(histogram_b->total_count(), 200'000);
+    EXPECT_FLOAT_EQ(histogram_b->total_distinct_count(), 50);
+    EXPECT_EQ(histogram_b->bin_count(), 50);
+    EXPECT_FLOAT_EQ(column_statistics_b->null_value_ratio->ratio, 0.0f);
+  };
+
+  // Tables of this size are not sampled by default
+  ASSERT_LT(table->row_count(), TableStatistics::SAMPLED_STATISTICS_MIN_ROW_COUNT);
+  const auto full_statistics = TableStatistics::from_table(*table);
+  check_statistics(full_statistics);
+  EXPECT_FLOAT_EQ(std::dynamic_pointer_cast<AttributeStatistics<int32_t>>(full_statistics->column_statistics.at(0))
+                      ->histogram->total_count(),
+                  171'428);
+
+  check_statistics(TableStatistics::from_table(*table, StatisticsGenerationMode::Sampled));
+
+  // For dictionary segments, the distinct values are taken from the dictionary
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::Dictionary});
+  check_statistics(TableStatistics::from_table(*table, StatisticsGenerationMode::Sampled));
+}
+
+TEST_F(TableStatisticsTest, FromTableSampledWithMutableChunk) {
+  const auto rows = load_table("resources/test_data/tbl/int_with_nulls_large.tbl")->get_rows();
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::Int, true}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{100});
+  for (auto row_id = size_t{0}; row_id < 150; ++row_id) {
+    table->append(rows[row_id]);
+  }
+
+  // The sketch only covers the first (finalized) chunk, the rows of the mutable chunk are accounted for by scaling
+  const auto table_statistics = TableStatistics::from_table(*table, StatisticsGenerationMode::Sampled);
+  ASSERT_TRUE(table_statistics->table_sketch);
+  EXPECT_FLOAT_EQ(table_statistics->table_sketch->row_count(), 100);
+  EXPECT_FLOAT_EQ(table_statistics->row_count, 150);
+
+  // Without immutable chunks, nothing can be scaled and full statistics are built instead
+  const auto mutable_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{200});
+  for (auto row_id = size_t{0}; row_id < 150; ++row_id) {
+    mutable_table->append(rows[row_id]);
+  }
+  const auto mutable_table_statistics = TableStatistics::from_table(*mutable_table, StatisticsGenerationMode::Sampled);
+  EXPECT_FALSE(mutable_table_statistics->table_sketch);
+  EXPECT_FLOAT_EQ(mutable_table_statistics->row_count, 150);
+}
+
+TEST_F(TableStatisticsTest, UpdateTableStatistics) {
+  const auto rows = load_table("resources/test_data/tbl/int_with_nulls_large.tbl")->get_rows();
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::Int, true}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{20});
+
+  // Table::append() finalizes full chunks without creating pruning statistics
+  const auto append_rows = [&](const size_t begin, const size_t end) {
+    for (auto row_id = begin; row_id < end; ++row_id) {
+      table->append(rows[row_id]);
+    }
+  };
+  append_rows(0, 81);
+  ASSERT_EQ(table->chunk_count(), 5);
+
+  // Tables without statistics are ignored
+  update_table_statistics(table);
+  EXPECT_FALSE(table->table_statistics());
+  EXPECT_FALSE(table->get_chunk(ChunkID{0})->pruning_statistics());
+
+  // Full statistics do not have a sketch, which is created on the first update
+  table->set_table_statistics(TableStatistics::from_table(*table));
+  EXPECT_FALSE(table->table_statistics()->table_sketch);
+  update_table_statistics(table);
+  const auto table_sketch = table->table_statistics()->table_sketch;
+  ASSERT_TRUE(table_sketch);
+  EXPECT_FLOAT_EQ(table_sketch->row_count(), 80);
+
+  // The mutable chunk is not sketched, but its rows are part of the statistics' row count
+  EXPECT_FLOAT_EQ(table->table_statistics()->row_count, 81);
+
+  // Newly finalized chunks are folded into the statistics and get pruning statistics, the mutable chunk does not
+  append_rows(81, 121);
+  ASSERT_EQ(table->chunk_count(), 7);
+  update_table_statistics(table);
+  EXPECT_FLOAT_EQ(table_sketch->row_count(), 120);
+  EXPECT_FLOAT_EQ(table->table_statistics()->row_count, 121);
+  EXPECT_EQ(table->table_statistics()->table_sketch, table_sketch);
+  EXPECT_TRUE(table->get_chunk(ChunkID{4})->pruning_statistics());
+  EXPECT_TRUE(table->get_chunk(ChunkID{5})->pruning_statistics());
+  EXPECT_FALSE(table->get_chunk(ChunkID{6})->pruning_statistics());
+
+  // Once the table has grown by more than half, the sketch is rebuilt. With the ImmediateExecutionScheduler, this
+  // happens before update_table_statistics() returns.
+  append_rows(121, 141);
+  update_table_statistics(table);
+  EXPECT_FLOAT_EQ(table->table_statistics()->row_count, 141);
+  EXPECT_NE(table->table_statistics()->table_sketch, table_sketch);
+  EXPECT_TRUE(table->table_statistics()->table_sketch->contains_chunk(ChunkID{6}));
+}
+
 }  // namespace opossum
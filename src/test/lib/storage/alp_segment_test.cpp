@@ -0,0 +1,165 @@
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "storage/alp_segment.hpp"
+#include "storage/alp_segment/alp_encoder.hpp"
+#include "storage/alp_segment/alp_utils.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class StorageALPSegmentTest : public BaseTest {
+ protected:
+  template <typename T>
+  std::shared_ptr<ALPSegment<T>> _compress(const std::shared_ptr<ValueSegment<T>>& segment,
+                                           const VectorCompressionType vector_compression_type) {
+    const auto encoded_segment = ChunkEncoder::encode_segment(
+        segment, data_type_from_type<T>(), SegmentEncodingSpec{EncodingType::ALP, vector_compression_type});
+    return std::dynamic_pointer_cast<ALPSegment<T>>(encoded_segment);
+  }
+
+  // Compares bitwise so that NaN and -0.0 are checked as well
+  template <typename T>
+  void _expect_bitwise_equal(const T lhs, const T rhs) {
+    EXPECT_EQ(std::memcmp(&lhs, &rhs, sizeof(T)), 0) << lhs << " != " << rhs;
+  }
+};
+
+TEST_F(StorageALPSegmentTest, EncodeAndDecodeDecimals) {
+  const auto encoded_value = alp_encode(12.34, 2, 0);
+  ASSERT_TRUE(encoded_value);
+  EXPECT_EQ(*encoded_value, 1234);
+  EXPECT_EQ(alp_decode<double>(1234, 2, 0), 12.34);
+
+  // Factors remove trailing zeros
+  EXPECT_EQ(alp_encode(1200.0, 0, 2), int64_t{12});
+  EXPECT_EQ(alp_encode(0.5f, 1, 0), int64_t{5});
+
+  // Values that cannot be restored exactly are rejected
+  EXPECT_FALSE(alp_encode(M_PI, 2, 0));
+  EXPECT_FALSE(alp_encode(-0.0, 0, 0));
+  EXPECT_FALSE(alp_encode(std::numeric_limits<double>::quiet_NaN(), 0, 0));
+  EXPECT_FALSE(alp_encode(std::numeric_limits<double>::infinity(), 0, 0));
+  EXPECT_FALSE(alp_encode(1e300, 0, 0));
+}
+
+TEST_F(StorageALPSegmentTest, CompressDecimalSegment) {
+  for (const auto vector_compression_type :
+       {VectorCompressionType::FixedSizeByteAligned, VectorCompressionType::SimdBp128}) {
+    auto values = pmr_vector<double>{};
+    for (auto index = 0; index < 3000; ++index) {
+      values.push_back(static_cast<double>(index % 977) / 100.0);
+    }
+    const auto value_segment = std::make_shared<ValueSegment<double>>(pmr_vector<double>{values});
+
+    const auto alp_segment = _compress(value_segment, vector_compression_type);
+    ASSERT_TRUE(alp_segment);
+    ASSERT_EQ(alp_segment->size(), values.size());
+    EXPECT_EQ(alp_segment->blocks().size(), 3u);
+    EXPECT_TRUE(alp_segment->exception_values().empty());
+    EXPECT_FALSE(alp_segment->null_values());
+    EXPECT_LT(alp_segment->memory_usage(MemoryUsageCalculationMode::Full), value_segment->memory_usage(
+                                                                               MemoryUsageCalculationMode::Full));
+
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size(); ++chunk_offset) {
+      EXPECT_EQ(alp_segment->get_typed_value(chunk_offset), values[chunk_offset]);
+    }
+
+    auto chunk_offset = ChunkOffset{0};
+    segment_iterate<double>(*alp_segment, [&](const auto& position) {
+      EXPECT_FALSE(position.is_null());
+      EXPECT_EQ(position.value(), values[chunk_offset]);
+      ++chunk_offset;
+    });
+    EXPECT_EQ(chunk_offset, values.size());
+  }
+}
+
+TEST_F(StorageALPSegmentTest, CompressFloatSegmentWithExceptionsAndNulls) {
+  const auto values = pmr_vector<float>{1.5f,  0.25f, -0.0f, std::numeric_limits<float>::quiet_NaN(),
+                                        3.14159265f, 7.0f, -2.75f, std::numeric_limits<float>::infinity()};
+  const auto null_values = pmr_vector<bool>{false, false, false, false, false, true, false, false};
+  const auto value_segment =
+      std::make_shared<ValueSegment<float>>(pmr_vector<float>{values}, pmr_vector<bool>{null_values});
+
+  const auto alp_segment = _compress(value_segment, VectorCompressionType::FixedSizeByteAligned);
+  ASSERT_TRUE(alp_segment);
+  ASSERT_EQ(alp_segment->size(), values.size());
+  ASSERT_TRUE(alp_segment->null_values());
+  EXPECT_EQ(*alp_segment->null_values(), null_values);
+  EXPECT_GE(alp_segment->exception_values().size(), 3u);
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size(); ++chunk_offset) {
+    const auto value = alp_segment->get_typed_value(chunk_offset);
+    if (null_values[chunk_offset]) {
+      EXPECT_FALSE(value);
+      EXPECT_TRUE(variant_is_null((*alp_segment)[chunk_offset]));
+      continue;
+    }
+    ASSERT_TRUE(value);
+    _expect_bitwise_equal(*value, values[chunk_offset]);
+  }
+
+  auto chunk_offset = ChunkOffset{0};
+  segment_iterate<float>(*alp_segment, [&](const auto& position) {
+    EXPECT_EQ(position.is_null(), null_values[chunk_offset]);
+    if (!position.is_null()) _expect_bitwise_equal(position.value(), values[chunk_offset]);
+    ++chunk_offset;
+  });
+  EXPECT_EQ(chunk_offset, values.size());
+}
+
+TEST_F(StorageALPSegmentTest, ExceptionsInMultipleBlocks) {
+  auto values = pmr_vector<double>{};
+  for (auto index = 0u; index < ALPSegment<double>::block_size * 2 + 10; ++index) {
+    values.push_back(index % 100 == 0 ? std::sqrt(static_cast<double>(index + 2))
+                                      : static_cast<double>(index * 7 % 1000) / 100.0);
+  }
+  const auto value_segment = std::make_shared<ValueSegment<double>>(pmr_vector<double>{values});
+
+  const auto alp_segment = _compress(value_segment, VectorCompressionType::SimdBp128);
+  ASSERT_TRUE(alp_segment);
+  ASSERT_EQ(alp_segment->blocks().size(), 3u);
+  EXPECT_EQ(alp_segment->exception_values().size(), 21u);
+  EXPECT_EQ(alp_segment->blocks()[1].first_exception, 11u);
+
+  // Sequential iteration decodes the blocks as a whole and patches in their exceptions
+  auto chunk_offset = ChunkOffset{0};
+  segment_iterate<double>(*alp_segment, [&](const auto& position) {
+    EXPECT_EQ(position.value(), values[chunk_offset]);
+    ++chunk_offset;
+  });
+  EXPECT_EQ(chunk_offset, values.size());
+
+  auto position_filter = std::make_shared<RowIDPosList>();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < values.size(); chunk_offset += 50) {
+    position_filter->emplace_back(RowID{ChunkID{0}, chunk_offset});
+  }
+  position_filter->guarantee_single_chunk();
+
+  auto index = size_t{0};
+  segment_iterate_filtered<double>(*alp_segment, position_filter, [&](const auto& position) {
+    EXPECT_EQ(position.value(), values[(*position_filter)[index].chunk_offset]);
+    ++index;
+  });
+  EXPECT_EQ(index, position_filter->size());
+}
+
+TEST_F(StorageALPSegmentTest, CompressEmptySegment) {
+  const auto value_segment = std::make_shared<ValueSegment<double>>(true);
+  const auto alp_segment = _compress(value_segment, VectorCompressionType::FixedSizeByteAligned);
+  ASSERT_TRUE(alp_segment);
+  EXPECT_EQ(alp_segment->size(), 0u);
+  EXPECT_TRUE(alp_segment->blocks().empty());
+  EXPECT_FALSE(alp_segment->null_values());
+}
+
+}  // namespace opossum
@@ -1,6 +1,8 @@
 #include <cctype>
+#include <limits>
 #include <memory>
 #include <sstream>
+#include <vector>
 
 #include "base_test.hpp"
 #include "lib/storage/encoding_test.hpp"
@@ -672,4 +674,95 @@ TEST_F(EncodedSegmentTest, FrameOfReference) {
   EXPECT_FALSE(for_segment_no_nulls->null_values());
 }
 
+// The offsets of 64 bit values fit into 32 bits as long as the values of each block do not span more than 2^32, as is
+// the case for timestamps or sequential IDs.
+TEST_F(EncodedSegmentTest, FrameOfReferenceInt64) {
+  constexpr auto block_size = FrameOfReferenceSegment<int64_t>::block_size;
+  constexpr auto row_count = block_size + 10u;
+  constexpr auto first_timestamp = int64_t{1'600'000'000'000'000};
+  auto values = pmr_vector<int64_t>(row_count);
+  for (auto row_id = size_t{0}; row_id < row_count; ++row_id) {
+    // The values of the second block start far later than those of the first block
+    values[row_id] = first_timestamp + static_cast<int64_t>(row_id / block_size) * int64_t{1'000'000'000'000} +
+                     static_cast<int64_t>(row_id % block_size) * 1'000'000;
+  }
+
+  const auto value_segment = std::make_shared<ValueSegment<int64_t>>(pmr_vector<int64_t>{values});
+  const auto encoded_segment =
+      this->_encode_segment(value_segment, DataType::Long, SegmentEncodingSpec{EncodingType::FrameOfReference});
+
+  const auto for_segment = std::dynamic_pointer_cast<const FrameOfReferenceSegment<int64_t>>(encoded_segment);
+  ASSERT_TRUE(for_segment);
+  EXPECT_EQ(for_segment->block_minima(), (pmr_vector<int64_t>{first_timestamp, first_timestamp + 1'000'000'000'000}));
+
+  EXPECT_FALSE(for_segment->high_offset_values());
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+    EXPECT_EQ(for_segment->get_typed_value(chunk_offset), values[chunk_offset]);
+  }
+}
+
+// If the values of a block span more than 2^32, the upper 32 bits of the offsets are stored separately.
+TEST_F(EncodedSegmentTest, FrameOfReferenceInt64WideBlock) {
+  constexpr auto block_size = FrameOfReferenceSegment<int64_t>::block_size;
+  constexpr auto row_count = block_size + 10u;
+  constexpr auto first_timestamp = int64_t{1'600'000'000'000'000};
+  auto values = pmr_vector<int64_t>(row_count);
+  auto null_values = pmr_vector<bool>(row_count);
+  for (auto row_id = size_t{0}; row_id < row_count; ++row_id) {
+    values[row_id] = first_timestamp + static_cast<int64_t>(row_id);
+  }
+
+  // The first block spans more than 2^32, the values of the second block span the entire range of int64_t
+  values[1] = first_timestamp + int64_t{1'000'000'000'000};
+  null_values[2] = true;
+  values[block_size + 1] = std::numeric_limits<int64_t>::min();
+  values[block_size + 2] = std::numeric_limits<int64_t>::max();
+
+  const auto value_segment =
+      std::make_shared<ValueSegment<int64_t>>(pmr_vector<int64_t>{values}, pmr_vector<bool>{null_values});
+  const auto encoded_segment =
+      this->_encode_segment(value_segment, DataType::Long, SegmentEncodingSpec{EncodingType::FrameOfReference});
+
+  const auto for_segment = std::dynamic_pointer_cast<const FrameOfReferenceSegment<int64_t>>(encoded_segment);
+  ASSERT_TRUE(for_segment);
+  EXPECT_EQ(for_segment->block_minima(), (pmr_vector<int64_t>{first_timestamp, std::numeric_limits<int64_t>::min()}));
+  ASSERT_TRUE(for_segment->high_offset_values());
+  EXPECT_EQ(for_segment->high_offset_values()->size(), row_count);
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+    if (null_values[chunk_offset]) {
+      EXPECT_FALSE(for_segment->get_typed_value(chunk_offset));
+    } else {
+      EXPECT_EQ(for_segment->get_typed_value(chunk_offset), values[chunk_offset]);
+    }
+  }
+
+  // Sequential and point access via the iterable
+  const auto iterable = create_iterable_from_segment<int64_t>(*for_segment);
+  auto chunk_offset = ChunkOffset{0};
+  iterable.for_each([&](const auto& position) {
+    EXPECT_EQ(position.is_null(), null_values[chunk_offset]);
+    if (!position.is_null()) {
+      EXPECT_EQ(position.value(), values[chunk_offset]);
+    }
+    ++chunk_offset;
+  });
+  EXPECT_EQ(chunk_offset, row_count);
+
+  const auto position_filter = std::make_shared<RowIDPosList>();
+  position_filter->emplace_back(RowID{ChunkID{0}, ChunkOffset{block_size + 2}});
+  position_filter->emplace_back(RowID{ChunkID{0}, ChunkOffset{1}});
+  position_filter->guarantee_single_chunk();
+  auto filtered_values = std::vector<int64_t>{};
+  iterable.for_each(position_filter, [&](const auto& position) { filtered_values.emplace_back(position.value()); });
+  EXPECT_EQ(filtered_values, (std::vector<int64_t>{values[block_size + 2], values[1]}));
+
+  // Copying the segment keeps the high offsets
+  const auto copied_segment = std::dynamic_pointer_cast<const FrameOfReferenceSegment<int64_t>>(
+      for_segment->copy_using_allocator(PolymorphicAllocator<size_t>{}));
+  ASSERT_TRUE(copied_segment);
+  EXPECT_EQ(copied_segment->get_typed_value(ChunkOffset{block_size + 2}), std::numeric_limits<int64_t>::max());
+}
+
 }  // namespace opossum
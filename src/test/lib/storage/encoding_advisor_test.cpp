@@ -0,0 +1,139 @@
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "storage/chunk.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/encoding_advisor.hpp"
+#include "storage/segment_access_counter.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class EncodingAdvisorTest : public BaseTest {
+ protected:
+  static std::shared_ptr<ValueSegment<int32_t>> _create_sorted_segment() {
+    auto values = pmr_vector<int32_t>(_row_count);
+    for (auto index = size_t{0}; index < _row_count; ++index) {
+      values[index] = static_cast<int32_t>(index / 1'000);
+    }
+    return std::make_shared<ValueSegment<int32_t>>(std::move(values));
+  }
+
+  static std::shared_ptr<ValueSegment<int32_t>> _create_random_segment() {
+    auto generator = std::mt19937{42};
+    auto distribution = std::uniform_int_distribution<int32_t>{0, 99'999};
+
+    auto values = pmr_vector<int32_t>(_row_count);
+    for (auto& value : values) {
+      value = distribution(generator);
+    }
+    return std::make_shared<ValueSegment<int32_t>>(std::move(values));
+  }
+
+  static constexpr auto _row_count = size_t{10'000};
+};
+
+TEST_F(EncodingAdvisorTest, RecommendsRunLengthForRuns) {
+  const auto segment = _create_sorted_segment();
+  EXPECT_EQ(EncodingAdvisor::recommend_segment_encoding(segment, DataType::Int).encoding_type,
+            EncodingType::RunLength);
+}
+
+TEST_F(EncodingAdvisorTest, RecommendsFrameOfReferenceForRandomValues) {
+  const auto segment = _create_random_segment();
+  EXPECT_EQ(EncodingAdvisor::recommend_segment_encoding(segment, DataType::Int),
+            SegmentEncodingSpec(EncodingType::FrameOfReference, VectorCompressionType::SimdBp128));
+}
+
+TEST_F(EncodingAdvisorTest, SkipsFrameOfReferenceForWideRanges) {
+  // Random values whose range exceeds 32 bits, so that FrameOfReference would have to store 64 bit offsets
+  auto generator = std::mt19937{42};
+  auto distribution = std::uniform_int_distribution<int64_t>{0, int64_t{1} << 40};
+  auto values = pmr_vector<int64_t>(_row_count);
+  for (auto& value : values) {
+    value = distribution(generator);
+  }
+  const auto segment = std::make_shared<ValueSegment<int64_t>>(std::move(values));
+
+  const auto estimates = EncodingAdvisor::estimate_encodings(segment, DataType::Long);
+  ASSERT_FALSE(estimates.empty());
+  for (const auto& estimate : estimates) {
+    EXPECT_NE(estimate.encoding_spec.encoding_type, EncodingType::FrameOfReference);
+  }
+
+  // Values of a long column within a 32 bit range can be encoded using FrameOfReference
+  auto narrow_values = pmr_vector<int64_t>(_row_count);
+  for (auto& value : narrow_values) {
+    value = (int64_t{1} << 40) + distribution(generator) % 100'000;
+  }
+  const auto narrow_segment = std::make_shared<ValueSegment<int64_t>>(std::move(narrow_values));
+  EXPECT_EQ(EncodingAdvisor::recommend_segment_encoding(narrow_segment, DataType::Long).encoding_type,
+            EncodingType::FrameOfReference);
+}
+
+TEST_F(EncodingAdvisorTest, KeepsFrequentlyAccessedSegmentsUnencoded) {
+  const auto segment = _create_random_segment();
+  segment->access_counter[SegmentAccessCounter::AccessType::Sequential] = 1'000 * _row_count;
+  EXPECT_EQ(EncodingAdvisor::recommend_segment_encoding(segment, DataType::Int),
+            SegmentEncodingSpec(EncodingType::Unencoded));
+}
+
+TEST_F(EncodingAdvisorTest, ConsidersOnlyAccessesSincePreviousCounter) {
+  const auto segment = _create_random_segment();
+  segment->access_counter[SegmentAccessCounter::AccessType::Sequential] = 1'000 * _row_count;
+
+  // The segment has not been accessed since the snapshot was taken, so it is treated as cold
+  const auto previous_access_counter = segment->access_counter;
+  EXPECT_EQ(EncodingAdvisor::recommend_segment_encoding(segment, DataType::Int, previous_access_counter).encoding_type,
+            EncodingType::FrameOfReference);
+
+  segment->access_counter[SegmentAccessCounter::AccessType::Sequential] += 1'000 * _row_count;
+  EXPECT_EQ(EncodingAdvisor::recommend_segment_encoding(segment, DataType::Int, previous_access_counter),
+            SegmentEncodingSpec(EncodingType::Unencoded));
+}
+
+TEST_F(EncodingAdvisorTest, EstimatesAreOrderedByCost) {
+  const auto estimates = EncodingAdvisor::estimate_encodings(_create_random_segment(), DataType::Int);
+  ASSERT_FALSE(estimates.empty());
+  for (auto estimate_id = size_t{1}; estimate_id < estimates.size(); ++estimate_id) {
+    EXPECT_LE(estimates[estimate_id - 1].cost, estimates[estimate_id].cost);
+  }
+
+  // LZ4 is never considered
+  for (const auto& estimate : estimates) {
+    EXPECT_NE(estimate.encoding_spec.encoding_type, EncodingType::LZ4);
+  }
+}
+
+TEST_F(EncodingAdvisorTest, RecommendationIsStable) {
+  for (const auto& segment : {_create_sorted_segment(), _create_random_segment()}) {
+    const auto encoding_spec = EncodingAdvisor::recommend_segment_encoding(segment, DataType::Int);
+    const auto encoded_segment = ChunkEncoder::encode_segment(segment, DataType::Int, encoding_spec);
+    EXPECT_EQ(EncodingAdvisor::recommend_segment_encoding(encoded_segment, DataType::Int), encoding_spec);
+  }
+}
+
+TEST_F(EncodingAdvisorTest, SamplingDoesNotCountAsAccess) {
+  const auto segment = _create_random_segment();
+  EncodingAdvisor::estimate_encodings(segment, DataType::Int);
+  for (auto access_type = size_t{0}; access_type < static_cast<size_t>(SegmentAccessCounter::AccessType::Count);
+       ++access_type) {
+    EXPECT_EQ(segment->access_counter[static_cast<SegmentAccessCounter::AccessType>(access_type)], 0);
+  }
+}
+
+TEST_F(EncodingAdvisorTest, RecommendChunkEncoding) {
+  const auto chunk = std::make_shared<Chunk>(Segments{_create_sorted_segment(), _create_random_segment()});
+  const auto chunk_encoding_spec = EncodingAdvisor::recommend_chunk_encoding(chunk, {DataType::Int, DataType::Int});
+  ASSERT_EQ(chunk_encoding_spec.size(), 2);
+  EXPECT_EQ(chunk_encoding_spec[0].encoding_type, EncodingType::RunLength);
+  EXPECT_EQ(chunk_encoding_spec[1].encoding_type, EncodingType::FrameOfReference);
+
+  EXPECT_THROW(EncodingAdvisor::recommend_chunk_encoding(chunk, {DataType::Int}), std::logic_error);
+}
+
+}  // namespace opossum
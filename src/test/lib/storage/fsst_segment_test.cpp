@@ -0,0 +1,151 @@
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "storage/chunk_encoder.hpp"
+#include "storage/fsst_segment.hpp"
+#include "storage/fsst_segment/fsst_encoder.hpp"
+#include "storage/fsst_segment/fsst_symbol_table.hpp"
+#include "storage/value_segment.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class StorageFSSTSegmentTest : public BaseTest {
+ protected:
+  std::string_view _codes(const pmr_vector<char>& codes) { return std::string_view{codes.data(), codes.size()}; }
+
+  std::shared_ptr<FSSTSegment<pmr_string>> _compress(const std::shared_ptr<ValueSegment<pmr_string>>& segment) {
+    const auto encoded_segment =
+        ChunkEncoder::encode_segment(segment, DataType::String, SegmentEncodingSpec{EncodingType::FSST});
+    return std::dynamic_pointer_cast<FSSTSegment<pmr_string>>(encoded_segment);
+  }
+
+  std::shared_ptr<ValueSegment<pmr_string>> vs_str = std::make_shared<ValueSegment<pmr_string>>(true);
+
+  std::vector<std::string_view> _sample{"https://hyrise.org/",         "https://hyrise.org/docs",
+                                        "https://www.hpi.de/",         "https://www.hpi.de/research",
+                                        "http://hyrise.org/old_page/", "mailto:hyrise@hpi.de"};
+};
+
+TEST_F(StorageFSSTSegmentTest, EmptySymbolTableEscapesEveryByte) {
+  const auto symbol_table = FSSTSymbolTable{};
+  EXPECT_EQ(symbol_table.symbol_count(), 0u);
+
+  auto codes = pmr_vector<char>{};
+  symbol_table.compress("abc", codes);
+  ASSERT_EQ(codes.size(), 6u);
+  EXPECT_EQ(static_cast<uint8_t>(codes[0]), FSSTSymbolTable::ESCAPE_CODE);
+  EXPECT_EQ(codes[1], 'a');
+
+  auto value = pmr_string{};
+  symbol_table.decompress(_codes(codes), value);
+  EXPECT_EQ(value, "abc");
+}
+
+TEST_F(StorageFSSTSegmentTest, BuildCompressesFrequentSubstrings) {
+  const auto symbol_table = FSSTSymbolTable::build(_sample);
+  EXPECT_GT(symbol_table.symbol_count(), 0u);
+
+  auto compressed_size = size_t{0};
+  auto uncompressed_size = size_t{0};
+  for (const auto& sample_value : _sample) {
+    auto codes = pmr_vector<char>{};
+    symbol_table.compress(sample_value, codes);
+    compressed_size += codes.size();
+    uncompressed_size += sample_value.size();
+
+    auto value = pmr_string{};
+    symbol_table.decompress(_codes(codes), value);
+    EXPECT_EQ(value, sample_value);
+  }
+  EXPECT_LT(compressed_size, uncompressed_size / 2);
+
+  // Values that are not part of the sample are compressed as well, falling back to escapes for unknown bytes
+  for (const auto& other_value : {"https://hyrise.org/\xe2\x98\x83", "", "\xff\xff", "ZZZZ"}) {
+    auto codes = pmr_vector<char>{};
+    symbol_table.compress(other_value, codes);
+    auto value = pmr_string{};
+    symbol_table.decompress(_codes(codes), value);
+    EXPECT_EQ(value, other_value);
+  }
+}
+
+TEST_F(StorageFSSTSegmentTest, SymbolsRoundTrip) {
+  const auto symbol_table = FSSTSymbolTable::build(_sample);
+
+  auto symbols = std::vector<std::string_view>{};
+  for (auto code = size_t{0}; code < symbol_table.symbol_count(); ++code) {
+    symbols.emplace_back(symbol_table.symbol(static_cast<uint8_t>(code)));
+  }
+  const auto imported_symbol_table = FSSTSymbolTable{symbols};
+
+  for (const auto& sample_value : _sample) {
+    auto codes = pmr_vector<char>{};
+    auto imported_codes = pmr_vector<char>{};
+    symbol_table.compress(sample_value, codes);
+    imported_symbol_table.compress(sample_value, imported_codes);
+    EXPECT_EQ(codes, imported_codes);
+  }
+
+  // Symbols have to be sorted by their first byte and, for equal first bytes, by descending length
+  EXPECT_THROW(FSSTSymbolTable({"b", "a"}), std::logic_error);
+  EXPECT_THROW(FSSTSymbolTable({"a", "ab"}), std::logic_error);
+}
+
+TEST_F(StorageFSSTSegmentTest, CompressedEqualityAndPrefix) {
+  const auto symbol_table = FSSTSymbolTable::build(_sample);
+
+  const auto compress_value = [&](const std::string_view value) {
+    auto codes = pmr_vector<char>{};
+    symbol_table.compress(value, codes);
+    return codes;
+  };
+
+  EXPECT_EQ(compress_value("https://hyrise.org/docs"), compress_value("https://hyrise.org/docs"));
+  EXPECT_NE(compress_value("https://hyrise.org/docs"), compress_value("https://hyrise.org/doc"));
+
+  const auto codes = compress_value("https://hyrise.org/docs");
+  EXPECT_TRUE(symbol_table.decompressed_value_starts_with(_codes(codes), ""));
+  EXPECT_TRUE(symbol_table.decompressed_value_starts_with(_codes(codes), "h"));
+  EXPECT_TRUE(symbol_table.decompressed_value_starts_with(_codes(codes), "https://hyr"));
+  EXPECT_TRUE(symbol_table.decompressed_value_starts_with(_codes(codes), "https://hyrise.org/docs"));
+  EXPECT_FALSE(symbol_table.decompressed_value_starts_with(_codes(codes), "https://hyrise.org/docs/"));
+  EXPECT_FALSE(symbol_table.decompressed_value_starts_with(_codes(codes), "https://www"));
+  EXPECT_FALSE(symbol_table.decompressed_value_starts_with(_codes(codes), "x"));
+}
+
+TEST_F(StorageFSSTSegmentTest, CompressNullableStringSegment) {
+  vs_str->append("Alex");
+  vs_str->append("Peter");
+  vs_str->append(NULL_VALUE);
+  vs_str->append("");
+  vs_str->append("Alexander");
+
+  const auto fsst_segment = _compress(vs_str);
+  ASSERT_TRUE(fsst_segment);
+  ASSERT_EQ(fsst_segment->size(), 5u);
+
+  ASSERT_TRUE(fsst_segment->null_values());
+  EXPECT_EQ(*fsst_segment->null_values(), (pmr_vector<bool>{false, false, true, false, false}));
+
+  EXPECT_EQ(fsst_segment->get_typed_value(ChunkOffset{0}), "Alex");
+  EXPECT_EQ(fsst_segment->get_typed_value(ChunkOffset{1}), "Peter");
+  EXPECT_EQ(fsst_segment->get_typed_value(ChunkOffset{2}), std::nullopt);
+  EXPECT_EQ(fsst_segment->get_typed_value(ChunkOffset{3}), "");
+  EXPECT_EQ(fsst_segment->get_typed_value(ChunkOffset{4}), "Alexander");
+  EXPECT_TRUE(variant_is_null((*fsst_segment)[ChunkOffset{2}]));
+}
+
+TEST_F(StorageFSSTSegmentTest, CompressEmptySegment) {
+  const auto fsst_segment = _compress(vs_str);
+  ASSERT_TRUE(fsst_segment);
+  EXPECT_EQ(fsst_segment->size(), 0u);
+  EXPECT_FALSE(fsst_segment->null_values());
+  EXPECT_EQ(fsst_segment->symbol_table().symbol_count(), 0u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,96 @@
+#include "base_test.hpp"
+#include "storage/pos_lists/bitmap_pos_list.hpp"
+
+namespace opossum {
+
+class BitmapPosListTest : public BaseTest {
+ public:
+  void SetUp() override {
+    // The second word of the bitmap (rows 64 to 127) is empty
+    auto bitmap = BitmapPosList::Bitmap(BitmapPosList::word_count(200));
+    for (const auto chunk_offset : chunk_offsets) {
+      bitmap[chunk_offset / 64] |= uint64_t{1} << (chunk_offset % 64);
+    }
+
+    pos_list = std::make_shared<BitmapPosList>(ChunkID{4}, std::move(bitmap));
+  }
+
+  std::vector<ChunkOffset> chunk_offsets{1, 3, 63, 130, 199};
+  std::shared_ptr<BitmapPosList> pos_list;
+};
+
+TEST_F(BitmapPosListTest, WordCount) {
+  EXPECT_EQ(BitmapPosList::word_count(0), 0);
+  EXPECT_EQ(BitmapPosList::word_count(1), 1);
+  EXPECT_EQ(BitmapPosList::word_count(64), 1);
+  EXPECT_EQ(BitmapPosList::word_count(65), 2);
+}
+
+TEST_F(BitmapPosListTest, AccessPositions) {
+  ASSERT_EQ(pos_list->size(), chunk_offsets.size());
+  EXPECT_FALSE(pos_list->empty());
+  EXPECT_TRUE(pos_list->references_single_chunk());
+  EXPECT_EQ(pos_list->common_chunk_id(), ChunkID{4});
+
+  for (auto index = size_t{0}; index < chunk_offsets.size(); ++index) {
+    EXPECT_EQ((*pos_list)[index], (RowID{ChunkID{4}, chunk_offsets[index]}));
+  }
+
+  auto iterated_row_ids = std::vector<RowID>{pos_list->cbegin(), pos_list->cend()};
+  ASSERT_EQ(iterated_row_ids.size(), chunk_offsets.size());
+  for (auto index = size_t{0}; index < chunk_offsets.size(); ++index) {
+    EXPECT_EQ(iterated_row_ids[index].chunk_offset, chunk_offsets[index]);
+  }
+}
+
+TEST_F(BitmapPosListTest, Iterator) {
+  // Increments walk the bitmap, including the empty second word
+  auto iter = pos_list->cbegin();
+  for (const auto chunk_offset : chunk_offsets) {
+    ASSERT_NE(iter, pos_list->cend());
+    EXPECT_EQ(*iter, (RowID{ChunkID{4}, chunk_offset}));
+    ++iter;
+  }
+  EXPECT_EQ(iter, pos_list->cend());
+
+  // Other movements seek the position
+  --iter;
+  EXPECT_EQ(iter->chunk_offset, ChunkOffset{199});
+  iter -= 3;
+  EXPECT_EQ(iter->chunk_offset, ChunkOffset{3});
+  iter += 2;
+  EXPECT_EQ(iter->chunk_offset, ChunkOffset{130});
+  EXPECT_EQ((pos_list->cbegin() + 2)->chunk_offset, ChunkOffset{63});
+  EXPECT_EQ(iter - pos_list->cbegin(), 3);
+  EXPECT_EQ(pos_list->cend() - iter, 2);
+}
+
+TEST_F(BitmapPosListTest, ContainsAndRank) {
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 256; ++chunk_offset) {
+    const auto position = std::lower_bound(chunk_offsets.cbegin(), chunk_offsets.cend(), chunk_offset);
+    const auto contained = position != chunk_offsets.cend() && *position == chunk_offset;
+    EXPECT_EQ(pos_list->contains(chunk_offset), contained);
+    EXPECT_EQ(pos_list->rank(chunk_offset), static_cast<size_t>(std::distance(chunk_offsets.cbegin(), position)));
+  }
+}
+
+TEST_F(BitmapPosListTest, EmptyBitmap) {
+  const auto empty_pos_list = BitmapPosList{ChunkID{0}, BitmapPosList::Bitmap(3)};
+  EXPECT_TRUE(empty_pos_list.empty());
+  EXPECT_EQ(empty_pos_list.size(), 0);
+  EXPECT_EQ(empty_pos_list.cbegin(), empty_pos_list.cend());
+}
+
+TEST_F(BitmapPosListTest, IsPreferable) {
+  // A RowIDPosList for 65'535 rows takes 8 bytes per match, the bitmap takes 12 bytes per 64 rows.
+  EXPECT_FALSE(BitmapPosList::is_preferable(1'000, 65'535));
+  EXPECT_TRUE(BitmapPosList::is_preferable(10'000, 65'535));
+  EXPECT_TRUE(BitmapPosList::is_preferable(65'535, 65'535));
+}
+
+TEST_F(BitmapPosListTest, MemoryUsage) {
+  EXPECT_GE(pos_list->memory_usage(MemoryUsageCalculationMode::Full), 4 * sizeof(uint64_t) + 4 * sizeof(uint32_t));
+  EXPECT_LT(pos_list->memory_usage(MemoryUsageCalculationMode::Full), 200 * sizeof(RowID));
+}
+
+}  // namespace opossum
@@ -8,6 +8,7 @@
 #include "hyrise.hpp"
 #include "operators/get_table.hpp"
 #include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
 #include "operators/validate.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "tasks/chunk_compression_task.hpp"
@@ -115,4 +116,42 @@ TEST_F(ChunkCompressionTaskTest, CompressionWithAbortedInsert) {
   EXPECT_EQ(validate->get_output()->row_count(), 12u);
 }
 
+TEST_F(ChunkCompressionTaskTest, ChunkIsCompletedOnceInsertsFinished) {
+  const auto input_table = load_table("resources/test_data/tbl/compression_input.tbl", 3u);
+  const auto table = std::make_shared<Table>(input_table->column_definitions(), TableType::Data, 8u, UseMvcc::Yes);
+  Hyrise::get().storage_manager.add_table("table_insert", table);
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(input_table);
+  table_wrapper->execute();
+
+  const auto insert = [&]() {
+    const auto insert = std::make_shared<Insert>("table_insert", table_wrapper);
+    const auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    insert->set_transaction_context(context);
+    insert->execute();
+    return context;
+  };
+
+  // Each Insert adds 12 rows. Thus, the first one writes to the chunks 0 and 1, the second one to the chunks 1 and 2.
+  const auto committing_context = insert();
+  const auto rolled_back_context = insert();
+  ASSERT_EQ(table->chunk_count(), 3u);
+  EXPECT_EQ(table->get_chunk(ChunkID{1})->mvcc_data()->pending_inserts(), 2u);
+
+  // A full chunk is not completed as long as an Insert into it has neither committed nor rolled back
+  for (auto chunk_id = ChunkID{0}; chunk_id < 3; ++chunk_id) {
+    EXPECT_FALSE(ChunkCompressionTask::chunk_is_completed(table->get_chunk(chunk_id), 8u));
+  }
+
+  committing_context->commit();
+  EXPECT_TRUE(ChunkCompressionTask::chunk_is_completed(table->get_chunk(ChunkID{0}), 8u));
+  EXPECT_FALSE(ChunkCompressionTask::chunk_is_completed(table->get_chunk(ChunkID{1}), 8u));
+  EXPECT_FALSE(ChunkCompressionTask::chunk_is_completed(table->get_chunk(ChunkID{2}), 8u));
+
+  rolled_back_context->rollback(RollbackReason::User);
+  for (auto chunk_id = ChunkID{0}; chunk_id < 3; ++chunk_id) {
+    EXPECT_TRUE(ChunkCompressionTask::chunk_is_completed(table->get_chunk(chunk_id), 8u));
+  }
+}
+
 }  // namespace opossum
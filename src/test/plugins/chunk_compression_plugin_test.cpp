@@ -0,0 +1,144 @@
+#include <memory>
+
+#include "base_test.hpp"
+#include "lib/utils/plugin_test_utils.hpp"
+
+#include "../../plugins/chunk_compression_plugin.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/plugin_manager.hpp"
+
+namespace opossum {
+
+class ChunkCompressionPluginTest : public BaseTest {
+ public:
+  void SetUp() override {
+    _input_table = load_table("resources/test_data/tbl/compression_input.tbl");
+    _input_table_wrapper = std::make_shared<TableWrapper>(_input_table);
+    _input_table_wrapper->execute();
+  }
+
+  void TearDown() override { Hyrise::reset(); }
+
+ protected:
+  static void _compression_loop(ChunkCompressionPlugin& plugin) { plugin._compression_loop(); }
+
+  std::shared_ptr<TransactionContext> _insert_into(const std::string& table_name) {
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    const auto insert = std::make_shared<Insert>(table_name, _input_table_wrapper);
+    insert->set_transaction_context(transaction_context);
+    insert->execute();
+    return transaction_context;
+  }
+
+  static EncodingType _encoding_type(const std::shared_ptr<const Table>& table, const ChunkID chunk_id) {
+    return get_segment_encoding_spec(table->get_chunk(chunk_id)->get_segment(ColumnID{0})).encoding_type;
+  }
+
+  std::shared_ptr<Table> _input_table;
+  std::shared_ptr<TableWrapper> _input_table_wrapper;
+  static constexpr auto _chunk_size = ChunkOffset{5};
+};
+
+TEST_F(ChunkCompressionPluginTest, LoadUnloadPlugin) {
+  auto& pm = Hyrise::get().plugin_manager;
+  pm.load_plugin(build_dylib_path("libhyriseChunkCompressionPlugin"));
+  pm.unload_plugin("hyriseChunkCompressionPlugin");
+}
+
+TEST_F(ChunkCompressionPluginTest, CompressesFullChunks) {
+  const auto table = std::make_shared<Table>(_input_table->column_definitions(), TableType::Data, _chunk_size,
+                                             UseMvcc::Yes);
+  Hyrise::get().storage_manager.add_table("table_a", table);
+
+  auto plugin = ChunkCompressionPlugin{};
+
+  // Chunks are only compressed once all inserts into them have been committed
+  const auto transaction_context = _insert_into("table_a");
+  ASSERT_EQ(table->chunk_count(), 3);
+  _compression_loop(plugin);
+  EXPECT_TRUE(table->get_chunk(ChunkID{0})->is_mutable());
+  EXPECT_EQ(_encoding_type(table, ChunkID{0}), EncodingType::Unencoded);
+
+  transaction_context->commit();
+  _compression_loop(plugin);
+
+  // Without previously encoded chunks, the default encoding is used
+  for (auto chunk_id = ChunkID{0}; chunk_id < 2; ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    EXPECT_FALSE(chunk->is_mutable());
+    EXPECT_TRUE(chunk->pruning_statistics());
+    EXPECT_EQ(_encoding_type(table, chunk_id), SegmentEncodingSpec{}.encoding_type);
+  }
+
+  // The last chunk is not full yet
+  EXPECT_TRUE(table->get_chunk(ChunkID{2})->is_mutable());
+  EXPECT_EQ(_encoding_type(table, ChunkID{2}), EncodingType::Unencoded);
+
+  EXPECT_TABLE_EQ_ORDERED(table, _input_table);
+}
+
+TEST_F(ChunkCompressionPluginTest, UsesEncodingOfPreviousChunks) {
+  const auto table = load_table("resources/test_data/tbl/compression_input.tbl", _chunk_size);
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::RunLength});
+  Hyrise::get().storage_manager.add_table("table_a", table);
+
+  _insert_into("table_a")->commit();
+  ASSERT_EQ(table->chunk_count(), 6);
+
+  auto plugin = ChunkCompressionPlugin{};
+  _compression_loop(plugin);
+
+  EXPECT_EQ(_encoding_type(table, ChunkID{3}), EncodingType::RunLength);
+  EXPECT_EQ(_encoding_type(table, ChunkID{4}), EncodingType::RunLength);
+  EXPECT_EQ(_encoding_type(table, ChunkID{5}), EncodingType::Unencoded);
+}
+
+TEST_F(ChunkCompressionPluginTest, KeepsFrameOfReferenceEncodingForWideValueRanges) {
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Long, false}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, _chunk_size, UseMvcc::Yes);
+  table->append_chunk({std::make_shared<ValueSegment<int64_t>>(pmr_vector<int64_t>{1, 2, 3, 4, 5})},
+                      std::make_shared<MvccData>(_chunk_size, CommitID{0}));
+  table->last_chunk()->finalize();
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::FrameOfReference});
+  Hyrise::get().storage_manager.add_table("table_a", table);
+
+  // The first inserted chunk spans a narrow range of values, the second one a range wider than 32 bits
+  const auto input_table = std::make_shared<Table>(column_definitions, TableType::Data);
+  for (const auto value : {int64_t{6}, int64_t{7}, int64_t{8}, int64_t{9}, int64_t{10}}) {
+    input_table->append({value});
+  }
+  for (const auto value : {int64_t{0}, int64_t{1} << 40, int64_t{2} << 40, int64_t{3} << 40, int64_t{4} << 40}) {
+    input_table->append({value});
+  }
+  const auto input_table_wrapper = std::make_shared<TableWrapper>(input_table);
+  input_table_wrapper->execute();
+
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto insert = std::make_shared<Insert>("table_a", input_table_wrapper);
+  insert->set_transaction_context(transaction_context);
+  insert->execute();
+  transaction_context->commit();
+  ASSERT_EQ(table->chunk_count(), 3);
+
+  auto plugin = ChunkCompressionPlugin{};
+  _compression_loop(plugin);
+
+  // FrameOfReference splits the offsets of blocks whose values span more than 32 bits, so the encoding of the
+  // previous chunk is kept for both chunks
+  EXPECT_EQ(_encoding_type(table, ChunkID{1}), EncodingType::FrameOfReference);
+  EXPECT_FALSE(table->get_chunk(ChunkID{2})->is_mutable());
+  EXPECT_EQ(_encoding_type(table, ChunkID{2}), EncodingType::FrameOfReference);
+
+  const auto& segment = *table->get_chunk(ChunkID{2})->get_segment(ColumnID{0});
+  EXPECT_EQ(segment[ChunkOffset{0}], AllTypeVariant{int64_t{0}});
+  EXPECT_EQ(segment[ChunkOffset{4}], AllTypeVariant{int64_t{4} << 40});
+}
+
+}  // namespace opossum
@@ -0,0 +1,105 @@
+#include <memory>
+
+#include "base_test.hpp"
+#include "lib/utils/plugin_test_utils.hpp"
+
+#include "../../plugins/encoding_advisor_plugin.hpp"
+#include "storage/segment_access_counter.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/plugin_manager.hpp"
+
+namespace opossum {
+
+class EncodingAdvisorPluginTest : public BaseTest {
+ public:
+  void SetUp() override {
+    const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}};
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, _chunk_size, UseMvcc::Yes);
+
+    // The first two chunks are full and thus finalized, the third one is still mutable
+    for (auto row_id = int32_t{0}; row_id < 2'500; ++row_id) {
+      _table->append({row_id / 100});
+    }
+    Hyrise::get().storage_manager.add_table("table_a", _table);
+  }
+
+  void TearDown() override { Hyrise::reset(); }
+
+ protected:
+  static void _reencoding_loop(EncodingAdvisorPlugin& plugin) { plugin._reencoding_loop(); }
+
+  std::shared_ptr<Table> _table;
+  static constexpr auto _chunk_size = ChunkOffset{1'000};
+};
+
+TEST_F(EncodingAdvisorPluginTest, LoadUnloadPlugin) {
+  auto& pm = Hyrise::get().plugin_manager;
+  pm.load_plugin(build_dylib_path("libhyriseEncodingAdvisorPlugin"));
+  pm.unload_plugin("hyriseEncodingAdvisorPlugin");
+}
+
+TEST_F(EncodingAdvisorPluginTest, ReencodesImmutableChunks) {
+  ASSERT_EQ(_table->chunk_count(), 3);
+
+  auto plugin = EncodingAdvisorPlugin{};
+  _reencoding_loop(plugin);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < 2; ++chunk_id) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    EXPECT_EQ(get_segment_encoding_spec(chunk->get_segment(ColumnID{0})).encoding_type, EncodingType::RunLength);
+    EXPECT_TRUE(chunk->pruning_statistics());
+  }
+
+  const auto mutable_chunk = _table->get_chunk(ChunkID{2});
+  EXPECT_EQ(get_segment_encoding_spec(mutable_chunk->get_segment(ColumnID{0})).encoding_type, EncodingType::Unencoded);
+  EXPECT_FALSE(mutable_chunk->pruning_statistics());
+
+  // The recommendation does not change without further accesses, so a second pass keeps the segments
+  const auto segment = _table->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  _reencoding_loop(plugin);
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}), segment);
+}
+
+TEST_F(EncodingAdvisorPluginTest, ReencodesSegmentsThatBecameCold) {
+  // The segment is accessed heavily before the first pass and thus kept unencoded
+  const auto segment = _table->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  segment->access_counter[SegmentAccessCounter::AccessType::Random] = 1'000 * _chunk_size;
+
+  auto plugin = EncodingAdvisorPlugin{};
+  _reencoding_loop(plugin);
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}), segment);
+  EXPECT_EQ(get_segment_encoding_spec(_table->get_chunk(ChunkID{1})->get_segment(ColumnID{0})).encoding_type,
+            EncodingType::RunLength);
+
+  // Without further accesses, the next pass moves it to the densest encoding. The past accesses are not considered.
+  _reencoding_loop(plugin);
+  const auto encoded_segment = _table->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  EXPECT_EQ(get_segment_encoding_spec(encoded_segment).encoding_type, EncodingType::RunLength);
+  EXPECT_EQ(encoded_segment->access_counter[SegmentAccessCounter::AccessType::Random], 0);
+}
+
+TEST_F(EncodingAdvisorPluginTest, ReencodesLongColumnWithWideRange) {
+  // Few distinct values that span more than 2^32 within each chunk
+  auto long_table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Long, false}}, TableType::Data,
+                                            _chunk_size, UseMvcc::Yes);
+  for (auto row_id = int64_t{0}; row_id < 2'500; ++row_id) {
+    long_table->append({(row_id % 10) * (int64_t{1} << 40)});
+  }
+  Hyrise::get().storage_manager.add_table("table_b", long_table);
+
+  auto plugin = EncodingAdvisorPlugin{};
+  _reencoding_loop(plugin);
+
+  // The chunks of both tables are re-encoded
+  EXPECT_EQ(get_segment_encoding_spec(_table->get_chunk(ChunkID{0})->get_segment(ColumnID{0})).encoding_type,
+            EncodingType::RunLength);
+  for (auto chunk_id = ChunkID{0}; chunk_id < 2; ++chunk_id) {
+    const auto chunk = long_table->get_chunk(chunk_id);
+    EXPECT_EQ(get_segment_encoding_spec(chunk->get_segment(ColumnID{0})).encoding_type, EncodingType::Dictionary);
+    EXPECT_TRUE(chunk->pruning_statistics());
+  }
+}
+
+}  // namespace opossum